@@ -25,6 +25,11 @@ macro(setup_default_compiler_flags _project_name)
 			add_definitions(-DRTM_NO_INTRINSICS)
 		endif()
 
+		if(USE_DETERMINISTIC_MATH)
+			add_definitions(-DRTM_DETERMINISTIC)
+			target_compile_options(${_project_name} PRIVATE /fp:precise)	# Do not contract multiplications and additions
+		endif()
+
 		# Add linker flags
 		set(CMAKE_EXE_LINKER_FLAGS "${CMAKE_EXE_LINKER_FLAGS} /DEBUG")
 	else()
@@ -50,11 +55,19 @@ macro(setup_default_compiler_flags _project_name)
 				else()
 					target_compile_options(${_project_name} PRIVATE "-msse4.1")
 				endif()
-			else()
-				add_definitions(-DRTM_NO_INTRINSICS)
 			endif()
 		endif()
 
+		if(NOT USE_SIMD_INSTRUCTIONS)
+			# Force the scalar code paths on every architecture, not just x86 and x64
+			add_definitions(-DRTM_NO_INTRINSICS)
+		endif()
+
+		if(USE_DETERMINISTIC_MATH)
+			add_definitions(-DRTM_DETERMINISTIC)
+			target_compile_options(${_project_name} PRIVATE -ffp-contract=off)	# Do not contract multiplications and additions into FMA
+		endif()
+
 		target_compile_options(${_project_name} PRIVATE -Wall -Wextra)		# Enable all warnings
 		target_compile_options(${_project_name} PRIVATE -Wshadow)			# Enable shadowing warnings
 		target_compile_options(${_project_name} PRIVATE -Werror)			# Treat warnings as errors
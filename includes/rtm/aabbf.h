@@ -0,0 +1,398 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/macros.h"
+#include "rtm/mask4f.h"
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/planef.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/cpu_dispatch.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Planes used to test bounding volumes are stored in a vector4f as [normal.xyz, distance].
+	// The signed distance of a point from the plane is: dot(normal, point) + distance
+	// A bounding volume is considered inside when it is on the positive side of every plane.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its center and half extent.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_set(vector4f_arg0 center, vector4f_arg1 extent) RTM_NO_EXCEPT
+	{
+		return aabbf{ center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its minimum and maximum corners.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_from_min_max(vector4f_arg0 min, vector4f_arg1 max) RTM_NO_EXCEPT
+	{
+		const vector4f center = vector_mul(vector_add(min, max), 0.5F);
+		const vector4f extent = vector_mul(vector_sub(max, min), 0.5F);
+		return aabbf{ center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the minimum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_min(aabbf_arg0 aabb) RTM_NO_EXCEPT
+	{
+		return vector_sub(aabb.center, aabb.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the maximum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_max(aabbf_arg0 aabb) RTM_NO_EXCEPT
+	{
+		return vector_add(aabb.center, aabb.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains both inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_merge(aabbf_arg0 lhs, aabbf_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector4f min = vector_min(aabb_get_min(lhs), aabb_get_min(rhs));
+		const vector4f max = vector_max(aabb_get_max(lhs), aabb_get_max(rhs));
+		return aabb_from_min_max(min, max);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains every point.
+	// At least one point must be provided.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf aabb_from_points(const float3f* points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_points != 0, "At least one point is required");
+
+		// We use two sets of accumulators to break the dependency chain
+		vector4f min0 = vector_load3(points);
+		vector4f max0 = min0;
+		vector4f min1 = min0;
+		vector4f max1 = min0;
+
+		uint32_t point_index = 1;
+		for (; point_index + 2 <= num_points; point_index += 2)
+		{
+			const vector4f point0 = vector_load3(points + point_index + 0);
+			const vector4f point1 = vector_load3(points + point_index + 1);
+
+			min0 = vector_min(min0, point0);
+			max0 = vector_max(max0, point0);
+			min1 = vector_min(min1, point1);
+			max1 = vector_max(max1, point1);
+		}
+
+		if (point_index < num_points)
+		{
+			const vector4f point = vector_load3(points + point_index);
+			min0 = vector_min(min0, point);
+			max0 = vector_max(max0, point);
+		}
+
+		return aabb_from_min_max(vector_min(min0, min1), vector_max(max0, max1));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the point is inside or on the surface of the axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_contains_point(aabbf_arg0 aabb, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal3(vector_abs(vector_sub(point, aabb.center)), aabb.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if both axis aligned bounding boxes overlap or touch.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_intersects(aabbf_arg0 lhs, aabbf_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal3(vector_abs(vector_sub(lhs.center, rhs.center)), vector_add(lhs.extent, rhs.extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box by an affine matrix and returns
+	// the smallest axis aligned bounding box that contains the result.
+	// Rather than transforming all 8 corners, the center is transformed as a point
+	// and the new extent is obtained from the absolute value of the matrix axes.
+	// See: James Arvo, "Transforming Axis-Aligned Bounding Boxes", Graphics Gems, 1990
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_transform(aabbf_arg0 aabb, matrix3x4f_arg1 transform) RTM_NO_EXCEPT
+	{
+		const vector4f center = matrix_mul_point3(aabb.center, transform);
+
+		vector4f extent = vector_mul(vector_dup_x(aabb.extent), vector_abs(transform.x_axis));
+		extent = vector_mul_add(vector_dup_y(aabb.extent), vector_abs(transform.y_axis), extent);
+		extent = vector_mul_add(vector_dup_z(aabb.extent), vector_abs(transform.z_axis), extent);
+
+		return aabbf{ center, extent };
+	}
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA kernel for aabb_transform(..), 8 boxes are transformed per iteration
+		// as two groups of 4 in the 128 bit halves of each register.
+		// The number of boxes must be a multiple of 8.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline void aabb_transform_avx2_fma(matrix3x4f_arg0 transform, const aabbf* input_aabbs, aabbf* output_aabbs, uint32_t num_aabbs) RTM_NO_EXCEPT
+		{
+			const __m256 x_axis = combine_x2_avx2_fma(transform.x_axis, transform.x_axis);
+			const __m256 y_axis = combine_x2_avx2_fma(transform.y_axis, transform.y_axis);
+			const __m256 z_axis = combine_x2_avx2_fma(transform.z_axis, transform.z_axis);
+			const __m256 w_axis = combine_x2_avx2_fma(transform.w_axis, transform.w_axis);
+			const __m256 x_axis_x = _mm256_permute_ps(x_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 x_axis_y = _mm256_permute_ps(x_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 x_axis_z = _mm256_permute_ps(x_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 y_axis_x = _mm256_permute_ps(y_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 y_axis_y = _mm256_permute_ps(y_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 y_axis_z = _mm256_permute_ps(y_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 z_axis_x = _mm256_permute_ps(z_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 z_axis_y = _mm256_permute_ps(z_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 z_axis_z = _mm256_permute_ps(z_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 w_axis_x = _mm256_permute_ps(w_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 w_axis_y = _mm256_permute_ps(w_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 w_axis_z = _mm256_permute_ps(w_axis, _MM_SHUFFLE(2, 2, 2, 2));
+
+			const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+			const __m256 abs_x_axis_x = _mm256_and_ps(x_axis_x, abs_mask);
+			const __m256 abs_x_axis_y = _mm256_and_ps(x_axis_y, abs_mask);
+			const __m256 abs_x_axis_z = _mm256_and_ps(x_axis_z, abs_mask);
+			const __m256 abs_y_axis_x = _mm256_and_ps(y_axis_x, abs_mask);
+			const __m256 abs_y_axis_y = _mm256_and_ps(y_axis_y, abs_mask);
+			const __m256 abs_y_axis_z = _mm256_and_ps(y_axis_z, abs_mask);
+			const __m256 abs_z_axis_x = _mm256_and_ps(z_axis_x, abs_mask);
+			const __m256 abs_z_axis_y = _mm256_and_ps(z_axis_y, abs_mask);
+			const __m256 abs_z_axis_z = _mm256_and_ps(z_axis_z, abs_mask);
+
+			for (uint32_t aabb_index = 0; aabb_index < num_aabbs; aabb_index += 8)
+			{
+				const aabbf* inputs = input_aabbs + aabb_index;
+
+				__m256 center_xxxx = combine_x2_avx2_fma(inputs[0].center, inputs[4].center);
+				__m256 center_yyyy = combine_x2_avx2_fma(inputs[1].center, inputs[5].center);
+				__m256 center_zzzz = combine_x2_avx2_fma(inputs[2].center, inputs[6].center);
+				__m256 center_wwww = combine_x2_avx2_fma(inputs[3].center, inputs[7].center);
+				transpose_4x4_x2_avx2_fma(center_xxxx, center_yyyy, center_zzzz, center_wwww);
+
+				__m256 extent_xxxx = combine_x2_avx2_fma(inputs[0].extent, inputs[4].extent);
+				__m256 extent_yyyy = combine_x2_avx2_fma(inputs[1].extent, inputs[5].extent);
+				__m256 extent_zzzz = combine_x2_avx2_fma(inputs[2].extent, inputs[6].extent);
+				__m256 extent_wwww = combine_x2_avx2_fma(inputs[3].extent, inputs[7].extent);
+				transpose_4x4_x2_avx2_fma(extent_xxxx, extent_yyyy, extent_zzzz, extent_wwww);
+
+				__m256 new_center_xxxx = _mm256_fmadd_ps(center_zzzz, z_axis_x, _mm256_fmadd_ps(center_yyyy, y_axis_x, _mm256_fmadd_ps(center_xxxx, x_axis_x, w_axis_x)));
+				__m256 new_center_yyyy = _mm256_fmadd_ps(center_zzzz, z_axis_y, _mm256_fmadd_ps(center_yyyy, y_axis_y, _mm256_fmadd_ps(center_xxxx, x_axis_y, w_axis_y)));
+				__m256 new_center_zzzz = _mm256_fmadd_ps(center_zzzz, z_axis_z, _mm256_fmadd_ps(center_yyyy, y_axis_z, _mm256_fmadd_ps(center_xxxx, x_axis_z, w_axis_z)));
+				__m256 new_center_wwww = new_center_zzzz;
+
+				// Back to one box per row, the [w] component is undefined like RTM_MATRIXF_TRANSPOSE_3X4
+				transpose_4x4_x2_avx2_fma(new_center_xxxx, new_center_yyyy, new_center_zzzz, new_center_wwww);
+
+				__m256 new_extent_xxxx = _mm256_fmadd_ps(extent_zzzz, abs_z_axis_x, _mm256_fmadd_ps(extent_yyyy, abs_y_axis_x, _mm256_mul_ps(extent_xxxx, abs_x_axis_x)));
+				__m256 new_extent_yyyy = _mm256_fmadd_ps(extent_zzzz, abs_z_axis_y, _mm256_fmadd_ps(extent_yyyy, abs_y_axis_y, _mm256_mul_ps(extent_xxxx, abs_x_axis_y)));
+				__m256 new_extent_zzzz = _mm256_fmadd_ps(extent_zzzz, abs_z_axis_z, _mm256_fmadd_ps(extent_yyyy, abs_y_axis_z, _mm256_mul_ps(extent_xxxx, abs_x_axis_z)));
+				__m256 new_extent_wwww = new_extent_zzzz;
+				transpose_4x4_x2_avx2_fma(new_extent_xxxx, new_extent_yyyy, new_extent_zzzz, new_extent_wwww);
+
+				// The inputs are fully read before writing since the output can alias the input
+				aabbf* outputs = output_aabbs + aabb_index;
+				outputs[0].center = _mm256_castps256_ps128(new_center_xxxx);
+				outputs[1].center = _mm256_castps256_ps128(new_center_yyyy);
+				outputs[2].center = _mm256_castps256_ps128(new_center_zzzz);
+				outputs[3].center = _mm256_castps256_ps128(new_center_wwww);
+				outputs[4].center = _mm256_extractf128_ps(new_center_xxxx, 1);
+				outputs[5].center = _mm256_extractf128_ps(new_center_yyyy, 1);
+				outputs[6].center = _mm256_extractf128_ps(new_center_zzzz, 1);
+				outputs[7].center = _mm256_extractf128_ps(new_center_wwww, 1);
+				outputs[0].extent = _mm256_castps256_ps128(new_extent_xxxx);
+				outputs[1].extent = _mm256_castps256_ps128(new_extent_yyyy);
+				outputs[2].extent = _mm256_castps256_ps128(new_extent_zzzz);
+				outputs[3].extent = _mm256_castps256_ps128(new_extent_wwww);
+				outputs[4].extent = _mm256_extractf128_ps(new_extent_xxxx, 1);
+				outputs[5].extent = _mm256_extractf128_ps(new_extent_yyyy, 1);
+				outputs[6].extent = _mm256_extractf128_ps(new_extent_zzzz, 1);
+				outputs[7].extent = _mm256_extractf128_ps(new_extent_wwww, 1);
+			}
+
+			// Avoid the AVX to SSE transition penalty in the caller
+			_mm256_zeroupper();
+		}
+	}
+#endif
+
+	RTM_IMPL_DISPATCH_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a number of axis aligned bounding boxes by an affine matrix.
+	// See aabb_transform(..) above for details.
+	// Boxes are processed 4 at a time in SoA form: each matrix component is
+	// broadcast once and every multiplication operates on 4 boxes.
+	// With RTM_RUNTIME_DISPATCH, 8 boxes are processed at a time when AVX2 and FMA are supported.
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_transform(matrix3x4f_arg0 transform, const aabbf* input_aabbs, aabbf* output_aabbs, uint32_t num_aabbs) RTM_NO_EXCEPT
+	{
+		const vector4f x_axis_x = vector_dup_x(transform.x_axis);
+		const vector4f x_axis_y = vector_dup_y(transform.x_axis);
+		const vector4f x_axis_z = vector_dup_z(transform.x_axis);
+		const vector4f y_axis_x = vector_dup_x(transform.y_axis);
+		const vector4f y_axis_y = vector_dup_y(transform.y_axis);
+		const vector4f y_axis_z = vector_dup_z(transform.y_axis);
+		const vector4f z_axis_x = vector_dup_x(transform.z_axis);
+		const vector4f z_axis_y = vector_dup_y(transform.z_axis);
+		const vector4f z_axis_z = vector_dup_z(transform.z_axis);
+		const vector4f w_axis_x = vector_dup_x(transform.w_axis);
+		const vector4f w_axis_y = vector_dup_y(transform.w_axis);
+		const vector4f w_axis_z = vector_dup_z(transform.w_axis);
+
+		uint32_t aabb_index = 0;
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		if (rtm_impl::is_avx2_fma_supported())
+		{
+			// Boxes are processed 8 at a time, the remaining ones fall through to the loops below
+			aabb_index = num_aabbs & ~7U;
+			rtm_impl::aabb_transform_avx2_fma(transform, input_aabbs, output_aabbs, aabb_index);
+		}
+#endif
+
+		for (; aabb_index + 4 <= num_aabbs; aabb_index += 4)
+		{
+			const aabbf* inputs = input_aabbs + aabb_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].center, inputs[1].center, inputs[2].center, inputs[3].center, center_xxxx, center_yyyy, center_zzzz);
+
+			vector4f extent_xxxx;
+			vector4f extent_yyyy;
+			vector4f extent_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].extent, inputs[1].extent, inputs[2].extent, inputs[3].extent, extent_xxxx, extent_yyyy, extent_zzzz);
+
+			const vector4f new_center_xxxx = vector_mul_add(center_zzzz, z_axis_x, vector_mul_add(center_yyyy, y_axis_x, vector_mul_add(center_xxxx, x_axis_x, w_axis_x)));
+			const vector4f new_center_yyyy = vector_mul_add(center_zzzz, z_axis_y, vector_mul_add(center_yyyy, y_axis_y, vector_mul_add(center_xxxx, x_axis_y, w_axis_y)));
+			const vector4f new_center_zzzz = vector_mul_add(center_zzzz, z_axis_z, vector_mul_add(center_yyyy, y_axis_z, vector_mul_add(center_xxxx, x_axis_z, w_axis_z)));
+
+			const vector4f new_extent_xxxx = vector_mul_add(extent_zzzz, vector_abs(z_axis_x), vector_mul_add(extent_yyyy, vector_abs(y_axis_x), vector_mul(extent_xxxx, vector_abs(x_axis_x))));
+			const vector4f new_extent_yyyy = vector_mul_add(extent_zzzz, vector_abs(z_axis_y), vector_mul_add(extent_yyyy, vector_abs(y_axis_y), vector_mul(extent_xxxx, vector_abs(x_axis_y))));
+			const vector4f new_extent_zzzz = vector_mul_add(extent_zzzz, vector_abs(z_axis_z), vector_mul_add(extent_yyyy, vector_abs(y_axis_z), vector_mul(extent_xxxx, vector_abs(x_axis_z))));
+
+			aabbf* outputs = output_aabbs + aabb_index;
+			RTM_MATRIXF_TRANSPOSE_3X4(new_center_xxxx, new_center_yyyy, new_center_zzzz, outputs[0].center, outputs[1].center, outputs[2].center, outputs[3].center);
+			RTM_MATRIXF_TRANSPOSE_3X4(new_extent_xxxx, new_extent_yyyy, new_extent_zzzz, outputs[0].extent, outputs[1].extent, outputs[2].extent, outputs[3].extent);
+		}
+
+		for (; aabb_index < num_aabbs; ++aabb_index)
+			output_aabbs[aabb_index] = aabb_transform(input_aabbs[aabb_index], transform);
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_END
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the axis aligned bounding box is inside or intersects the volume
+	// delimited by the provided planes. It is only rejected when it lies entirely on the
+	// negative side of at least one plane. This is conservative and suitable for culling.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_intersects_planes(aabbf_arg0 aabb, const vector4f* planes, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+		{
+			const vector4f plane = planes[plane_index];
+			const float distance = plane_distance_point(planef{ plane }, aabb.center);
+			const float radius = vector_dot3(vector_abs(plane), aabb.extent);
+			if (distance + radius < 0.0F)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests a number of axis aligned bounding boxes against the volume delimited by the
+	// provided planes and writes whether or not each box is inside or intersects it.
+	// See aabb_intersects_planes(..) above for details.
+	// Boxes are processed 4 at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void aabb_intersects_planes(const vector4f* planes, uint32_t num_planes, const aabbf* input_aabbs, bool* output_results, uint32_t num_aabbs) RTM_NO_EXCEPT
+	{
+		uint32_t aabb_index = 0;
+		for (; aabb_index + 4 <= num_aabbs; aabb_index += 4)
+		{
+			const aabbf* inputs = input_aabbs + aabb_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].center, inputs[1].center, inputs[2].center, inputs[3].center, center_xxxx, center_yyyy, center_zzzz);
+
+			vector4f extent_xxxx;
+			vector4f extent_yyyy;
+			vector4f extent_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].extent, inputs[1].extent, inputs[2].extent, inputs[3].extent, extent_xxxx, extent_yyyy, extent_zzzz);
+
+			// We track the smallest signed distance of the closest point to each plane, a negative value means we are outside
+			vector4f min_distance = vector_zero();
+			for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+			{
+				const vector4f plane = planes[plane_index];
+				const vector4f abs_plane = vector_abs(plane);
+
+				vector4f distance = vector_mul_add(center_xxxx, vector_dup_x(plane), vector_dup_w(plane));
+				distance = vector_mul_add(center_yyyy, vector_dup_y(plane), distance);
+				distance = vector_mul_add(center_zzzz, vector_dup_z(plane), distance);
+
+				distance = vector_mul_add(extent_xxxx, vector_dup_x(abs_plane), distance);
+				distance = vector_mul_add(extent_yyyy, vector_dup_y(abs_plane), distance);
+				distance = vector_mul_add(extent_zzzz, vector_dup_z(abs_plane), distance);
+
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			const mask4f is_inside = vector_greater_equal(min_distance, vector_zero());
+			output_results[aabb_index + 0] = mask_get_x(is_inside) != 0;
+			output_results[aabb_index + 1] = mask_get_y(is_inside) != 0;
+			output_results[aabb_index + 2] = mask_get_z(is_inside) != 0;
+			output_results[aabb_index + 3] = mask_get_w(is_inside) != 0;
+		}
+
+		for (; aabb_index < num_aabbs; ++aabb_index)
+			output_results[aabb_index] = aabb_intersects_planes(input_aabbs[aabb_index], planes, num_planes);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
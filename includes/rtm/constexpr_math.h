@@ -0,0 +1,558 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/constants.h"
+#include "rtm/types.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <limits>
+
+#if RTM_CPP_VERSION < 201402L
+	#error "rtm/constexpr_math.h requires C++14 or later"
+#endif
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Functions here can be evaluated at compile time to build constant data
+	// (e.g. default poses, lookup tables) without runtime initialization.
+	// Vectors, quaternions, and transforms are held in aligned storage
+	// that loads with vector_load, quat_load, qvv_load, and matrix_load.
+	//
+	// Usage:
+	//     constexpr aligned_qvvf pose = constexpr_math::qvv_set(
+	//         constexpr_math::quat_from_euler(0.5F, 0.0F, 0.25F),
+	//         constexpr_math::vector_set(1.0F, 2.0F, 3.0F),
+	//         constexpr_math::vector_set(1.0F));
+	//     const qvvf transform = qvv_load(&pose);
+	//
+	// Arithmetic follows the scalar code path, trigonometric functions and
+	// square roots are evaluated with doubles. Inputs must be finite.
+	// Requires C++14.
+	//////////////////////////////////////////////////////////////////////////
+	namespace constexpr_math
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Scalar
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the absolute value of the input.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float scalar_abs(float input) RTM_NO_EXCEPT
+		{
+			return input >= 0.0F ? input : -input;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the square root of the input, correctly rounded.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double scalar_sqrt(double input) RTM_NO_EXCEPT
+		{
+			if (input < 0.0)
+				return std::numeric_limits<double>::quiet_NaN();
+
+			if (input == 0.0)
+				return input;
+
+			// Newton-Raphson, our estimate always starts above the root and decreases
+			// monotonically until it converges
+			double estimate = input >= 1.0 ? input : 1.0;
+			for (uint32_t iteration = 0; iteration < 1024; ++iteration)
+			{
+				const double next_estimate = 0.5 * (estimate + input / estimate);
+				if (next_estimate >= estimate)
+					break;
+
+				estimate = next_estimate;
+			}
+
+			return estimate;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the square root of the input, correctly rounded.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float scalar_sqrt(float input) RTM_NO_EXCEPT
+		{
+			return static_cast<float>(scalar_sqrt(static_cast<double>(input)));
+		}
+
+		namespace rtm_impl
+		{
+			//////////////////////////////////////////////////////////////////////////
+			// Returns the input angle wrapped in [-PI, PI].
+			//////////////////////////////////////////////////////////////////////////
+			constexpr double wrap_angle(double angle) RTM_NO_EXCEPT
+			{
+				const double quotient = angle * double(constants::one_div_two_pi());
+				const double rounded_quotient = static_cast<double>(static_cast<int64_t>(quotient >= 0.0 ? (quotient + 0.5) : (quotient - 0.5)));
+				return angle - rounded_quotient * double(constants::two_pi());
+			}
+
+			//////////////////////////////////////////////////////////////////////////
+			// Returns the sine of an angle in [-PI/2, PI/2].
+			//////////////////////////////////////////////////////////////////////////
+			constexpr double sin_poly(double angle) RTM_NO_EXCEPT
+			{
+				// Taylor series up to x^21, the truncation error is well below double precision
+				const double angle_sq = angle * angle;
+
+				double term = angle;
+				double result = angle;
+				for (uint32_t term_index = 1; term_index <= 10; ++term_index)
+				{
+					term *= -angle_sq / static_cast<double>((2 * term_index) * (2 * term_index + 1));
+					result += term;
+				}
+
+				return result;
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine of the input angle.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double scalar_sin(double angle) RTM_NO_EXCEPT
+		{
+			// Use sin(x) = sin(PI - x) to bring our angle in [-PI/2, PI/2]
+			const double wrapped_angle = rtm_impl::wrap_angle(angle);
+			const double pi = double(constants::pi());
+			const double half_pi = double(constants::half_pi());
+
+			double reduced_angle = wrapped_angle;
+			if (wrapped_angle > half_pi)
+				reduced_angle = pi - wrapped_angle;
+			else if (wrapped_angle < -half_pi)
+				reduced_angle = -pi - wrapped_angle;
+
+			return rtm_impl::sin_poly(reduced_angle);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine of the input angle.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float scalar_sin(float angle) RTM_NO_EXCEPT
+		{
+			return static_cast<float>(scalar_sin(static_cast<double>(angle)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the cosine of the input angle.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double scalar_cos(double angle) RTM_NO_EXCEPT
+		{
+			// Use cos(x) = cos(|x|) = sin(PI/2 - |x|) to bring our angle in [-PI/2, PI/2]
+			const double wrapped_angle = rtm_impl::wrap_angle(angle);
+			const double abs_angle = wrapped_angle >= 0.0 ? wrapped_angle : -wrapped_angle;
+			return rtm_impl::sin_poly(double(constants::half_pi()) - abs_angle);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the cosine of the input angle.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float scalar_cos(float angle) RTM_NO_EXCEPT
+		{
+			return static_cast<float>(scalar_cos(static_cast<double>(angle)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts degrees into radians.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float scalar_deg_to_rad(float deg) RTM_NO_EXCEPT
+		{
+			return deg * constants::pi_div_one_eighty();
+		}
+
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// Vector
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a vector4 from all 4 components.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_set(float x, float y, float z, float w) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ x, y, z, w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a vector4 from the [xyz] components and sets [w] to 0.0.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_set(float x, float y, float z) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ x, y, z, 0.0F };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a vector4 from a single value for all 4 components.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_set(float xyzw) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ xyzw, xyzw, xyzw, xyzw };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a vector4 with all components set to zero.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_zero() RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ 0.0F, 0.0F, 0.0F, 0.0F };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component addition of the two inputs: lhs + rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_add(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component subtraction of the two inputs: lhs - rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_sub(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication of the two inputs: lhs * rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_mul(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication of a vector4 and a scalar: lhs * rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_mul(const aligned_float4f& lhs, float rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ lhs.x * rhs, lhs.y * rhs, lhs.z * rhs, lhs.w * rhs };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component division of the two inputs: lhs / rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_div(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component negation of the input: -input
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_neg(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ -input.x, -input.y, -input.z, -input.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication/addition of the three inputs: v2 + (v0 * v1)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_mul_add(const aligned_float4f& v0, const aligned_float4f& v1, const aligned_float4f& v2) RTM_NO_EXCEPT
+		{
+			return vector_add(vector_mul(v0, v1), v2);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component linear interpolation of the two inputs at the specified alpha.
+		// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_lerp(const aligned_float4f& start, const aligned_float4f& end, float alpha) RTM_NO_EXCEPT
+		{
+			return vector_add(vector_mul(start, 1.0F - alpha), vector_mul(end, alpha));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 4D dot product: lhs . rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float vector_dot(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return ((lhs.x * rhs.x) + (lhs.y * rhs.y)) + ((lhs.z * rhs.z) + (lhs.w * rhs.w));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 3D dot product: lhs . rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float vector_dot3(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return ((lhs.x * rhs.x) + (lhs.y * rhs.y)) + (lhs.z * rhs.z);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 3D cross product: lhs x rhs
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_cross3(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ (lhs.y * rhs.z) - (lhs.z * rhs.y), (lhs.z * rhs.x) - (lhs.x * rhs.z), (lhs.x * rhs.y) - (lhs.y * rhs.x), 0.0F };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the length of the input 4D vector.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float vector_length(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			return scalar_sqrt(vector_dot(input, input));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the length of the input 3D vector.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float vector_length3(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			return scalar_sqrt(vector_dot3(input, input));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a normalized 3D vector, the [w] component is preserved.
+		// If the length of the input is zero, the input is returned.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f vector_normalize3(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			const float length = vector_length3(input);
+			if (length == 0.0F)
+				return input;
+
+			return aligned_float4f{ input.x / length, input.y / length, input.z / length, input.w };
+		}
+
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// Quaternion
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a quaternion from all 4 components.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_set(float x, float y, float z, float w) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ x, y, z, w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the identity quaternion.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_identity() RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ 0.0F, 0.0F, 0.0F, 1.0F };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the quaternion conjugate.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_conjugate(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			return aligned_float4f{ -input.x, -input.y, -input.z, input.w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies two quaternions.
+		// Note that due to floating point rounding, the result might not be perfectly normalized.
+		// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_mul(const aligned_float4f& lhs, const aligned_float4f& rhs) RTM_NO_EXCEPT
+		{
+			const float x = (rhs.w * lhs.x) + (rhs.x * lhs.w) + (rhs.y * lhs.z) - (rhs.z * lhs.y);
+			const float y = (rhs.w * lhs.y) - (rhs.x * lhs.z) + (rhs.y * lhs.w) + (rhs.z * lhs.x);
+			const float z = (rhs.w * lhs.z) + (rhs.x * lhs.y) - (rhs.y * lhs.x) + (rhs.z * lhs.w);
+			const float w = (rhs.w * lhs.w) - (rhs.x * lhs.x) - (rhs.y * lhs.y) - (rhs.z * lhs.z);
+
+			return aligned_float4f{ x, y, z, w };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies a quaternion and a 3D vector, rotating it.
+		// Multiplication order is as follow: world_position = quat_mul_vector3(local_vector, local_to_world)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_mul_vector3(const aligned_float4f& vector, const aligned_float4f& rotation) RTM_NO_EXCEPT
+		{
+			const aligned_float4f vector_quat = aligned_float4f{ vector.x, vector.y, vector.z, 0.0F };
+			return quat_mul(quat_mul(quat_conjugate(rotation), vector_quat), rotation);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a normalized quaternion.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_normalize(const aligned_float4f& input) RTM_NO_EXCEPT
+		{
+			const float length = vector_length(input);
+			return aligned_float4f{ input.x / length, input.y / length, input.z / length, input.w / length };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a quaternion from a normalized axis and an angle.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_from_axis_angle(const aligned_float4f& axis, float angle) RTM_NO_EXCEPT
+		{
+			const float half_angle = 0.5F * angle;
+			const float sin_ = scalar_sin(half_angle);
+			const float cos_ = scalar_cos(half_angle);
+
+			return aligned_float4f{ axis.x * sin_, axis.y * sin_, axis.z * sin_, cos_ };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a quaternion from Euler Pitch/Yaw/Roll angles.
+		// Pitch is around the Y axis (right)
+		// Yaw is around the Z axis (up)
+		// Roll is around the X axis (forward)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f quat_from_euler(float pitch, float yaw, float roll) RTM_NO_EXCEPT
+		{
+			const float sp = scalar_sin(pitch * 0.5F);
+			const float sy = scalar_sin(yaw * 0.5F);
+			const float sr = scalar_sin(roll * 0.5F);
+			const float cp = scalar_cos(pitch * 0.5F);
+			const float cy = scalar_cos(yaw * 0.5F);
+			const float cr = scalar_cos(roll * 0.5F);
+
+			return aligned_float4f{ cr * sp * sy - sr * cp * cy,
+				-cr * sp * cy - sr * cp * sy,
+				cr * cp * sy - sr * sp * cy,
+				cr * cp * cy + sr * sp * sy };
+		}
+
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// QVV transform
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates a QVV transform from a rotation quaternion, a translation, and a 3D scale.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_qvvf qvv_set(const aligned_float4f& rotation, const aligned_float4f& translation, const aligned_float4f& scale) RTM_NO_EXCEPT
+		{
+			return aligned_qvvf{ rotation, translation, scale };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the identity QVV transform.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_qvvf qvv_identity() RTM_NO_EXCEPT
+		{
+			return aligned_qvvf{ quat_identity(), vector_zero(), vector_set(1.0F) };
+		}
+
+
+
+		//////////////////////////////////////////////////////////////////////////
+		// 3x4 affine matrix
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the identity 3x4 affine matrix.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_matrix3x4f matrix_identity() RTM_NO_EXCEPT
+		{
+			return aligned_matrix3x4f{ vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_zero() };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sets a 3x4 affine matrix from a rotation quaternion, translation, and 3D scale.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_matrix3x4f matrix_from_qvv(const aligned_float4f& quat, const aligned_float4f& translation, const aligned_float4f& scale) RTM_NO_EXCEPT
+		{
+			const float x2 = quat.x + quat.x;
+			const float y2 = quat.y + quat.y;
+			const float z2 = quat.z + quat.z;
+			const float xx = quat.x * x2;
+			const float xy = quat.x * y2;
+			const float xz = quat.x * z2;
+			const float yy = quat.y * y2;
+			const float yz = quat.y * z2;
+			const float zz = quat.z * z2;
+			const float wx = quat.w * x2;
+			const float wy = quat.w * y2;
+			const float wz = quat.w * z2;
+
+			const aligned_float4f x_axis = vector_mul(vector_set(1.0F - (yy + zz), xy + wz, xz - wy, 0.0F), scale.x);
+			const aligned_float4f y_axis = vector_mul(vector_set(xy - wz, 1.0F - (xx + zz), yz + wx, 0.0F), scale.y);
+			const aligned_float4f z_axis = vector_mul(vector_set(xz + wy, yz - wx, 1.0F - (xx + yy), 0.0F), scale.z);
+			return aligned_matrix3x4f{ x_axis, y_axis, z_axis, translation };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts a QVV transform into a 3x4 affine matrix.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_matrix3x4f matrix_from_qvv(const aligned_qvvf& transform) RTM_NO_EXCEPT
+		{
+			return matrix_from_qvv(transform.rotation, transform.translation, transform.scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies two 3x4 affine matrices.
+		// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_matrix3x4f matrix_mul(const aligned_matrix3x4f& lhs, const aligned_matrix3x4f& rhs) RTM_NO_EXCEPT
+		{
+			aligned_float4f tmp = vector_mul(vector_set(lhs.x_axis.x), rhs.x_axis);
+			tmp = vector_mul_add(vector_set(lhs.x_axis.y), rhs.y_axis, tmp);
+			tmp = vector_mul_add(vector_set(lhs.x_axis.z), rhs.z_axis, tmp);
+			const aligned_float4f x_axis = tmp;
+
+			tmp = vector_mul(vector_set(lhs.y_axis.x), rhs.x_axis);
+			tmp = vector_mul_add(vector_set(lhs.y_axis.y), rhs.y_axis, tmp);
+			tmp = vector_mul_add(vector_set(lhs.y_axis.z), rhs.z_axis, tmp);
+			const aligned_float4f y_axis = tmp;
+
+			tmp = vector_mul(vector_set(lhs.z_axis.x), rhs.x_axis);
+			tmp = vector_mul_add(vector_set(lhs.z_axis.y), rhs.y_axis, tmp);
+			tmp = vector_mul_add(vector_set(lhs.z_axis.z), rhs.z_axis, tmp);
+			const aligned_float4f z_axis = tmp;
+
+			tmp = vector_mul(vector_set(lhs.w_axis.x), rhs.x_axis);
+			tmp = vector_mul_add(vector_set(lhs.w_axis.y), rhs.y_axis, tmp);
+			tmp = vector_mul_add(vector_set(lhs.w_axis.z), rhs.z_axis, tmp);
+			const aligned_float4f w_axis = vector_add(rhs.w_axis, tmp);
+			return aligned_matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies a 3x4 affine matrix and a 3D point.
+		// Multiplication order is as follow: world_position = matrix_mul_point3(local_position, local_to_world)
+		//////////////////////////////////////////////////////////////////////////
+		constexpr aligned_float4f matrix_mul_point3(const aligned_float4f& point, const aligned_matrix3x4f& mtx) RTM_NO_EXCEPT
+		{
+			aligned_float4f tmp0 = vector_mul(vector_set(point.x), mtx.x_axis);
+			tmp0 = vector_mul_add(vector_set(point.y), mtx.y_axis, tmp0);
+			const aligned_float4f tmp1 = vector_mul_add(vector_set(point.z), mtx.z_axis, mtx.w_axis);
+
+			return vector_add(tmp0, tmp1);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
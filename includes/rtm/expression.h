@@ -0,0 +1,415 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <type_traits>
+#include <utility>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Expression nodes are evaluated with eval() or by coercing them to a vector4f.
+		// Operands are held by value, everything is inlined and the nodes vanish.
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// A leaf that holds a vector4f value.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4f_expr_value
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return value; }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return value; }
+
+			vector4f value;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// A leaf that holds a vector4f value known to have a unit length in 3D.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4f_expr_unit3_value
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return value; }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return value; }
+
+			vector4f value;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts an operand into an expression node, vector4f values become leaves.
+		// Overloads are used, SIMD types can lose their attributes as template arguments.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f_expr_value RTM_SIMD_CALL make_vector4f_expr(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			return vector4f_expr_value{ input };
+		}
+
+		template<typename expr_type>
+		constexpr const expr_type& make_vector4f_expr(const expr_type& input) RTM_NO_EXCEPT
+		{
+			return input;
+		}
+
+		template<typename expr_type>
+		using vector4f_expr_operand_t = typename std::decay<decltype(make_vector4f_expr(std::declval<const expr_type&>()))>::type;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication: lhs * rhs
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		struct vector4f_mul_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return vector_mul(lhs.eval(), rhs.eval()); }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			lhs_type lhs;
+			rhs_type rhs;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Addition evaluation, a multiplication operand is fused: v2 + (v0 * v1)
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		inline vector4f RTM_SIMD_CALL eval_add(const lhs_type& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return vector_add(lhs.eval(), rhs.eval());
+		}
+
+		template<typename lhs_mul0_type, typename lhs_mul1_type, typename rhs_type>
+		inline vector4f RTM_SIMD_CALL eval_add(const vector4f_mul_expr<lhs_mul0_type, lhs_mul1_type>& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(lhs.lhs.eval(), lhs.rhs.eval(), rhs.eval());
+		}
+
+		template<typename lhs_type, typename rhs_mul0_type, typename rhs_mul1_type>
+		inline vector4f RTM_SIMD_CALL eval_add(const lhs_type& lhs, const vector4f_mul_expr<rhs_mul0_type, rhs_mul1_type>& rhs) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(rhs.lhs.eval(), rhs.rhs.eval(), lhs.eval());
+		}
+
+		template<typename lhs_mul0_type, typename lhs_mul1_type, typename rhs_mul0_type, typename rhs_mul1_type>
+		inline vector4f RTM_SIMD_CALL eval_add(const vector4f_mul_expr<lhs_mul0_type, lhs_mul1_type>& lhs, const vector4f_mul_expr<rhs_mul0_type, rhs_mul1_type>& rhs) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(rhs.lhs.eval(), rhs.rhs.eval(), lhs.eval());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component addition: lhs + rhs
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		struct vector4f_add_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return eval_add(lhs, rhs); }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			lhs_type lhs;
+			rhs_type rhs;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Subtraction evaluation, a multiplication right operand is fused: v2 - (v0 * v1)
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		inline vector4f RTM_SIMD_CALL eval_sub(const lhs_type& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return vector_sub(lhs.eval(), rhs.eval());
+		}
+
+		template<typename lhs_type, typename rhs_mul0_type, typename rhs_mul1_type>
+		inline vector4f RTM_SIMD_CALL eval_sub(const lhs_type& lhs, const vector4f_mul_expr<rhs_mul0_type, rhs_mul1_type>& rhs) RTM_NO_EXCEPT
+		{
+			return vector_neg_mul_sub(rhs.lhs.eval(), rhs.rhs.eval(), lhs.eval());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component subtraction: lhs - rhs
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		struct vector4f_sub_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return eval_sub(lhs, rhs); }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			lhs_type lhs;
+			rhs_type rhs;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// 3D normalization, the result has a unit length.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type>
+		struct vector4f_normalize3_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT { return vector_normalize3(input.eval()); }
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			input_type input;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// A rotation cached as a 3x3 matrix to rotate many vectors.
+		// Rotating a vector only needs to broadcast its 3 components followed
+		// by a multiplication and two multiply-adds, the quaternion is not shuffled
+		// every time.
+		//////////////////////////////////////////////////////////////////////////
+		struct quatf_rotation_expr
+		{
+			vector4f x_axis;
+			vector4f y_axis;
+			vector4f z_axis;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotation of a 3D vector with a cached rotation.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type>
+		struct vector4f_rotate_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT
+			{
+				const vector4f input_value = input.eval();
+
+				vector4f result = vector_mul(vector_dup_x(input_value), rotation.x_axis);
+				result = vector_mul_add(vector_dup_y(input_value), rotation.y_axis, result);
+				result = vector_mul_add(vector_dup_z(input_value), rotation.z_axis, result);
+				return result;
+			}
+
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			input_type input;
+			quatf_rotation_expr rotation;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotation of a single 3D vector with a quaternion.
+		// Building a matrix does not pay off for a single vector, we use the
+		// cross product form instead of two quaternion multiplications:
+		// t = 2 * cross(rotation.xyz, input)
+		// result = input + rotation.w * t + cross(rotation.xyz, t)
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type>
+		struct vector4f_quat_rotate_expr
+		{
+			inline vector4f RTM_SIMD_CALL eval() const RTM_NO_EXCEPT
+			{
+				const vector4f input_value = input.eval();
+				const vector4f rotation_value = quat_to_vector(rotation);
+
+				const vector4f cross = vector_cross3(rotation_value, input_value);
+				const vector4f t = vector_add(cross, cross);
+				return vector_add(vector_mul_add(vector_dup_w(rotation_value), t, input_value), vector_cross3(rotation_value, t));
+			}
+
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT { return eval(); }
+
+			input_type input;
+			quatf rotation;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Whether or not an expression is known to have a unit length in 3D.
+		// Normalizations of such expressions are skipped.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename expr_type>
+		struct is_vector4f_expr_unit3 : std::false_type {};
+
+		template<>
+		struct is_vector4f_expr_unit3<vector4f_expr_unit3_value> : std::true_type {};
+
+		template<typename input_type>
+		struct is_vector4f_expr_unit3<vector4f_normalize3_expr<input_type>> : std::true_type {};
+
+		// A rotation preserves the length of its input
+		template<typename input_type>
+		struct is_vector4f_expr_unit3<vector4f_rotate_expr<input_type>> : is_vector4f_expr_unit3<input_type> {};
+
+		template<typename input_type>
+		struct is_vector4f_expr_unit3<vector4f_quat_rotate_expr<input_type>> : is_vector4f_expr_unit3<input_type> {};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// The expression layer is opt-in, include this header to use it.
+	// Functions here mirror the regular API but instead of returning a value,
+	// they return an expression that is evaluated when it is coerced to a
+	// vector4f (or with eval()). Knowing the whole expression, we can:
+	//    - Fuse multiplications into the addition or subtraction that consumes
+	//      them with vector_mul_add and vector_neg_mul_sub (FMA on ARM64)
+	//    - Rotate many vectors with a rotation converted once into a 3x3 matrix
+	//      (see expr::quat_rotation(..)) and a single one with the cheaper
+	//      cross product form
+	//    - Skip normalizing values that are known to be normalized
+	//
+	// e.g. vector4f result = expr::vector_add(expr::vector_mul(a, b), expr::vector_mul(c, d));
+	//      evaluates as: vector_mul_add(c, d, vector_mul(a, b))
+	//
+	// Note that fused operations can round differently than their separate equivalents.
+	//////////////////////////////////////////////////////////////////////////
+	namespace expr
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication of the two inputs: lhs * rhs
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		inline rtm_impl::vector4f_mul_expr<rtm_impl::vector4f_expr_operand_t<lhs_type>, rtm_impl::vector4f_expr_operand_t<rhs_type>> RTM_SIMD_CALL vector_mul(const lhs_type& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(lhs), rtm_impl::make_vector4f_expr(rhs) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component multiplication of a vector and a scalar: lhs * rhs
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type>
+		inline rtm_impl::vector4f_mul_expr<rtm_impl::vector4f_expr_operand_t<lhs_type>, rtm_impl::vector4f_expr_value> RTM_SIMD_CALL vector_mul(const lhs_type& lhs, float rhs) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(lhs), rtm_impl::vector4f_expr_value{ vector_set(rhs) } };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component addition of the two inputs: lhs + rhs
+		// Multiplication inputs are fused: v2 + (v0 * v1)
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		inline rtm_impl::vector4f_add_expr<rtm_impl::vector4f_expr_operand_t<lhs_type>, rtm_impl::vector4f_expr_operand_t<rhs_type>> RTM_SIMD_CALL vector_add(const lhs_type& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(lhs), rtm_impl::make_vector4f_expr(rhs) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component subtraction of the two inputs: lhs - rhs
+		// A multiplication right input is fused: v2 - (v0 * v1)
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lhs_type, typename rhs_type>
+		inline rtm_impl::vector4f_sub_expr<rtm_impl::vector4f_expr_operand_t<lhs_type>, rtm_impl::vector4f_expr_operand_t<rhs_type>> RTM_SIMD_CALL vector_sub(const lhs_type& lhs, const rhs_type& rhs) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(lhs), rtm_impl::make_vector4f_expr(rhs) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Marks a vector as having a unit length in 3D, normalizing it or its rotation will do nothing.
+		//////////////////////////////////////////////////////////////////////////
+		inline rtm_impl::vector4f_expr_unit3_value RTM_SIMD_CALL vector_unit3(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(scalar_abs(float(vector_length_squared3(input)) - 1.0F) < 0.00001F, "Vector is not normalized");
+			return { input };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a normalized 3D vector.
+		// If the input is known to be normalized, it is returned as is.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type, typename std::enable_if<!rtm_impl::is_vector4f_expr_unit3<rtm_impl::vector4f_expr_operand_t<input_type>>::value, int>::type = 0>
+		inline rtm_impl::vector4f_normalize3_expr<rtm_impl::vector4f_expr_operand_t<input_type>> RTM_SIMD_CALL vector_normalize3(const input_type& input) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(input) };
+		}
+
+		template<typename input_type, typename std::enable_if<rtm_impl::is_vector4f_expr_unit3<rtm_impl::vector4f_expr_operand_t<input_type>>::value, int>::type = 0>
+		constexpr input_type RTM_SIMD_CALL vector_normalize3(const input_type& input) RTM_NO_EXCEPT
+		{
+			return input;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts a normalized quaternion into a rotation that can rotate many vectors
+		// more efficiently than with quat_mul_vector3(..). Building the matrix costs more
+		// than rotating a single vector, use expr::quat_mul_vector3(..) with the quaternion then.
+		// Note that the result can differ slightly from quat_mul_vector3(..) due to rounding.
+		//////////////////////////////////////////////////////////////////////////
+		inline rtm_impl::quatf_rotation_expr RTM_SIMD_CALL quat_rotation(quatf_arg0 rotation) RTM_NO_EXCEPT
+		{
+			// Each axis is built with two products of shuffled components, e.g. for the X axis:
+			// [1 - 2yy - 2zz, 2xy + 2wz, 2xz - 2wy]
+			// The [w] component of the signs is 0.0 and so is the [w] component of every axis
+			const vector4f q = quat_to_vector(rotation);
+			const vector4f q2 = vector_add(q, q);
+
+			const vector4f x_axis_a = vector_mix<mix4::y, mix4::x, mix4::x, mix4::x>(q, q);
+			const vector4f x_axis_b = vector_mul(vector_mix<mix4::y, mix4::y, mix4::z, mix4::x>(q2, q2), vector_set(-1.0F, 1.0F, 1.0F, 0.0F));
+			const vector4f x_axis_c = vector_mix<mix4::z, mix4::w, mix4::w, mix4::x>(q, q);
+			const vector4f x_axis_d = vector_mul(vector_mix<mix4::z, mix4::z, mix4::y, mix4::x>(q2, q2), vector_set(-1.0F, 1.0F, -1.0F, 0.0F));
+			const vector4f x_axis = vector_mul_add(x_axis_c, x_axis_d, vector_mul_add(x_axis_a, x_axis_b, vector_set(1.0F, 0.0F, 0.0F, 0.0F)));
+
+			const vector4f y_axis_a = vector_mix<mix4::x, mix4::x, mix4::y, mix4::x>(q, q);
+			const vector4f y_axis_b = vector_mul(vector_mix<mix4::y, mix4::x, mix4::z, mix4::x>(q2, q2), vector_set(1.0F, -1.0F, 1.0F, 0.0F));
+			const vector4f y_axis_c = vector_mix<mix4::w, mix4::z, mix4::w, mix4::x>(q, q);
+			const vector4f y_axis_d = vector_mul(vector_mix<mix4::z, mix4::z, mix4::x, mix4::x>(q2, q2), vector_set(-1.0F, -1.0F, 1.0F, 0.0F));
+			const vector4f y_axis = vector_mul_add(y_axis_c, y_axis_d, vector_mul_add(y_axis_a, y_axis_b, vector_set(0.0F, 1.0F, 0.0F, 0.0F)));
+
+			const vector4f z_axis_a = vector_mix<mix4::x, mix4::y, mix4::x, mix4::x>(q, q);
+			const vector4f z_axis_b = vector_mul(vector_mix<mix4::z, mix4::z, mix4::x, mix4::x>(q2, q2), vector_set(1.0F, 1.0F, -1.0F, 0.0F));
+			const vector4f z_axis_c = vector_mix<mix4::w, mix4::w, mix4::y, mix4::x>(q, q);
+			const vector4f z_axis_d = vector_mul(vector_mix<mix4::y, mix4::x, mix4::y, mix4::x>(q2, q2), vector_set(1.0F, -1.0F, -1.0F, 0.0F));
+			const vector4f z_axis = vector_mul_add(z_axis_c, z_axis_d, vector_mul_add(z_axis_a, z_axis_b, vector_set(0.0F, 0.0F, 1.0F, 0.0F)));
+
+			return { x_axis, y_axis, z_axis };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates a 3D vector with a cached rotation.
+		// Multiplication order is as follow: world_position = quat_mul_vector3(local_vector, local_to_world)
+		// The [w] component of the result is 0.0.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type>
+		inline rtm_impl::vector4f_rotate_expr<rtm_impl::vector4f_expr_operand_t<input_type>> RTM_SIMD_CALL quat_mul_vector3(const input_type& input, const rtm_impl::quatf_rotation_expr& rotation) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(input), rotation };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates a single 3D vector with a normalized quaternion.
+		// Use expr::quat_rotation(..) instead when many vectors share the same rotation.
+		// Multiplication order is as follow: world_position = quat_mul_vector3(local_vector, local_to_world)
+		// The [w] component of the result is undefined.
+		// Note that the result can differ slightly from quat_mul_vector3(..) due to rounding.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename input_type>
+		inline rtm_impl::vector4f_quat_rotate_expr<rtm_impl::vector4f_expr_operand_t<input_type>> RTM_SIMD_CALL quat_mul_vector3(const input_type& input, quatf_arg1 rotation) RTM_NO_EXCEPT
+		{
+			return { rtm_impl::make_vector4f_expr(input), rotation };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates an expression.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename expr_type>
+		inline vector4f RTM_SIMD_CALL eval(const expr_type& input) RTM_NO_EXCEPT
+		{
+			return rtm_impl::make_vector4f_expr(input).eval();
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
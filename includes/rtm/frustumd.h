@@ -0,0 +1,81 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix4x4d.h"
+#include "rtm/planed.h"
+#include "rtm/vector4d.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Scales a plane such that its normal has unit length.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d frustum_normalize_plane(const vector4d& plane) RTM_NO_EXCEPT
+		{
+			return plane_normalize(planed{ plane }).normal_distance;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a frustum float32 variant to a float64 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumd frustum_cast(const frustumf& input) RTM_NO_EXCEPT
+	{
+		return frustumd{ { vector_cast(input.planes[0]), vector_cast(input.planes[1]), vector_cast(input.planes[2]),
+			vector_cast(input.planes[3]), vector_cast(input.planes[4]), vector_cast(input.planes[5]) } };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the frustum planes from a view projection matrix.
+	// The planes are normalized such that distances are expressed in world units.
+	// Clip space depth is assumed to be in [0, w] (e.g. Direct3D, Vulkan, Metal).
+	// Extracting in float64 before casting to float32 is useful when the view
+	// projection matrix contains large translations.
+	// See: Gil Gribb and Klaus Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix", 2001
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumd frustum_from_matrix(const matrix4x4d& view_projection) RTM_NO_EXCEPT
+	{
+		// Points are row vectors: the clip space components are the dot products with the matrix columns
+		const matrix4x4d columns = matrix_transpose(view_projection);
+
+		frustumd result;
+		result.planes[0] = rtm_impl::frustum_normalize_plane(vector_add(columns.w_axis, columns.x_axis));	// Left
+		result.planes[1] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.x_axis));	// Right
+		result.planes[2] = rtm_impl::frustum_normalize_plane(vector_add(columns.w_axis, columns.y_axis));	// Bottom
+		result.planes[3] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.y_axis));	// Top
+		result.planes[4] = rtm_impl::frustum_normalize_plane(columns.z_axis);								// Near
+		result.planes[5] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.z_axis));	// Far
+		return result;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,273 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/aabbf.h"
+#include "rtm/macros.h"
+#include "rtm/mask4f.h"
+#include "rtm/math.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/planef.h"
+#include "rtm/spheref.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Scales a plane such that its normal has unit length.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL frustum_normalize_plane(vector4f_arg0 plane) RTM_NO_EXCEPT
+		{
+			return plane_normalize(planef{ plane }).normal_distance;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// The frustum planes in SoA form: each plane component is broadcast into
+		// every lane so we can test 4 bounding volumes at once.
+		//////////////////////////////////////////////////////////////////////////
+		struct frustumf_soa
+		{
+			vector4f	normal_xxxx[6];
+			vector4f	normal_yyyy[6];
+			vector4f	normal_zzzz[6];
+			vector4f	distance_wwww[6];
+			vector4f	abs_normal_xxxx[6];
+			vector4f	abs_normal_yyyy[6];
+			vector4f	abs_normal_zzzz[6];
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts the frustum planes into SoA form.
+		//////////////////////////////////////////////////////////////////////////
+		inline void frustum_to_soa(const frustumf& frustum, frustumf_soa& out_frustum) RTM_NO_EXCEPT
+		{
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				const vector4f plane = frustum.planes[plane_index];
+				const vector4f abs_plane = vector_abs(plane);
+
+				out_frustum.normal_xxxx[plane_index] = vector_dup_x(plane);
+				out_frustum.normal_yyyy[plane_index] = vector_dup_y(plane);
+				out_frustum.normal_zzzz[plane_index] = vector_dup_z(plane);
+				out_frustum.distance_wwww[plane_index] = vector_dup_w(plane);
+				out_frustum.abs_normal_xxxx[plane_index] = vector_dup_x(abs_plane);
+				out_frustum.abs_normal_yyyy[plane_index] = vector_dup_y(abs_plane);
+				out_frustum.abs_normal_zzzz[plane_index] = vector_dup_z(abs_plane);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Tests 4 spheres against the frustum and returns a bit mask of the visible ones.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t frustum_test4(const frustumf_soa& frustum, const spheref* spheres) RTM_NO_EXCEPT
+		{
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			vector4f radius_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(spheres[0].center_radius, spheres[1].center_radius, spheres[2].center_radius, spheres[3].center_radius, center_xxxx, center_yyyy, center_zzzz, radius_wwww);
+
+			// We track the smallest signed distance of the closest point to each plane, a negative value means we are outside
+			vector4f min_distance = vector_zero();
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				vector4f distance = vector_mul_add(center_xxxx, frustum.normal_xxxx[plane_index], vector_add(frustum.distance_wwww[plane_index], radius_wwww));
+				distance = vector_mul_add(center_yyyy, frustum.normal_yyyy[plane_index], distance);
+				distance = vector_mul_add(center_zzzz, frustum.normal_zzzz[plane_index], distance);
+
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return mask_get_bits(vector_greater_equal(min_distance, vector_zero()));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Tests 4 axis aligned bounding boxes against the frustum and returns a bit mask of the visible ones.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t frustum_test4(const frustumf_soa& frustum, const aabbf* aabbs) RTM_NO_EXCEPT
+		{
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(aabbs[0].center, aabbs[1].center, aabbs[2].center, aabbs[3].center, center_xxxx, center_yyyy, center_zzzz);
+
+			vector4f extent_xxxx;
+			vector4f extent_yyyy;
+			vector4f extent_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(aabbs[0].extent, aabbs[1].extent, aabbs[2].extent, aabbs[3].extent, extent_xxxx, extent_yyyy, extent_zzzz);
+
+			// We track the smallest signed distance of the closest point to each plane, a negative value means we are outside
+			vector4f min_distance = vector_zero();
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				vector4f distance = vector_mul_add(center_xxxx, frustum.normal_xxxx[plane_index], frustum.distance_wwww[plane_index]);
+				distance = vector_mul_add(center_yyyy, frustum.normal_yyyy[plane_index], distance);
+				distance = vector_mul_add(center_zzzz, frustum.normal_zzzz[plane_index], distance);
+
+				distance = vector_mul_add(extent_xxxx, frustum.abs_normal_xxxx[plane_index], distance);
+				distance = vector_mul_add(extent_yyyy, frustum.abs_normal_yyyy[plane_index], distance);
+				distance = vector_mul_add(extent_zzzz, frustum.abs_normal_zzzz[plane_index], distance);
+
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return mask_get_bits(vector_greater_equal(min_distance, vector_zero()));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Appends the indices of the visible entries to the output list without branching.
+		// Every index is written but the output cursor only advances when it is visible.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t frustum_append_visible(uint32_t visible_bits, uint32_t first_index, uint32_t num_lanes, uint32_t* visible_indices, uint32_t num_visible) RTM_NO_EXCEPT
+		{
+			for (uint32_t lane_index = 0; lane_index < num_lanes; ++lane_index)
+			{
+				visible_indices[num_visible] = first_index + lane_index;
+				num_visible += (visible_bits >> lane_index) & 1;
+			}
+
+			return num_visible;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Culls bounding volumes 8 at a time, then 4 at a time, and finally pads the remainder.
+		// Padding the remainder allows every volume to be tested the same way.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename volume_type>
+		inline uint32_t frustum_cull(const frustumf& frustum, const volume_type* volumes, uint32_t num_volumes, uint32_t* visible_indices) RTM_NO_EXCEPT
+		{
+			frustumf_soa frustum_soa;
+			frustum_to_soa(frustum, frustum_soa);
+
+			uint32_t num_visible = 0;
+			uint32_t volume_index = 0;
+
+			// Two independent groups per iteration give the processor more work to overlap
+			for (; volume_index + 8 <= num_volumes; volume_index += 8)
+			{
+				const uint32_t visible_bits0 = frustum_test4(frustum_soa, volumes + volume_index + 0);
+				const uint32_t visible_bits1 = frustum_test4(frustum_soa, volumes + volume_index + 4);
+				num_visible = frustum_append_visible(visible_bits0 | (visible_bits1 << 4), volume_index, 8, visible_indices, num_visible);
+			}
+
+			if (volume_index + 4 <= num_volumes)
+			{
+				const uint32_t visible_bits = frustum_test4(frustum_soa, volumes + volume_index);
+				num_visible = frustum_append_visible(visible_bits, volume_index, 4, visible_indices, num_visible);
+				volume_index += 4;
+			}
+
+			const uint32_t num_remaining = num_volumes - volume_index;
+			if (num_remaining != 0)
+			{
+				volume_type padded_volumes[4];
+				for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+					padded_volumes[lane_index] = volumes[volume_index + (lane_index < num_remaining ? lane_index : 0)];
+
+				const uint32_t visible_bits = frustum_test4(frustum_soa, &padded_volumes[0]);
+				num_visible = frustum_append_visible(visible_bits, volume_index, num_remaining, visible_indices, num_visible);
+			}
+
+			return num_visible;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a frustum float64 variant to a float32 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumf frustum_cast(const frustumd& input) RTM_NO_EXCEPT
+	{
+		return frustumf{ { vector_cast(input.planes[0]), vector_cast(input.planes[1]), vector_cast(input.planes[2]),
+			vector_cast(input.planes[3]), vector_cast(input.planes[4]), vector_cast(input.planes[5]) } };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the frustum planes from a view projection matrix.
+	// The planes are normalized such that distances are expressed in world units.
+	// Clip space depth is assumed to be in [0, w] (e.g. Direct3D, Vulkan, Metal).
+	// See: Gil Gribb and Klaus Hartmann, "Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix", 2001
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumf RTM_SIMD_CALL frustum_from_matrix(matrix4x4f_arg0 view_projection) RTM_NO_EXCEPT
+	{
+		// Points are row vectors: the clip space components are the dot products with the matrix columns
+		const matrix4x4f columns = matrix_transpose(view_projection);
+
+		frustumf result;
+		result.planes[0] = rtm_impl::frustum_normalize_plane(vector_add(columns.w_axis, columns.x_axis));	// Left
+		result.planes[1] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.x_axis));	// Right
+		result.planes[2] = rtm_impl::frustum_normalize_plane(vector_add(columns.w_axis, columns.y_axis));	// Bottom
+		result.planes[3] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.y_axis));	// Top
+		result.planes[4] = rtm_impl::frustum_normalize_plane(columns.z_axis);								// Near
+		result.planes[5] = rtm_impl::frustum_normalize_plane(vector_sub(columns.w_axis, columns.z_axis));	// Far
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the bounding sphere is inside or intersects the frustum.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects(const frustumf& frustum, spheref_arg0 sphere) RTM_NO_EXCEPT
+	{
+		return sphere_intersects_planes(sphere, frustum.planes, 6);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the axis aligned bounding box is inside or intersects the frustum.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects(const frustumf& frustum, aabbf_arg0 aabb) RTM_NO_EXCEPT
+	{
+		return aabb_intersects_planes(aabb, frustum.planes, 6);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Culls bounding spheres against the frustum and writes the indices of the
+	// visible ones to the output list in increasing order. Returns the number of visible spheres.
+	// Spheres are tested 8 at a time in SoA form against all 6 planes.
+	// The output list must be large enough to hold 'num_spheres' indices.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t frustum_cull(const frustumf& frustum, const spheref* spheres, uint32_t num_spheres, uint32_t* visible_indices) RTM_NO_EXCEPT
+	{
+		return rtm_impl::frustum_cull(frustum, spheres, num_spheres, visible_indices);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Culls axis aligned bounding boxes against the frustum and writes the indices of the
+	// visible ones to the output list in increasing order. Returns the number of visible boxes.
+	// Boxes are tested 8 at a time in SoA form against all 6 planes.
+	// The output list must be large enough to hold 'num_aabbs' indices.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t frustum_cull(const frustumf& frustum, const aabbf* aabbs, uint32_t num_aabbs, uint32_t* visible_indices) RTM_NO_EXCEPT
+	{
+		return rtm_impl::frustum_cull(frustum, aabbs, num_aabbs, visible_indices);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,618 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/macros.h"
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Inverse kinematics building blocks operating on joint chains.
+//
+// A chain is a contiguous array of joint transforms ordered from the root to
+// the tip where every joint is the parent of the next one. All transforms are
+// expressed in a common space (e.g. world or object space) and only their
+// rotation and translation are modified, scale is left untouched.
+// Rotating a joint rotates every joint after it around its position.
+//
+// Every solver also has an SoA version operating on ik_chain4f which solves
+// four chains in lockstep, one per SIMD lane.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Squared length under which a direction is considered degenerate.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float ik_epsilon_squared() RTM_NO_EXCEPT { return 1.0E-12F; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates the joints [first_joint, num_joints) around the position of the first joint.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL ik_rotate_chain(qvvf* chain, uint32_t first_joint, uint32_t num_joints, quatf_arg0 delta) RTM_NO_EXCEPT
+		{
+			const vector4f pivot = chain[first_joint].translation;
+			chain[first_joint].rotation = quat_normalize(quat_mul(chain[first_joint].rotation, delta));
+
+			for (uint32_t joint_index = first_joint + 1; joint_index < num_joints; ++joint_index)
+			{
+				qvvf& joint = chain[joint_index];
+				joint.translation = vector_add(quat_mul_vector3(vector_sub(joint.translation, pivot), delta), pivot);
+				joint.rotation = quat_normalize(quat_mul(joint.rotation, delta));
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an axis perpendicular to the input direction.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL ik_perpendicular_axis(vector4f_arg0 direction) RTM_NO_EXCEPT
+		{
+			const vector4f abs_direction = vector_abs(direction);
+			const vector4f perpendicular = float(vector_get_x(abs_direction)) > float(vector_get_z(abs_direction))
+				? vector_set(-float(vector_get_y(direction)), float(vector_get_x(direction)), 0.0F)
+				: vector_set(0.0F, -float(vector_get_z(direction)), float(vector_get_y(direction)));
+			return vector_normalize3(perpendicular);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// A 3D vector in SoA form.
+		//////////////////////////////////////////////////////////////////////////
+		struct ik_vector3_soa
+		{
+			vector4f	x;
+			vector4f	y;
+			vector4f	z;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// A quaternion in SoA form.
+		//////////////////////////////////////////////////////////////////////////
+		struct ik_quat_soa
+		{
+			vector4f	x;
+			vector4f	y;
+			vector4f	z;
+			vector4f	w;
+		};
+
+		template<uint32_t num_joints>
+		inline ik_vector3_soa ik_get_position(const ik_chain4f<num_joints>& chains, uint32_t joint_index) RTM_NO_EXCEPT
+		{
+			return ik_vector3_soa{ chains.position_x[joint_index], chains.position_y[joint_index], chains.position_z[joint_index] };
+		}
+
+		inline ik_vector3_soa RTM_SIMD_CALL ik_sub(const ik_vector3_soa& lhs, const ik_vector3_soa& rhs) RTM_NO_EXCEPT
+		{
+			return ik_vector3_soa{ vector_sub(lhs.x, rhs.x), vector_sub(lhs.y, rhs.y), vector_sub(lhs.z, rhs.z) };
+		}
+
+		inline vector4f RTM_SIMD_CALL ik_dot(const ik_vector3_soa& lhs, const ik_vector3_soa& rhs) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(lhs.z, rhs.z, vector_mul_add(lhs.y, rhs.y, vector_mul(lhs.x, rhs.x)));
+		}
+
+		// Returns: input * scale + offset
+		inline ik_vector3_soa RTM_SIMD_CALL ik_mul_add(const ik_vector3_soa& input, vector4f_arg0 scale, const ik_vector3_soa& offset) RTM_NO_EXCEPT
+		{
+			return ik_vector3_soa{ vector_mul_add(input.x, scale, offset.x), vector_mul_add(input.y, scale, offset.y), vector_mul_add(input.z, scale, offset.z) };
+		}
+
+		// Returns: input * scale
+		inline ik_vector3_soa RTM_SIMD_CALL ik_mul(const ik_vector3_soa& input, vector4f_arg0 scale) RTM_NO_EXCEPT
+		{
+			return ik_vector3_soa{ vector_mul(input.x, scale), vector_mul(input.y, scale), vector_mul(input.z, scale) };
+		}
+
+		inline ik_vector3_soa RTM_SIMD_CALL ik_select(mask4f_arg0 mask, const ik_vector3_soa& if_true, const ik_vector3_soa& if_false) RTM_NO_EXCEPT
+		{
+			return ik_vector3_soa{ vector_select(mask, if_true.x, if_false.x), vector_select(mask, if_true.y, if_false.y), vector_select(mask, if_true.z, if_false.z) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_from_to that returns the identity when either direction is degenerate.
+		//////////////////////////////////////////////////////////////////////////
+		inline ik_quat_soa RTM_SIMD_CALL ik_quat_from_to(const ik_vector3_soa& from, const ik_vector3_soa& to) RTM_NO_EXCEPT
+		{
+			ik_quat_soa result;
+			quat_from_to_soa(from.x, from.y, from.z, to.x, to.y, to.z, result.x, result.y, result.z, result.w);
+
+			const vector4f min_length_sq = vector_min(ik_dot(from, from), ik_dot(to, to));
+			const mask4f is_valid = vector_greater_equal(min_length_sq, vector_set(ik_epsilon_squared()));
+
+			const vector4f zero = vector_zero();
+			result.x = vector_select(is_valid, result.x, zero);
+			result.y = vector_select(is_valid, result.y, zero);
+			result.z = vector_select(is_valid, result.z, zero);
+			result.w = vector_select(is_valid, result.w, vector_set(1.0F));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_mul_vector3.
+		//////////////////////////////////////////////////////////////////////////
+		inline ik_vector3_soa RTM_SIMD_CALL ik_quat_mul_vector3(const ik_vector3_soa& vector, const ik_quat_soa& rotation) RTM_NO_EXCEPT
+		{
+			// t = 2 * cross(q.xyz, v)
+			// v' = v + q.w * t + cross(q.xyz, t)
+			const vector4f tx = vector_mul(vector_neg_mul_sub(rotation.z, vector.y, vector_mul(rotation.y, vector.z)), 2.0F);
+			const vector4f ty = vector_mul(vector_neg_mul_sub(rotation.x, vector.z, vector_mul(rotation.z, vector.x)), 2.0F);
+			const vector4f tz = vector_mul(vector_neg_mul_sub(rotation.y, vector.x, vector_mul(rotation.x, vector.y)), 2.0F);
+
+			const vector4f x = vector_add(vector_mul_add(rotation.w, tx, vector.x), vector_neg_mul_sub(rotation.z, ty, vector_mul(rotation.y, tz)));
+			const vector4f y = vector_add(vector_mul_add(rotation.w, ty, vector.y), vector_neg_mul_sub(rotation.x, tz, vector_mul(rotation.z, tx)));
+			const vector4f z = vector_add(vector_mul_add(rotation.w, tz, vector.z), vector_neg_mul_sub(rotation.y, tx, vector_mul(rotation.x, ty)));
+			return ik_vector3_soa{ x, y, z };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Applies a rotation delta to a joint: rotation = quat_normalize(quat_mul(rotation, delta))
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_joints>
+		inline void RTM_SIMD_CALL ik_rotate_joint(ik_chain4f<num_joints>& chains, uint32_t joint_index, const ik_quat_soa& delta) RTM_NO_EXCEPT
+		{
+			const vector4f lhs_x = chains.rotation_x[joint_index];
+			const vector4f lhs_y = chains.rotation_y[joint_index];
+			const vector4f lhs_z = chains.rotation_z[joint_index];
+			const vector4f lhs_w = chains.rotation_w[joint_index];
+
+			const vector4f x = vector_add(vector_mul_add(delta.w, lhs_x, vector_mul(delta.x, lhs_w)), vector_neg_mul_sub(delta.z, lhs_y, vector_mul(delta.y, lhs_z)));
+			const vector4f y = vector_add(vector_mul_add(delta.w, lhs_y, vector_mul(delta.y, lhs_w)), vector_neg_mul_sub(delta.x, lhs_z, vector_mul(delta.z, lhs_x)));
+			const vector4f z = vector_add(vector_mul_add(delta.w, lhs_z, vector_mul(delta.z, lhs_w)), vector_neg_mul_sub(delta.y, lhs_x, vector_mul(delta.x, lhs_y)));
+			const vector4f w = vector_neg_mul_sub(delta.z, lhs_z, vector_neg_mul_sub(delta.y, lhs_y, vector_neg_mul_sub(delta.x, lhs_x, vector_mul(delta.w, lhs_w))));
+
+			const vector4f length_sq = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(length_sq));
+			chains.rotation_x[joint_index] = vector_mul(x, inv_length);
+			chains.rotation_y[joint_index] = vector_mul(y, inv_length);
+			chains.rotation_z[joint_index] = vector_mul(z, inv_length);
+			chains.rotation_w[joint_index] = vector_mul(w, inv_length);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates the joints [first_joint, num_joints) around the position of the first joint.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_joints>
+		inline void RTM_SIMD_CALL ik_rotate_chain(ik_chain4f<num_joints>& chains, uint32_t first_joint, const ik_quat_soa& delta) RTM_NO_EXCEPT
+		{
+			const ik_vector3_soa pivot = ik_get_position(chains, first_joint);
+			ik_rotate_joint(chains, first_joint, delta);
+
+			for (uint32_t joint_index = first_joint + 1; joint_index < num_joints; ++joint_index)
+			{
+				const ik_vector3_soa offset = ik_quat_mul_vector3(ik_sub(ik_get_position(chains, joint_index), pivot), delta);
+				chains.position_x[joint_index] = vector_add(offset.x, pivot.x);
+				chains.position_y[joint_index] = vector_add(offset.y, pivot.y);
+				chains.position_z[joint_index] = vector_add(offset.z, pivot.z);
+				ik_rotate_joint(chains, joint_index, delta);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Performs one FABRIK iteration on joint positions: a backward pass from the
+		// target to the root followed by a forward pass from the root to the target.
+		// See: FABRIK: A fast, iterative solver for the Inverse Kinematics problem (Aristidou and Lasenby, 2011)
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL ik_fabrik_iteration(vector4f* positions, const float* bone_lengths, uint32_t num_joints, vector4f_arg0 target) RTM_NO_EXCEPT
+		{
+			const vector4f root = positions[0];
+			const uint32_t tip_index = num_joints - 1;
+
+			positions[tip_index] = target;
+			for (uint32_t joint_index = tip_index; joint_index-- > 0;)
+			{
+				const vector4f direction = vector_normalize3(vector_sub(positions[joint_index], positions[joint_index + 1]), vector_zero());
+				positions[joint_index] = vector_mul_add(direction, bone_lengths[joint_index], positions[joint_index + 1]);
+			}
+
+			positions[0] = root;
+			for (uint32_t joint_index = 0; joint_index < tip_index; ++joint_index)
+			{
+				const vector4f direction = vector_normalize3(vector_sub(positions[joint_index + 1], positions[joint_index]), vector_zero());
+				positions[joint_index + 1] = vector_mul_add(direction, bone_lengths[joint_index], positions[joint_index]);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of ik_fabrik_iteration.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_joints>
+		inline void RTM_SIMD_CALL ik_fabrik_iteration(ik_vector3_soa (&positions)[num_joints], const vector4f (&bone_lengths)[num_joints], const ik_vector3_soa& target) RTM_NO_EXCEPT
+		{
+			const ik_vector3_soa root = positions[0];
+			const uint32_t tip_index = num_joints - 1;
+			const vector4f epsilon_squared = vector_set(ik_epsilon_squared());
+
+			positions[tip_index] = target;
+			for (uint32_t joint_index = tip_index; joint_index-- > 0;)
+			{
+				const ik_vector3_soa offset = ik_sub(positions[joint_index], positions[joint_index + 1]);
+				const vector4f length_sq = vector_max(ik_dot(offset, offset), epsilon_squared);
+				const vector4f scale = vector_div(bone_lengths[joint_index], vector_sqrt(length_sq));
+				positions[joint_index] = ik_mul_add(offset, scale, positions[joint_index + 1]);
+			}
+
+			positions[0] = root;
+			for (uint32_t joint_index = 0; joint_index < tip_index; ++joint_index)
+			{
+				const ik_vector3_soa offset = ik_sub(positions[joint_index + 1], positions[joint_index]);
+				const vector4f length_sq = vector_max(ik_dot(offset, offset), epsilon_squared);
+				const vector4f scale = vector_div(bone_lengths[joint_index], vector_sqrt(length_sq));
+				positions[joint_index + 1] = ik_mul_add(offset, scale, positions[joint_index]);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads four chains of joint transforms into SoA form.
+	// Each chain must contain as many joints as the SoA chains.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	inline void ik_chain_load(const qvvf* chain0, const qvvf* chain1, const qvvf* chain2, const qvvf* chain3, ik_chain4f<num_joints>& out_chains) RTM_NO_EXCEPT
+	{
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+		{
+			RTM_MATRIXF_TRANSPOSE_4X3(chain0[joint_index].translation, chain1[joint_index].translation, chain2[joint_index].translation, chain3[joint_index].translation,
+				out_chains.position_x[joint_index], out_chains.position_y[joint_index], out_chains.position_z[joint_index]);
+
+			const vector4f rotation0 = quat_to_vector(chain0[joint_index].rotation);
+			const vector4f rotation1 = quat_to_vector(chain1[joint_index].rotation);
+			const vector4f rotation2 = quat_to_vector(chain2[joint_index].rotation);
+			const vector4f rotation3 = quat_to_vector(chain3[joint_index].rotation);
+			RTM_MATRIXF_TRANSPOSE_4X4(rotation0, rotation1, rotation2, rotation3,
+				out_chains.rotation_x[joint_index], out_chains.rotation_y[joint_index], out_chains.rotation_z[joint_index], out_chains.rotation_w[joint_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Stores the rotations and translations of four SoA chains back into their joint transforms.
+	// The scale of the joint transforms is left untouched.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	inline void ik_chain_store(const ik_chain4f<num_joints>& chains, qvvf* chain0, qvvf* chain1, qvvf* chain2, qvvf* chain3) RTM_NO_EXCEPT
+	{
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+		{
+			vector4f position0;
+			vector4f position1;
+			vector4f position2;
+			vector4f position3;
+			RTM_MATRIXF_TRANSPOSE_3X4(chains.position_x[joint_index], chains.position_y[joint_index], chains.position_z[joint_index], position0, position1, position2, position3);
+
+			vector4f rotation0;
+			vector4f rotation1;
+			vector4f rotation2;
+			vector4f rotation3;
+			RTM_MATRIXF_TRANSPOSE_4X4(chains.rotation_x[joint_index], chains.rotation_y[joint_index], chains.rotation_z[joint_index], chains.rotation_w[joint_index],
+				rotation0, rotation1, rotation2, rotation3);
+
+			chain0[joint_index].translation = position0;
+			chain1[joint_index].translation = position1;
+			chain2[joint_index].translation = position2;
+			chain3[joint_index].translation = position3;
+			chain0[joint_index].rotation = vector_to_quat(rotation0);
+			chain1[joint_index].rotation = vector_to_quat(rotation1);
+			chain2[joint_index].rotation = vector_to_quat(rotation2);
+			chain3[joint_index].rotation = vector_to_quat(rotation3);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Analytic two bone IK: rotates the root and middle joints of a 3 joint chain
+	// so that the tip reaches the target.
+	// When the target is out of reach, the chain is fully extended towards it.
+	// The middle joint bends towards the bend direction (e.g. the knee or elbow pole),
+	// it does not need to be normalized. When it is aligned with the target, the
+	// current bend of the chain is retained.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL ik_two_bone(qvvf* chain, vector4f_arg0 target, vector4f_arg1 bend_direction) RTM_NO_EXCEPT
+	{
+		const vector4f root = chain[0].translation;
+		const vector4f mid = chain[1].translation;
+		const vector4f tip = chain[2].translation;
+
+		const float upper_length = vector_length3(vector_sub(mid, root));
+		const float lower_length = vector_length3(vector_sub(tip, mid));
+
+		// When the target sits on the root, we keep the current tip direction
+		const vector4f root_to_target = vector_sub(target, root);
+		const vector4f target_direction = vector_normalize3(root_to_target, vector_normalize3(vector_sub(tip, root)));
+
+		// The chain cannot stretch further than its full length nor fold tighter than its bone length difference
+		const float target_distance = scalar_clamp(float(vector_length3(root_to_target)), scalar_abs(upper_length - lower_length), upper_length + lower_length);
+
+		// Law of cosines for the root angle
+		const float cos_root = scalar_clamp((upper_length * upper_length + target_distance * target_distance - lower_length * lower_length) / scalar_max(2.0F * upper_length * target_distance, 1.0E-12F), -1.0F, 1.0F);
+		const float sin_root = scalar_sqrt(scalar_max(1.0F - cos_root * cos_root, 0.0F));
+
+		// The bend axis is the component of the bend direction perpendicular to the target direction
+		const scalarf bend_dot = vector_dot3(bend_direction, target_direction);
+		const vector4f bend_perpendicular = vector_neg_mul_sub(target_direction, bend_dot, bend_direction);
+		const vector4f mid_offset = vector_sub(mid, root);
+		const scalarf mid_dot = vector_dot3(mid_offset, target_direction);
+		const vector4f mid_perpendicular = vector_neg_mul_sub(target_direction, mid_dot, mid_offset);
+		const vector4f fallback_axis = vector_normalize3(mid_perpendicular, rtm_impl::ik_perpendicular_axis(target_direction), rtm_impl::ik_epsilon_squared());
+		const vector4f bend_axis = vector_normalize3(bend_perpendicular, fallback_axis, rtm_impl::ik_epsilon_squared());
+
+		const vector4f new_mid_direction = vector_mul_add(bend_axis, sin_root, vector_mul(target_direction, cos_root));
+		const vector4f new_mid = vector_mul_add(new_mid_direction, upper_length, root);
+		const vector4f new_tip = vector_mul_add(target_direction, target_distance, root);
+
+		// Rotating the upper bone carries the lower bone with it, we then align the lower bone
+		rtm_impl::ik_rotate_chain(chain, 0, 3, quat_from_to(mid_offset, vector_sub(new_mid, root)));
+
+		const vector4f rotated_mid = chain[1].translation;
+		const vector4f rotated_lower = vector_sub(chain[2].translation, rotated_mid);
+		rtm_impl::ik_rotate_chain(chain, 1, 3, quat_from_to(rotated_lower, vector_sub(new_tip, rotated_mid)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SoA version of ik_two_bone for four 3 joint chains, each with its own target and bend direction.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL ik_two_bone(ik_chain4f<3>& chains, vector4f_arg0 target_x, vector4f_arg1 target_y, vector4f_arg2 target_z,
+		vector4f_arg3 bend_direction_x, vector4f_arg4 bend_direction_y, vector4f_arg5 bend_direction_z) RTM_NO_EXCEPT
+	{
+		using namespace rtm_impl;
+
+		const ik_vector3_soa root = ik_get_position(chains, 0);
+		const ik_vector3_soa mid = ik_get_position(chains, 1);
+		const ik_vector3_soa tip = ik_get_position(chains, 2);
+		const ik_vector3_soa target{ target_x, target_y, target_z };
+		const ik_vector3_soa bend_direction{ bend_direction_x, bend_direction_y, bend_direction_z };
+
+		const vector4f one = vector_set(1.0F);
+		const vector4f epsilon_squared = vector_set(ik_epsilon_squared());
+
+		const ik_vector3_soa mid_offset = ik_sub(mid, root);
+		const ik_vector3_soa lower_offset = ik_sub(tip, mid);
+		const vector4f upper_length = vector_sqrt(ik_dot(mid_offset, mid_offset));
+		const vector4f lower_length = vector_sqrt(ik_dot(lower_offset, lower_offset));
+
+		// When the target sits on the root, we keep the current tip direction
+		const ik_vector3_soa root_to_target = ik_sub(target, root);
+		const ik_vector3_soa root_to_tip = ik_sub(tip, root);
+		const vector4f target_length_sq = ik_dot(root_to_target, root_to_target);
+		const vector4f target_length = vector_sqrt(target_length_sq);
+		const vector4f tip_length = vector_sqrt(vector_max(ik_dot(root_to_tip, root_to_tip), epsilon_squared));
+		const mask4f has_target_direction = vector_greater_equal(target_length_sq, epsilon_squared);
+		const ik_vector3_soa target_direction = ik_select(has_target_direction,
+			ik_mul(root_to_target, vector_div(one, vector_sqrt(vector_max(target_length_sq, epsilon_squared)))),
+			ik_mul(root_to_tip, vector_div(one, tip_length)));
+
+		// The chain cannot stretch further than its full length nor fold tighter than its bone length difference
+		const vector4f target_distance = vector_clamp(target_length, vector_abs(vector_sub(upper_length, lower_length)), vector_add(upper_length, lower_length));
+
+		// Law of cosines for the root angle
+		const vector4f cos_numerator = vector_neg_mul_sub(lower_length, lower_length, vector_mul_add(target_distance, target_distance, vector_mul(upper_length, upper_length)));
+		const vector4f cos_denominator = vector_max(vector_mul(vector_add(upper_length, upper_length), target_distance), vector_set(1.0E-12F));
+		const vector4f cos_root = vector_clamp(vector_div(cos_numerator, cos_denominator), vector_set(-1.0F), one);
+		const vector4f sin_root = vector_sqrt(vector_max(vector_neg_mul_sub(cos_root, cos_root, one), vector_zero()));
+
+		// The bend axis is the component of the bend direction perpendicular to the target direction
+		// When it is degenerate, we use the current bend and if the chain is straight, an arbitrary perpendicular axis
+		const ik_vector3_soa bend_perpendicular = ik_mul_add(target_direction, vector_neg(ik_dot(bend_direction, target_direction)), bend_direction);
+		const ik_vector3_soa mid_perpendicular = ik_mul_add(target_direction, vector_neg(ik_dot(mid_offset, target_direction)), mid_offset);
+
+		const mask4f is_x_larger = vector_greater_than(vector_abs(target_direction.x), vector_abs(target_direction.z));
+		const vector4f zero = vector_zero();
+		const ik_vector3_soa any_perpendicular{
+			vector_select(is_x_larger, vector_neg(target_direction.y), zero),
+			vector_select(is_x_larger, target_direction.x, vector_neg(target_direction.z)),
+			vector_select(is_x_larger, zero, target_direction.y) };
+
+		const vector4f bend_length_sq = ik_dot(bend_perpendicular, bend_perpendicular);
+		const vector4f mid_length_sq = ik_dot(mid_perpendicular, mid_perpendicular);
+		const vector4f any_length_sq = ik_dot(any_perpendicular, any_perpendicular);
+		const mask4f is_bend_valid = vector_greater_equal(bend_length_sq, epsilon_squared);
+		const mask4f is_mid_valid = vector_greater_equal(mid_length_sq, epsilon_squared);
+
+		const ik_vector3_soa bend_axis_unnormalized = ik_select(is_bend_valid, bend_perpendicular, ik_select(is_mid_valid, mid_perpendicular, any_perpendicular));
+		const vector4f bend_axis_length_sq = vector_select(is_bend_valid, bend_length_sq, vector_select(is_mid_valid, mid_length_sq, any_length_sq));
+		const ik_vector3_soa bend_axis = ik_mul(bend_axis_unnormalized, vector_div(one, vector_sqrt(bend_axis_length_sq)));
+
+		const ik_vector3_soa new_mid = ik_mul_add(ik_mul_add(bend_axis, sin_root, ik_mul(target_direction, cos_root)), upper_length, root);
+		const ik_vector3_soa new_tip = ik_mul_add(target_direction, target_distance, root);
+
+		// Rotating the upper bone carries the lower bone with it, we then align the lower bone
+		ik_rotate_chain(chains, 0, ik_quat_from_to(mid_offset, ik_sub(new_mid, root)));
+
+		const ik_vector3_soa rotated_mid = ik_get_position(chains, 1);
+		const ik_vector3_soa rotated_lower = ik_sub(ik_get_position(chains, 2), rotated_mid);
+		ik_rotate_chain(chains, 1, ik_quat_from_to(rotated_lower, ik_sub(new_tip, rotated_mid)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Performs one cyclic coordinate descent (CCD) iteration: every joint from the tip's
+	// parent down to the root is rotated to align the tip with the target.
+	// Joints where the tip or the target are located are skipped.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL ik_ccd_iteration(qvvf* chain, uint32_t num_joints, vector4f_arg0 target) RTM_NO_EXCEPT
+	{
+		const uint32_t tip_index = num_joints - 1;
+		for (uint32_t joint_index = tip_index; joint_index-- > 0;)
+		{
+			const vector4f joint_position = chain[joint_index].translation;
+			const vector4f joint_to_tip = vector_sub(chain[tip_index].translation, joint_position);
+			const vector4f joint_to_target = vector_sub(target, joint_position);
+
+			const float min_length_sq = scalar_min(float(vector_length_squared3(joint_to_tip)), float(vector_length_squared3(joint_to_target)));
+			if (min_length_sq < rtm_impl::ik_epsilon_squared())
+				continue;
+
+			rtm_impl::ik_rotate_chain(chain, joint_index, num_joints, quat_from_to(joint_to_tip, joint_to_target));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Solves a chain with a fixed number of cyclic coordinate descent (CCD) iterations.
+	// Iterations stop early once the tip is within the tolerance of the target.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL ik_ccd(qvvf* chain, uint32_t num_joints, vector4f_arg0 target, uint32_t num_iterations, float tolerance = 1.0E-4F) RTM_NO_EXCEPT
+	{
+		const vector4f& tip_position = chain[num_joints - 1].translation;
+		const float tolerance_sq = tolerance * tolerance;
+
+		for (uint32_t iteration = 0; iteration < num_iterations; ++iteration)
+		{
+			if (float(vector_length_squared3(vector_sub(target, tip_position))) <= tolerance_sq)
+				break;
+
+			ik_ccd_iteration(chain, num_joints, target);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SoA version of ik_ccd_iteration for four chains, each with its own target.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	inline void RTM_SIMD_CALL ik_ccd_iteration(ik_chain4f<num_joints>& chains, vector4f_arg0 target_x, vector4f_arg1 target_y, vector4f_arg2 target_z) RTM_NO_EXCEPT
+	{
+		using namespace rtm_impl;
+
+		const ik_vector3_soa target{ target_x, target_y, target_z };
+		const uint32_t tip_index = num_joints - 1;
+
+		for (uint32_t joint_index = tip_index; joint_index-- > 0;)
+		{
+			const ik_vector3_soa joint_position = ik_get_position(chains, joint_index);
+			const ik_vector3_soa joint_to_tip = ik_sub(ik_get_position(chains, tip_index), joint_position);
+			const ik_vector3_soa joint_to_target = ik_sub(target, joint_position);
+
+			ik_rotate_chain(chains, joint_index, ik_quat_from_to(joint_to_tip, joint_to_target));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SoA version of ik_ccd for four chains, each with its own target.
+	// All iterations are performed since the chains solve in lockstep.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	inline void RTM_SIMD_CALL ik_ccd(ik_chain4f<num_joints>& chains, vector4f_arg0 target_x, vector4f_arg1 target_y, vector4f_arg2 target_z, uint32_t num_iterations) RTM_NO_EXCEPT
+	{
+		for (uint32_t iteration = 0; iteration < num_iterations; ++iteration)
+			ik_ccd_iteration(chains, target_x, target_y, target_z);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Solves a chain with a fixed number of FABRIK iterations.
+	// Joint positions are solved first, joint rotations are then updated with the
+	// shortest arc between their old and new bone directions.
+	// The tip joint follows the rotation of its parent.
+	// See: FABRIK: A fast, iterative solver for the Inverse Kinematics problem (Aristidou and Lasenby, 2011)
+	//
+	// The original joint positions are needed to update the rotations once solved, the
+	// new positions are solved in the provided scratch buffers instead:
+	// 'positions' holds num_joints entries and 'bone_lengths' holds num_joints - 1 entries.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL ik_fabrik(qvvf* chain, uint32_t num_joints, vector4f_arg0 target, uint32_t num_iterations, vector4f* positions, float* bone_lengths) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_joints >= 2, "A chain requires at least 2 joints");
+
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+			positions[joint_index] = chain[joint_index].translation;
+
+		for (uint32_t joint_index = 0; joint_index < num_joints - 1; ++joint_index)
+			bone_lengths[joint_index] = vector_length3(vector_sub(positions[joint_index + 1], positions[joint_index]));
+
+		for (uint32_t iteration = 0; iteration < num_iterations; ++iteration)
+			rtm_impl::ik_fabrik_iteration(positions, bone_lengths, num_joints, target);
+
+		quatf delta = quat_identity();
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+		{
+			if (joint_index + 1 < num_joints)
+			{
+				const vector4f old_bone = vector_sub(chain[joint_index + 1].translation, chain[joint_index].translation);
+				const vector4f new_bone = vector_sub(positions[joint_index + 1], positions[joint_index]);
+				delta = quat_from_to(old_bone, new_bone);
+			}
+
+			chain[joint_index].rotation = quat_normalize(quat_mul(chain[joint_index].rotation, delta));
+		}
+
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+			chain[joint_index].translation = positions[joint_index];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SoA version of ik_fabrik for four chains, each with its own target.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	inline void RTM_SIMD_CALL ik_fabrik(ik_chain4f<num_joints>& chains, vector4f_arg0 target_x, vector4f_arg1 target_y, vector4f_arg2 target_z, uint32_t num_iterations) RTM_NO_EXCEPT
+	{
+		static_assert(num_joints >= 2, "A chain requires at least 2 joints");
+
+		using namespace rtm_impl;
+
+		ik_vector3_soa positions[num_joints];
+		vector4f bone_lengths[num_joints];
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+			positions[joint_index] = ik_get_position(chains, joint_index);
+
+		for (uint32_t joint_index = 0; joint_index < num_joints - 1; ++joint_index)
+		{
+			const ik_vector3_soa bone = ik_sub(positions[joint_index + 1], positions[joint_index]);
+			bone_lengths[joint_index] = vector_sqrt(ik_dot(bone, bone));
+		}
+		bone_lengths[num_joints - 1] = vector_zero();
+
+		const ik_vector3_soa target{ target_x, target_y, target_z };
+		for (uint32_t iteration = 0; iteration < num_iterations; ++iteration)
+			ik_fabrik_iteration(positions, bone_lengths, target);
+
+		ik_quat_soa delta{ vector_zero(), vector_zero(), vector_zero(), vector_set(1.0F) };
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+		{
+			if (joint_index + 1 < num_joints)
+			{
+				const ik_vector3_soa old_bone = ik_sub(ik_get_position(chains, joint_index + 1), ik_get_position(chains, joint_index));
+				const ik_vector3_soa new_bone = ik_sub(positions[joint_index + 1], positions[joint_index]);
+				delta = ik_quat_from_to(old_bone, new_bone);
+			}
+
+			// Only this joint rotates, its children are moved to their solved positions
+			ik_rotate_joint(chains, joint_index, delta);
+		}
+
+		for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+		{
+			chains.position_x[joint_index] = positions[joint_index].x;
+			chains.position_y[joint_index] = positions[joint_index].y;
+			chains.position_z[joint_index] = positions[joint_index].z;
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
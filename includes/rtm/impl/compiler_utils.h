@@ -85,6 +85,16 @@
 	#define RTM_FORCE_NOINLINE
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// The C++ version we compile with, e.g. 201402L for C++14.
+// MSVC only reports it properly in __cplusplus with /Zc:__cplusplus.
+//////////////////////////////////////////////////////////////////////////
+#if defined(_MSVC_LANG)
+	#define RTM_CPP_VERSION _MSVC_LANG
+#else
+	#define RTM_CPP_VERSION __cplusplus
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Joins two pre-processor tokens: RTM_JOIN_TOKENS(foo, bar) yields 'foobar'
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,209 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/impl/compiler_utils.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Runtime CPU dispatch is opt-in. When RTM_RUNTIME_DISPATCH is defined, the
+// bulk entry points (e.g. skin_positions(..)) detect the CPU features once and
+// route to kernels compiled for AVX2 and FMA when the host supports them,
+// regardless of the compilation flags. Single element functions are unaffected
+// and always use the instruction set selected at compile time.
+//
+// The dispatching entry points live in an inline namespace when dispatch is
+// enabled. Their mangled names then differ from the non-dispatching versions
+// and translation units compiled with and without RTM_RUNTIME_DISPATCH can be
+// linked together without violating the one definition rule.
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_RUNTIME_DISPATCH) && defined(RTM_DETERMINISTIC)
+	#error "RTM_DETERMINISTIC is incompatible with RTM_RUNTIME_DISPATCH, the dispatched kernels use FMA"
+#endif
+
+#if defined(RTM_RUNTIME_DISPATCH) && defined(RTM_SSE2_INTRINSICS) && (defined(RTM_COMPILER_MSVC) || defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG))
+	#define RTM_IMPL_DISPATCH_AVX2_FMA
+
+	#include <immintrin.h>
+
+	#if defined(RTM_COMPILER_MSVC)
+		#include <intrin.h>
+
+		// MSVC allows every intrinsic in any function
+		#define RTM_IMPL_TARGET_AVX2_FMA
+	#else
+		#include <cpuid.h>
+
+		// GCC and Clang require the target to be specified for functions using AVX2 and FMA intrinsics
+		#define RTM_IMPL_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+	#endif
+
+	#define RTM_IMPL_DISPATCH_NAMESPACE_BEGIN inline namespace rtm_dispatch_avx2_fma {
+	#define RTM_IMPL_DISPATCH_NAMESPACE_END }
+#else
+	#define RTM_IMPL_DISPATCH_NAMESPACE_BEGIN
+	#define RTM_IMPL_DISPATCH_NAMESPACE_END
+#endif
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		//////////////////////////////////////////////////////////////////////////
+		// The CPU features relevant to runtime dispatch.
+		//////////////////////////////////////////////////////////////////////////
+		struct cpu_features
+		{
+			bool sse3;
+			bool sse4;
+			bool avx;
+			bool avx2;
+			bool fma;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Queries the CPU and the OS for the supported features.
+		// Use get_cpu_features() instead, it caches the result.
+		//////////////////////////////////////////////////////////////////////////
+		inline cpu_features detect_cpu_features() RTM_NO_EXCEPT
+		{
+			uint32_t leaf1_ecx = 0;
+			uint32_t leaf7_ebx = 0;
+			uint64_t xcr0 = 0;
+
+#if defined(RTM_COMPILER_MSVC)
+			int registers[4];
+			__cpuid(registers, 0);
+			const int max_leaf = registers[0];
+
+			__cpuid(registers, 1);
+			leaf1_ecx = uint32_t(registers[2]);
+
+			if (max_leaf >= 7)
+			{
+				__cpuidex(registers, 7, 0);
+				leaf7_ebx = uint32_t(registers[1]);
+			}
+
+			// XGETBV is only valid when the OS has enabled it
+			if ((leaf1_ecx & (1U << 27)) != 0)
+				xcr0 = _xgetbv(0);
+#else
+			const unsigned int max_leaf = __get_cpuid_max(0, nullptr);
+
+			unsigned int eax;
+			unsigned int ebx;
+			unsigned int ecx;
+			unsigned int edx;
+			if (max_leaf >= 1)
+			{
+				__cpuid_count(1, 0, eax, ebx, ecx, edx);
+				leaf1_ecx = ecx;
+			}
+
+			if (max_leaf >= 7)
+			{
+				__cpuid_count(7, 0, eax, ebx, ecx, edx);
+				leaf7_ebx = ebx;
+			}
+
+			// XGETBV is only valid when the OS has enabled it
+			if ((leaf1_ecx & (1U << 27)) != 0)
+			{
+				uint32_t xcr0_lo;
+				uint32_t xcr0_hi;
+				__asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+				xcr0 = (uint64_t(xcr0_hi) << 32) | xcr0_lo;
+			}
+#endif
+
+			// The OS must save the XMM and YMM registers on context switches for AVX to be usable
+			const bool is_ymm_state_enabled = (xcr0 & 0x6) == 0x6;
+
+			cpu_features features;
+			features.sse3 = (leaf1_ecx & (1U << 0)) != 0;
+			features.sse4 = (leaf1_ecx & (1U << 19)) != 0;
+			features.avx = is_ymm_state_enabled && (leaf1_ecx & (1U << 28)) != 0;
+			features.avx2 = features.avx && (leaf7_ebx & (1U << 5)) != 0;
+			features.fma = features.avx && (leaf1_ecx & (1U << 12)) != 0;
+			return features;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the supported CPU features, they are detected on the first call only.
+		//////////////////////////////////////////////////////////////////////////
+		inline const cpu_features& get_cpu_features() RTM_NO_EXCEPT
+		{
+			static const cpu_features features = detect_cpu_features();
+			return features;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns whether or not the AVX2 and FMA kernels can run on this CPU.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool is_avx2_fma_supported() RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX2_INTRINSICS) && defined(RTM_FMA_INTRINSICS)
+			// Known at compile time
+			return true;
+#else
+			const cpu_features& features = get_cpu_features();
+			return features.avx2 && features.fma;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Combines two 128 bit vectors into a single 256 bit vector: [low, high]
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline __m256 combine_x2_avx2_fma(__m128 low, __m128 high) RTM_NO_EXCEPT
+		{
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes two 4x4 matrices at once, one in each 128 bit half of the rows.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline void transpose_4x4_x2_avx2_fma(__m256& row0, __m256& row1, __m256& row2, __m256& row3) RTM_NO_EXCEPT
+		{
+			const __m256 x0x1y0y1 = _mm256_unpacklo_ps(row0, row1);
+			const __m256 z0z1w0w1 = _mm256_unpackhi_ps(row0, row1);
+			const __m256 x2x3y2y3 = _mm256_unpacklo_ps(row2, row3);
+			const __m256 z2z3w2w3 = _mm256_unpackhi_ps(row2, row3);
+			row0 = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(1, 0, 1, 0));
+			row1 = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(3, 2, 3, 2));
+			row2 = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(1, 0, 1, 0));
+			row3 = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(3, 2, 3, 2));
+		}
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
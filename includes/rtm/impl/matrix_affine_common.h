@@ -24,6 +24,7 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "rtm/macros.h"
 #include "rtm/math.h"
 #include "rtm/vector4f.h"
 #include "rtm/vector4d.h"
@@ -146,6 +147,11 @@ namespace rtm
 
 		//////////////////////////////////////////////////////////////////////////
 		// Converts a 3x3 matrix into a rotation quaternion.
+		// The four candidate solutions (one per quaternion component that can be
+		// the largest) are computed in lanes and the most stable one is selected
+		// with masks without branching. Each candidate is equal to the quaternion
+		// scaled by four times its largest component. That scale is positive and it
+		// vanishes when we normalize which means we do not need its square root.
 		//////////////////////////////////////////////////////////////////////////
 		inline quatf RTM_SIMD_CALL quat_from_matrix(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis) RTM_NO_EXCEPT
 		{
@@ -153,65 +159,158 @@ namespace rtm
 			if (vector_all_near_equal3(x_axis, zero) || vector_all_near_equal3(y_axis, zero) || vector_all_near_equal3(z_axis, zero))
 				return quat_identity();	// Zero scale not supported, return the identity
 
-			const float x_axis_x = vector_get_x(x_axis);
-			const float y_axis_y = vector_get_y(y_axis);
-			const float z_axis_z = vector_get_z(z_axis);
-
-			const float mtx_trace = x_axis_x + y_axis_y + z_axis_z;
-			if (mtx_trace > 0.0F)
-			{
-				const float x_axis_y = vector_get_y(x_axis);
-				const float x_axis_z = vector_get_z(x_axis);
-
-				const float y_axis_x = vector_get_x(y_axis);
-				const float y_axis_z = vector_get_z(y_axis);
-
-				const float z_axis_x = vector_get_x(z_axis);
-				const float z_axis_y = vector_get_y(z_axis);
-
-				const float inv_trace = scalar_sqrt_reciprocal(mtx_trace + 1.0F);
-				const float half_inv_trace = inv_trace * 0.5F;
+			// [x_axis.x, y_axis.y, z_axis.z, z_axis.z]
+			const vector4f diagonal = vector_mix<mix4::x, mix4::y, mix4::c, mix4::c>(vector_mix<mix4::x, mix4::b, mix4::z, mix4::w>(x_axis, y_axis), z_axis);
+			const vector4f x_axis_x = vector_dup_x(diagonal);
+			const vector4f y_axis_y = vector_dup_y(diagonal);
+			const vector4f z_axis_z = vector_dup_z(diagonal);
+			const vector4f mtx_trace = vector_add(vector_add(x_axis_x, y_axis_y), z_axis_z);
+
+			// [1 + xx - yy - zz, 1 - xx + yy - zz, 1 - xx - yy + zz, 1 + xx + yy + zz]
+			vector4f traces = vector_mul_add(x_axis_x, vector_set(1.0F, -1.0F, -1.0F, 1.0F), vector_set(1.0F));
+			traces = vector_mul_add(y_axis_y, vector_set(-1.0F, 1.0F, -1.0F, 1.0F), traces);
+			traces = vector_mul_add(z_axis_z, vector_set(-1.0F, -1.0F, 1.0F, 1.0F), traces);
+
+			// [y_axis.z, z_axis.x, x_axis.y] and [z_axis.y, x_axis.z, y_axis.x]
+			const vector4f lhs = vector_mix<mix4::x, mix4::y, mix4::b, mix4::b>(vector_mix<mix4::z, mix4::a, mix4::z, mix4::a>(y_axis, z_axis), x_axis);
+			const vector4f rhs = vector_mix<mix4::x, mix4::y, mix4::a, mix4::a>(vector_mix<mix4::y, mix4::c, mix4::y, mix4::c>(z_axis, x_axis), y_axis);
+			const vector4f sums = vector_add(lhs, rhs);
+			const vector4f diffs = vector_sub(lhs, rhs);
+
+			const vector4f x_candidate = vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(vector_mix<mix4::x, mix4::c, mix4::b, mix4::b>(traces, sums), diffs);
+			const vector4f y_candidate = vector_mix<mix4::x, mix4::y, mix4::z, mix4::b>(vector_mix<mix4::c, mix4::y, mix4::a, mix4::a>(traces, sums), diffs);
+			const vector4f z_candidate = vector_mix<mix4::x, mix4::y, mix4::z, mix4::c>(vector_mix<mix4::b, mix4::a, mix4::z, mix4::z>(traces, sums), diffs);
+			const vector4f w_candidate = vector_mix<mix4::a, mix4::b, mix4::c, mix4::w>(traces, diffs);
+
+			// Same selection as the branching implementation: W when the trace is positive
+			// otherwise the component matching the largest diagonal entry
+			const mask4f is_w_best = vector_greater_than(mtx_trace, zero);
+			const mask4f is_z_best = vector_greater_than(z_axis_z, vector_max(x_axis_x, y_axis_y));
+			const mask4f is_y_best = vector_greater_than(y_axis_y, x_axis_x);
+
+			vector4f result = vector_select(is_y_best, y_candidate, x_candidate);
+			result = vector_select(is_z_best, z_candidate, result);
+			result = vector_select(is_w_best, w_candidate, result);
+
+			return quat_normalize(vector_to_quat(result));
+		}
 
-				const float x = (y_axis_z - z_axis_y) * half_inv_trace;
-				const float y = (z_axis_x - x_axis_z) * half_inv_trace;
-				const float z = (x_axis_y - y_axis_x) * half_inv_trace;
-				const float w = scalar_reciprocal(inv_trace) * 0.5F;
+		//////////////////////////////////////////////////////////////////////////
+		// Converts four 3x3 matrices in SoA form into four rotation quaternions in SoA form.
+		// See quat_from_matrix(..) above for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_from_matrix_soa(
+			vector4f_arg0 x_axis_x, vector4f_arg1 x_axis_y, vector4f_arg2 x_axis_z,
+			vector4f_arg3 y_axis_x, vector4f_arg4 y_axis_y, vector4f_arg5 y_axis_z,
+			vector4f_arg6 z_axis_x, vector4f_arg7 z_axis_y, vector4f_argn z_axis_z,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+
+			const vector4f mtx_trace = vector_add(vector_add(x_axis_x, y_axis_y), z_axis_z);
+			const vector4f x_trace = vector_sub(vector_sub(vector_add(one, x_axis_x), y_axis_y), z_axis_z);
+			const vector4f y_trace = vector_sub(vector_add(vector_sub(one, x_axis_x), y_axis_y), z_axis_z);
+			const vector4f z_trace = vector_add(vector_sub(vector_sub(one, x_axis_x), y_axis_y), z_axis_z);
+			const vector4f w_trace = vector_add(one, mtx_trace);
+
+			const vector4f sum_yz = vector_add(y_axis_z, z_axis_y);
+			const vector4f sum_zx = vector_add(z_axis_x, x_axis_z);
+			const vector4f sum_xy = vector_add(x_axis_y, y_axis_x);
+			const vector4f diff_yz = vector_sub(y_axis_z, z_axis_y);
+			const vector4f diff_zx = vector_sub(z_axis_x, x_axis_z);
+			const vector4f diff_xy = vector_sub(x_axis_y, y_axis_x);
+
+			const mask4f is_w_best = vector_greater_than(mtx_trace, zero);
+			const mask4f is_z_best = vector_greater_than(z_axis_z, vector_max(x_axis_x, y_axis_y));
+			const mask4f is_y_best = vector_greater_than(y_axis_y, x_axis_x);
+
+			vector4f x = vector_select(is_y_best, sum_xy, x_trace);
+			vector4f y = vector_select(is_y_best, y_trace, sum_xy);
+			vector4f z = vector_select(is_y_best, sum_yz, sum_zx);
+			vector4f w = vector_select(is_y_best, diff_zx, diff_yz);
+
+			x = vector_select(is_z_best, sum_zx, x);
+			y = vector_select(is_z_best, sum_yz, y);
+			z = vector_select(is_z_best, z_trace, z);
+			w = vector_select(is_z_best, diff_xy, w);
+
+			x = vector_select(is_w_best, diff_yz, x);
+			y = vector_select(is_w_best, diff_zx, y);
+			z = vector_select(is_w_best, diff_xy, z);
+			w = vector_select(is_w_best, w_trace, w);
+
+			// Zero scale is not supported, return the identity
+			const vector4f x_axis_max = vector_max(vector_max(vector_abs(x_axis_x), vector_abs(x_axis_y)), vector_abs(x_axis_z));
+			const vector4f y_axis_max = vector_max(vector_max(vector_abs(y_axis_x), vector_abs(y_axis_y)), vector_abs(y_axis_z));
+			const vector4f z_axis_max = vector_max(vector_max(vector_abs(z_axis_x), vector_abs(z_axis_y)), vector_abs(z_axis_z));
+			const mask4f is_zero_scale = vector_less_equal(vector_min(vector_min(x_axis_max, y_axis_max), z_axis_max), vector_set(0.00001F));
+
+			x = vector_select(is_zero_scale, zero, x);
+			y = vector_select(is_zero_scale, zero, y);
+			z = vector_select(is_zero_scale, zero, z);
+			w = vector_select(is_zero_scale, one, w);
+
+			const vector4f len_sq = vector_add(vector_add(vector_mul(x, x), vector_mul(y, y)), vector_add(vector_mul(z, z), vector_mul(w, w)));
+			const vector4f inv_len = vector_div(one, vector_sqrt(len_sq));
+
+			out_x = vector_mul(x, inv_len);
+			out_y = vector_mul(y, inv_len);
+			out_z = vector_mul(z, inv_len);
+			out_w = vector_mul(w, inv_len);
+		}
 
-				return quat_normalize(quat_set(x, y, z, w));
-			}
-			else
+		//////////////////////////////////////////////////////////////////////////
+		// Converts an array of 3x3 or 3x4 matrices into rotation quaternions, four at a time.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename matrix_type>
+		inline void quat_from_matrices(const matrix_type* matrices, uint32_t num_matrices, quatf* out_rotations) RTM_NO_EXCEPT
+		{
+			uint32_t matrix_index = 0;
+			for (; matrix_index + 4 <= num_matrices; matrix_index += 4)
 			{
-				// Note that axis3::xyz have the same values as mix4::xyz
-				int32_t best_axis = (int32_t)axis4::x;
-				if (y_axis_y > x_axis_x)
-					best_axis = (int32_t)axis4::y;
-				if (z_axis_z > vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(best_axis)), mix4(best_axis)))
-					best_axis = (int32_t)axis4::z;
-
-				const int32_t next_best_axis = (best_axis + 1) % 3;
-				const int32_t next_next_best_axis = (next_best_axis + 1) % 3;
-
-				const float mtx_pseudo_trace = 1.0F +
-					vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(best_axis)), mix4(best_axis)) -
-					vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_best_axis)), mix4(next_best_axis)) -
-					vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_next_best_axis)), mix4(next_next_best_axis));
-
-				const float inv_pseudo_trace = scalar_sqrt_reciprocal(mtx_pseudo_trace);
-				const float half_inv_pseudo_trace = inv_pseudo_trace * 0.5F;
-
-				float quat_values[4];
-				quat_values[best_axis] = scalar_reciprocal(inv_pseudo_trace) * 0.5F;
-				quat_values[next_best_axis] = half_inv_pseudo_trace *
-					(vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(best_axis)), mix4(next_best_axis)) +
-						vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_best_axis)), mix4(best_axis)));
-				quat_values[next_next_best_axis] = half_inv_pseudo_trace *
-					(vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(best_axis)), mix4(next_next_best_axis)) +
-						vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_next_best_axis)), mix4(best_axis)));
-				quat_values[3] = half_inv_pseudo_trace *
-					(vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_best_axis)), mix4(next_next_best_axis)) -
-						vector_get_component(matrix_get_axis(x_axis, y_axis, z_axis, axis3(next_next_best_axis)), mix4(next_best_axis)));
+				const matrix_type& matrix0 = matrices[matrix_index + 0];
+				const matrix_type& matrix1 = matrices[matrix_index + 1];
+				const matrix_type& matrix2 = matrices[matrix_index + 2];
+				const matrix_type& matrix3 = matrices[matrix_index + 3];
+
+				vector4f x_axis_x;
+				vector4f x_axis_y;
+				vector4f x_axis_z;
+				RTM_MATRIXF_TRANSPOSE_4X3(matrix0.x_axis, matrix1.x_axis, matrix2.x_axis, matrix3.x_axis, x_axis_x, x_axis_y, x_axis_z);
+
+				vector4f y_axis_x;
+				vector4f y_axis_y;
+				vector4f y_axis_z;
+				RTM_MATRIXF_TRANSPOSE_4X3(matrix0.y_axis, matrix1.y_axis, matrix2.y_axis, matrix3.y_axis, y_axis_x, y_axis_y, y_axis_z);
+
+				vector4f z_axis_x;
+				vector4f z_axis_y;
+				vector4f z_axis_z;
+				RTM_MATRIXF_TRANSPOSE_4X3(matrix0.z_axis, matrix1.z_axis, matrix2.z_axis, matrix3.z_axis, z_axis_x, z_axis_y, z_axis_z);
+
+				vector4f quat_x;
+				vector4f quat_y;
+				vector4f quat_z;
+				vector4f quat_w;
+				quat_from_matrix_soa(x_axis_x, x_axis_y, x_axis_z, y_axis_x, y_axis_y, y_axis_z, z_axis_x, z_axis_y, z_axis_z, quat_x, quat_y, quat_z, quat_w);
+
+				vector4f rotation0;
+				vector4f rotation1;
+				vector4f rotation2;
+				vector4f rotation3;
+				RTM_MATRIXF_TRANSPOSE_4X4(quat_x, quat_y, quat_z, quat_w, rotation0, rotation1, rotation2, rotation3);
+
+				out_rotations[matrix_index + 0] = vector_to_quat(rotation0);
+				out_rotations[matrix_index + 1] = vector_to_quat(rotation1);
+				out_rotations[matrix_index + 2] = vector_to_quat(rotation2);
+				out_rotations[matrix_index + 3] = vector_to_quat(rotation3);
+			}
 
-				return quat_normalize(quat_load(&quat_values[0]));
+			for (; matrix_index < num_matrices; ++matrix_index)
+			{
+				const matrix_type& matrix = matrices[matrix_index];
+				out_rotations[matrix_index] = quat_from_matrix(matrix.x_axis, matrix.y_axis, matrix.z_axis);
 			}
 		}
 
@@ -66,6 +66,11 @@ namespace rtm
 			{
 				return qvv_set(quat_identity(), vector_zero(), vector_set(1.0F));
 			}
+
+			inline RTM_SIMD_CALL operator qvvm() const RTM_NO_EXCEPT
+			{
+				return qvvm{ quat_identity(), vector_zero(), vector_set(1.0F) };
+			}
 		};
 	}
 
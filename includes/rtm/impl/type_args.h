@@ -88,6 +88,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	// With __vectorcall, vector aggregates are also passed by register and they can use up to 4 registers.
 
 	using qvvf_arg0 = const qvvf;
@@ -105,6 +115,30 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f;
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf;
+	using aabbf_arg1 = const aabbf;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf;
+	using obbf_arg1 = const obbf;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf;
+	using rayf_arg1 = const rayf;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef;
+	using planef_arg1 = const planef;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef;
+	using linef_arg1 = const linef;
+	using linef_argn = const linef&;
 #elif defined(RTM_NEON64_INTRINSICS)
 	// On ARM64 NEON, the first 8x vector4f/quatf arguments can be passed by value in a register,
 	// everything else afterwards is passed by const&. They can also be returned by register.
@@ -159,6 +193,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// With ARM64 NEON, vector aggregates are also passed by register but the whole aggregate
 	// must fit in the number of registers available (e.g. we can pass 2x qvvf but not 3x).
 	// A qvvf can also be returned by register.
@@ -178,6 +222,30 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f;
 	using matrix4x4f_arg1 = const matrix4x4f;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf;
+	using aabbf_arg1 = const aabbf;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf;
+	using obbf_arg1 = const obbf;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf;
+	using rayf_arg1 = const rayf;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef;
+	using planef_arg1 = const planef;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef;
+	using linef_arg1 = const linef;
+	using linef_argn = const linef&;
 #elif defined(RTM_NEON_INTRINSICS)
 	// On ARM NEON, the first 4x vector4f/quatf arguments can be passed by value in a register,
 	// everything else afterwards is passed by const&. They can also be returned by register.
@@ -232,6 +300,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i&;
+	using vector4i_arg5 = const vector4i&;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	// ARM NEON does not support passing aggregates by register.
 
 	using qvvf_arg0 = const qvvf&;
@@ -249,6 +327,30 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f&;
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref&;
+	using spheref_arg1 = const spheref&;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf&;
+	using obbf_arg1 = const obbf&;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf&;
+	using rayf_arg1 = const rayf&;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef&;
+	using planef_arg1 = const planef&;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef&;
+	using linef_arg1 = const linef&;
+	using linef_argn = const linef&;
 #elif defined(__x86_64__) && defined(RTM_COMPILER_GCC)
 	// On x64 with gcc, the first 8x vector4f/quatf arguments can be passed by value in a register,
 	// everything else afterwards is passed by const&. They can also be returned by register.
@@ -303,6 +405,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// gcc does not appear to support passing and returning aggregates by register
 
 	using qvvf_arg0 = const qvvf&;
@@ -320,6 +432,30 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f&;
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref&;
+	using spheref_arg1 = const spheref&;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf&;
+	using obbf_arg1 = const obbf&;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf&;
+	using rayf_arg1 = const rayf&;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef&;
+	using planef_arg1 = const planef&;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef&;
+	using linef_arg1 = const linef&;
+	using linef_argn = const linef&;
 #elif defined(__x86_64__) && defined(RTM_COMPILER_CLANG)
 	// On x64 with clang, the first 8x vector4f/quatf arguments can be passed by value in a register,
 	// everything else afterwards is passed by const&. They can also be returned by register.
@@ -374,6 +510,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// We could pass up to 2 full qvvf types by register and the rotation/translation of
 	// the third but aggregates are not returned by register.
 	// TODO: Measure the impact of this because it could potentially degrade performance
@@ -396,6 +542,30 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f&;
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref&;
+	using spheref_arg1 = const spheref&;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf&;
+	using obbf_arg1 = const obbf&;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf&;
+	using rayf_arg1 = const rayf&;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef&;
+	using planef_arg1 = const planef&;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef&;
+	using linef_arg1 = const linef&;
+	using linef_argn = const linef&;
 #else
 	// On every other platform, everything is passed by const&
 	using vector4f_arg0 = const vector4f&;
@@ -448,6 +618,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i&;
+	using vector4i_arg1 = const vector4i&;
+	using vector4i_arg2 = const vector4i&;
+	using vector4i_arg3 = const vector4i&;
+	using vector4i_arg4 = const vector4i&;
+	using vector4i_arg5 = const vector4i&;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	using qvvf_arg0 = const qvvf&;
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
@@ -463,5 +643,29 @@ namespace rtm
 	using matrix4x4f_arg0 = const matrix4x4f&;
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref&;
+	using spheref_arg1 = const spheref&;
+	using spheref_argn = const spheref&;
+
+	using obbf_arg0 = const obbf&;
+	using obbf_arg1 = const obbf&;
+	using obbf_argn = const obbf&;
+
+	using rayf_arg0 = const rayf&;
+	using rayf_arg1 = const rayf&;
+	using rayf_argn = const rayf&;
+
+	using planef_arg0 = const planef&;
+	using planef_arg1 = const planef&;
+	using planef_argn = const planef&;
+
+	using linef_arg0 = const linef&;
+	using linef_arg1 = const linef&;
+	using linef_argn = const linef&;
 #endif
 }
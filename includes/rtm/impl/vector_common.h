@@ -202,6 +202,74 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		constexpr bool is_mix_abcd(mix4 arg) RTM_NO_EXCEPT { return uint32_t(arg) >= uint32_t(mix4::a); }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the lane index [0, 3] that a mix4 component reads from
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t get_mix_lane(mix4 arg) RTM_NO_EXCEPT { return uint32_t(arg) % 4; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if every mix4 component reads from the same lane it writes to
+		// e.g. [x, b, c, w] can be performed with a single blend
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool is_mix_in_place(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3) RTM_NO_EXCEPT
+		{
+			return get_mix_lane(comp0) == 0 && get_mix_lane(comp1) == 1 && get_mix_lane(comp2) == 2 && get_mix_lane(comp3) == 3;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if every mix4 component that reads from [abcd] reads from the same lane it writes to
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool is_mix_abcd_in_place(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3) RTM_NO_EXCEPT
+		{
+			return (is_mix_xyzw(comp0) || comp0 == mix4::a) && (is_mix_xyzw(comp1) || comp1 == mix4::b) && (is_mix_xyzw(comp2) || comp2 == mix4::c) && (is_mix_xyzw(comp3) || comp3 == mix4::d);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if every mix4 component that reads from [xyzw] reads from the same lane it writes to
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool is_mix_xyzw_in_place(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3) RTM_NO_EXCEPT
+		{
+			return (is_mix_abcd(comp0) || comp0 == mix4::x) && (is_mix_abcd(comp1) || comp1 == mix4::y) && (is_mix_abcd(comp2) || comp2 == mix4::z) && (is_mix_abcd(comp3) || comp3 == mix4::w);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the blend mask with a bit set for every mix4 component that reads from [abcd]
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int get_mix_blend_mask(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3) RTM_NO_EXCEPT
+		{
+			return (is_mix_abcd(comp0) ? 1 : 0) | (is_mix_abcd(comp1) ? 2 : 0) | (is_mix_abcd(comp2) ? 4 : 0) | (is_mix_abcd(comp3) ? 8 : 0);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of mix4 components that match the provided ones, used to
+		// detect a mix that only differs from an input by a single lane
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t get_mix_num_matching(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3, mix4 ref0, mix4 ref1, mix4 ref2, mix4 ref3) RTM_NO_EXCEPT
+		{
+			return (comp0 == ref0 ? 1 : 0) + (comp1 == ref1 ? 1 : 0) + (comp2 == ref2 ? 1 : 0) + (comp3 == ref3 ? 1 : 0);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the mix4 component that reads from the provided position [0, 7] when two
+		// sources are concatenated. Each source is either input 0 or input 1.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t get_mix_concat_component(uint32_t position, bool is_first_input0, bool is_second_input0) RTM_NO_EXCEPT
+		{
+			return position < 4 ? ((is_first_input0 ? 0 : 4) + position) : ((is_second_input0 ? 0 : 4) + position - 4);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the mix4 components read the provided positions of two concatenated sources.
+		// This is used to match the fixed permutations some instructions perform (e.g. zip, unzip, extract).
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool is_mix_concat_permutation(mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3, uint32_t position0, uint32_t position1, uint32_t position2, uint32_t position3, bool is_first_input0, bool is_second_input0) RTM_NO_EXCEPT
+		{
+			return uint32_t(comp0) == get_mix_concat_component(position0, is_first_input0, is_second_input0)
+				&& uint32_t(comp1) == get_mix_concat_component(position1, is_first_input0, is_second_input0)
+				&& uint32_t(comp2) == get_mix_concat_component(position2, is_first_input0, is_second_input0)
+				&& uint32_t(comp3) == get_mix_concat_component(position3, is_first_input0, is_second_input0);
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to help manipulate SIMD masks.
 		//////////////////////////////////////////////////////////////////////////
@@ -240,6 +308,69 @@ namespace rtm
 			return mask == 0 ? if_false : if_true;
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a SIMD mask lane value from a boolean: ~0 if true, 0 otherwise.
+		// Unlike get_mask_value, this form is recognized by auto-vectorizers.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lane_type>
+		constexpr lane_type get_mask_lane(bool is_true) RTM_NO_EXCEPT
+		{
+			return lane_type(0) - lane_type(is_true);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Aligned storage for the 4 lanes of a vector, quaternion, or mask.
+		// The scalar code paths copy their inputs into lanes and express their
+		// operations as loops over them. Such loops are reliably auto-vectorized
+		// by GCC and Clang on targets without a dedicated code path (e.g. RISC-V
+		// or when RTM_NO_INTRINSICS is defined) while field by field code isn't.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lane_type>
+		struct alignas(16) vector_lanes
+		{
+			lane_type values[4];
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reinterprets the bits of a lane value as another type of the same size.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename dst_type, typename src_type>
+		RTM_FORCE_INLINE dst_type bit_cast_lane(src_type input) RTM_NO_EXCEPT
+		{
+			static_assert(sizeof(dst_type) == sizeof(src_type), "Lane types must have the same size");
+
+			dst_type result;
+			std::memcpy(&result, &input, sizeof(dst_type));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Copies the [xyzw] components of the input into lanes.
+		// Each component is copied individually, copying the whole input with memcpy
+		// would force it into memory and prevent it from staying in registers.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lane_type, typename input_type>
+		RTM_FORCE_INLINE vector_lanes<lane_type> to_lanes(const input_type& input) RTM_NO_EXCEPT
+		{
+			return vector_lanes<lane_type>{ { bit_cast_lane<lane_type>(input.x), bit_cast_lane<lane_type>(input.y), bit_cast_lane<lane_type>(input.z), bit_cast_lane<lane_type>(input.w) } };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Copies the lanes into the [xyzw] components of the output.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename output_type, typename lane_type>
+		RTM_FORCE_INLINE output_type from_lanes(const vector_lanes<lane_type>& input) RTM_NO_EXCEPT
+		{
+			using component_type = decltype(output_type::x);
+
+			output_type result;
+			result.x = bit_cast_lane<component_type>(input.values[0]);
+			result.y = bit_cast_lane<component_type>(input.values[1]);
+			result.z = bit_cast_lane<component_type>(input.values[2]);
+			result.w = bit_cast_lane<component_type>(input.values[3]);
+			return result;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to allow a single consistent API between
 		// various vector types when the semantics are identical but the return
@@ -0,0 +1,98 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/planef.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a line from a point on it and its direction.
+	//////////////////////////////////////////////////////////////////////////
+	inline linef RTM_SIMD_CALL line_set(vector4f_arg0 origin, vector4f_arg1 direction) RTM_NO_EXCEPT
+	{
+		return linef{ origin, direction };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a line that passes through both points.
+	// The origin is the first point and the direction goes towards the second point.
+	//////////////////////////////////////////////////////////////////////////
+	inline linef RTM_SIMD_CALL line_from_points(vector4f_arg0 point0, vector4f_arg1 point1) RTM_NO_EXCEPT
+	{
+		return linef{ point0, vector_sub(point1, point0) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point along the line at the provided distance: origin + direction * t
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL line_get_point(linef_arg0 line, float t) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(line.direction, t, line.origin);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the closest point on the line to the provided point.
+	// The line direction must not be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL line_project_point(linef_arg0 line, vector4f_arg2 point) RTM_NO_EXCEPT
+	{
+		const float projection = vector_dot3(vector_sub(point, line.origin), line.direction);
+		const float direction_length_sq = vector_length_squared3(line.direction);
+		return line_get_point(line, projection / direction_length_sq);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the distance between the point and the closest point on the line.
+	// The line direction must not be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL line_distance_point(linef_arg0 line, vector4f_arg2 point) RTM_NO_EXCEPT
+	{
+		return vector_distance3(point, line_project_point(line, point));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the line intersects the plane and writes the distance along the
+	// line of the intersection point. Lines parallel to the plane never intersect.
+	// Note: The output distance is left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL line_intersect_plane(linef_arg0 line, planef_arg1 plane, float& out_t) RTM_NO_EXCEPT
+	{
+		const float direction_projection = vector_dot3(plane.normal_distance, line.direction);
+		if (direction_projection == 0.0F)
+			return false;
+
+		out_t = -plane_distance_point(plane, line.origin) / direction_projection;
+		return true;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
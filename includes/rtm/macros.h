@@ -0,0 +1,106 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+
+//////////////////////////////////////////////////////////////////////////
+// This file contains helper macros that operate on several registers at once.
+// Macros are used because they can write to multiple outputs without having
+// to return an aggregate.
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Transposes a 4x4 block of floats stored as 4 row vectors into 4 column vectors.
+// This is typically used to convert 4 AoS entries into SoA form and back.
+// e.g. [x0 y0 z0 w0], [x1 y1 z1 w1], ... becomes [x0 x1 x2 x3], [y0 y1 y2 y3], ...
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_SSE2_INTRINSICS)
+	#define RTM_MATRIXF_TRANSPOSE_4X4(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz, output_wwww) \
+		do { \
+			const __m128 rtm_x0x1y0y1 = _mm_unpacklo_ps(input_xyzw0, input_xyzw1); \
+			const __m128 rtm_z0z1w0w1 = _mm_unpackhi_ps(input_xyzw0, input_xyzw1); \
+			const __m128 rtm_x2x3y2y3 = _mm_unpacklo_ps(input_xyzw2, input_xyzw3); \
+			const __m128 rtm_z2z3w2w3 = _mm_unpackhi_ps(input_xyzw2, input_xyzw3); \
+			output_xxxx = _mm_movelh_ps(rtm_x0x1y0y1, rtm_x2x3y2y3); \
+			output_yyyy = _mm_movehl_ps(rtm_x2x3y2y3, rtm_x0x1y0y1); \
+			output_zzzz = _mm_movelh_ps(rtm_z0z1w0w1, rtm_z2z3w2w3); \
+			output_wwww = _mm_movehl_ps(rtm_z2z3w2w3, rtm_z0z1w0w1); \
+		} while(0)
+#elif defined(RTM_NEON_INTRINSICS)
+	#define RTM_MATRIXF_TRANSPOSE_4X4(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz, output_wwww) \
+		do { \
+			const float32x4x2_t rtm_x0x1y0y1_z0z1w0w1 = vzipq_f32(input_xyzw0, input_xyzw1); \
+			const float32x4x2_t rtm_x2x3y2y3_z2z3w2w3 = vzipq_f32(input_xyzw2, input_xyzw3); \
+			output_xxxx = vcombine_f32(vget_low_f32(rtm_x0x1y0y1_z0z1w0w1.val[0]), vget_low_f32(rtm_x2x3y2y3_z2z3w2w3.val[0])); \
+			output_yyyy = vcombine_f32(vget_high_f32(rtm_x0x1y0y1_z0z1w0w1.val[0]), vget_high_f32(rtm_x2x3y2y3_z2z3w2w3.val[0])); \
+			output_zzzz = vcombine_f32(vget_low_f32(rtm_x0x1y0y1_z0z1w0w1.val[1]), vget_low_f32(rtm_x2x3y2y3_z2z3w2w3.val[1])); \
+			output_wwww = vcombine_f32(vget_high_f32(rtm_x0x1y0y1_z0z1w0w1.val[1]), vget_high_f32(rtm_x2x3y2y3_z2z3w2w3.val[1])); \
+		} while(0)
+#else
+	#define RTM_MATRIXF_TRANSPOSE_4X4(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz, output_wwww) \
+		do { \
+			const rtm::vector4f rtm_x0y0x1y1 = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::a, rtm::mix4::b>(input_xyzw0, input_xyzw1); \
+			const rtm::vector4f rtm_z0w0z1w1 = rtm::vector_mix<rtm::mix4::z, rtm::mix4::w, rtm::mix4::c, rtm::mix4::d>(input_xyzw0, input_xyzw1); \
+			const rtm::vector4f rtm_x2y2x3y3 = rtm::vector_mix<rtm::mix4::x, rtm::mix4::y, rtm::mix4::a, rtm::mix4::b>(input_xyzw2, input_xyzw3); \
+			const rtm::vector4f rtm_z2w2z3w3 = rtm::vector_mix<rtm::mix4::z, rtm::mix4::w, rtm::mix4::c, rtm::mix4::d>(input_xyzw2, input_xyzw3); \
+			output_xxxx = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::a, rtm::mix4::c>(rtm_x0y0x1y1, rtm_x2y2x3y3); \
+			output_yyyy = rtm::vector_mix<rtm::mix4::y, rtm::mix4::w, rtm::mix4::b, rtm::mix4::d>(rtm_x0y0x1y1, rtm_x2y2x3y3); \
+			output_zzzz = rtm::vector_mix<rtm::mix4::x, rtm::mix4::z, rtm::mix4::a, rtm::mix4::c>(rtm_z0w0z1w1, rtm_z2w2z3w3); \
+			output_wwww = rtm::vector_mix<rtm::mix4::y, rtm::mix4::w, rtm::mix4::b, rtm::mix4::d>(rtm_z0w0z1w1, rtm_z2w2z3w3); \
+		} while(0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Transposes 4 row vectors into 3 column vectors, the [w] components are discarded.
+// e.g. [x0 y0 z0 w0], [x1 y1 z1 w1], ... becomes [x0 x1 x2 x3], [y0 y1 y2 y3], [z0 z1 z2 z3]
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_SSE2_INTRINSICS)
+	#define RTM_MATRIXF_TRANSPOSE_4X3(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz) \
+		do { \
+			const __m128 rtm_x0x1y0y1 = _mm_unpacklo_ps(input_xyzw0, input_xyzw1); \
+			const __m128 rtm_z0z1w0w1 = _mm_unpackhi_ps(input_xyzw0, input_xyzw1); \
+			const __m128 rtm_x2x3y2y3 = _mm_unpacklo_ps(input_xyzw2, input_xyzw3); \
+			const __m128 rtm_z2z3w2w3 = _mm_unpackhi_ps(input_xyzw2, input_xyzw3); \
+			output_xxxx = _mm_movelh_ps(rtm_x0x1y0y1, rtm_x2x3y2y3); \
+			output_yyyy = _mm_movehl_ps(rtm_x2x3y2y3, rtm_x0x1y0y1); \
+			output_zzzz = _mm_movelh_ps(rtm_z0z1w0w1, rtm_z2z3w2w3); \
+		} while(0)
+#else
+	#define RTM_MATRIXF_TRANSPOSE_4X3(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz) \
+		do { \
+			rtm::vector4f rtm_wwww; \
+			RTM_MATRIXF_TRANSPOSE_4X4(input_xyzw0, input_xyzw1, input_xyzw2, input_xyzw3, output_xxxx, output_yyyy, output_zzzz, rtm_wwww); \
+			(void)rtm_wwww; \
+		} while(0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Transposes 3 column vectors into 4 row vectors, the [w] components of the outputs are undefined.
+// e.g. [x0 x1 x2 x3], [y0 y1 y2 y3], [z0 z1 z2 z3] becomes [x0 y0 z0 ?], [x1 y1 z1 ?], ...
+//////////////////////////////////////////////////////////////////////////
+#define RTM_MATRIXF_TRANSPOSE_3X4(input_xxxx, input_yyyy, input_zzzz, output_xyzw0, output_xyzw1, output_xyzw2, output_xyzw3) \
+	RTM_MATRIXF_TRANSPOSE_4X4(input_xxxx, input_yyyy, input_zzzz, input_zzzz, output_xyzw0, output_xyzw1, output_xyzw2, output_xyzw3)
@@ -88,6 +88,30 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a 4 bit integer where each bit is set when the matching component is true.
+	// The [x] component maps to the least significant bit.
+	// This is useful to compact the results of 4 tests at once.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(mask4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return static_cast<uint32_t>(_mm_movemask_ps(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		alignas(16) static constexpr uint32_t bit_values[4] = { 1, 2, 4, 8 };
+		const uint32x4_t bits = vandq_u32(vreinterpretq_u32_f32(input), vld1q_u32(&bit_values[0]));
+#if defined(RTM_NEON64_INTRINSICS)
+		return vaddvq_u32(bits);
+#else
+		uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+		sum = vpadd_u32(sum, sum);
+		return vget_lane_u32(sum, 0);
+#endif
+#else
+		return (input.x != 0 ? 1U : 0U) | (input.y != 0 ? 2U : 0U) | (input.z != 0 ? 4U : 0U) | (input.w != 0 ? 8U : 0U);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if all 4 components are true, otherwise false: all(input != 0)
 	//////////////////////////////////////////////////////////////////////////
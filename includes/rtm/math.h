@@ -35,6 +35,11 @@
 		#define RTM_FMA_INTRINSICS
 	#endif
 
+	// BMI2 is independent from AVX2 and only available when explicitly enabled (e.g. -mbmi2 or -march=haswell)
+	#if defined(__BMI2__)
+		#define RTM_BMI2_INTRINSICS
+	#endif
+
 	#if defined(__AVX__)
 		#define RTM_AVX_INTRINSICS
 		#define RTM_SSE4_INTRINSICS
@@ -71,6 +76,31 @@
 	#endif
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// When RTM_DETERMINISTIC is defined, every function produces bit identical
+// results on all supported platforms. Estimate instructions and fused
+// multiply-add are not used and the evaluation order is identical everywhere.
+// See docs/simd_support.md for details.
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_DETERMINISTIC)
+	#if defined(__FAST_MATH__) || defined(_M_FP_FAST)
+		#error "RTM_DETERMINISTIC requires IEEE-754 compliant floating point arithmetic, fast math must be disabled"
+	#endif
+
+	// ARMv7 NEON always flushes denormals to zero, use the scalar implementation instead
+	#if defined(RTM_NEON_INTRINSICS) && !defined(RTM_NEON64_INTRINSICS)
+		#undef RTM_NEON_INTRINSICS
+		#define RTM_NO_INTRINSICS
+	#endif
+
+	#include <cfloat>
+
+	// Intermediate values must be rounded to float, this isn't the case with x87 arithmetic
+	#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+		#error "RTM_DETERMINISTIC requires FLT_EVAL_METHOD == 0, compile with SSE2 when targeting x86"
+	#endif
+#endif
+
 #if defined(RTM_SSE2_INTRINSICS)
 	#include <xmmintrin.h>
 	#include <emmintrin.h>
@@ -92,7 +122,7 @@
 	#include <smmintrin.h>
 #endif
 
-#if defined(RTM_AVX_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS) || defined(RTM_BMI2_INTRINSICS)
 	#include <immintrin.h>
 #endif
 
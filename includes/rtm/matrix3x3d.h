@@ -380,6 +380,158 @@ namespace rtm
 		result.z_axis = vector_normalize3(input.z_axis, input.z_axis);
 		return result;
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates a diagonal inertia tensor (or its inverse) expressed in the principal axes
+	// of a body into world space: matrix_mul(matrix_mul(matrix_transpose(R), diagonal), R)
+	// where R is the rotation matrix of the body. The diagonal is stored in [xyz].
+	// The result is symmetric and only the rotated axes are needed, the rows are
+	// built from them directly without any matrix multiplication or transpose.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3d matrix_rotate_inertia(const quatd& rotation, const vector4d& diagonal) RTM_NO_EXCEPT
+	{
+		const matrix3x3d rotation_mtx = matrix_from_quat(rotation);
+
+		// Each rotated axis scaled by its principal moment
+		const vector4d scaled_x_axis = vector_mul(rotation_mtx.x_axis, vector_dup_x(diagonal));
+		const vector4d scaled_y_axis = vector_mul(rotation_mtx.y_axis, vector_dup_y(diagonal));
+		const vector4d scaled_z_axis = vector_mul(rotation_mtx.z_axis, vector_dup_z(diagonal));
+
+		// result[i] = sum_k rotation_mtx[k][i] * scaled_axis[k]
+		vector4d tmp = vector_mul(vector_dup_x(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_x(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_x(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4d x_axis = tmp;
+
+		tmp = vector_mul(vector_dup_y(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_y(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_y(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4d y_axis = tmp;
+
+		tmp = vector_mul(vector_dup_z(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_z(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_z(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4d z_axis = tmp;
+
+		return matrix3x3d{ x_axis, y_axis, z_axis };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates four diagonal inertia tensors in SoA form, see matrix_rotate_inertia(..).
+		// Only the 6 unique values of the symmetric results are computed.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_rotate_inertia_soa(
+			const vector4d& quat_x, const vector4d& quat_y, const vector4d& quat_z, const vector4d& quat_w,
+			const vector4d& diagonal_x, const vector4d& diagonal_y, const vector4d& diagonal_z,
+			vector4d& out_xx, vector4d& out_yy, vector4d& out_zz,
+			vector4d& out_xy, vector4d& out_xz, vector4d& out_yz) RTM_NO_EXCEPT
+		{
+			// Same as matrix_from_quat(..), row k holds the rotated axis k
+			const vector4d x2 = vector_add(quat_x, quat_x);
+			const vector4d y2 = vector_add(quat_y, quat_y);
+			const vector4d z2 = vector_add(quat_z, quat_z);
+			const vector4d xx = vector_mul(quat_x, x2);
+			const vector4d xy = vector_mul(quat_x, y2);
+			const vector4d xz = vector_mul(quat_x, z2);
+			const vector4d yy = vector_mul(quat_y, y2);
+			const vector4d yz = vector_mul(quat_y, z2);
+			const vector4d zz = vector_mul(quat_z, z2);
+			const vector4d wx = vector_mul(quat_w, x2);
+			const vector4d wy = vector_mul(quat_w, y2);
+			const vector4d wz = vector_mul(quat_w, z2);
+
+			const vector4d one = vector_set(1.0);
+			const vector4d r00 = vector_sub(one, vector_add(yy, zz));
+			const vector4d r01 = vector_add(xy, wz);
+			const vector4d r02 = vector_sub(xz, wy);
+			const vector4d r10 = vector_sub(xy, wz);
+			const vector4d r11 = vector_sub(one, vector_add(xx, zz));
+			const vector4d r12 = vector_add(yz, wx);
+			const vector4d r20 = vector_add(xz, wy);
+			const vector4d r21 = vector_sub(yz, wx);
+			const vector4d r22 = vector_sub(one, vector_add(xx, yy));
+
+			// Each rotated axis scaled by its principal moment
+			const vector4d s00 = vector_mul(r00, diagonal_x);
+			const vector4d s01 = vector_mul(r01, diagonal_x);
+			const vector4d s02 = vector_mul(r02, diagonal_x);
+			const vector4d s10 = vector_mul(r10, diagonal_y);
+			const vector4d s11 = vector_mul(r11, diagonal_y);
+			const vector4d s12 = vector_mul(r12, diagonal_y);
+			const vector4d s20 = vector_mul(r20, diagonal_z);
+			const vector4d s21 = vector_mul(r21, diagonal_z);
+			const vector4d s22 = vector_mul(r22, diagonal_z);
+
+			// result[i][j] = sum_k r[k][i] * s[k][j]
+			out_xx = vector_mul_add(r20, s20, vector_mul_add(r10, s10, vector_mul(r00, s00)));
+			out_yy = vector_mul_add(r21, s21, vector_mul_add(r11, s11, vector_mul(r01, s01)));
+			out_zz = vector_mul_add(r22, s22, vector_mul_add(r12, s12, vector_mul(r02, s02)));
+			out_xy = vector_mul_add(r20, s21, vector_mul_add(r10, s11, vector_mul(r00, s01)));
+			out_xz = vector_mul_add(r20, s22, vector_mul_add(r10, s12, vector_mul(r00, s02)));
+			out_yz = vector_mul_add(r21, s22, vector_mul_add(r11, s12, vector_mul(r01, s02)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates an array of diagonal inertia tensors (or their inverse) into world space.
+	// See matrix_rotate_inertia(..) for details.
+	// Four tensors are rotated at a time in SoA form and only the 6 unique values
+	// of each symmetric result are computed.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_rotate_inertia(const quatd* rotations, const vector4d* diagonals, uint32_t num_tensors, matrix3x3d* out_tensors) RTM_NO_EXCEPT
+	{
+		uint32_t tensor_index = 0;
+		for (; tensor_index + 4 <= num_tensors; tensor_index += 4)
+		{
+			const quatd& rotation0 = rotations[tensor_index + 0];
+			const quatd& rotation1 = rotations[tensor_index + 1];
+			const quatd& rotation2 = rotations[tensor_index + 2];
+			const quatd& rotation3 = rotations[tensor_index + 3];
+			const vector4d quat_x = vector_set(double(quat_get_x(rotation0)), double(quat_get_x(rotation1)), double(quat_get_x(rotation2)), double(quat_get_x(rotation3)));
+			const vector4d quat_y = vector_set(double(quat_get_y(rotation0)), double(quat_get_y(rotation1)), double(quat_get_y(rotation2)), double(quat_get_y(rotation3)));
+			const vector4d quat_z = vector_set(double(quat_get_z(rotation0)), double(quat_get_z(rotation1)), double(quat_get_z(rotation2)), double(quat_get_z(rotation3)));
+			const vector4d quat_w = vector_set(double(quat_get_w(rotation0)), double(quat_get_w(rotation1)), double(quat_get_w(rotation2)), double(quat_get_w(rotation3)));
+
+			const vector4d& diagonal0 = diagonals[tensor_index + 0];
+			const vector4d& diagonal1 = diagonals[tensor_index + 1];
+			const vector4d& diagonal2 = diagonals[tensor_index + 2];
+			const vector4d& diagonal3 = diagonals[tensor_index + 3];
+			const vector4d diagonal_x = vector_set(double(vector_get_x(diagonal0)), double(vector_get_x(diagonal1)), double(vector_get_x(diagonal2)), double(vector_get_x(diagonal3)));
+			const vector4d diagonal_y = vector_set(double(vector_get_y(diagonal0)), double(vector_get_y(diagonal1)), double(vector_get_y(diagonal2)), double(vector_get_y(diagonal3)));
+			const vector4d diagonal_z = vector_set(double(vector_get_z(diagonal0)), double(vector_get_z(diagonal1)), double(vector_get_z(diagonal2)), double(vector_get_z(diagonal3)));
+
+			vector4d xx;
+			vector4d yy;
+			vector4d zz;
+			vector4d xy;
+			vector4d xz;
+			vector4d yz;
+			rtm_impl::matrix_rotate_inertia_soa(quat_x, quat_y, quat_z, quat_w, diagonal_x, diagonal_y, diagonal_z, xx, yy, zz, xy, xz, yz);
+
+			// The matrices are symmetric, the rows are: [xx xy xz], [xy yy yz], [xz yz zz]
+			out_tensors[tensor_index + 0] = matrix3x3d{
+				vector_set(double(vector_get_x(xx)), double(vector_get_x(xy)), double(vector_get_x(xz)), 0.0),
+				vector_set(double(vector_get_x(xy)), double(vector_get_x(yy)), double(vector_get_x(yz)), 0.0),
+				vector_set(double(vector_get_x(xz)), double(vector_get_x(yz)), double(vector_get_x(zz)), 0.0) };
+			out_tensors[tensor_index + 1] = matrix3x3d{
+				vector_set(double(vector_get_y(xx)), double(vector_get_y(xy)), double(vector_get_y(xz)), 0.0),
+				vector_set(double(vector_get_y(xy)), double(vector_get_y(yy)), double(vector_get_y(yz)), 0.0),
+				vector_set(double(vector_get_y(xz)), double(vector_get_y(yz)), double(vector_get_y(zz)), 0.0) };
+			out_tensors[tensor_index + 2] = matrix3x3d{
+				vector_set(double(vector_get_z(xx)), double(vector_get_z(xy)), double(vector_get_z(xz)), 0.0),
+				vector_set(double(vector_get_z(xy)), double(vector_get_z(yy)), double(vector_get_z(yz)), 0.0),
+				vector_set(double(vector_get_z(xz)), double(vector_get_z(yz)), double(vector_get_z(zz)), 0.0) };
+			out_tensors[tensor_index + 3] = matrix3x3d{
+				vector_set(double(vector_get_w(xx)), double(vector_get_w(xy)), double(vector_get_w(xz)), 0.0),
+				vector_set(double(vector_get_w(xy)), double(vector_get_w(yy)), double(vector_get_w(yz)), 0.0),
+				vector_set(double(vector_get_w(xz)), double(vector_get_w(yz)), double(vector_get_w(zz)), 0.0) };
+		}
+
+		for (; tensor_index < num_tensors; ++tensor_index)
+			out_tensors[tensor_index] = matrix_rotate_inertia(rotations[tensor_index], diagonals[tensor_index]);
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -67,6 +67,16 @@ namespace rtm
 		return rtm_impl::quat_from_matrix(input.x_axis, input.y_axis, input.z_axis);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Converts an array of 3x3 matrices into rotation quaternions.
+	// Four matrices are converted at a time in SoA form without branching,
+	// this is faster than calling quat_from_matrix(..) for each matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrices(const matrix3x3f* matrices, uint32_t num_matrices, quatf* out_rotations) RTM_NO_EXCEPT
+	{
+		rtm_impl::quat_from_matrices(matrices, num_matrices, out_rotations);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Multiplies two 3x3 matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
@@ -380,6 +390,149 @@ namespace rtm
 		result.z_axis = vector_normalize3(input.z_axis, input.z_axis);
 		return result;
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates a diagonal inertia tensor (or its inverse) expressed in the principal axes
+	// of a body into world space: matrix_mul(matrix_mul(matrix_transpose(R), diagonal), R)
+	// where R is the rotation matrix of the body. The diagonal is stored in [xyz].
+	// The result is symmetric and only the rotated axes are needed, the rows are
+	// built from them directly without any matrix multiplication or transpose.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3f RTM_SIMD_CALL matrix_rotate_inertia(quatf_arg0 rotation, vector4f_arg1 diagonal) RTM_NO_EXCEPT
+	{
+		const matrix3x3f rotation_mtx = matrix_from_quat(rotation);
+
+		// Each rotated axis scaled by its principal moment
+		const vector4f scaled_x_axis = vector_mul(rotation_mtx.x_axis, vector_dup_x(diagonal));
+		const vector4f scaled_y_axis = vector_mul(rotation_mtx.y_axis, vector_dup_y(diagonal));
+		const vector4f scaled_z_axis = vector_mul(rotation_mtx.z_axis, vector_dup_z(diagonal));
+
+		// result[i] = sum_k rotation_mtx[k][i] * scaled_axis[k]
+		vector4f tmp = vector_mul(vector_dup_x(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_x(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_x(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4f x_axis = tmp;
+
+		tmp = vector_mul(vector_dup_y(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_y(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_y(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4f y_axis = tmp;
+
+		tmp = vector_mul(vector_dup_z(rotation_mtx.x_axis), scaled_x_axis);
+		tmp = vector_mul_add(vector_dup_z(rotation_mtx.y_axis), scaled_y_axis, tmp);
+		tmp = vector_mul_add(vector_dup_z(rotation_mtx.z_axis), scaled_z_axis, tmp);
+		const vector4f z_axis = tmp;
+
+		return matrix3x3f{ x_axis, y_axis, z_axis };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates four diagonal inertia tensors in SoA form, see matrix_rotate_inertia(..).
+		// Only the 6 unique values of the symmetric results are computed.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_rotate_inertia_soa(
+			vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w,
+			vector4f_arg4 diagonal_x, vector4f_arg5 diagonal_y, vector4f_arg6 diagonal_z,
+			vector4f& out_xx, vector4f& out_yy, vector4f& out_zz,
+			vector4f& out_xy, vector4f& out_xz, vector4f& out_yz) RTM_NO_EXCEPT
+		{
+			// Same as matrix_from_quat(..), row k holds the rotated axis k
+			const vector4f x2 = vector_add(quat_x, quat_x);
+			const vector4f y2 = vector_add(quat_y, quat_y);
+			const vector4f z2 = vector_add(quat_z, quat_z);
+			const vector4f xx = vector_mul(quat_x, x2);
+			const vector4f xy = vector_mul(quat_x, y2);
+			const vector4f xz = vector_mul(quat_x, z2);
+			const vector4f yy = vector_mul(quat_y, y2);
+			const vector4f yz = vector_mul(quat_y, z2);
+			const vector4f zz = vector_mul(quat_z, z2);
+			const vector4f wx = vector_mul(quat_w, x2);
+			const vector4f wy = vector_mul(quat_w, y2);
+			const vector4f wz = vector_mul(quat_w, z2);
+
+			const vector4f one = vector_set(1.0F);
+			const vector4f r00 = vector_sub(one, vector_add(yy, zz));
+			const vector4f r01 = vector_add(xy, wz);
+			const vector4f r02 = vector_sub(xz, wy);
+			const vector4f r10 = vector_sub(xy, wz);
+			const vector4f r11 = vector_sub(one, vector_add(xx, zz));
+			const vector4f r12 = vector_add(yz, wx);
+			const vector4f r20 = vector_add(xz, wy);
+			const vector4f r21 = vector_sub(yz, wx);
+			const vector4f r22 = vector_sub(one, vector_add(xx, yy));
+
+			// Each rotated axis scaled by its principal moment
+			const vector4f s00 = vector_mul(r00, diagonal_x);
+			const vector4f s01 = vector_mul(r01, diagonal_x);
+			const vector4f s02 = vector_mul(r02, diagonal_x);
+			const vector4f s10 = vector_mul(r10, diagonal_y);
+			const vector4f s11 = vector_mul(r11, diagonal_y);
+			const vector4f s12 = vector_mul(r12, diagonal_y);
+			const vector4f s20 = vector_mul(r20, diagonal_z);
+			const vector4f s21 = vector_mul(r21, diagonal_z);
+			const vector4f s22 = vector_mul(r22, diagonal_z);
+
+			// result[i][j] = sum_k r[k][i] * s[k][j]
+			out_xx = vector_mul_add(r20, s20, vector_mul_add(r10, s10, vector_mul(r00, s00)));
+			out_yy = vector_mul_add(r21, s21, vector_mul_add(r11, s11, vector_mul(r01, s01)));
+			out_zz = vector_mul_add(r22, s22, vector_mul_add(r12, s12, vector_mul(r02, s02)));
+			out_xy = vector_mul_add(r20, s21, vector_mul_add(r10, s11, vector_mul(r00, s01)));
+			out_xz = vector_mul_add(r20, s22, vector_mul_add(r10, s12, vector_mul(r00, s02)));
+			out_yz = vector_mul_add(r21, s22, vector_mul_add(r11, s12, vector_mul(r01, s02)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates an array of diagonal inertia tensors (or their inverse) into world space.
+	// See matrix_rotate_inertia(..) for details.
+	// Four tensors are rotated at a time in SoA form and only the 6 unique values
+	// of each symmetric result are computed. The [w] component of the output axes is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_rotate_inertia(const quatf* rotations, const vector4f* diagonals, uint32_t num_tensors, matrix3x3f* out_tensors) RTM_NO_EXCEPT
+	{
+		uint32_t tensor_index = 0;
+		for (; tensor_index + 4 <= num_tensors; tensor_index += 4)
+		{
+			const vector4f rotation0 = quat_to_vector(rotations[tensor_index + 0]);
+			const vector4f rotation1 = quat_to_vector(rotations[tensor_index + 1]);
+			const vector4f rotation2 = quat_to_vector(rotations[tensor_index + 2]);
+			const vector4f rotation3 = quat_to_vector(rotations[tensor_index + 3]);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			RTM_MATRIXF_TRANSPOSE_4X4(rotation0, rotation1, rotation2, rotation3, quat_x, quat_y, quat_z, quat_w);
+
+			vector4f diagonal_x;
+			vector4f diagonal_y;
+			vector4f diagonal_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(diagonals[tensor_index + 0], diagonals[tensor_index + 1], diagonals[tensor_index + 2], diagonals[tensor_index + 3], diagonal_x, diagonal_y, diagonal_z);
+
+			vector4f xx;
+			vector4f yy;
+			vector4f zz;
+			vector4f xy;
+			vector4f xz;
+			vector4f yz;
+			rtm_impl::matrix_rotate_inertia_soa(quat_x, quat_y, quat_z, quat_w, diagonal_x, diagonal_y, diagonal_z, xx, yy, zz, xy, xz, yz);
+
+			matrix3x3f& tensor0 = out_tensors[tensor_index + 0];
+			matrix3x3f& tensor1 = out_tensors[tensor_index + 1];
+			matrix3x3f& tensor2 = out_tensors[tensor_index + 2];
+			matrix3x3f& tensor3 = out_tensors[tensor_index + 3];
+
+			// The matrices are symmetric, the rows are: [xx xy xz], [xy yy yz], [xz yz zz]
+			RTM_MATRIXF_TRANSPOSE_3X4(xx, xy, xz, tensor0.x_axis, tensor1.x_axis, tensor2.x_axis, tensor3.x_axis);
+			RTM_MATRIXF_TRANSPOSE_3X4(xy, yy, yz, tensor0.y_axis, tensor1.y_axis, tensor2.y_axis, tensor3.y_axis);
+			RTM_MATRIXF_TRANSPOSE_3X4(xz, yz, zz, tensor0.z_axis, tensor1.z_axis, tensor2.z_axis, tensor3.z_axis);
+		}
+
+		for (; tensor_index < num_tensors; ++tensor_index)
+			out_tensors[tensor_index] = matrix_rotate_inertia(rotations[tensor_index], diagonals[tensor_index]);
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -37,6 +37,14 @@ RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
 {
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an aligned 3x4 affine matrix from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_load(const aligned_matrix3x4f* input) RTM_NO_EXCEPT
+	{
+		return matrix3x4f{ vector_load(&input->x_axis), vector_load(&input->y_axis), vector_load(&input->z_axis), vector_load(&input->w_axis) };
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a rotation 3x3 matrix into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
@@ -107,6 +115,16 @@ namespace rtm
 		return rtm_impl::quat_from_matrix(input.x_axis, input.y_axis, input.z_axis);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Converts an array of 3x4 affine matrices into rotation quaternions.
+	// Four matrices are converted at a time in SoA form without branching,
+	// this is faster than calling quat_from_matrix(..) for each matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrices(const matrix3x4f* matrices, uint32_t num_matrices, quatf* out_rotations) RTM_NO_EXCEPT
+	{
+		rtm_impl::quat_from_matrices(matrices, num_matrices, out_rotations);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Multiplies two 3x4 affine matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
@@ -0,0 +1,133 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/aabbf.h"
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/planef.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an oriented bounding box from its center, half extent, and rotation.
+	//////////////////////////////////////////////////////////////////////////
+	inline obbf RTM_SIMD_CALL obb_set(vector4f_arg0 center, vector4f_arg1 extent, quatf_arg2 rotation) RTM_NO_EXCEPT
+	{
+		return obbf{ rotation, center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an oriented bounding box from an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline obbf RTM_SIMD_CALL obb_from_aabb(aabbf_arg0 aabb) RTM_NO_EXCEPT
+	{
+		return obbf{ quat_identity(), aabb.center, aabb.extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains the oriented bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_from_obb(obbf_arg0 obb) RTM_NO_EXCEPT
+	{
+		const matrix3x3f rotation = matrix_from_quat(obb.rotation);
+
+		vector4f extent = vector_mul(vector_dup_x(obb.extent), vector_abs(rotation.x_axis));
+		extent = vector_mul_add(vector_dup_y(obb.extent), vector_abs(rotation.y_axis), extent);
+		extent = vector_mul_add(vector_dup_z(obb.extent), vector_abs(rotation.z_axis), extent);
+
+		return aabbf{ obb.center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the point is inside or on the surface of the oriented bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL obb_contains_point(obbf_arg0 obb, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		const vector4f local_point = quat_mul_vector3(vector_sub(point, obb.center), quat_conjugate(obb.rotation));
+		return vector_all_less_equal3(vector_abs(local_point), obb.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an oriented bounding box by a QVV transform.
+	// An oriented box can only represent a uniform scale: when the transform contains
+	// non-uniform scale, the extent is scaled by the largest scale component to
+	// remain conservative.
+	//////////////////////////////////////////////////////////////////////////
+	inline obbf RTM_SIMD_CALL obb_transform(obbf_arg0 obb, qvvf_arg1 transform) RTM_NO_EXCEPT
+	{
+		const vector4f abs_scale = vector_abs(transform.scale);
+		const float scale_x = vector_get_x(abs_scale);
+		const float scale_y = vector_get_y(abs_scale);
+		const float scale_z = vector_get_z(abs_scale);
+		const float max_scale = scalar_max(scalar_max(scale_x, scale_y), scale_z);
+
+		const quatf rotation = quat_mul(obb.rotation, transform.rotation);
+		const vector4f center = qvv_mul_point3(obb.center, transform);
+		const vector4f extent = vector_mul(obb.extent, max_scale);
+		return obbf{ rotation, center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the oriented bounding box is inside or intersects the volume
+	// delimited by the provided planes. It is only rejected when it lies entirely on the
+	// negative side of at least one plane. This is conservative and suitable for culling.
+	// See aabbf.h for the plane convention.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL obb_intersects_planes(obbf_arg0 obb, const vector4f* planes, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		const matrix3x3f rotation = matrix_from_quat(obb.rotation);
+
+		// Scale the box axes by their extent, the projected radius is then the sum of their absolute projections
+		const vector4f x_axis = vector_mul(rotation.x_axis, vector_dup_x(obb.extent));
+		const vector4f y_axis = vector_mul(rotation.y_axis, vector_dup_y(obb.extent));
+		const vector4f z_axis = vector_mul(rotation.z_axis, vector_dup_z(obb.extent));
+
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+		{
+			const vector4f plane = planes[plane_index];
+			const float distance = plane_distance_point(planef{ plane }, obb.center);
+			const float projection_x = vector_dot3(plane, x_axis);
+			const float projection_y = vector_dot3(plane, y_axis);
+			const float projection_z = vector_dot3(plane, z_axis);
+			const float radius = scalar_abs(projection_x) + scalar_abs(projection_y) + scalar_abs(projection_z);
+			if (distance + radius < 0.0F)
+				return false;
+		}
+
+		return true;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
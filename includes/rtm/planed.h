@@ -0,0 +1,149 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4d.h"
+#include "rtm/scalard.h"
+#include "rtm/vector4d.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and distance.
+	// See planed for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_set(const vector4d& normal, double distance) RTM_NO_EXCEPT
+	{
+		return planed{ vector_set_w(normal, distance) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from a [normal, distance] vector.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_set(const vector4d& normal_distance) RTM_NO_EXCEPT
+	{
+		return planed{ normal_distance };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a plane float32 variant to a float64 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_cast(const planef& input) RTM_NO_EXCEPT
+	{
+		return planed{ vector_cast(input.normal_distance) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and a point on the plane.
+	// The normal should be normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_from_point_normal(const vector4d& point, const vector4d& normal) RTM_NO_EXCEPT
+	{
+		const double distance = vector_dot3(normal, point);
+		return plane_set(normal, -distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a normalized plane that contains the 3 points.
+	// The normal is: normalize(cross(point1 - point0, point2 - point0))
+	// If the points are colinear, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_from_points(const vector4d& point0, const vector4d& point1, const vector4d& point2) RTM_NO_EXCEPT
+	{
+		const vector4d normal = vector_normalize3(vector_cross3(vector_sub(point1, point0), vector_sub(point2, point0)));
+		return plane_from_point_normal(point0, normal);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the normal of the plane.
+	// Note: The [w] component contains the distance.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d plane_get_normal(const planed& plane) RTM_NO_EXCEPT
+	{
+		return plane.normal_distance;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the distance of the plane: dot(normal, point) + distance = 0
+	//////////////////////////////////////////////////////////////////////////
+	inline double plane_get_distance(const planed& plane) RTM_NO_EXCEPT
+	{
+		return vector_get_w(plane.normal_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scales a plane such that its normal has unit length.
+	// Distances to a normalized plane are expressed in world units.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_normalize(const planed& plane) RTM_NO_EXCEPT
+	{
+		const scalard inv_length = vector_length_reciprocal3(plane.normal_distance);
+		return planed{ vector_mul(plane.normal_distance, inv_length) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the signed distance of a point to the plane: dot(normal, point) + distance
+	// The distance is expressed in world units when the plane is normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline double plane_distance_point(const planed& plane, const vector4d& point) RTM_NO_EXCEPT
+	{
+		// dot([normal, distance], [point, 1.0])
+		return vector_dot(plane.normal_distance, vector_set_w(point, 1.0));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the closest point on the plane to the provided point.
+	// The plane must be normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d plane_project_point(const planed& plane, const vector4d& point) RTM_NO_EXCEPT
+	{
+		const double distance = plane_distance_point(plane, point);
+		return vector_neg_mul_sub(plane.normal_distance, distance, point);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a plane by an affine matrix and normalizes it.
+	// Planes transform with the inverse transpose of the matrix which properly
+	// handles non-uniform scale. The transform must be invertible.
+	//////////////////////////////////////////////////////////////////////////
+	inline planed plane_transform(const planed& plane, const matrix3x4d& transform) RTM_NO_EXCEPT
+	{
+		const matrix3x4d inv_transform = matrix_inverse(transform);
+
+		// Points are row vectors, the plane is a column vector multiplied by the inverse.
+		// Each output component is the dot product of a row of the inverse with the plane normal.
+		const double normal_x = vector_dot3(inv_transform.x_axis, plane.normal_distance);
+		const double normal_y = vector_dot3(inv_transform.y_axis, plane.normal_distance);
+		const double normal_z = vector_dot3(inv_transform.z_axis, plane.normal_distance);
+		const double distance = double(vector_dot3(inv_transform.w_axis, plane.normal_distance)) + plane_get_distance(plane);
+		return plane_normalize(planed{ vector_set(normal_x, normal_y, normal_z, distance) });
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,315 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/macros.h"
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and distance.
+	// See planef for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_set(vector4f_arg0 normal, float distance) RTM_NO_EXCEPT
+	{
+		return planef{ vector_set_w(normal, distance) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from a [normal, distance] vector.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_set(vector4f_arg0 normal_distance) RTM_NO_EXCEPT
+	{
+		return planef{ normal_distance };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a plane float64 variant to a float32 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_cast(const planed& input) RTM_NO_EXCEPT
+	{
+		return planef{ vector_cast(input.normal_distance) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a plane from its normal and a point on the plane.
+	// The normal should be normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_from_point_normal(vector4f_arg0 point, vector4f_arg1 normal) RTM_NO_EXCEPT
+	{
+		const float distance = vector_dot3(normal, point);
+		return plane_set(normal, -distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a normalized plane that contains the 3 points.
+	// The normal is: normalize(cross(point1 - point0, point2 - point0))
+	// If the points are colinear, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_from_points(vector4f_arg0 point0, vector4f_arg1 point1, vector4f_arg2 point2) RTM_NO_EXCEPT
+	{
+		const vector4f normal = vector_normalize3(vector_cross3(vector_sub(point1, point0), vector_sub(point2, point0)));
+		return plane_from_point_normal(point0, normal);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the normal of the plane.
+	// Note: The [w] component contains the distance.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL plane_get_normal(planef_arg0 plane) RTM_NO_EXCEPT
+	{
+		return plane.normal_distance;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the distance of the plane: dot(normal, point) + distance = 0
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL plane_get_distance(planef_arg0 plane) RTM_NO_EXCEPT
+	{
+		return vector_get_w(plane.normal_distance);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scales a plane such that its normal has unit length.
+	// Distances to a normalized plane are expressed in world units.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_normalize(planef_arg0 plane) RTM_NO_EXCEPT
+	{
+		const scalarf inv_length = vector_length_reciprocal3(plane.normal_distance);
+		return planef{ vector_mul(plane.normal_distance, inv_length) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the signed distance of a point to the plane: dot(normal, point) + distance
+	// The distance is expressed in world units when the plane is normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL plane_distance_point(planef_arg0 plane, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		// dot([normal, distance], [point, 1.0])
+		return vector_dot(plane.normal_distance, vector_set_w(point, 1.0F));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the closest point on the plane to the provided point.
+	// The plane must be normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL plane_project_point(planef_arg0 plane, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		const float distance = plane_distance_point(plane, point);
+		return vector_neg_mul_sub(plane.normal_distance, distance, point);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms a plane with the inverse of an affine matrix and normalizes it.
+		//////////////////////////////////////////////////////////////////////////
+		inline planef RTM_SIMD_CALL plane_transform_by_inverse(planef_arg0 plane, matrix3x4f_arg1 inv_transform) RTM_NO_EXCEPT
+		{
+			// Points are row vectors, the plane is a column vector multiplied by the inverse.
+			// Each output component is the dot product of a row of the inverse with the plane normal.
+			vector4f inv_transform_x;
+			vector4f inv_transform_y;
+			vector4f inv_transform_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(inv_transform.x_axis, inv_transform.y_axis, inv_transform.z_axis, inv_transform.w_axis, inv_transform_x, inv_transform_y, inv_transform_z);
+
+			// The distance only picks up the translation contribution
+			const vector4f distance = vector_mix<mix4::a, mix4::b, mix4::c, mix4::w>(plane.normal_distance, vector_zero());
+
+			vector4f result = vector_mul_add(vector_dup_x(plane.normal_distance), inv_transform_x, distance);
+			result = vector_mul_add(vector_dup_y(plane.normal_distance), inv_transform_y, result);
+			result = vector_mul_add(vector_dup_z(plane.normal_distance), inv_transform_z, result);
+			return plane_normalize(planef{ result });
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a plane by an affine matrix and normalizes it.
+	// Planes transform with the inverse transpose of the matrix which properly
+	// handles non-uniform scale. The transform must be invertible.
+	// When transforming many planes, use the batch version below which only inverts the matrix once.
+	//////////////////////////////////////////////////////////////////////////
+	inline planef RTM_SIMD_CALL plane_transform(planef_arg0 plane, matrix3x4f_arg1 transform) RTM_NO_EXCEPT
+	{
+		return rtm_impl::plane_transform_by_inverse(plane, matrix_inverse(transform));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the signed distance of a number of points to the plane.
+	// See plane_distance_point(..) above for details.
+	// Points are processed 4 at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void plane_distance_point(planef_arg0 plane, const float3f* points, float* output_distances, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		const vector4f normal_xxxx = vector_dup_x(plane.normal_distance);
+		const vector4f normal_yyyy = vector_dup_y(plane.normal_distance);
+		const vector4f normal_zzzz = vector_dup_z(plane.normal_distance);
+		const vector4f distance_wwww = vector_dup_w(plane.normal_distance);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const float3f* inputs = points + point_index;
+			const vector4f point0 = vector_load3(inputs + 0);
+			const vector4f point1 = vector_load3(inputs + 1);
+			const vector4f point2 = vector_load3(inputs + 2);
+			const vector4f point3 = vector_load3(inputs + 3);
+
+			vector4f point_xxxx;
+			vector4f point_yyyy;
+			vector4f point_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(point0, point1, point2, point3, point_xxxx, point_yyyy, point_zzzz);
+
+			vector4f distance = vector_mul_add(point_xxxx, normal_xxxx, distance_wwww);
+			distance = vector_mul_add(point_yyyy, normal_yyyy, distance);
+			distance = vector_mul_add(point_zzzz, normal_zzzz, distance);
+
+			vector_store(distance, output_distances + point_index);
+		}
+
+		for (; point_index < num_points; ++point_index)
+			output_distances[point_index] = plane_distance_point(plane, vector_load3(points + point_index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Projects a number of points onto the plane.
+	// See plane_project_point(..) above for details.
+	// Points are processed 4 at a time in SoA form.
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void plane_project_point(planef_arg0 plane, const float3f* points, float3f* output_points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		const vector4f normal_xxxx = vector_dup_x(plane.normal_distance);
+		const vector4f normal_yyyy = vector_dup_y(plane.normal_distance);
+		const vector4f normal_zzzz = vector_dup_z(plane.normal_distance);
+		const vector4f distance_wwww = vector_dup_w(plane.normal_distance);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const float3f* inputs = points + point_index;
+			const vector4f point0 = vector_load3(inputs + 0);
+			const vector4f point1 = vector_load3(inputs + 1);
+			const vector4f point2 = vector_load3(inputs + 2);
+			const vector4f point3 = vector_load3(inputs + 3);
+
+			vector4f point_xxxx;
+			vector4f point_yyyy;
+			vector4f point_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(point0, point1, point2, point3, point_xxxx, point_yyyy, point_zzzz);
+
+			vector4f distance = vector_mul_add(point_xxxx, normal_xxxx, distance_wwww);
+			distance = vector_mul_add(point_yyyy, normal_yyyy, distance);
+			distance = vector_mul_add(point_zzzz, normal_zzzz, distance);
+
+			const vector4f projected_xxxx = vector_neg_mul_sub(normal_xxxx, distance, point_xxxx);
+			const vector4f projected_yyyy = vector_neg_mul_sub(normal_yyyy, distance, point_yyyy);
+			const vector4f projected_zzzz = vector_neg_mul_sub(normal_zzzz, distance, point_zzzz);
+
+			vector4f projected0;
+			vector4f projected1;
+			vector4f projected2;
+			vector4f projected3;
+			RTM_MATRIXF_TRANSPOSE_3X4(projected_xxxx, projected_yyyy, projected_zzzz, projected0, projected1, projected2, projected3);
+
+			float3f* outputs = output_points + point_index;
+			vector_store3(projected0, outputs + 0);
+			vector_store3(projected1, outputs + 1);
+			vector_store3(projected2, outputs + 2);
+			vector_store3(projected3, outputs + 3);
+		}
+
+		for (; point_index < num_points; ++point_index)
+			vector_store3(plane_project_point(plane, vector_load3(points + point_index)), output_points + point_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a number of planes by an affine matrix and normalizes them.
+	// See plane_transform(..) above for details.
+	// Planes are processed 4 at a time in SoA form.
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void plane_transform(matrix3x4f_arg0 transform, const planef* input_planes, planef* output_planes, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		const matrix3x4f inv_transform = matrix_inverse(transform);
+
+		const vector4f x_axis_x = vector_dup_x(inv_transform.x_axis);
+		const vector4f x_axis_y = vector_dup_y(inv_transform.x_axis);
+		const vector4f x_axis_z = vector_dup_z(inv_transform.x_axis);
+		const vector4f y_axis_x = vector_dup_x(inv_transform.y_axis);
+		const vector4f y_axis_y = vector_dup_y(inv_transform.y_axis);
+		const vector4f y_axis_z = vector_dup_z(inv_transform.y_axis);
+		const vector4f z_axis_x = vector_dup_x(inv_transform.z_axis);
+		const vector4f z_axis_y = vector_dup_y(inv_transform.z_axis);
+		const vector4f z_axis_z = vector_dup_z(inv_transform.z_axis);
+		const vector4f w_axis_x = vector_dup_x(inv_transform.w_axis);
+		const vector4f w_axis_y = vector_dup_y(inv_transform.w_axis);
+		const vector4f w_axis_z = vector_dup_z(inv_transform.w_axis);
+		const vector4f one = vector_set(1.0F);
+
+		uint32_t plane_index = 0;
+		for (; plane_index + 4 <= num_planes; plane_index += 4)
+		{
+			const planef* inputs = input_planes + plane_index;
+
+			vector4f normal_xxxx;
+			vector4f normal_yyyy;
+			vector4f normal_zzzz;
+			vector4f distance_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(inputs[0].normal_distance, inputs[1].normal_distance, inputs[2].normal_distance, inputs[3].normal_distance, normal_xxxx, normal_yyyy, normal_zzzz, distance_wwww);
+
+			// Each output component is the dot product of a row of the inverse with the plane normal
+			const vector4f new_normal_xxxx = vector_mul_add(normal_zzzz, x_axis_z, vector_mul_add(normal_yyyy, x_axis_y, vector_mul(normal_xxxx, x_axis_x)));
+			const vector4f new_normal_yyyy = vector_mul_add(normal_zzzz, y_axis_z, vector_mul_add(normal_yyyy, y_axis_y, vector_mul(normal_xxxx, y_axis_x)));
+			const vector4f new_normal_zzzz = vector_mul_add(normal_zzzz, z_axis_z, vector_mul_add(normal_yyyy, z_axis_y, vector_mul(normal_xxxx, z_axis_x)));
+			const vector4f new_distance_wwww = vector_mul_add(normal_zzzz, w_axis_z, vector_mul_add(normal_yyyy, w_axis_y, vector_mul_add(normal_xxxx, w_axis_x, distance_wwww)));
+
+			const vector4f length_sq = vector_mul_add(new_normal_zzzz, new_normal_zzzz, vector_mul_add(new_normal_yyyy, new_normal_yyyy, vector_mul(new_normal_xxxx, new_normal_xxxx)));
+			const vector4f inv_length = vector_div(one, vector_sqrt(length_sq));
+
+			const vector4f normalized_xxxx = vector_mul(new_normal_xxxx, inv_length);
+			const vector4f normalized_yyyy = vector_mul(new_normal_yyyy, inv_length);
+			const vector4f normalized_zzzz = vector_mul(new_normal_zzzz, inv_length);
+			const vector4f normalized_wwww = vector_mul(new_distance_wwww, inv_length);
+
+			planef* outputs = output_planes + plane_index;
+			RTM_MATRIXF_TRANSPOSE_4X4(normalized_xxxx, normalized_yyyy, normalized_zzzz, normalized_wwww, outputs[0].normal_distance, outputs[1].normal_distance, outputs[2].normal_distance, outputs[3].normal_distance);
+		}
+
+		for (; plane_index < num_planes; ++plane_index)
+			output_planes[plane_index] = rtm_impl::plane_transform_by_inverse(input_planes[plane_index], inv_transform);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
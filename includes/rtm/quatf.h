@@ -25,6 +25,7 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "rtm/macros.h"
 #include "rtm/math.h"
 #include "rtm/scalarf.h"
 #include "rtm/vector4f.h"
@@ -56,6 +57,20 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an aligned quaternion from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_load(const aligned_float4f* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_load_ps(&input->x);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vld1q_f32(&input->x);
+#else
+		return quat_set(input->x, input->y, input->z, input->w);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned quaternion from memory.
 	//////////////////////////////////////////////////////////////////////////
@@ -510,10 +525,11 @@ namespace rtm
 		const float rhs_z = quat_get_z(rhs);
 		const float rhs_w = quat_get_w(rhs);
 
-		const float x = (rhs_w * lhs_x) + (rhs_x * lhs_w) + (rhs_y * lhs_z) - (rhs_z * lhs_y);
-		const float y = (rhs_w * lhs_y) - (rhs_x * lhs_z) + (rhs_y * lhs_w) + (rhs_z * lhs_x);
-		const float z = (rhs_w * lhs_z) + (rhs_x * lhs_y) - (rhs_y * lhs_x) + (rhs_z * lhs_w);
-		const float w = (rhs_w * lhs_w) - (rhs_x * lhs_x) - (rhs_y * lhs_y) - (rhs_z * lhs_z);
+		// The terms are summed pairwise like the SSE implementation which yields identical results
+		const float x = ((rhs_w * lhs_x) + (rhs_x * lhs_w)) + ((rhs_y * lhs_z) - (rhs_z * lhs_y));
+		const float y = ((rhs_w * lhs_y) - (rhs_x * lhs_z)) + ((rhs_y * lhs_w) + (rhs_z * lhs_x));
+		const float z = ((rhs_w * lhs_z) + (rhs_x * lhs_y)) + ((rhs_z * lhs_w) - (rhs_y * lhs_x));
+		const float w = ((rhs_w * lhs_w) - (rhs_x * lhs_x)) - ((rhs_y * lhs_y) + (rhs_z * lhs_z));
 
 		return quat_set(x, y, z, w);
 #endif
@@ -525,7 +541,8 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL quat_mul_vector3(vector4f_arg0 vector, quatf_arg1 rotation) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+		// The optimized implementations below drop terms and sum in a different order, they aren't deterministic
+#if defined(RTM_SSE2_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		const __m128 inv_rotation = quat_conjugate(rotation);
 
 		// Normally when we multiply our inverse rotation quaternion with the input vector as a quaternion with W = 0.0.
@@ -581,7 +598,7 @@ namespace rtm
 			__m128 result1 = _mm_add_ps(lzry_lwry_lxry_lyry, lyrz_lxrz_lwrz_lzrz);
 			return _mm_add_ps(result0, result1);
 		}
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 
 		// Normally when we multiply our inverse rotation quaternion with the input vector as a quaternion with W = 0.0.
 		// As a result, we can strip the whole part that uses W saving a few instructions.
@@ -648,35 +665,13 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-				// SSE4 dot product instruction isn't precise enough
-				return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF));
-#elif defined(RTM_SSE2_INTRINSICS)
-				__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-				__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-				__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-				return _mm_cvtss_f32(x2y2z2w2_0_0_0);
-#else
-				return (quat_get_x(lhs) * quat_get_x(rhs)) + (quat_get_y(lhs) * quat_get_y(rhs)) + (quat_get_z(lhs) * quat_get_z(rhs)) + (quat_get_w(lhs) * quat_get_w(rhs));
-#endif
+				return vector_dot(quat_to_vector(lhs), quat_to_vector(rhs));
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-				// SSE4 dot product instruction isn't precise enough
-				return scalarf{ _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF)) };
-#else
-				__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-				__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-				__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-				return scalarf{ x2y2z2w2_0_0_0 };
-#endif
+				return vector_dot(quat_to_vector(lhs), quat_to_vector(rhs));
 			}
 #endif
 
@@ -782,16 +777,14 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		// We first calculate the dot product to get the length squared: dot(input, input)
-		__m128 x2_y2_z2_w2 = _mm_mul_ps(input, input);
-		__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-		__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-		__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-		__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-
 		// Keep the dot product result as a scalar within the first lane, it is faster to
 		// calculate the reciprocal square root of a single lane VS all 4 lanes
-		__m128 dot = x2y2z2w2_0_0_0;
+		__m128 dot = rtm_impl::vector_hadd_ss(_mm_mul_ps(input, input));
 
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use a full precision division
+		__m128 x2 = _mm_div_ss(_mm_set_ss(1.0F), _mm_sqrt_ss(dot));
+#else
 		// Calculate the reciprocal square root to get the inverse length of our vector
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		__m128 half = _mm_set_ss(0.5F);
@@ -807,6 +800,7 @@ namespace rtm
 		__m128 x2 = _mm_mul_ss(x1, x1);
 		x2 = _mm_sub_ss(half, _mm_mul_ss(input_half_v, x2));
 		x2 = _mm_add_ss(_mm_mul_ss(x1, x2), x1);
+#endif
 
 		// Broadcast the vector length reciprocal to all 4 lanes in order to multiply it with the vector
 		__m128 inv_len = _mm_shuffle_ps(x2, x2, _MM_SHUFFLE(0, 0, 0, 0));
@@ -824,6 +818,31 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized quaternion using the hardware estimate of the
+	// reciprocal square root. See scalar_sqrt_reciprocal_approx(..) for its precision.
+	// Note that if the input quaternion is invalid (pure zero or with NaN/Inf),
+	// the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_normalize_approx(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf len_sq = quat_length_squared(input);
+		return vector_to_quat(vector_mul(quat_to_vector(input), scalar_sqrt_reciprocal_approx(len_sq)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized quaternion using a single Newton-Raphson iteration on the
+	// hardware estimate of the reciprocal square root. See scalar_sqrt_reciprocal_nr1(..)
+	// for its precision.
+	// Note that if the input quaternion is invalid (pure zero or with NaN/Inf),
+	// the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_normalize_nr1(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf len_sq = quat_length_squared(input);
+		return vector_to_quat(vector_mul(quat_to_vector(input), scalar_sqrt_reciprocal_nr1(len_sq)));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the linear interpolation between start and end for a given alpha value.
 	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
@@ -837,7 +856,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatf RTM_SIMD_CALL quat_lerp(quatf_arg0 start, quatf_arg1 end, float alpha) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_SSE2_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		// The dot products below are summed in a different order than vector_dot(..) and the
+		// normalization uses the reciprocal square root estimate, this path isn't deterministic
 		// Calculate the vector4 dot product: dot(start, end)
 		__m128 dot;
 #if defined(RTM_SSE4_INTRINSICS)
@@ -906,7 +927,7 @@ namespace rtm
 
 		// Multiply the rotation by it's inverse length in order to normalize it
 		return _mm_mul_ps(interpolated_rotation, inv_len);
-#elif defined (RTM_NEON64_INTRINSICS)
+#elif defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		// On ARM64 with NEON, we load 1.0 once and use it twice which is faster than
 		// using a AND/XOR with the bias (same number of instructions)
 		float dot = vector_dot(start, end);
@@ -916,7 +937,7 @@ namespace rtm
 		// Use sqrt/div/mul to normalize because the sqrt/div are faster than rsqrt
 		float inv_len = 1.0F / scalar_sqrt(vector_length_squared(interpolated_rotation));
 		return vector_mul(interpolated_rotation, inv_len);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		// Calculate the vector4 dot product: dot(start, end)
 		float32x4_t x2_y2_z2_w2 = vmulq_f32(start, end);
 		float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
@@ -973,6 +994,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatf RTM_SIMD_CALL quat_lerp(quatf_arg0 start, quatf_arg1 end, scalarf_arg2 alpha) RTM_NO_EXCEPT
 	{
+#if defined(RTM_DETERMINISTIC)
+		return quat_lerp(start, end, scalar_cast(alpha));
+#else
 		// Calculate the vector4 dot product: dot(start, end)
 		__m128 dot;
 #if defined(RTM_SSE4_INTRINSICS)
@@ -1041,6 +1065,7 @@ namespace rtm
 
 		// Multiply the rotation by it's inverse length in order to normalize it
 		return _mm_mul_ps(interpolated_rotation, inv_len);
+#endif
 	}
 #endif
 
@@ -1184,6 +1209,27 @@ namespace rtm
 		return vector_to_quat(vector_set_w(vector_mul(sin_, axis), cos_));
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Integrates a rotation with a world space angular velocity in radians per second
+	// over a time step. The exponential map is used which is exact for a constant
+	// angular velocity, unlike: quat_normalize(q + 0.5 * w * q * delta_time)
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_integrate(quatf_arg0 rotation, vector4f_arg1 angular_velocity, float delta_time) RTM_NO_EXCEPT
+	{
+		const float speed = vector_length3(angular_velocity);
+		const float half_angle = 0.5F * speed * delta_time;
+
+		float sin_;
+		float cos_;
+		scalar_sincos(half_angle, sin_, cos_);
+
+		// The axis is scaled by sin(half_angle) / speed, near zero we use its Taylor series instead
+		const float axis_scale = scalar_abs(half_angle) >= 1.0E-3F ? (sin_ / speed) : (0.5F * delta_time * (1.0F - half_angle * half_angle * (1.0F / 6.0F)));
+
+		const quatf delta = vector_to_quat(vector_set_w(vector_mul(angular_velocity, axis_scale), cos_));
+		return quat_normalize(quat_mul(rotation, delta));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a quaternion from Euler Pitch/Yaw/Roll angles.
 	// Pitch is around the Y axis (right)
@@ -1209,6 +1255,790 @@ namespace rtm
 			cr * cp * cy + sr * sp * sy);
 	}
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Describes the axes used by an Euler rotation order: 0 = X, 1 = Y, 2 = Z.
+		//////////////////////////////////////////////////////////////////////////
+		template<int first_axis, int second_axis, int third_axis>
+		struct euler_axes
+		{
+			static constexpr int first = first_axis;
+			static constexpr int second = second_axis;
+			static constexpr int third = third_axis;
+
+			// Proper Euler angles repeat their first axis, the last axis is the one left unused
+			static constexpr bool is_proper = first_axis == third_axis;
+			static constexpr int last = is_proper ? (3 - first_axis - second_axis) : third_axis;
+
+			// +1 if [first, second, last] is an even permutation of [X, Y, Z], -1 otherwise
+			static constexpr int parity = ((first_axis - second_axis) * (second_axis - last) * (last - first_axis)) / 2;
+		};
+
+		template<euler_order order> struct euler_order_axes;
+		template<> struct euler_order_axes<euler_order::xyz> : euler_axes<0, 1, 2> {};
+		template<> struct euler_order_axes<euler_order::xzy> : euler_axes<0, 2, 1> {};
+		template<> struct euler_order_axes<euler_order::yxz> : euler_axes<1, 0, 2> {};
+		template<> struct euler_order_axes<euler_order::yzx> : euler_axes<1, 2, 0> {};
+		template<> struct euler_order_axes<euler_order::zxy> : euler_axes<2, 0, 1> {};
+		template<> struct euler_order_axes<euler_order::zyx> : euler_axes<2, 1, 0> {};
+		template<> struct euler_order_axes<euler_order::xyx> : euler_axes<0, 1, 0> {};
+		template<> struct euler_order_axes<euler_order::xzx> : euler_axes<0, 2, 0> {};
+		template<> struct euler_order_axes<euler_order::yxy> : euler_axes<1, 0, 1> {};
+		template<> struct euler_order_axes<euler_order::yzy> : euler_axes<1, 2, 1> {};
+		template<> struct euler_order_axes<euler_order::zxz> : euler_axes<2, 0, 2> {};
+		template<> struct euler_order_axes<euler_order::zyz> : euler_axes<2, 1, 2> {};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the quaternion rotating around a single axis from the sine and cosine
+		// of its half angle stored in the specified lane.
+		//////////////////////////////////////////////////////////////////////////
+		template<int axis, int lane>
+		inline quatf RTM_SIMD_CALL quat_from_euler_axis(vector4f_arg0 half_sin, vector4f_arg1 half_cos) RTM_NO_EXCEPT
+		{
+			constexpr mix4 sin_lane = static_cast<mix4>(lane);
+			constexpr mix4 cos_lane = static_cast<mix4>(lane + 4);
+
+			// [sin, sin, sin, cos] * [axis, 1.0]
+			const vector4f sin_cos = vector_mix<sin_lane, sin_lane, sin_lane, cos_lane>(half_sin, half_cos);
+			const vector4f axis_mask = vector_set(axis == 0 ? 1.0F : 0.0F, axis == 1 ? 1.0F : 0.0F, axis == 2 ? 1.0F : 0.0F, 1.0F);
+			return vector_to_quat(vector_mul(sin_cos, axis_mask));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Applies a rotation around a single axis after the input SoA quaternions.
+		// Components are stored as [x, y, z, w].
+		//////////////////////////////////////////////////////////////////////////
+		template<int axis>
+		inline void RTM_SIMD_CALL quat_mul_axis_soa(vector4f_arg0 half_sin, vector4f_arg1 half_cos, vector4f (&components)[4]) RTM_NO_EXCEPT
+		{
+			constexpr int axis1 = (axis + 1) % 3;
+			constexpr int axis2 = (axis + 2) % 3;
+
+			const vector4f axis_value = components[axis];
+			const vector4f axis1_value = components[axis1];
+			const vector4f axis2_value = components[axis2];
+			const vector4f w_value = components[3];
+
+			components[axis] = vector_mul_add(w_value, half_sin, vector_mul(axis_value, half_cos));
+			components[axis1] = vector_neg_mul_sub(axis2_value, half_sin, vector_mul(axis1_value, half_cos));
+			components[axis2] = vector_mul_add(axis1_value, half_sin, vector_mul(axis2_value, half_cos));
+			components[3] = vector_neg_mul_sub(axis_value, half_sin, vector_mul(w_value, half_cos));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Tait-Bryan angles are extracted by rotating the quaternion around the second
+		// axis by 90 degrees which turns them into proper Euler angles.
+		// See: Quaternion to Euler angles conversion: A direct, general and computationally
+		// efficient method (Bernardes and Viollet, 2022)
+		//////////////////////////////////////////////////////////////////////////
+		template<bool is_proper, int parity>
+		struct euler_angle_remap
+		{
+			// [a, b, c, d] -> [a - c, b + d, c + a, d - b]
+			static inline vector4f RTM_SIMD_CALL to_proper(vector4f_arg0 abcd) RTM_NO_EXCEPT
+			{
+				const vector4f cdab = vector_mix<mix4::z, mix4::w, mix4::x, mix4::y>(abcd, abcd);
+				return vector_mul_add(cdab, vector_set(-1.0F, 1.0F, 1.0F, -1.0F), abcd);
+			}
+
+			static inline void RTM_SIMD_CALL to_proper_soa(vector4f& a, vector4f& b, vector4f& c, vector4f& d) RTM_NO_EXCEPT
+			{
+				const vector4f a_ = vector_sub(a, c);
+				const vector4f b_ = vector_add(b, d);
+				const vector4f c_ = vector_add(c, a);
+				const vector4f d_ = vector_sub(d, b);
+				a = a_;
+				b = b_;
+				c = c_;
+				d = d_;
+			}
+
+			static inline vector4f RTM_SIMD_CALL from_proper(vector4f_arg0 angles) RTM_NO_EXCEPT
+			{
+				const float half_pi = rtm::constants::half_pi();
+				return vector_mul_add(angles, vector_set(1.0F, 1.0F, float(parity), 1.0F), vector_set(0.0F, -half_pi, 0.0F, 0.0F));
+			}
+
+			static inline void RTM_SIMD_CALL from_proper_soa(vector4f& second, vector4f& third) RTM_NO_EXCEPT
+			{
+				const float half_pi = rtm::constants::half_pi();
+				second = vector_sub(second, vector_set(half_pi));
+				third = vector_mul(third, float(parity));
+			}
+		};
+
+		template<int parity>
+		struct euler_angle_remap<true, parity>
+		{
+			static inline vector4f RTM_SIMD_CALL to_proper(vector4f_arg0 abcd) RTM_NO_EXCEPT { return abcd; }
+			static inline void RTM_SIMD_CALL to_proper_soa(vector4f&, vector4f&, vector4f&, vector4f&) RTM_NO_EXCEPT {}
+			static inline vector4f RTM_SIMD_CALL from_proper(vector4f_arg0 angles) RTM_NO_EXCEPT { return angles; }
+			static inline void RTM_SIMD_CALL from_proper_soa(vector4f&, vector4f&) RTM_NO_EXCEPT {}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gimbal lock is detected when the second half angle is within this threshold of 0 or PI/2.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr float euler_gimbal_lock_threshold() RTM_NO_EXCEPT { return 1.0E-6F; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Wraps angles into the [-PI, PI] range.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL euler_wrap_angles(vector4f_arg0 angles) RTM_NO_EXCEPT
+		{
+			const vector4f revolutions = vector_round_bankers(vector_mul(angles, rtm::constants::one_div_two_pi()));
+			return vector_neg_mul_sub(revolutions, rtm::constants::two_pi(), angles);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts 4 quaternions in SoA form into Euler angles in SoA form.
+		//////////////////////////////////////////////////////////////////////////
+		template<euler_order order>
+		inline void RTM_SIMD_CALL quat_to_euler_soa(vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w,
+			vector4f& out_first, vector4f& out_second, vector4f& out_third) RTM_NO_EXCEPT
+		{
+			using axes = euler_order_axes<order>;
+			using remap = euler_angle_remap<axes::is_proper, axes::parity>;
+
+			const vector4f components[3] = { quat_x, quat_y, quat_z };
+
+			vector4f a = quat_w;
+			vector4f b = components[axes::first];
+			vector4f c = components[axes::second];
+			vector4f d = axes::parity > 0 ? components[axes::last] : vector_neg(components[axes::last]);
+			remap::to_proper_soa(a, b, c, d);
+
+			const vector4f length_ab = vector_sqrt(vector_mul_add(a, a, vector_mul(b, b)));
+			const vector4f length_cd = vector_sqrt(vector_mul_add(c, c, vector_mul(d, d)));
+
+			const vector4f half_sum = vector_atan2(b, a);
+			const vector4f half_diff = vector_atan2(d, c);
+			const vector4f half_second = vector_atan2(length_cd, length_ab);
+
+			// When the second angle is 0 or PI, the first and third axes are aligned and we only retain the first angle
+			const mask4f is_sum_locked = vector_less_equal(half_second, vector_set(euler_gimbal_lock_threshold()));
+			const mask4f is_diff_locked = vector_greater_equal(half_second, vector_set(float(rtm::constants::half_pi()) - euler_gimbal_lock_threshold()));
+
+			const vector4f zero = vector_zero();
+			vector4f first = vector_select(is_diff_locked, vector_neg(vector_add(half_diff, half_diff)), vector_sub(half_sum, half_diff));
+			first = vector_select(is_sum_locked, vector_add(half_sum, half_sum), first);
+			vector4f third = vector_select(is_diff_locked, zero, vector_add(half_sum, half_diff));
+			third = vector_select(is_sum_locked, zero, third);
+			vector4f second = vector_add(half_second, half_second);
+
+			remap::from_proper_soa(second, third);
+
+			out_first = euler_wrap_angles(first);
+			out_second = second;
+			out_third = euler_wrap_angles(third);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a quaternion from Euler angles with the specified rotation order.
+	// The input [xyz] components contain the angles of the first, second, and third
+	// rotations in the order they are applied (e.g. euler_order::zyx: Z, Y, then X).
+	// The [w] component is ignored.
+	//////////////////////////////////////////////////////////////////////////
+	template<euler_order order>
+	inline quatf RTM_SIMD_CALL quat_from_euler(vector4f_arg0 angles) RTM_NO_EXCEPT
+	{
+		using axes = rtm_impl::euler_order_axes<order>;
+
+		vector4f half_sin;
+		vector4f half_cos;
+		vector_sincos(vector_mul(angles, 0.5F), half_sin, half_cos);
+
+		const quatf first = rtm_impl::quat_from_euler_axis<axes::first, 0>(half_sin, half_cos);
+		const quatf second = rtm_impl::quat_from_euler_axis<axes::second, 1>(half_sin, half_cos);
+		const quatf third = rtm_impl::quat_from_euler_axis<axes::third, 2>(half_sin, half_cos);
+		return quat_mul(quat_mul(first, second), third);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates quaternions from an array of Euler angles with the specified rotation order.
+	// Each input contains the angles of the first, second, and third rotations in
+	// the order they are applied (e.g. euler_order::zyx: Z, Y, then X).
+	// Four rotations are converted at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	template<euler_order order>
+	inline void quat_from_euler(const float3f* angles, uint32_t num_rotations, quatf* out_rotations) RTM_NO_EXCEPT
+	{
+		using axes = rtm_impl::euler_order_axes<order>;
+
+		uint32_t rotation_index = 0;
+		for (; rotation_index + 4 <= num_rotations; rotation_index += 4)
+		{
+			// Four float3f entries are contiguous and span exactly three vectors
+			const float* angles_ptr = &angles[rotation_index].x;
+			const vector4f f0s0t0f1 = vector_load(angles_ptr + 0);
+			const vector4f s1t1f2s2 = vector_load(angles_ptr + 4);
+			const vector4f t2f3s3t3 = vector_load(angles_ptr + 8);
+
+			const vector4f f0f1f2f2 = vector_mix<mix4::x, mix4::w, mix4::c, mix4::c>(f0s0t0f1, s1t1f2s2);
+			const vector4f s0s1s2s2 = vector_mix<mix4::y, mix4::a, mix4::d, mix4::d>(f0s0t0f1, s1t1f2s2);
+			const vector4f t0t1t1t1 = vector_mix<mix4::z, mix4::b, mix4::b, mix4::b>(f0s0t0f1, s1t1f2s2);
+			const vector4f first_angles = vector_mix<mix4::x, mix4::y, mix4::z, mix4::b>(f0f1f2f2, t2f3s3t3);
+			const vector4f second_angles = vector_mix<mix4::x, mix4::y, mix4::z, mix4::c>(s0s1s2s2, t2f3s3t3);
+			const vector4f third_angles = vector_mix<mix4::x, mix4::y, mix4::a, mix4::d>(t0t1t1t1, t2f3s3t3);
+
+			vector4f first_sin;
+			vector4f first_cos;
+			vector_sincos(vector_mul(first_angles, 0.5F), first_sin, first_cos);
+
+			vector4f second_sin;
+			vector4f second_cos;
+			vector_sincos(vector_mul(second_angles, 0.5F), second_sin, second_cos);
+
+			vector4f third_sin;
+			vector4f third_cos;
+			vector_sincos(vector_mul(third_angles, 0.5F), third_sin, third_cos);
+
+			const vector4f zero = vector_zero();
+			vector4f components[4] = { zero, zero, zero, first_cos };
+			components[axes::first] = first_sin;
+
+			rtm_impl::quat_mul_axis_soa<axes::second>(second_sin, second_cos, components);
+			rtm_impl::quat_mul_axis_soa<axes::third>(third_sin, third_cos, components);
+
+			vector4f rotation0;
+			vector4f rotation1;
+			vector4f rotation2;
+			vector4f rotation3;
+			RTM_MATRIXF_TRANSPOSE_4X4(components[0], components[1], components[2], components[3], rotation0, rotation1, rotation2, rotation3);
+
+			out_rotations[rotation_index + 0] = vector_to_quat(rotation0);
+			out_rotations[rotation_index + 1] = vector_to_quat(rotation1);
+			out_rotations[rotation_index + 2] = vector_to_quat(rotation2);
+			out_rotations[rotation_index + 3] = vector_to_quat(rotation3);
+		}
+
+		for (; rotation_index < num_rotations; ++rotation_index)
+			out_rotations[rotation_index] = quat_from_euler<order>(vector_load3(&angles[rotation_index]));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a quaternion into Euler angles with the specified rotation order.
+	// The result [xyz] components contain the angles of the first, second, and third
+	// rotations in the order they are applied (e.g. euler_order::zyx: Z, Y, then X).
+	// The first and third angles are in the range [-PI, PI]. The second angle is in
+	// the range [-PI/2, PI/2] for Tait-Bryan orders and [0, PI] for proper Euler orders.
+	// When the first and third axes align (gimbal lock), the third angle is set to 0.
+	// The [w] component is 0.0.
+	// See: Quaternion to Euler angles conversion: A direct, general and computationally
+	// efficient method (Bernardes and Viollet, 2022)
+	//////////////////////////////////////////////////////////////////////////
+	template<euler_order order>
+	inline vector4f RTM_SIMD_CALL quat_to_euler(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		using axes = rtm_impl::euler_order_axes<order>;
+		using remap = rtm_impl::euler_angle_remap<axes::is_proper, axes::parity>;
+
+		constexpr mix4 first_component = static_cast<mix4>(axes::first);
+		constexpr mix4 second_component = static_cast<mix4>(axes::second);
+		constexpr mix4 last_component = static_cast<mix4>(axes::last);
+
+		// [a, b, c, d] = [w, first, second, last * parity]
+		const vector4f input_v = quat_to_vector(input);
+		const vector4f wfsl = vector_mix<mix4::w, first_component, second_component, last_component>(input_v, input_v);
+		const vector4f abcd = remap::to_proper(vector_mul(wfsl, vector_set(1.0F, 1.0F, 1.0F, float(axes::parity))));
+
+		// [|ab|, |ab|, |cd|, |cd|]
+		const vector4f abcd_sq = vector_mul(abcd, abcd);
+		const vector4f lengths = vector_sqrt(vector_add(abcd_sq, vector_mix<mix4::y, mix4::x, mix4::w, mix4::z>(abcd_sq, abcd_sq)));
+
+		// [atan2(b, a), atan2(d, c), atan2(|cd|, |ab|)] = [half sum, half diff, half second]
+		const vector4f atan_y = vector_mix<mix4::y, mix4::w, mix4::c, mix4::c>(abcd, lengths);
+		const vector4f atan_x = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(abcd, lengths);
+		const vector4f half_angles = vector_atan2(atan_y, atan_x);
+
+		// [half sum, half second, half sum] and [half diff, half second, half diff]
+		const vector4f sum_terms = vector_mix<mix4::x, mix4::z, mix4::x, mix4::z>(half_angles, half_angles);
+		const vector4f diff_terms = vector_mix<mix4::y, mix4::z, mix4::y, mix4::z>(half_angles, half_angles);
+
+		// When the second angle is 0 or PI, the first and third axes are aligned and we only retain the first angle
+		const vector4f half_second = vector_dup_z(half_angles);
+		const mask4f is_sum_locked = vector_less_equal(half_second, vector_set(rtm_impl::euler_gimbal_lock_threshold()));
+		const mask4f is_diff_locked = vector_greater_equal(half_second, vector_set(float(rtm::constants::half_pi()) - rtm_impl::euler_gimbal_lock_threshold()));
+
+		const vector4f regular_angles = vector_mul_add(diff_terms, vector_set(-1.0F, 1.0F, 1.0F, 0.0F), sum_terms);
+		const vector4f sum_locked_angles = vector_mul(sum_terms, vector_set(2.0F, 2.0F, 0.0F, 0.0F));
+		const vector4f diff_locked_angles = vector_mul(diff_terms, vector_set(-2.0F, 2.0F, 0.0F, 0.0F));
+
+		vector4f angles = vector_select(is_diff_locked, diff_locked_angles, regular_angles);
+		angles = vector_select(is_sum_locked, sum_locked_angles, angles);
+		angles = remap::from_proper(angles);
+
+		// Only the first and third angles can leave the [-PI, PI] range
+		const vector4f wrapped_angles = rtm_impl::euler_wrap_angles(angles);
+		return vector_mix<mix4::a, mix4::y, mix4::c, mix4::w>(vector_set_w(angles, 0.0F), vector_set_w(wrapped_angles, 0.0F));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts an array of quaternions into Euler angles with the specified rotation order.
+	// Each output contains the angles of the first, second, and third rotations in
+	// the order they are applied (e.g. euler_order::zyx: Z, Y, then X).
+	// See quat_to_euler(quatf) for the output ranges.
+	// Four rotations are converted at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	template<euler_order order>
+	inline void quat_to_euler(const quatf* rotations, uint32_t num_rotations, float3f* out_angles) RTM_NO_EXCEPT
+	{
+		uint32_t rotation_index = 0;
+		for (; rotation_index + 4 <= num_rotations; rotation_index += 4)
+		{
+			const vector4f rotation0 = quat_to_vector(rotations[rotation_index + 0]);
+			const vector4f rotation1 = quat_to_vector(rotations[rotation_index + 1]);
+			const vector4f rotation2 = quat_to_vector(rotations[rotation_index + 2]);
+			const vector4f rotation3 = quat_to_vector(rotations[rotation_index + 3]);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			RTM_MATRIXF_TRANSPOSE_4X4(rotation0, rotation1, rotation2, rotation3, quat_x, quat_y, quat_z, quat_w);
+
+			vector4f first_angles;
+			vector4f second_angles;
+			vector4f third_angles;
+			rtm_impl::quat_to_euler_soa<order>(quat_x, quat_y, quat_z, quat_w, first_angles, second_angles, third_angles);
+
+			// Four float3f entries are contiguous and span exactly three vectors
+			const vector4f f0s0f1s1 = vector_mix<mix4::x, mix4::a, mix4::y, mix4::b>(first_angles, second_angles);
+			const vector4f f2s2f3s3 = vector_mix<mix4::z, mix4::c, mix4::w, mix4::d>(first_angles, second_angles);
+			const vector4f s1t1s1t1 = vector_mix<mix4::w, mix4::b, mix4::w, mix4::b>(f0s0f1s1, third_angles);
+
+			float* angles_ptr = &out_angles[rotation_index].x;
+			vector_store(vector_mix<mix4::x, mix4::y, mix4::a, mix4::z>(f0s0f1s1, third_angles), angles_ptr + 0);
+			vector_store(vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(s1t1s1t1, f2s2f3s3), angles_ptr + 4);
+			vector_store(vector_mix<mix4::c, mix4::z, mix4::w, mix4::d>(f2s2f3s3, third_angles), angles_ptr + 8);
+		}
+
+		for (; rotation_index < num_rotations; ++rotation_index)
+			vector_store3(quat_to_euler<order>(rotations[rotation_index]), &out_angles[rotation_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the shortest arc rotation that rotates the 'from' direction onto the 'to' direction.
+	// The input vectors do not need to be normalized but must not be zero.
+	// When the vectors are opposite, a 180 degree rotation around an arbitrary
+	// axis perpendicular to 'from' is returned.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_from_to(vector4f_arg0 from, vector4f_arg1 to) RTM_NO_EXCEPT
+	{
+		// Using the half way vector implicitly: [cross(from, to), |from| * |to| + dot(from, to)]
+		const float from_length_sq = vector_length_squared3(from);
+		const float to_length_sq = vector_length_squared3(to);
+		const float length = scalar_sqrt(from_length_sq * to_length_sq);
+		const float w = float(vector_dot3(from, to)) + length;
+
+		if (w > length * 1.0E-6F)
+			return quat_normalize(vector_to_quat(vector_set_w(vector_cross3(from, to), w)));
+
+		// Opposite vectors, use the axis least aligned with 'from' to build a perpendicular axis
+		const vector4f abs_from = vector_abs(from);
+		const vector4f perpendicular = float(vector_get_x(abs_from)) > float(vector_get_z(abs_from))
+			? vector_set(-float(vector_get_y(from)), float(vector_get_x(from)), 0.0F)
+			: vector_set(0.0F, -float(vector_get_z(from)), float(vector_get_y(from)));
+		return vector_to_quat(vector_set_w(vector_normalize3(perpendicular), 0.0F));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes a rotation into its swing and twist parts around the specified twist axis.
+	// The twist axis must be normalized.
+	// The twist is a rotation around the twist axis and the swing is a rotation around
+	// an axis perpendicular to it such that: input = quat_mul(twist, swing)
+	// When the swing is 180 degrees, the twist is undefined and the identity is returned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_swing_twist(quatf_arg0 input, vector4f_arg1 twist_axis, quatf& out_swing, quatf& out_twist) RTM_NO_EXCEPT
+	{
+		// The twist is the projection of the rotation axis onto the twist axis
+		const vector4f input_v = quat_to_vector(input);
+		const scalarf projection = vector_dot3(input_v, twist_axis);
+		const scalarf input_w = quat_get_w(input);
+		const quatf twist = vector_to_quat(vector_set_w(vector_mul(twist_axis, projection), input_w));
+
+		const quatf identity = quat_identity();
+		const float twist_length_sq = quat_length_squared(twist);
+		out_twist = twist_length_sq >= 1.0E-8F ? quat_normalize(twist) : identity;
+		out_swing = quat_mul(quat_conjugate(out_twist), input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps a swing rotation to a cone around the twist axis with the specified
+	// maximum angle in radians.
+	// The swing must be normalized and perpendicular to the twist axis (e.g. from quat_swing_twist).
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_clamp_swing(quatf_arg0 swing, float max_angle) RTM_NO_EXCEPT
+	{
+		float sin_limit;
+		float cos_limit;
+		scalar_sincos(max_angle * 0.5F, sin_limit, cos_limit);
+
+		// Use the shortest path, the swing angle is within the limit when cos(angle / 2) >= cos(limit / 2)
+		const quatf shortest_swing = float(quat_get_w(swing)) >= 0.0F ? swing : quat_neg(swing);
+		if (float(quat_get_w(shortest_swing)) >= cos_limit)
+			return shortest_swing;
+
+		const vector4f swing_axis = vector_normalize3(quat_to_vector(shortest_swing));
+		return vector_to_quat(vector_set_w(vector_mul(swing_axis, sin_limit), cos_limit));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps a twist rotation around the twist axis within the specified angles in radians.
+	// The angles must be in the range [-PI, PI] with min_angle <= max_angle.
+	// The twist must be normalized and its rotation axis aligned with the twist axis (e.g. from quat_swing_twist).
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_clamp_twist(quatf_arg0 twist, vector4f_arg1 twist_axis, float min_angle, float max_angle) RTM_NO_EXCEPT
+	{
+		vector4f sin_limits;
+		vector4f cos_limits;
+		vector_sincos(vector_set(min_angle * 0.5F, max_angle * 0.5F, 0.0F, 0.0F), sin_limits, cos_limits);
+
+		// Use the shortest path, our half angle is then in the range [-PI/2, PI/2]
+		const quatf shortest_twist = float(quat_get_w(twist)) >= 0.0F ? twist : quat_neg(twist);
+		const float sin_twist = vector_dot3(quat_to_vector(shortest_twist), twist_axis);
+		const float cos_twist = quat_get_w(shortest_twist);
+
+		// sin(angle - limit) tells us on which side of the limit we are
+		const float sin_min = vector_get_x(sin_limits);
+		const float cos_min = vector_get_x(cos_limits);
+		if (sin_twist * cos_min - cos_twist * sin_min < 0.0F)
+			return vector_to_quat(vector_set_w(vector_mul(twist_axis, sin_min), cos_min));
+
+		const float sin_max = vector_get_y(sin_limits);
+		const float cos_max = vector_get_y(cos_limits);
+		if (sin_twist * cos_max - cos_twist * sin_max > 0.0F)
+			return vector_to_quat(vector_set_w(vector_mul(twist_axis, sin_max), cos_max));
+
+		return shortest_twist;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps a rotation to a swing cone and twist limits around the twist axis.
+	// The twist axis must be normalized and the angles are in radians.
+	// See quat_swing_twist, quat_clamp_swing, and quat_clamp_twist for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_clamp_swing_twist(quatf_arg0 input, vector4f_arg1 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle) RTM_NO_EXCEPT
+	{
+		quatf swing;
+		quatf twist;
+		quat_swing_twist(input, twist_axis, swing, twist);
+
+		swing = quat_clamp_swing(swing, max_swing_angle);
+		twist = quat_clamp_twist(twist, twist_axis, min_twist_angle, max_twist_angle);
+		return quat_mul(twist, swing);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_from_to for 4 pairs of vectors.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_from_to_soa(vector4f_arg0 from_x, vector4f_arg1 from_y, vector4f_arg2 from_z,
+			vector4f_arg3 to_x, vector4f_arg4 to_y, vector4f_arg5 to_z,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f from_length_sq = vector_mul_add(from_z, from_z, vector_mul_add(from_y, from_y, vector_mul(from_x, from_x)));
+			const vector4f to_length_sq = vector_mul_add(to_z, to_z, vector_mul_add(to_y, to_y, vector_mul(to_x, to_x)));
+			const vector4f length = vector_sqrt(vector_mul(from_length_sq, to_length_sq));
+			const vector4f dot = vector_mul_add(from_z, to_z, vector_mul_add(from_y, to_y, vector_mul(from_x, to_x)));
+
+			vector4f x = vector_neg_mul_sub(from_z, to_y, vector_mul(from_y, to_z));
+			vector4f y = vector_neg_mul_sub(from_x, to_z, vector_mul(from_z, to_x));
+			vector4f z = vector_neg_mul_sub(from_y, to_x, vector_mul(from_x, to_y));
+			vector4f w = vector_add(dot, length);
+
+			// Opposite vectors, use the axis least aligned with 'from' to build a perpendicular axis
+			const vector4f zero = vector_zero();
+			const mask4f is_opposite = vector_less_equal(w, vector_mul(length, 1.0E-6F));
+			const mask4f is_x_larger = vector_greater_than(vector_abs(from_x), vector_abs(from_z));
+			const vector4f perpendicular_x = vector_select(is_x_larger, vector_neg(from_y), zero);
+			const vector4f perpendicular_y = vector_select(is_x_larger, from_x, vector_neg(from_z));
+			const vector4f perpendicular_z = vector_select(is_x_larger, zero, from_y);
+
+			x = vector_select(is_opposite, perpendicular_x, x);
+			y = vector_select(is_opposite, perpendicular_y, y);
+			z = vector_select(is_opposite, perpendicular_z, z);
+			w = vector_select(is_opposite, zero, w);
+
+			const vector4f length_sq = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(length_sq));
+			out_x = vector_mul(x, inv_length);
+			out_y = vector_mul(y, inv_length);
+			out_z = vector_mul(z, inv_length);
+			out_w = vector_mul(w, inv_length);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_swing_twist for 4 rotations and twist axes.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_swing_twist_soa(vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w,
+			vector4f_arg4 axis_x, vector4f_arg5 axis_y, vector4f_arg6 axis_z,
+			vector4f& out_swing_x, vector4f& out_swing_y, vector4f& out_swing_z, vector4f& out_swing_w,
+			vector4f& out_twist_x, vector4f& out_twist_y, vector4f& out_twist_z, vector4f& out_twist_w) RTM_NO_EXCEPT
+		{
+			const vector4f projection = vector_mul_add(quat_z, axis_z, vector_mul_add(quat_y, axis_y, vector_mul(quat_x, axis_x)));
+			const vector4f twist_x = vector_mul(axis_x, projection);
+			const vector4f twist_y = vector_mul(axis_y, projection);
+			const vector4f twist_z = vector_mul(axis_z, projection);
+
+			// When the swing is 180 degrees, the twist is the identity
+			const vector4f twist_length_sq = vector_mul_add(quat_w, quat_w, vector_mul(projection, projection));
+			const mask4f is_twist_valid = vector_greater_equal(twist_length_sq, vector_set(1.0E-8F));
+			const vector4f inv_twist_length = vector_div(vector_set(1.0F), vector_sqrt(twist_length_sq));
+
+			const vector4f zero = vector_zero();
+			const vector4f tx = vector_select(is_twist_valid, vector_mul(twist_x, inv_twist_length), zero);
+			const vector4f ty = vector_select(is_twist_valid, vector_mul(twist_y, inv_twist_length), zero);
+			const vector4f tz = vector_select(is_twist_valid, vector_mul(twist_z, inv_twist_length), zero);
+			const vector4f tw = vector_select(is_twist_valid, vector_mul(quat_w, inv_twist_length), vector_set(1.0F));
+
+			// swing = quat_mul(quat_conjugate(twist), input)
+			out_swing_x = vector_sub(vector_neg_mul_sub(quat_w, tx, vector_mul(tw, quat_x)), vector_neg_mul_sub(quat_z, ty, vector_mul(quat_y, tz)));
+			out_swing_y = vector_sub(vector_neg_mul_sub(quat_w, ty, vector_mul(tw, quat_y)), vector_neg_mul_sub(quat_x, tz, vector_mul(quat_z, tx)));
+			out_swing_z = vector_sub(vector_neg_mul_sub(quat_w, tz, vector_mul(tw, quat_z)), vector_neg_mul_sub(quat_y, tx, vector_mul(quat_x, ty)));
+			out_swing_w = vector_mul_add(quat_z, tz, vector_mul_add(quat_y, ty, vector_mul_add(quat_x, tx, vector_mul(quat_w, tw))));
+
+			out_twist_x = tx;
+			out_twist_y = ty;
+			out_twist_z = tz;
+			out_twist_w = tw;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_clamp_swing for 4 swings with their limit's half angle sine and cosine.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_clamp_swing_soa(vector4f_arg0 sin_limit, vector4f_arg1 cos_limit,
+			vector4f& swing_x, vector4f& swing_y, vector4f& swing_z, vector4f& swing_w) RTM_NO_EXCEPT
+		{
+			// Use the shortest path
+			const vector4f sign = vector_select(vector_less_than(swing_w, vector_zero()), vector_set(-1.0F), vector_set(1.0F));
+			const vector4f x = vector_mul(swing_x, sign);
+			const vector4f y = vector_mul(swing_y, sign);
+			const vector4f z = vector_mul(swing_z, sign);
+			const vector4f w = vector_mul(swing_w, sign);
+
+			const vector4f axis_length_sq = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+			const vector4f scale = vector_div(sin_limit, vector_sqrt(vector_max(axis_length_sq, vector_set(1.0E-16F))));
+
+			const mask4f is_outside = vector_less_than(w, cos_limit);
+			swing_x = vector_select(is_outside, vector_mul(x, scale), x);
+			swing_y = vector_select(is_outside, vector_mul(y, scale), y);
+			swing_z = vector_select(is_outside, vector_mul(z, scale), z);
+			swing_w = vector_select(is_outside, cos_limit, w);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// SoA version of quat_clamp_twist for 4 twists with their limits' half angle sine and cosine.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_clamp_twist_soa(vector4f_arg0 axis_x, vector4f_arg1 axis_y, vector4f_arg2 axis_z,
+			vector4f_arg3 sin_min, vector4f_arg4 cos_min, vector4f_arg5 sin_max, vector4f_arg6 cos_max,
+			vector4f& twist_x, vector4f& twist_y, vector4f& twist_z, vector4f& twist_w) RTM_NO_EXCEPT
+		{
+			// Use the shortest path, our half angle is then in the range [-PI/2, PI/2]
+			const vector4f sign = vector_select(vector_less_than(twist_w, vector_zero()), vector_set(-1.0F), vector_set(1.0F));
+			const vector4f sin_twist = vector_mul(vector_mul_add(twist_z, axis_z, vector_mul_add(twist_y, axis_y, vector_mul(twist_x, axis_x))), sign);
+			const vector4f cos_twist = vector_mul(twist_w, sign);
+
+			// sin(angle - limit) tells us on which side of the limit we are
+			const mask4f is_below_min = vector_less_than(vector_neg_mul_sub(cos_twist, sin_min, vector_mul(sin_twist, cos_min)), vector_zero());
+			const mask4f is_above_max = vector_greater_than(vector_neg_mul_sub(cos_twist, sin_max, vector_mul(sin_twist, cos_max)), vector_zero());
+
+			vector4f sin_result = vector_select(is_below_min, sin_min, sin_twist);
+			sin_result = vector_select(is_above_max, sin_max, sin_result);
+			vector4f cos_result = vector_select(is_below_min, cos_min, cos_twist);
+			cos_result = vector_select(is_above_max, cos_max, cos_result);
+
+			twist_x = vector_mul(axis_x, sin_result);
+			twist_y = vector_mul(axis_y, sin_result);
+			twist_z = vector_mul(axis_z, sin_result);
+			twist_w = cos_result;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the shortest arc rotations between arrays of directions.
+	// See quat_from_to(vector4f, vector4f) for details.
+	// Four rotations are computed at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_to(const vector4f* from, const vector4f* to, uint32_t num_rotations, quatf* out_rotations) RTM_NO_EXCEPT
+	{
+		uint32_t rotation_index = 0;
+		for (; rotation_index + 4 <= num_rotations; rotation_index += 4)
+		{
+			vector4f from_x;
+			vector4f from_y;
+			vector4f from_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(from[rotation_index + 0], from[rotation_index + 1], from[rotation_index + 2], from[rotation_index + 3], from_x, from_y, from_z);
+
+			vector4f to_x;
+			vector4f to_y;
+			vector4f to_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(to[rotation_index + 0], to[rotation_index + 1], to[rotation_index + 2], to[rotation_index + 3], to_x, to_y, to_z);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			rtm_impl::quat_from_to_soa(from_x, from_y, from_z, to_x, to_y, to_z, quat_x, quat_y, quat_z, quat_w);
+
+			vector4f rotation0;
+			vector4f rotation1;
+			vector4f rotation2;
+			vector4f rotation3;
+			RTM_MATRIXF_TRANSPOSE_4X4(quat_x, quat_y, quat_z, quat_w, rotation0, rotation1, rotation2, rotation3);
+
+			out_rotations[rotation_index + 0] = vector_to_quat(rotation0);
+			out_rotations[rotation_index + 1] = vector_to_quat(rotation1);
+			out_rotations[rotation_index + 2] = vector_to_quat(rotation2);
+			out_rotations[rotation_index + 3] = vector_to_quat(rotation3);
+		}
+
+		for (; rotation_index < num_rotations; ++rotation_index)
+			out_rotations[rotation_index] = quat_from_to(from[rotation_index], to[rotation_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes an array of rotations into their swing and twist parts around their twist axis.
+	// See quat_swing_twist(quatf, vector4f, quatf&, quatf&) for details.
+	// Four rotations are decomposed at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_swing_twist(const quatf* inputs, const vector4f* twist_axes, uint32_t num_rotations, quatf* out_swings, quatf* out_twists) RTM_NO_EXCEPT
+	{
+		uint32_t rotation_index = 0;
+		for (; rotation_index + 4 <= num_rotations; rotation_index += 4)
+		{
+			const vector4f input0 = quat_to_vector(inputs[rotation_index + 0]);
+			const vector4f input1 = quat_to_vector(inputs[rotation_index + 1]);
+			const vector4f input2 = quat_to_vector(inputs[rotation_index + 2]);
+			const vector4f input3 = quat_to_vector(inputs[rotation_index + 3]);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			RTM_MATRIXF_TRANSPOSE_4X4(input0, input1, input2, input3, quat_x, quat_y, quat_z, quat_w);
+
+			vector4f axis_x;
+			vector4f axis_y;
+			vector4f axis_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(twist_axes[rotation_index + 0], twist_axes[rotation_index + 1], twist_axes[rotation_index + 2], twist_axes[rotation_index + 3], axis_x, axis_y, axis_z);
+
+			vector4f swing_x;
+			vector4f swing_y;
+			vector4f swing_z;
+			vector4f swing_w;
+			vector4f twist_x;
+			vector4f twist_y;
+			vector4f twist_z;
+			vector4f twist_w;
+			rtm_impl::quat_swing_twist_soa(quat_x, quat_y, quat_z, quat_w, axis_x, axis_y, axis_z,
+				swing_x, swing_y, swing_z, swing_w, twist_x, twist_y, twist_z, twist_w);
+
+			vector4f swing0;
+			vector4f swing1;
+			vector4f swing2;
+			vector4f swing3;
+			RTM_MATRIXF_TRANSPOSE_4X4(swing_x, swing_y, swing_z, swing_w, swing0, swing1, swing2, swing3);
+
+			out_swings[rotation_index + 0] = vector_to_quat(swing0);
+			out_swings[rotation_index + 1] = vector_to_quat(swing1);
+			out_swings[rotation_index + 2] = vector_to_quat(swing2);
+			out_swings[rotation_index + 3] = vector_to_quat(swing3);
+
+			vector4f twist0;
+			vector4f twist1;
+			vector4f twist2;
+			vector4f twist3;
+			RTM_MATRIXF_TRANSPOSE_4X4(twist_x, twist_y, twist_z, twist_w, twist0, twist1, twist2, twist3);
+
+			out_twists[rotation_index + 0] = vector_to_quat(twist0);
+			out_twists[rotation_index + 1] = vector_to_quat(twist1);
+			out_twists[rotation_index + 2] = vector_to_quat(twist2);
+			out_twists[rotation_index + 3] = vector_to_quat(twist3);
+		}
+
+		for (; rotation_index < num_rotations; ++rotation_index)
+			quat_swing_twist(inputs[rotation_index], twist_axes[rotation_index], out_swings[rotation_index], out_twists[rotation_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps an array of rotations to their swing cone and twist limits around their twist axis.
+	// Each rotation has its own normalized twist axis and limits in radians.
+	// See quat_clamp_swing_twist(quatf, vector4f, float, float, float) for details.
+	// Four rotations are clamped at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_clamp_swing_twist(const quatf* inputs, const vector4f* twist_axes, const float* max_swing_angles,
+		const float* min_twist_angles, const float* max_twist_angles, uint32_t num_rotations, quatf* out_rotations) RTM_NO_EXCEPT
+	{
+		uint32_t rotation_index = 0;
+		for (; rotation_index + 4 <= num_rotations; rotation_index += 4)
+		{
+			const vector4f input0 = quat_to_vector(inputs[rotation_index + 0]);
+			const vector4f input1 = quat_to_vector(inputs[rotation_index + 1]);
+			const vector4f input2 = quat_to_vector(inputs[rotation_index + 2]);
+			const vector4f input3 = quat_to_vector(inputs[rotation_index + 3]);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			RTM_MATRIXF_TRANSPOSE_4X4(input0, input1, input2, input3, quat_x, quat_y, quat_z, quat_w);
+
+			vector4f axis_x;
+			vector4f axis_y;
+			vector4f axis_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(twist_axes[rotation_index + 0], twist_axes[rotation_index + 1], twist_axes[rotation_index + 2], twist_axes[rotation_index + 3], axis_x, axis_y, axis_z);
+
+			vector4f swing_x;
+			vector4f swing_y;
+			vector4f swing_z;
+			vector4f swing_w;
+			vector4f twist_x;
+			vector4f twist_y;
+			vector4f twist_z;
+			vector4f twist_w;
+			rtm_impl::quat_swing_twist_soa(quat_x, quat_y, quat_z, quat_w, axis_x, axis_y, axis_z,
+				swing_x, swing_y, swing_z, swing_w, twist_x, twist_y, twist_z, twist_w);
+
+			vector4f sin_swing;
+			vector4f cos_swing;
+			vector_sincos(vector_mul(vector_load(max_swing_angles + rotation_index), 0.5F), sin_swing, cos_swing);
+			rtm_impl::quat_clamp_swing_soa(sin_swing, cos_swing, swing_x, swing_y, swing_z, swing_w);
+
+			vector4f sin_min;
+			vector4f cos_min;
+			vector_sincos(vector_mul(vector_load(min_twist_angles + rotation_index), 0.5F), sin_min, cos_min);
+
+			vector4f sin_max;
+			vector4f cos_max;
+			vector_sincos(vector_mul(vector_load(max_twist_angles + rotation_index), 0.5F), sin_max, cos_max);
+			rtm_impl::quat_clamp_twist_soa(axis_x, axis_y, axis_z, sin_min, cos_min, sin_max, cos_max, twist_x, twist_y, twist_z, twist_w);
+
+			// result = quat_mul(twist, swing)
+			const vector4f result_x = vector_add(vector_mul_add(swing_w, twist_x, vector_mul(swing_x, twist_w)), vector_neg_mul_sub(swing_z, twist_y, vector_mul(swing_y, twist_z)));
+			const vector4f result_y = vector_add(vector_mul_add(swing_w, twist_y, vector_mul(swing_y, twist_w)), vector_neg_mul_sub(swing_x, twist_z, vector_mul(swing_z, twist_x)));
+			const vector4f result_z = vector_add(vector_mul_add(swing_w, twist_z, vector_mul(swing_z, twist_w)), vector_neg_mul_sub(swing_y, twist_x, vector_mul(swing_x, twist_y)));
+			const vector4f result_w = vector_neg_mul_sub(swing_z, twist_z, vector_neg_mul_sub(swing_y, twist_y, vector_neg_mul_sub(swing_x, twist_x, vector_mul(swing_w, twist_w))));
+
+			vector4f rotation0;
+			vector4f rotation1;
+			vector4f rotation2;
+			vector4f rotation3;
+			RTM_MATRIXF_TRANSPOSE_4X4(result_x, result_y, result_z, result_w, rotation0, rotation1, rotation2, rotation3);
+
+			out_rotations[rotation_index + 0] = vector_to_quat(rotation0);
+			out_rotations[rotation_index + 1] = vector_to_quat(rotation1);
+			out_rotations[rotation_index + 2] = vector_to_quat(rotation2);
+			out_rotations[rotation_index + 3] = vector_to_quat(rotation3);
+		}
+
+		for (; rotation_index < num_rotations; ++rotation_index)
+			out_rotations[rotation_index] = quat_clamp_swing_twist(inputs[rotation_index], twist_axes[rotation_index], max_swing_angles[rotation_index], min_twist_angles[rotation_index], max_twist_angles[rotation_index]);
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,14 @@ RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
 {
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an aligned QVV transform from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_load(const aligned_qvvf* input) RTM_NO_EXCEPT
+	{
+		return qvvf{ quat_load(&input->rotation), vector_load(&input->translation), vector_load(&input->scale) };
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a QVV transform float64 variant to a float32 variant.
 	//////////////////////////////////////////////////////////////////////////
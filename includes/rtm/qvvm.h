@@ -0,0 +1,178 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2017 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/quatd.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvd.h"
+#include "rtm/vector4d.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/qvv_common.h"
+
+#include <type_traits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a mixed precision QVV transform from a rotation quaternion, a translation, and a 3D scale.
+	// The translation must be a vector4d, this keeps qvv_set(quat_identity(), vector_zero(), ..)
+	// unambiguous for qvvf.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename translation_type, typename std::enable_if<std::is_same<translation_type, vector4d>::value, int>::type = 0>
+	constexpr qvvm qvv_set(quatf_arg0 rotation, const translation_type& translation, vector4f_arg2 scale) RTM_NO_EXCEPT
+	{
+		return qvvm{ rotation, translation, scale };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a mixed precision QVV transform to a float64 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_cast(const qvvm& input) RTM_NO_EXCEPT
+	{
+		return qvvd{ quat_cast(input.rotation), input.translation, vector_cast(input.scale) };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates a float64 3D vector with a float32 rotation in float64.
+		// A float32 quaternion is only normalized within about 1.0e-7, far away from the
+		// origin that error alone would move the result by several units. Instead, we rotate
+		// by the exact rotation the quaternion represents by dividing by its squared length.
+		// The cross product form is used, it is much cheaper than the conjugate sandwich:
+		// t = 2 * cross(rotation.xyz, vector) / length_sq(rotation)
+		// result = vector + rotation.w * t + cross(rotation.xyz, t)
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d RTM_SIMD_CALL qvvm_rotate_vector3(const vector4d& vector, quatf_arg0 rotation) RTM_NO_EXCEPT
+		{
+			const double rotation_x = double(float(quat_get_x(rotation)));
+			const double rotation_y = double(float(quat_get_y(rotation)));
+			const double rotation_z = double(float(quat_get_z(rotation)));
+			const double rotation_w = double(float(quat_get_w(rotation)));
+			const double vector_x = vector_get_x(vector);
+			const double vector_y = vector_get_y(vector);
+			const double vector_z = vector_get_z(vector);
+
+			const double length_sq = (rotation_x * rotation_x) + (rotation_y * rotation_y) + (rotation_z * rotation_z) + (rotation_w * rotation_w);
+			const double t_scale = 2.0 / length_sq;
+			const double t_x = t_scale * ((rotation_y * vector_z) - (rotation_z * vector_y));
+			const double t_y = t_scale * ((rotation_z * vector_x) - (rotation_x * vector_z));
+			const double t_z = t_scale * ((rotation_x * vector_y) - (rotation_y * vector_x));
+
+			return vector_set(
+				vector_x + (rotation_w * t_x) + ((rotation_y * t_z) - (rotation_z * t_y)),
+				vector_y + (rotation_w * t_y) + ((rotation_z * t_x) - (rotation_x * t_z)),
+				vector_z + (rotation_w * t_z) + ((rotation_x * t_y) - (rotation_y * t_x)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// If we have negative scale, we go through a float64 matrix.
+		// Kept out of line since it is rare and large.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_NOINLINE inline qvvm qvv_mul_negative_scale(const qvvm& lhs, const qvvm& rhs) RTM_NO_EXCEPT
+		{
+			const qvvd result = qvv_mul(qvv_cast(lhs), qvv_cast(rhs));
+			return qvv_set(quat_cast(result.rotation), result.translation, vector_cast(result.scale));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two mixed precision QVV transforms.
+	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
+	// The rotation and scale are combined in float32, the translation in float64.
+	// NOTE: When scale is present, multiplication will not properly handle skew/shear,
+	// use affine matrices if you have issues.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvm qvv_mul(const qvvm& lhs, const qvvm& rhs) RTM_NO_EXCEPT
+	{
+		const vector4f min_scale = vector_min(lhs.scale, rhs.scale);
+
+		if (vector_any_less_than3(min_scale, vector_zero()))
+			return rtm_impl::qvv_mul_negative_scale(lhs, rhs);
+
+		const quatf rotation = quat_mul(lhs.rotation, rhs.rotation);
+		const vector4f scale = vector_mul(lhs.scale, rhs.scale);
+
+		// Only the translation needs the extra precision, it is rotated in float64
+		const vector4d translation = vector_add(rtm_impl::qvvm_rotate_vector3(vector_mul(lhs.translation, vector_cast(rhs.scale)), rhs.rotation), rhs.translation);
+		return qvv_set(rotation, translation, scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a mixed precision QVV transform and a float32 3D point.
+	// The point is transformed in float32 and offset by the float64 translation,
+	// this is best suited for points local to the transform.
+	// Multiplication order is as follow: world_position = qvv_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d qvv_mul_point3(vector4f_arg0 point, const qvvm& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(vector_cast(quat_mul_vector3(vector_mul(qvv.scale, point), qvv.rotation)), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a mixed precision QVV transform and a float64 3D point.
+	// Multiplication order is as follow: world_position = qvv_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d qvv_mul_point3(const vector4d& point, const qvvm& qvv) RTM_NO_EXCEPT
+	{
+		return vector_add(rtm_impl::qvvm_rotate_vector3(vector_mul(vector_cast(qvv.scale), point), qvv.rotation), qvv.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the inverse of the input mixed precision QVV transform.
+	// The translation is divided by the scale in float64, the float32 reciprocal
+	// would lose the precision the translation needs.
+	// NOTE: The inverse scale is float32, transforming far away points with it
+	// retains float64 precision only when the reciprocal is exact (e.g. powers of two).
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvm qvv_inverse(const qvvm& input) RTM_NO_EXCEPT
+	{
+		const quatf inv_rotation = quat_conjugate(input.rotation);
+		const vector4f inv_scale = vector_reciprocal(input.scale);
+		const vector4d scale = vector_cast(input.scale);
+		const vector4d inv_translation = vector_neg(rtm_impl::qvvm_rotate_vector3(vector_div(input.translation, scale), inv_rotation));
+		return qvv_set(inv_rotation, inv_translation, inv_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a mixed precision QVV transform into a float32 affine 3x4 matrix
+	// relative to the provided origin (e.g. the camera position).
+	// The translation is made relative in float64 before it is converted which
+	// retains precision near the origin regardless of how far it is in the world.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f matrix_from_qvv(const qvvm& transform, const vector4d& origin) RTM_NO_EXCEPT
+	{
+		const vector4f relative_translation = vector_cast(vector_sub(transform.translation, origin));
+		return matrix_from_qvv(transform.rotation, relative_translation, transform.scale);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,535 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/aabbf.h"
+#include "rtm/macros.h"
+#include "rtm/mask4f.h"
+#include "rtm/math.h"
+#include "rtm/scalarf.h"
+#include "rtm/spheref.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+#include <limits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a ray from its origin and direction.
+	//////////////////////////////////////////////////////////////////////////
+	inline rayf RTM_SIMD_CALL ray_set(vector4f_arg0 origin, vector4f_arg1 direction) RTM_NO_EXCEPT
+	{
+		return rayf{ origin, direction };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point along the ray at the provided distance: origin + direction * t
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL ray_get_point(rayf_arg0 ray, float t) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(ray.direction, t, ray.origin);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects the triangle and writes the distance along
+	// the ray of the intersection point. Both triangle faces are considered.
+	// Uses the Möller-Trumbore algorithm. Rays parallel to the triangle plane never hit.
+	// Note: The output distance is left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL ray_intersect_triangle(rayf_arg0 ray, vector4f_arg2 vertex0, vector4f_arg3 vertex1, vector4f_arg4 vertex2, float& out_t) RTM_NO_EXCEPT
+	{
+		const vector4f edge1 = vector_sub(vertex1, vertex0);
+		const vector4f edge2 = vector_sub(vertex2, vertex0);
+
+		const vector4f p = vector_cross3(ray.direction, edge2);
+		const float det = vector_dot3(edge1, p);
+		if (det == 0.0F)
+			return false;
+
+		const float inv_det = 1.0F / det;
+
+		const vector4f s = vector_sub(ray.origin, vertex0);
+		const float u = float(vector_dot3(s, p)) * inv_det;
+		if (u < 0.0F || u > 1.0F)
+			return false;
+
+		const vector4f q = vector_cross3(s, edge1);
+		const float v = float(vector_dot3(ray.direction, q)) * inv_det;
+		if (v < 0.0F || u + v > 1.0F)
+			return false;
+
+		const float t = float(vector_dot3(edge2, q)) * inv_det;
+		if (t < 0.0F)
+			return false;
+
+		out_t = t;
+		return true;
+	}
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects the axis aligned bounding box and writes
+	// the distance along the ray where it enters the box. If the ray origin is inside
+	// the box, the distance is zero.
+	// Uses the slab method.
+	// Note: The output distance is left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL ray_intersect_aabb(rayf_arg0 ray, aabbf_arg1 aabb, float& out_t) RTM_NO_EXCEPT
+	{
+		// Axis aligned directions yield infinities which the min/max below handle
+		const vector4f inv_direction = vector_div(vector_set(1.0F), ray.direction);
+
+		const vector4f t0 = vector_mul(vector_sub(vector_sub(aabb.center, aabb.extent), ray.origin), inv_direction);
+		const vector4f t1 = vector_mul(vector_sub(vector_add(aabb.center, aabb.extent), ray.origin), inv_direction);
+		const vector4f t_min = vector_min(t0, t1);
+		const vector4f t_max = vector_max(t0, t1);
+
+		const float t_min_x = vector_get_x(t_min);
+		const float t_min_y = vector_get_y(t_min);
+		const float t_min_z = vector_get_z(t_min);
+		const float t_max_x = vector_get_x(t_max);
+		const float t_max_y = vector_get_y(t_max);
+		const float t_max_z = vector_get_z(t_max);
+
+		const float t_enter = scalar_max(scalar_max(scalar_max(t_min_x, t_min_y), t_min_z), 0.0F);
+		const float t_exit = scalar_min(scalar_min(t_max_x, t_max_y), t_max_z);
+		if (t_exit < t_enter)
+			return false;
+
+		out_t = t_enter;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects the bounding sphere and writes the distance
+	// along the ray where it enters the sphere. If the ray origin is inside the sphere,
+	// the distance where it exits is written instead.
+	// Note: The ray direction must not be zero.
+	// Note: The output distance is left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL ray_intersect_sphere(rayf_arg0 ray, spheref_arg1 sphere, float& out_t) RTM_NO_EXCEPT
+	{
+		const float radius = sphere_get_radius(sphere);
+		const vector4f center_to_origin = vector_sub(ray.origin, sphere.center_radius);
+
+		// Solve: a*t^2 + 2*b*t + c = 0
+		const float a = vector_length_squared3(ray.direction);
+		const float b = vector_dot3(center_to_origin, ray.direction);
+		const float c = float(vector_length_squared3(center_to_origin)) - radius * radius;
+
+		const float discriminant = b * b - a * c;
+		if (discriminant < 0.0F)
+			return false;
+
+		const float discriminant_sqrt = scalar_sqrt(discriminant);
+		float t = (-b - discriminant_sqrt) / a;
+		if (t < 0.0F)
+			t = (-b + discriminant_sqrt) / a;
+
+		if (t < 0.0F)
+			return false;
+
+		out_t = t;
+		return true;
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A ray in SoA form: each component is broadcast into every lane so we can
+		// test it against 4 primitives at once.
+		//////////////////////////////////////////////////////////////////////////
+		struct rayf_soa
+		{
+			vector4f	origin_xxxx;
+			vector4f	origin_yyyy;
+			vector4f	origin_zzzz;
+			vector4f	direction_xxxx;
+			vector4f	direction_yyyy;
+			vector4f	direction_zzzz;
+		};
+
+		inline rayf_soa RTM_SIMD_CALL ray_to_soa(rayf_arg0 ray) RTM_NO_EXCEPT
+		{
+			return rayf_soa{
+				vector_dup_x(ray.origin), vector_dup_y(ray.origin), vector_dup_z(ray.origin),
+				vector_dup_x(ray.direction), vector_dup_y(ray.direction), vector_dup_z(ray.direction) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Tracks the closest hit seen by each lane.
+		// Primitive indices are stored as floats which is exact below 2^24.
+		//////////////////////////////////////////////////////////////////////////
+		struct ray_closest_hits
+		{
+			vector4f	t;
+			vector4f	index;
+		};
+
+		inline ray_closest_hits ray_closest_hits_init() RTM_NO_EXCEPT
+		{
+			return ray_closest_hits{ vector_set(std::numeric_limits<float>::infinity()), vector_set(-1.0F) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Updates the closest hits with 4 new candidates. Misses must have an infinite distance.
+		// Strict comparison retains the lowest index on ties since indices only grow.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL ray_closest_hits_update(ray_closest_hits& hits, vector4f_arg0 hit_t, vector4f_arg1 hit_index) RTM_NO_EXCEPT
+		{
+			const mask4f is_closer = vector_less_than(hit_t, hits.t);
+			hits.t = vector_select(is_closer, hit_t, hits.t);
+			hits.index = vector_select(is_closer, hit_index, hits.index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces the closest hits of every lane into a single closest hit, the lowest index
+		// wins on ties. Returns false if nothing was hit.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool ray_closest_hits_reduce(const ray_closest_hits& hits, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+		{
+			float hit_t[4];
+			float hit_index[4];
+			vector_store(hits.t, &hit_t[0]);
+			vector_store(hits.index, &hit_index[0]);
+
+			float closest_t = std::numeric_limits<float>::infinity();
+			uint32_t closest_index = ~0U;
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			{
+				if (hit_index[lane_index] < 0.0F)
+					continue;	// No hit in this lane
+
+				const uint32_t primitive_index = static_cast<uint32_t>(hit_index[lane_index]);
+				if (hit_t[lane_index] < closest_t || (hit_t[lane_index] == closest_t && primitive_index < closest_index))
+				{
+					closest_t = hit_t[lane_index];
+					closest_index = primitive_index;
+				}
+			}
+
+			if (closest_index == ~0U)
+				return false;
+
+			out_t = closest_t;
+			out_index = closest_index;
+			return true;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects any of the provided triangles and writes the
+	// distance along the ray and the index of the closest one. The lowest index wins on ties.
+	// Triangles are stored as 3 consecutive vertices.
+	// See ray_intersect_triangle(..) above for details.
+	// Triangles are processed 4 at a time in SoA form.
+	// Note: The outputs are left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool ray_intersect_triangles(rayf_arg0 ray, const float3f* vertices, uint32_t num_triangles, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_triangles <= (1U << 24), "Too many triangles, indices must be exactly representable as floats");
+
+		const rtm_impl::rayf_soa ray_soa = rtm_impl::ray_to_soa(ray);
+		const vector4f zero = vector_zero();
+		const vector4f one = vector_set(1.0F);
+		const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+
+		rtm_impl::ray_closest_hits hits = rtm_impl::ray_closest_hits_init();
+		vector4f triangle_indices = vector_set(0.0F, 1.0F, 2.0F, 3.0F);
+		const vector4f four = vector_set(4.0F);
+
+		uint32_t triangle_index = 0;
+		for (; triangle_index + 4 <= num_triangles; triangle_index += 4)
+		{
+			const float3f* triangle_vertices = vertices + triangle_index * 3;
+
+			// Load 4 floats at a time, the [w] component is ignored, the last vertex
+			// is loaded with 3 floats to avoid reading past the end of the array
+			const vector4f vertex00 = vector_load(&triangle_vertices[0].x);
+			const vector4f vertex01 = vector_load(&triangle_vertices[1].x);
+			const vector4f vertex02 = vector_load(&triangle_vertices[2].x);
+			const vector4f vertex10 = vector_load(&triangle_vertices[3].x);
+			const vector4f vertex11 = vector_load(&triangle_vertices[4].x);
+			const vector4f vertex12 = vector_load(&triangle_vertices[5].x);
+			const vector4f vertex20 = vector_load(&triangle_vertices[6].x);
+			const vector4f vertex21 = vector_load(&triangle_vertices[7].x);
+			const vector4f vertex22 = vector_load(&triangle_vertices[8].x);
+			const vector4f vertex30 = vector_load(&triangle_vertices[9].x);
+			const vector4f vertex31 = vector_load(&triangle_vertices[10].x);
+			const vector4f vertex32 = vector_load3(triangle_vertices + 11);
+
+			vector4f vertex0_xxxx;
+			vector4f vertex0_yyyy;
+			vector4f vertex0_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(vertex00, vertex10, vertex20, vertex30, vertex0_xxxx, vertex0_yyyy, vertex0_zzzz);
+
+			vector4f vertex1_xxxx;
+			vector4f vertex1_yyyy;
+			vector4f vertex1_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(vertex01, vertex11, vertex21, vertex31, vertex1_xxxx, vertex1_yyyy, vertex1_zzzz);
+
+			vector4f vertex2_xxxx;
+			vector4f vertex2_yyyy;
+			vector4f vertex2_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(vertex02, vertex12, vertex22, vertex32, vertex2_xxxx, vertex2_yyyy, vertex2_zzzz);
+
+			const vector4f edge1_xxxx = vector_sub(vertex1_xxxx, vertex0_xxxx);
+			const vector4f edge1_yyyy = vector_sub(vertex1_yyyy, vertex0_yyyy);
+			const vector4f edge1_zzzz = vector_sub(vertex1_zzzz, vertex0_zzzz);
+			const vector4f edge2_xxxx = vector_sub(vertex2_xxxx, vertex0_xxxx);
+			const vector4f edge2_yyyy = vector_sub(vertex2_yyyy, vertex0_yyyy);
+			const vector4f edge2_zzzz = vector_sub(vertex2_zzzz, vertex0_zzzz);
+
+			// p = cross(direction, edge2)
+			const vector4f p_xxxx = vector_neg_mul_sub(ray_soa.direction_zzzz, edge2_yyyy, vector_mul(ray_soa.direction_yyyy, edge2_zzzz));
+			const vector4f p_yyyy = vector_neg_mul_sub(ray_soa.direction_xxxx, edge2_zzzz, vector_mul(ray_soa.direction_zzzz, edge2_xxxx));
+			const vector4f p_zzzz = vector_neg_mul_sub(ray_soa.direction_yyyy, edge2_xxxx, vector_mul(ray_soa.direction_xxxx, edge2_yyyy));
+
+			const vector4f det = vector_mul_add(edge1_zzzz, p_zzzz, vector_mul_add(edge1_yyyy, p_yyyy, vector_mul(edge1_xxxx, p_xxxx)));
+
+			const vector4f s_xxxx = vector_sub(ray_soa.origin_xxxx, vertex0_xxxx);
+			const vector4f s_yyyy = vector_sub(ray_soa.origin_yyyy, vertex0_yyyy);
+			const vector4f s_zzzz = vector_sub(ray_soa.origin_zzzz, vertex0_zzzz);
+
+			// q = cross(s, edge1)
+			const vector4f q_xxxx = vector_neg_mul_sub(s_zzzz, edge1_yyyy, vector_mul(s_yyyy, edge1_zzzz));
+			const vector4f q_yyyy = vector_neg_mul_sub(s_xxxx, edge1_zzzz, vector_mul(s_zzzz, edge1_xxxx));
+			const vector4f q_zzzz = vector_neg_mul_sub(s_yyyy, edge1_xxxx, vector_mul(s_xxxx, edge1_yyyy));
+
+			// To avoid the division, we test the barycentric coordinates and distance scaled by the determinant
+			// after flipping their sign to match a positive determinant
+			const vector4f det_sign = vector_copy_sign(one, det);
+			const vector4f abs_det = vector_abs(det);
+			const vector4f scaled_u = vector_mul(vector_mul_add(s_zzzz, p_zzzz, vector_mul_add(s_yyyy, p_yyyy, vector_mul(s_xxxx, p_xxxx))), det_sign);
+			const vector4f scaled_v = vector_mul(vector_mul_add(ray_soa.direction_zzzz, q_zzzz, vector_mul_add(ray_soa.direction_yyyy, q_yyyy, vector_mul(ray_soa.direction_xxxx, q_xxxx))), det_sign);
+			const vector4f scaled_t = vector_mul(vector_mul_add(edge2_zzzz, q_zzzz, vector_mul_add(edge2_yyyy, q_yyyy, vector_mul(edge2_xxxx, q_xxxx))), det_sign);
+			const vector4f scaled_w = vector_sub(vector_sub(abs_det, scaled_u), scaled_v);
+
+			// Comparisons against NaN are false which rejects them as well
+			const vector4f min_coordinate = vector_min(vector_min(scaled_u, scaled_v), vector_min(scaled_w, scaled_t));
+			vector4f hit_scaled_t = vector_select(vector_greater_equal(min_coordinate, zero), scaled_t, infinity);
+			hit_scaled_t = vector_select(vector_equal(det, zero), infinity, hit_scaled_t);
+
+			// Most triangles miss, only divide when we need to
+			if (vector_any_less_than(hit_scaled_t, infinity))
+				rtm_impl::ray_closest_hits_update(hits, vector_div(hit_scaled_t, abs_det), triangle_indices);
+
+			triangle_indices = vector_add(triangle_indices, four);
+		}
+
+		float closest_t = std::numeric_limits<float>::infinity();
+		uint32_t closest_index = ~0U;
+		rtm_impl::ray_closest_hits_reduce(hits, closest_t, closest_index);
+
+		for (; triangle_index < num_triangles; ++triangle_index)
+		{
+			const float3f* triangle_vertices = vertices + triangle_index * 3;
+
+			float t;
+			if (ray_intersect_triangle(ray, vector_load3(triangle_vertices + 0), vector_load3(triangle_vertices + 1), vector_load3(triangle_vertices + 2), t) && t < closest_t)
+			{
+				closest_t = t;
+				closest_index = triangle_index;
+			}
+		}
+
+		if (closest_index == ~0U)
+			return false;
+
+		out_t = closest_t;
+		out_index = closest_index;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects any of the provided axis aligned bounding boxes
+	// and writes the distance along the ray and the index of the closest one.
+	// The lowest index wins on ties.
+	// See ray_intersect_aabb(..) above for details.
+	// Boxes are processed 4 at a time in SoA form.
+	// Note: The outputs are left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool ray_intersect_aabbs(rayf_arg0 ray, const aabbf* aabbs, uint32_t num_aabbs, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_aabbs <= (1U << 24), "Too many boxes, indices must be exactly representable as floats");
+
+		const rtm_impl::rayf_soa ray_soa = rtm_impl::ray_to_soa(ray);
+		const vector4f zero = vector_zero();
+		const vector4f one = vector_set(1.0F);
+		const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+
+		// Axis aligned directions yield infinities which the min/max below handle
+		const vector4f inv_direction_xxxx = vector_div(one, ray_soa.direction_xxxx);
+		const vector4f inv_direction_yyyy = vector_div(one, ray_soa.direction_yyyy);
+		const vector4f inv_direction_zzzz = vector_div(one, ray_soa.direction_zzzz);
+
+		rtm_impl::ray_closest_hits hits = rtm_impl::ray_closest_hits_init();
+		vector4f aabb_indices = vector_set(0.0F, 1.0F, 2.0F, 3.0F);
+		const vector4f four = vector_set(4.0F);
+
+		uint32_t aabb_index = 0;
+		for (; aabb_index + 4 <= num_aabbs; aabb_index += 4)
+		{
+			const aabbf* inputs = aabbs + aabb_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].center, inputs[1].center, inputs[2].center, inputs[3].center, center_xxxx, center_yyyy, center_zzzz);
+
+			vector4f extent_xxxx;
+			vector4f extent_yyyy;
+			vector4f extent_zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0].extent, inputs[1].extent, inputs[2].extent, inputs[3].extent, extent_xxxx, extent_yyyy, extent_zzzz);
+
+			const vector4f origin_to_center_xxxx = vector_sub(center_xxxx, ray_soa.origin_xxxx);
+			const vector4f origin_to_center_yyyy = vector_sub(center_yyyy, ray_soa.origin_yyyy);
+			const vector4f origin_to_center_zzzz = vector_sub(center_zzzz, ray_soa.origin_zzzz);
+
+			const vector4f t0_xxxx = vector_mul(vector_sub(origin_to_center_xxxx, extent_xxxx), inv_direction_xxxx);
+			const vector4f t0_yyyy = vector_mul(vector_sub(origin_to_center_yyyy, extent_yyyy), inv_direction_yyyy);
+			const vector4f t0_zzzz = vector_mul(vector_sub(origin_to_center_zzzz, extent_zzzz), inv_direction_zzzz);
+			const vector4f t1_xxxx = vector_mul(vector_add(origin_to_center_xxxx, extent_xxxx), inv_direction_xxxx);
+			const vector4f t1_yyyy = vector_mul(vector_add(origin_to_center_yyyy, extent_yyyy), inv_direction_yyyy);
+			const vector4f t1_zzzz = vector_mul(vector_add(origin_to_center_zzzz, extent_zzzz), inv_direction_zzzz);
+
+			const vector4f t_enter = vector_max(vector_max(vector_min(t0_xxxx, t1_xxxx), vector_min(t0_yyyy, t1_yyyy)), vector_max(vector_min(t0_zzzz, t1_zzzz), zero));
+			const vector4f t_exit = vector_min(vector_min(vector_max(t0_xxxx, t1_xxxx), vector_max(t0_yyyy, t1_yyyy)), vector_max(t0_zzzz, t1_zzzz));
+
+			const vector4f hit_t = vector_select(vector_less_than(t_exit, t_enter), infinity, t_enter);
+
+			rtm_impl::ray_closest_hits_update(hits, hit_t, aabb_indices);
+			aabb_indices = vector_add(aabb_indices, four);
+		}
+
+		float closest_t = std::numeric_limits<float>::infinity();
+		uint32_t closest_index = ~0U;
+		rtm_impl::ray_closest_hits_reduce(hits, closest_t, closest_index);
+
+		for (; aabb_index < num_aabbs; ++aabb_index)
+		{
+			float t;
+			if (ray_intersect_aabb(ray, aabbs[aabb_index], t) && t < closest_t)
+			{
+				closest_t = t;
+				closest_index = aabb_index;
+			}
+		}
+
+		if (closest_index == ~0U)
+			return false;
+
+		out_t = closest_t;
+		out_index = closest_index;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the ray intersects any of the provided bounding spheres and writes
+	// the distance along the ray and the index of the closest one.
+	// The lowest index wins on ties.
+	// See ray_intersect_sphere(..) above for details.
+	// Spheres are processed 4 at a time in SoA form.
+	// Note: The outputs are left untouched when there is no intersection.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool ray_intersect_spheres(rayf_arg0 ray, const spheref* spheres, uint32_t num_spheres, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_spheres <= (1U << 24), "Too many spheres, indices must be exactly representable as floats");
+
+		const rtm_impl::rayf_soa ray_soa = rtm_impl::ray_to_soa(ray);
+		const vector4f zero = vector_zero();
+		const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+
+		const float direction_length_sq = vector_length_squared3(ray.direction);
+		const vector4f a = vector_set(direction_length_sq);
+		const vector4f inv_a = vector_set(1.0F / direction_length_sq);
+
+		rtm_impl::ray_closest_hits hits = rtm_impl::ray_closest_hits_init();
+		vector4f sphere_indices = vector_set(0.0F, 1.0F, 2.0F, 3.0F);
+		const vector4f four = vector_set(4.0F);
+
+		uint32_t sphere_index = 0;
+		for (; sphere_index + 4 <= num_spheres; sphere_index += 4)
+		{
+			const spheref* inputs = spheres + sphere_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			vector4f radius_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(inputs[0].center_radius, inputs[1].center_radius, inputs[2].center_radius, inputs[3].center_radius, center_xxxx, center_yyyy, center_zzzz, radius_wwww);
+
+			const vector4f center_to_origin_xxxx = vector_sub(ray_soa.origin_xxxx, center_xxxx);
+			const vector4f center_to_origin_yyyy = vector_sub(ray_soa.origin_yyyy, center_yyyy);
+			const vector4f center_to_origin_zzzz = vector_sub(ray_soa.origin_zzzz, center_zzzz);
+
+			// Solve: a*t^2 + 2*b*t + c = 0
+			const vector4f b = vector_mul_add(center_to_origin_zzzz, ray_soa.direction_zzzz, vector_mul_add(center_to_origin_yyyy, ray_soa.direction_yyyy, vector_mul(center_to_origin_xxxx, ray_soa.direction_xxxx)));
+			const vector4f c = vector_neg_mul_sub(radius_wwww, radius_wwww, vector_mul_add(center_to_origin_zzzz, center_to_origin_zzzz, vector_mul_add(center_to_origin_yyyy, center_to_origin_yyyy, vector_mul(center_to_origin_xxxx, center_to_origin_xxxx))));
+
+			const vector4f discriminant = vector_neg_mul_sub(a, c, vector_mul(b, b));
+			const vector4f discriminant_sqrt = vector_sqrt(vector_max(discriminant, zero));
+
+			const vector4f t_near = vector_mul(vector_sub(vector_neg(b), discriminant_sqrt), inv_a);
+			const vector4f t_far = vector_mul(vector_sub(discriminant_sqrt, b), inv_a);
+
+			// When the origin is inside the sphere, we exit through the far intersection
+			const vector4f t = vector_select(vector_less_than(t_near, zero), t_far, t_near);
+			vector4f hit_t = vector_select(vector_less_than(t, zero), infinity, t);
+			hit_t = vector_select(vector_less_than(discriminant, zero), infinity, hit_t);
+
+			rtm_impl::ray_closest_hits_update(hits, hit_t, sphere_indices);
+			sphere_indices = vector_add(sphere_indices, four);
+		}
+
+		float closest_t = std::numeric_limits<float>::infinity();
+		uint32_t closest_index = ~0U;
+		rtm_impl::ray_closest_hits_reduce(hits, closest_t, closest_index);
+
+		for (; sphere_index < num_spheres; ++sphere_index)
+		{
+			float t;
+			if (ray_intersect_sphere(ray, spheres[sphere_index], t) && t < closest_t)
+			{
+				closest_t = t;
+				closest_index = sphere_index;
+			}
+		}
+
+		if (closest_index == ~0U)
+			return false;
+
+		out_t = closest_t;
+		out_index = closest_index;
+		return true;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,341 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/mask4f.h"
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/cpu_dispatch.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Integration parameters shared by every body, broadcast once.
+		//////////////////////////////////////////////////////////////////////////
+		struct rigid_body_step4f
+		{
+			vector4f	linear_acceleration_x;
+			vector4f	linear_acceleration_y;
+			vector4f	linear_acceleration_z;
+			vector4f	delta_time;
+			vector4f	half_delta_time;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the 4 sleep bits of the bodies starting at the specified index.
+		// Groups of 4 bodies never straddle two words since their first index is a multiple of 4.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t rigid_body_get_sleep_bits4(const uint32_t* sleep_bits, uint32_t body_index) RTM_NO_EXCEPT
+		{
+			return sleep_bits != nullptr ? ((sleep_bits[body_index / 32] >> (body_index % 32)) & 0xF) : 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Integrates 4 consecutive bodies in SoA form, sleeping bodies retain their state.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL rigid_body_integrate4(const rigid_bodies_soaf& bodies, uint32_t body_index, const rigid_body_step4f& step, uint32_t sleep_bits) RTM_NO_EXCEPT
+		{
+			const mask4f is_awake = mask_set((sleep_bits & 1) == 0, (sleep_bits & 2) == 0, (sleep_bits & 4) == 0, (sleep_bits & 8) == 0);
+
+			// Semi-implicit Euler: the velocity is updated first and the position uses the new velocity
+			const vector4f old_linear_velocity_x = vector_load(bodies.linear_velocity_x + body_index);
+			const vector4f old_linear_velocity_y = vector_load(bodies.linear_velocity_y + body_index);
+			const vector4f old_linear_velocity_z = vector_load(bodies.linear_velocity_z + body_index);
+			const vector4f linear_velocity_x = vector_select(is_awake, vector_mul_add(step.linear_acceleration_x, step.delta_time, old_linear_velocity_x), old_linear_velocity_x);
+			const vector4f linear_velocity_y = vector_select(is_awake, vector_mul_add(step.linear_acceleration_y, step.delta_time, old_linear_velocity_y), old_linear_velocity_y);
+			const vector4f linear_velocity_z = vector_select(is_awake, vector_mul_add(step.linear_acceleration_z, step.delta_time, old_linear_velocity_z), old_linear_velocity_z);
+			vector_store(linear_velocity_x, bodies.linear_velocity_x + body_index);
+			vector_store(linear_velocity_y, bodies.linear_velocity_y + body_index);
+			vector_store(linear_velocity_z, bodies.linear_velocity_z + body_index);
+
+			// Sleeping bodies have their displacement zeroed
+			const vector4f zero = vector_zero();
+			const vector4f delta_time = vector_select(is_awake, step.delta_time, zero);
+			const vector4f half_delta_time = vector_select(is_awake, step.half_delta_time, zero);
+
+			vector_store(vector_mul_add(linear_velocity_x, delta_time, vector_load(bodies.position_x + body_index)), bodies.position_x + body_index);
+			vector_store(vector_mul_add(linear_velocity_y, delta_time, vector_load(bodies.position_y + body_index)), bodies.position_y + body_index);
+			vector_store(vector_mul_add(linear_velocity_z, delta_time, vector_load(bodies.position_z + body_index)), bodies.position_z + body_index);
+
+			// Exponential map of the angular velocity, see quat_integrate(..)
+			const vector4f angular_velocity_x = vector_load(bodies.angular_velocity_x + body_index);
+			const vector4f angular_velocity_y = vector_load(bodies.angular_velocity_y + body_index);
+			const vector4f angular_velocity_z = vector_load(bodies.angular_velocity_z + body_index);
+			const vector4f speed_sq = vector_mul_add(angular_velocity_z, angular_velocity_z, vector_mul_add(angular_velocity_y, angular_velocity_y, vector_mul(angular_velocity_x, angular_velocity_x)));
+			const vector4f speed = vector_sqrt(speed_sq);
+			const vector4f half_angle = vector_mul(speed, half_delta_time);
+
+			vector4f sin_;
+			vector4f cos_;
+			vector_sincos(half_angle, sin_, cos_);
+
+			// The axis is scaled by sin(half_angle) / speed, near zero we use its Taylor series instead
+			const mask4f is_small_angle = vector_less_than(vector_abs(half_angle), vector_set(1.0E-3F));
+			const vector4f taylor_scale = vector_mul(half_delta_time, vector_neg_mul_sub(vector_mul(half_angle, half_angle), vector_set(1.0F / 6.0F), vector_set(1.0F)));
+			const vector4f axis_scale = vector_select(is_small_angle, taylor_scale, vector_div(sin_, vector_max(speed, vector_set(1.0E-30F))));
+
+			const vector4f delta_x = vector_mul(angular_velocity_x, axis_scale);
+			const vector4f delta_y = vector_mul(angular_velocity_y, axis_scale);
+			const vector4f delta_z = vector_mul(angular_velocity_z, axis_scale);
+			const vector4f delta_w = cos_;
+
+			// rotation = quat_normalize(quat_mul(rotation, delta))
+			const vector4f rotation_x = vector_load(bodies.rotation_x + body_index);
+			const vector4f rotation_y = vector_load(bodies.rotation_y + body_index);
+			const vector4f rotation_z = vector_load(bodies.rotation_z + body_index);
+			const vector4f rotation_w = vector_load(bodies.rotation_w + body_index);
+
+			const vector4f x = vector_add(vector_mul_add(delta_w, rotation_x, vector_mul(delta_x, rotation_w)), vector_neg_mul_sub(delta_z, rotation_y, vector_mul(delta_y, rotation_z)));
+			const vector4f y = vector_add(vector_mul_add(delta_w, rotation_y, vector_mul(delta_y, rotation_w)), vector_neg_mul_sub(delta_x, rotation_z, vector_mul(delta_z, rotation_x)));
+			const vector4f z = vector_add(vector_mul_add(delta_w, rotation_z, vector_mul(delta_z, rotation_w)), vector_neg_mul_sub(delta_y, rotation_x, vector_mul(delta_x, rotation_y)));
+			const vector4f w = vector_neg_mul_sub(delta_z, rotation_z, vector_neg_mul_sub(delta_y, rotation_y, vector_neg_mul_sub(delta_x, rotation_x, vector_mul(delta_w, rotation_w))));
+
+			const vector4f length_sq = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(length_sq));
+			vector_store(vector_select(is_awake, vector_mul(x, inv_length), rotation_x), bodies.rotation_x + body_index);
+			vector_store(vector_select(is_awake, vector_mul(y, inv_length), rotation_y), bodies.rotation_y + body_index);
+			vector_store(vector_select(is_awake, vector_mul(z, inv_length), rotation_z), bodies.rotation_z + body_index);
+			vector_store(vector_select(is_awake, vector_mul(w, inv_length), rotation_w), bodies.rotation_w + body_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Integrates a single body.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL rigid_body_integrate1(const rigid_bodies_soaf& bodies, uint32_t body_index, vector4f_arg0 linear_acceleration, float delta_time) RTM_NO_EXCEPT
+		{
+			const vector4f old_linear_velocity = vector_set(bodies.linear_velocity_x[body_index], bodies.linear_velocity_y[body_index], bodies.linear_velocity_z[body_index]);
+			const vector4f linear_velocity = vector_mul_add(linear_acceleration, delta_time, old_linear_velocity);
+			bodies.linear_velocity_x[body_index] = vector_get_x(linear_velocity);
+			bodies.linear_velocity_y[body_index] = vector_get_y(linear_velocity);
+			bodies.linear_velocity_z[body_index] = vector_get_z(linear_velocity);
+
+			const vector4f old_position = vector_set(bodies.position_x[body_index], bodies.position_y[body_index], bodies.position_z[body_index]);
+			const vector4f position = vector_mul_add(linear_velocity, delta_time, old_position);
+			bodies.position_x[body_index] = vector_get_x(position);
+			bodies.position_y[body_index] = vector_get_y(position);
+			bodies.position_z[body_index] = vector_get_z(position);
+
+			const vector4f angular_velocity = vector_set(bodies.angular_velocity_x[body_index], bodies.angular_velocity_y[body_index], bodies.angular_velocity_z[body_index]);
+			const quatf old_rotation = quat_set(bodies.rotation_x[body_index], bodies.rotation_y[body_index], bodies.rotation_z[body_index], bodies.rotation_w[body_index]);
+			const quatf rotation = quat_integrate(old_rotation, angular_velocity, delta_time);
+			bodies.rotation_x[body_index] = quat_get_x(rotation);
+			bodies.rotation_y[body_index] = quat_get_y(rotation);
+			bodies.rotation_z[body_index] = quat_get_z(rotation);
+			bodies.rotation_w[body_index] = quat_get_w(rotation);
+		}
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA version of vector_sincos(..) for 8 angles, same range reduction and polynomials.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline void vector_sincos_avx2_fma(__m256 input, __m256& out_sine, __m256& out_cosine) RTM_NO_EXCEPT
+		{
+			// Remap our input in the [-pi, pi] range
+			__m256 quotient = _mm256_mul_ps(input, _mm256_set1_ps(rtm::constants::one_div_two_pi()));
+			quotient = _mm256_round_ps(quotient, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			__m256 x = _mm256_fnmadd_ps(quotient, _mm256_set1_ps(rtm::constants::two_pi()), input);
+
+			// Remap our input in the [-pi/2, pi/2] range
+			const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+			const __m256 reference = _mm256_or_ps(_mm256_and_ps(x, sign_mask), _mm256_set1_ps(rtm::constants::pi()));
+			const __m256 reflection = _mm256_sub_ps(reference, x);
+			const __m256 x_abs = _mm256_andnot_ps(sign_mask, x);
+			const __m256 is_less_equal_than_half_pi = _mm256_cmp_ps(x_abs, _mm256_set1_ps(rtm::constants::half_pi()), _CMP_LE_OQ);
+			x = _mm256_blendv_ps(reflection, x, is_less_equal_than_half_pi);
+
+			const __m256 x2 = _mm256_mul_ps(x, x);
+
+			// Use a degree 11 minimax approximation polynomial for the sine
+			__m256 sin_result = _mm256_fmadd_ps(x2, _mm256_set1_ps(-2.3828544692960918e-8F), _mm256_set1_ps(2.7521557770526783e-6F));
+			sin_result = _mm256_fmadd_ps(sin_result, x2, _mm256_set1_ps(-1.9840782426250314e-4F));
+			sin_result = _mm256_fmadd_ps(sin_result, x2, _mm256_set1_ps(8.3333303183525942e-3F));
+			sin_result = _mm256_fmadd_ps(sin_result, x2, _mm256_set1_ps(-1.6666666601721269e-1F));
+			sin_result = _mm256_fmadd_ps(sin_result, x2, _mm256_set1_ps(1.0F));
+			out_sine = _mm256_mul_ps(sin_result, x);
+
+			// Use a degree 10 minimax approximation polynomial for the cosine
+			__m256 cos_result = _mm256_fmadd_ps(x2, _mm256_set1_ps(-2.6051615464872668e-7F), _mm256_set1_ps(2.4760495088926859e-5F));
+			cos_result = _mm256_fmadd_ps(cos_result, x2, _mm256_set1_ps(-1.3888377661039897e-3F));
+			cos_result = _mm256_fmadd_ps(cos_result, x2, _mm256_set1_ps(4.1666638865338612e-2F));
+			cos_result = _mm256_fmadd_ps(cos_result, x2, _mm256_set1_ps(-4.9999999508695869e-1F));
+			cos_result = _mm256_fmadd_ps(cos_result, x2, _mm256_set1_ps(1.0F));
+
+			// The reflection flips the sign of the cosine
+			out_cosine = _mm256_or_ps(cos_result, _mm256_andnot_ps(is_less_equal_than_half_pi, sign_mask));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA kernel for rigid_body_integrate(..), 8 bodies are integrated per iteration.
+		// Groups of 8 bodies never straddle two sleep words since their first index is a multiple of 8.
+		// The number of bodies must be a multiple of 8.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline void rigid_body_integrate_avx2_fma(const rigid_bodies_soaf& bodies, uint32_t num_bodies, float linear_acceleration_x, float linear_acceleration_y, float linear_acceleration_z, float delta_time, const uint32_t* sleep_bits) RTM_NO_EXCEPT
+		{
+			const __m256 step_linear_acceleration_x = _mm256_set1_ps(linear_acceleration_x);
+			const __m256 step_linear_acceleration_y = _mm256_set1_ps(linear_acceleration_y);
+			const __m256 step_linear_acceleration_z = _mm256_set1_ps(linear_acceleration_z);
+			const __m256 step_delta_time = _mm256_set1_ps(delta_time);
+			const __m256 step_half_delta_time = _mm256_set1_ps(delta_time * 0.5F);
+			const __m256i lane_sleep_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+			const __m256 sign_mask = _mm256_set1_ps(-0.0F);
+
+			for (uint32_t body_index = 0; body_index < num_bodies; body_index += 8)
+			{
+				// Entirely sleeping groups are skipped
+				const uint32_t group_sleep_bits = sleep_bits != nullptr ? ((sleep_bits[body_index / 32] >> (body_index % 32)) & 0xFF) : 0;
+				if (group_sleep_bits == 0xFF)
+					continue;
+
+				const __m256i sleep_bits_masked = _mm256_and_si256(_mm256_set1_epi32(int32_t(group_sleep_bits)), lane_sleep_bits);
+				const __m256 is_awake = _mm256_castsi256_ps(_mm256_cmpeq_epi32(sleep_bits_masked, _mm256_setzero_si256()));
+
+				// Semi-implicit Euler: the velocity is updated first and the position uses the new velocity
+				const __m256 old_linear_velocity_x = _mm256_loadu_ps(bodies.linear_velocity_x + body_index);
+				const __m256 old_linear_velocity_y = _mm256_loadu_ps(bodies.linear_velocity_y + body_index);
+				const __m256 old_linear_velocity_z = _mm256_loadu_ps(bodies.linear_velocity_z + body_index);
+				const __m256 linear_velocity_x = _mm256_blendv_ps(old_linear_velocity_x, _mm256_fmadd_ps(step_linear_acceleration_x, step_delta_time, old_linear_velocity_x), is_awake);
+				const __m256 linear_velocity_y = _mm256_blendv_ps(old_linear_velocity_y, _mm256_fmadd_ps(step_linear_acceleration_y, step_delta_time, old_linear_velocity_y), is_awake);
+				const __m256 linear_velocity_z = _mm256_blendv_ps(old_linear_velocity_z, _mm256_fmadd_ps(step_linear_acceleration_z, step_delta_time, old_linear_velocity_z), is_awake);
+				_mm256_storeu_ps(bodies.linear_velocity_x + body_index, linear_velocity_x);
+				_mm256_storeu_ps(bodies.linear_velocity_y + body_index, linear_velocity_y);
+				_mm256_storeu_ps(bodies.linear_velocity_z + body_index, linear_velocity_z);
+
+				// Sleeping bodies have their displacement zeroed
+				const __m256 delta_time_ = _mm256_and_ps(is_awake, step_delta_time);
+				const __m256 half_delta_time = _mm256_and_ps(is_awake, step_half_delta_time);
+
+				_mm256_storeu_ps(bodies.position_x + body_index, _mm256_fmadd_ps(linear_velocity_x, delta_time_, _mm256_loadu_ps(bodies.position_x + body_index)));
+				_mm256_storeu_ps(bodies.position_y + body_index, _mm256_fmadd_ps(linear_velocity_y, delta_time_, _mm256_loadu_ps(bodies.position_y + body_index)));
+				_mm256_storeu_ps(bodies.position_z + body_index, _mm256_fmadd_ps(linear_velocity_z, delta_time_, _mm256_loadu_ps(bodies.position_z + body_index)));
+
+				// Exponential map of the angular velocity, see quat_integrate(..)
+				const __m256 angular_velocity_x = _mm256_loadu_ps(bodies.angular_velocity_x + body_index);
+				const __m256 angular_velocity_y = _mm256_loadu_ps(bodies.angular_velocity_y + body_index);
+				const __m256 angular_velocity_z = _mm256_loadu_ps(bodies.angular_velocity_z + body_index);
+				const __m256 speed_sq = _mm256_fmadd_ps(angular_velocity_z, angular_velocity_z, _mm256_fmadd_ps(angular_velocity_y, angular_velocity_y, _mm256_mul_ps(angular_velocity_x, angular_velocity_x)));
+				const __m256 speed = _mm256_sqrt_ps(speed_sq);
+				const __m256 half_angle = _mm256_mul_ps(speed, half_delta_time);
+
+				__m256 sin_;
+				__m256 cos_;
+				vector_sincos_avx2_fma(half_angle, sin_, cos_);
+
+				// The axis is scaled by sin(half_angle) / speed, near zero we use its Taylor series instead
+				const __m256 is_small_angle = _mm256_cmp_ps(_mm256_andnot_ps(sign_mask, half_angle), _mm256_set1_ps(1.0E-3F), _CMP_LT_OQ);
+				const __m256 taylor_scale = _mm256_mul_ps(half_delta_time, _mm256_fnmadd_ps(_mm256_mul_ps(half_angle, half_angle), _mm256_set1_ps(1.0F / 6.0F), _mm256_set1_ps(1.0F)));
+				const __m256 axis_scale = _mm256_blendv_ps(_mm256_div_ps(sin_, _mm256_max_ps(speed, _mm256_set1_ps(1.0E-30F))), taylor_scale, is_small_angle);
+
+				const __m256 delta_x = _mm256_mul_ps(angular_velocity_x, axis_scale);
+				const __m256 delta_y = _mm256_mul_ps(angular_velocity_y, axis_scale);
+				const __m256 delta_z = _mm256_mul_ps(angular_velocity_z, axis_scale);
+				const __m256 delta_w = cos_;
+
+				// rotation = quat_normalize(quat_mul(rotation, delta))
+				const __m256 rotation_x = _mm256_loadu_ps(bodies.rotation_x + body_index);
+				const __m256 rotation_y = _mm256_loadu_ps(bodies.rotation_y + body_index);
+				const __m256 rotation_z = _mm256_loadu_ps(bodies.rotation_z + body_index);
+				const __m256 rotation_w = _mm256_loadu_ps(bodies.rotation_w + body_index);
+
+				const __m256 x = _mm256_add_ps(_mm256_fmadd_ps(delta_w, rotation_x, _mm256_mul_ps(delta_x, rotation_w)), _mm256_fnmadd_ps(delta_z, rotation_y, _mm256_mul_ps(delta_y, rotation_z)));
+				const __m256 y = _mm256_add_ps(_mm256_fmadd_ps(delta_w, rotation_y, _mm256_mul_ps(delta_y, rotation_w)), _mm256_fnmadd_ps(delta_x, rotation_z, _mm256_mul_ps(delta_z, rotation_x)));
+				const __m256 z = _mm256_add_ps(_mm256_fmadd_ps(delta_w, rotation_z, _mm256_mul_ps(delta_z, rotation_w)), _mm256_fnmadd_ps(delta_y, rotation_x, _mm256_mul_ps(delta_x, rotation_y)));
+				const __m256 w = _mm256_fnmadd_ps(delta_z, rotation_z, _mm256_fnmadd_ps(delta_y, rotation_y, _mm256_fnmadd_ps(delta_x, rotation_x, _mm256_mul_ps(delta_w, rotation_w))));
+
+				const __m256 length_sq = _mm256_fmadd_ps(w, w, _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x))));
+				const __m256 inv_length = _mm256_div_ps(_mm256_set1_ps(1.0F), _mm256_sqrt_ps(length_sq));
+				_mm256_storeu_ps(bodies.rotation_x + body_index, _mm256_blendv_ps(rotation_x, _mm256_mul_ps(x, inv_length), is_awake));
+				_mm256_storeu_ps(bodies.rotation_y + body_index, _mm256_blendv_ps(rotation_y, _mm256_mul_ps(y, inv_length), is_awake));
+				_mm256_storeu_ps(bodies.rotation_z + body_index, _mm256_blendv_ps(rotation_z, _mm256_mul_ps(z, inv_length), is_awake));
+				_mm256_storeu_ps(bodies.rotation_w + body_index, _mm256_blendv_ps(rotation_w, _mm256_mul_ps(w, inv_length), is_awake));
+			}
+
+			// Avoid the AVX to SSE transition penalty in the caller
+			_mm256_zeroupper();
+		}
+#endif
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Integrates the state of rigid bodies over a time step with a common linear
+	// acceleration (e.g. gravity). Velocities are updated first with semi-implicit
+	// Euler and positions use the new velocities. Rotations are integrated with the
+	// exponential map of the angular velocity, see quat_integrate(..).
+	//
+	// Bodies are processed 4 at a time in SoA form and the remaining ones one at a time.
+	// With RTM_RUNTIME_DISPATCH, 8 bodies are processed at a time when AVX2 and FMA are supported.
+	// The optional sleep bits hold one bit per body (bit 'i % 32' of word 'i / 32'):
+	// when set, the body is sleeping and its state is left untouched.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL rigid_body_integrate(const rigid_bodies_soaf& bodies, uint32_t num_bodies, vector4f_arg0 linear_acceleration, float delta_time, const uint32_t* sleep_bits = nullptr) RTM_NO_EXCEPT
+	{
+		rtm_impl::rigid_body_step4f step;
+		step.linear_acceleration_x = vector_dup_x(linear_acceleration);
+		step.linear_acceleration_y = vector_dup_y(linear_acceleration);
+		step.linear_acceleration_z = vector_dup_z(linear_acceleration);
+		step.delta_time = vector_set(delta_time);
+		step.half_delta_time = vector_set(delta_time * 0.5F);
+
+		uint32_t body_index = 0;
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		if (rtm_impl::is_avx2_fma_supported())
+		{
+			// Bodies are processed 8 at a time, the remaining ones fall through to the loops below
+			body_index = num_bodies & ~7U;
+			rtm_impl::rigid_body_integrate_avx2_fma(bodies, body_index, vector_get_x(linear_acceleration), vector_get_y(linear_acceleration), vector_get_z(linear_acceleration), delta_time, sleep_bits);
+		}
+#endif
+
+		for (; body_index + 4 <= num_bodies; body_index += 4)
+		{
+			// Entirely sleeping groups are skipped
+			const uint32_t group_sleep_bits = rtm_impl::rigid_body_get_sleep_bits4(sleep_bits, body_index);
+			if (group_sleep_bits != 0xF)
+				rtm_impl::rigid_body_integrate4(bodies, body_index, step, group_sleep_bits);
+		}
+
+		for (; body_index < num_bodies; ++body_index)
+		{
+			const bool is_sleeping = sleep_bits != nullptr && ((sleep_bits[body_index / 32] >> (body_index % 32)) & 1) != 0;
+			if (!is_sleeping)
+				rtm_impl::rigid_body_integrate1(bodies, body_index, linear_acceleration, delta_time);
+		}
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_END
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
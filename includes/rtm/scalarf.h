@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
@@ -286,6 +287,10 @@ namespace rtm
 	#endif
 	inline scalarf RTM_SIMD_CALL scalar_sqrt_reciprocal(scalarf_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use a full precision division
+		return scalarf{ _mm_div_ss(_mm_set_ss(1.0F), _mm_sqrt_ss(input.value)) };
+#else
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		const __m128 half = _mm_set_ss(0.5F);
 		const __m128 input_half = _mm_mul_ss(input.value, half);
@@ -302,6 +307,7 @@ namespace rtm
 		x2 = _mm_add_ss(_mm_mul_ss(x1, x2), x1);
 
 		return scalarf{ x2 };
+#endif
 	}
 	#if defined(RTM_COMPILER_MSVC) && _MSC_VER >= 1920 && _MSC_VER < 1925 && defined(_M_X64) && !defined(RTM_AVX_INTRINSICS)
 		// HACK!!! See comment above
@@ -327,6 +333,10 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline scalarf RTM_SIMD_CALL scalar_reciprocal(scalarf_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use a full precision division
+		return scalarf{ _mm_div_ss(_mm_set_ss(1.0F), input.value) };
+#else
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		__m128 x0 = _mm_rcp_ss(input.value);
 
@@ -337,6 +347,7 @@ namespace rtm
 		__m128 x2 = _mm_sub_ss(_mm_add_ss(x1, x1), _mm_mul_ss(input.value, _mm_mul_ss(x1, x1)));
 
 		return scalarf{ x2 };
+#endif
 	}
 #endif
 
@@ -352,6 +363,155 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Approximate reciprocals
+	//
+	// The functions above are accurate to within a few ULPs. When less precision
+	// is acceptable, two cheaper tiers are available:
+	//    - '_approx' returns the raw hardware estimate. Its relative error is
+	//      at most 1.5 * 2^-12 with SSE and 2^-8 with NEON.
+	//    - '_nr1' refines the hardware estimate with a single Newton-Raphson
+	//      iteration. Its relative error is roughly 2^-22 with SSE and 2^-16 with NEON.
+	// When no estimate instruction is available (scalar and WebAssembly) or when
+	// RTM_DETERMINISTIC is defined, both tiers fall back to the full precision computation.
+	//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hardware estimate of the reciprocal square root of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_sqrt_reciprocal_approx(scalarf_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return scalar_sqrt_reciprocal(input);
+#else
+		return scalarf{ _mm_rsqrt_ss(input.value) };
+#endif
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hardware estimate of the reciprocal square root of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL scalar_sqrt_reciprocal_approx(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return scalar_cast(scalar_sqrt_reciprocal_approx(scalar_set(input)));
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		return vget_lane_f32(vrsqrte_f32(vdup_n_f32(input)), 0);
+#else
+		return 1.0F / scalar_sqrt(input);
+#endif
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the reciprocal square root of the input with a single
+	// Newton-Raphson iteration on the hardware estimate.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_sqrt_reciprocal_nr1(scalarf_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return scalar_sqrt_reciprocal(input);
+#else
+		const __m128 half = _mm_set_ss(0.5F);
+		const __m128 input_half = _mm_mul_ss(input.value, half);
+		const __m128 x0 = _mm_rsqrt_ss(input.value);
+
+		__m128 x1 = _mm_mul_ss(x0, x0);
+		x1 = _mm_sub_ss(half, _mm_mul_ss(input_half, x1));
+		x1 = _mm_add_ss(_mm_mul_ss(x0, x1), x0);
+
+		return scalarf{ x1 };
+#endif
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the reciprocal square root of the input with a single
+	// Newton-Raphson iteration on the hardware estimate.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL scalar_sqrt_reciprocal_nr1(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return scalar_cast(scalar_sqrt_reciprocal_nr1(scalar_set(input)));
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		const float32x2_t input_v = vdup_n_f32(input);
+		const float32x2_t x0 = vrsqrte_f32(input_v);
+		const float32x2_t x1 = vmul_f32(x0, vrsqrts_f32(vmul_f32(input_v, x0), x0));
+		return vget_lane_f32(x1, 0);
+#else
+		return 1.0F / scalar_sqrt(input);
+#endif
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hardware estimate of the reciprocal of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_reciprocal_approx(scalarf_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return scalar_reciprocal(input);
+#else
+		return scalarf{ _mm_rcp_ss(input.value) };
+#endif
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hardware estimate of the reciprocal of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL scalar_reciprocal_approx(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return scalar_cast(scalar_reciprocal_approx(scalar_set(input)));
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		return vget_lane_f32(vrecpe_f32(vdup_n_f32(input)), 0);
+#else
+		return 1.0F / input;
+#endif
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the reciprocal of the input with a single Newton-Raphson
+	// iteration on the hardware estimate.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_reciprocal_nr1(scalarf_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return scalar_reciprocal(input);
+#else
+		const __m128 x0 = _mm_rcp_ss(input.value);
+		const __m128 x1 = _mm_sub_ss(_mm_add_ss(x0, x0), _mm_mul_ss(input.value, _mm_mul_ss(x0, x0)));
+		return scalarf{ x1 };
+#endif
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the reciprocal of the input with a single Newton-Raphson
+	// iteration on the hardware estimate.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL scalar_reciprocal_nr1(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return scalar_cast(scalar_reciprocal_nr1(scalar_set(input)));
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		const float32x2_t input_v = vdup_n_f32(input);
+		const float32x2_t x0 = vrecpe_f32(input_v);
+		const float32x2_t x1 = vmul_f32(x0, vrecps_f32(x0, input_v));
+		return vget_lane_f32(x1, 0);
+#else
+		return 1.0F / input;
+#endif
+	}
+
 #if defined(RTM_SSE2_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the addition of the two scalar inputs.
@@ -919,6 +1079,9 @@ namespace rtm
 		__m128 truncating_offset = _mm_or_ps(sign, fractional_limit);
 		__m128 integer_part = _mm_sub_ss(_mm_add_ss(input.value, truncating_offset), truncating_offset);
 
+		// Restore the sign to return -0.0 when a negative input rounds to zero, like the SSE4 instruction
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		// If our input was so large that it had no fractional part, return it unchanged
 		// Otherwise return our integer part
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
@@ -951,13 +1114,15 @@ namespace rtm
 		int32_t whole = static_cast<int32_t>(input);
 		float whole_f = static_cast<float>(whole);
 		float remainder = scalar_abs(input - whole_f);
+
+		// When the input rounds to zero, it retains its sign like the SSE4 instruction
 		if (remainder < 0.5F)
-			return whole_f;
+			return std::copysign(whole_f, input);
 		if (remainder > 0.5F)
 			return input >= 0.0F ? (whole_f + 1.0F) : (whole_f - 1.0F);
 
 		if ((whole % 2) == 0)
-			return whole_f;
+			return std::copysign(whole_f, input);
 		else
 			return input >= 0.0F ? (whole_f + 1.0F) : (whole_f - 1.0F);
 #endif
@@ -1225,13 +1390,13 @@ namespace rtm
 		const __m128 scale = _mm_sqrt_ss(_mm_sub_ss(_mm_set_ps1(1.0F), abs_value));
 		result = result * _mm_cvtss_f32(scale);
 
-		// Handle negative values through reflection
-		if (_mm_cvtss_f32(value.value) < 0.0F)
-			result = rtm::constants::pi() - result;
-
-		// Shift our final result
+		// Handle negative values through reflection: PI/2 - (PI - result) = result - PI/2
+		// This matches vector_asin(..) and rounds once instead of twice
 		const float offset = rtm::constants::half_pi();
-		result = offset - result;
+		if (_mm_cvtss_f32(value.value) < 0.0F)
+			result = result - offset;
+		else
+			result = offset - result;
 		return scalarf{ _mm_set_ps1(result) };
 	}
 #endif
@@ -1264,13 +1429,13 @@ namespace rtm
 		const float scale = scalar_sqrt(1.0F - abs_value);
 		result = result * scale;
 
-		// Handle negative values through reflection
-		if (value < 0.0F)
-			result = rtm::constants::pi() - result;
-
-		// Shift our final result
+		// Handle negative values through reflection: PI/2 - (PI - result) = result - PI/2
+		// This matches vector_asin(..) and rounds once instead of twice
 		const float offset = rtm::constants::half_pi();
-		result = offset - result;
+		if (value < 0.0F)
+			result = result - offset;
+		else
+			result = offset - result;
 		return result;
 #endif
 	}
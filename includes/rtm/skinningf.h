@@ -0,0 +1,330 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/cpu_dispatch.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Loads a skinning weight and broadcasts it into every vector component.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL skinning_weight_load(const float* weight) RTM_NO_EXCEPT
+		{
+			return vector_broadcast(weight);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads an 8 bit unsigned normalized skinning weight [0, 255] and broadcasts
+		// it into every vector component.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL skinning_weight_load(const uint8_t* weight) RTM_NO_EXCEPT
+		{
+			return vector_set(float(*weight) * (1.0F / 255.0F));
+		}
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		//////////////////////////////////////////////////////////////////////////
+		// Two blended skinning matrices, the first vertex lives in the low
+		// 128 bits of each axis and the second vertex in the high 128 bits.
+		//////////////////////////////////////////////////////////////////////////
+		struct skinning_matrix_x2
+		{
+			__m256 x_axis;
+			__m256 y_axis;
+			__m256 z_axis;
+			__m256 w_axis;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Blends the palette matrices of two consecutive vertices at once.
+		// See matrix_blend(..) for details.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences, typename index_type, typename weight_type>
+		RTM_IMPL_TARGET_AVX2_FMA inline skinning_matrix_x2 matrix_blend_x2_avx2_fma(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights) RTM_NO_EXCEPT
+		{
+			const matrix3x4f& mtx0_a = palette[bone_indices[0]];
+			const matrix3x4f& mtx0_b = palette[bone_indices[num_influences]];
+
+			const __m256 x_axis0 = combine_x2_avx2_fma(mtx0_a.x_axis, mtx0_b.x_axis);
+			const __m256 y_axis0 = combine_x2_avx2_fma(mtx0_a.y_axis, mtx0_b.y_axis);
+			const __m256 z_axis0 = combine_x2_avx2_fma(mtx0_a.z_axis, mtx0_b.z_axis);
+			const __m256 w_axis0 = combine_x2_avx2_fma(mtx0_a.w_axis, mtx0_b.w_axis);
+
+			if (static_condition<num_influences == 1>::test())
+				return skinning_matrix_x2{ x_axis0, y_axis0, z_axis0, w_axis0 };
+
+			const __m256 weight0 = combine_x2_avx2_fma(skinning_weight_load(bone_weights + 0), skinning_weight_load(bone_weights + num_influences));
+
+			__m256 x_axis = _mm256_mul_ps(x_axis0, weight0);
+			__m256 y_axis = _mm256_mul_ps(y_axis0, weight0);
+			__m256 z_axis = _mm256_mul_ps(z_axis0, weight0);
+			__m256 w_axis = _mm256_mul_ps(w_axis0, weight0);
+
+			for (uint32_t influence_index = 1; influence_index < num_influences; ++influence_index)
+			{
+				const matrix3x4f& mtx_a = palette[bone_indices[influence_index]];
+				const matrix3x4f& mtx_b = palette[bone_indices[num_influences + influence_index]];
+				const __m256 weight = combine_x2_avx2_fma(skinning_weight_load(bone_weights + influence_index), skinning_weight_load(bone_weights + num_influences + influence_index));
+
+				x_axis = _mm256_fmadd_ps(combine_x2_avx2_fma(mtx_a.x_axis, mtx_b.x_axis), weight, x_axis);
+				y_axis = _mm256_fmadd_ps(combine_x2_avx2_fma(mtx_a.y_axis, mtx_b.y_axis), weight, y_axis);
+				z_axis = _mm256_fmadd_ps(combine_x2_avx2_fma(mtx_a.z_axis, mtx_b.z_axis), weight, z_axis);
+				w_axis = _mm256_fmadd_ps(combine_x2_avx2_fma(mtx_a.w_axis, mtx_b.w_axis), weight, w_axis);
+			}
+
+			return skinning_matrix_x2{ x_axis, y_axis, z_axis, w_axis };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies two 3D vectors with their blended matrix, the translation is added when requested.
+		//////////////////////////////////////////////////////////////////////////
+		template<bool add_translation>
+		RTM_IMPL_TARGET_AVX2_FMA inline __m256 matrix_mul_x2_avx2_fma(__m256 input, const skinning_matrix_x2& mtx) RTM_NO_EXCEPT
+		{
+			const __m256 x = _mm256_permute_ps(input, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 y = _mm256_permute_ps(input, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 z = _mm256_permute_ps(input, _MM_SHUFFLE(2, 2, 2, 2));
+
+			// Two independent chains, like matrix_mul_point3(..)
+			const __m256 tmp0 = _mm256_fmadd_ps(y, mtx.y_axis, _mm256_mul_ps(x, mtx.x_axis));
+			const __m256 tmp1 = add_translation ? _mm256_fmadd_ps(z, mtx.z_axis, mtx.w_axis) : _mm256_mul_ps(z, mtx.z_axis);
+			return _mm256_add_ps(tmp0, tmp1);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA kernel for skin_positions(..), two vertices are skinned per iteration.
+		// The number of vertices must be a multiple of two.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences, typename index_type, typename weight_type>
+		RTM_IMPL_TARGET_AVX2_FMA inline void skin_positions_avx2_fma(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights,
+			const float3f* input_positions, float3f* output_positions, uint32_t num_vertices) RTM_NO_EXCEPT
+		{
+			for (uint32_t vertex_index = 0; vertex_index < num_vertices; vertex_index += 2)
+			{
+				const skinning_matrix_x2 skin_mtx = matrix_blend_x2_avx2_fma<num_influences>(palette, bone_indices, bone_weights);
+				const __m256 positions = combine_x2_avx2_fma(vector_load3(input_positions + vertex_index), vector_load3(input_positions + vertex_index + 1));
+
+				const __m256 skinned_positions = matrix_mul_x2_avx2_fma<true>(positions, skin_mtx);
+
+				vector_store3(_mm256_castps256_ps128(skinned_positions), output_positions + vertex_index);
+				vector_store3(_mm256_extractf128_ps(skinned_positions, 1), output_positions + vertex_index + 1);
+
+				bone_indices += num_influences * 2;
+				bone_weights += num_influences * 2;
+			}
+
+			// Avoid the AVX to SSE transition penalty in the caller
+			_mm256_zeroupper();
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA kernel for skin_positions_normals(..), two vertices are skinned per iteration.
+		// The number of vertices must be a multiple of two.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_influences, typename index_type, typename weight_type>
+		RTM_IMPL_TARGET_AVX2_FMA inline void skin_positions_normals_avx2_fma(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights,
+			const float3f* input_positions, const float3f* input_normals,
+			float3f* output_positions, float3f* output_normals, uint32_t num_vertices) RTM_NO_EXCEPT
+		{
+			const __m256 one = _mm256_set1_ps(1.0F);
+			const __m256 threshold = _mm256_set1_ps(1.0E-8F);
+
+			for (uint32_t vertex_index = 0; vertex_index < num_vertices; vertex_index += 2)
+			{
+				const skinning_matrix_x2 skin_mtx = matrix_blend_x2_avx2_fma<num_influences>(palette, bone_indices, bone_weights);
+				const __m256 positions = combine_x2_avx2_fma(vector_load3(input_positions + vertex_index), vector_load3(input_positions + vertex_index + 1));
+				const __m256 normals = combine_x2_avx2_fma(vector_load3(input_normals + vertex_index), vector_load3(input_normals + vertex_index + 1));
+
+				const __m256 skinned_positions = matrix_mul_x2_avx2_fma<true>(positions, skin_mtx);
+				const __m256 skinned_normals = matrix_mul_x2_avx2_fma<false>(normals, skin_mtx);
+
+				// Normalize both normals, when the length is too small the input normal is used instead like vector_normalize3(..)
+				const __m256 normals_sq = _mm256_mul_ps(skinned_normals, skinned_normals);
+				const __m256 x_sq = _mm256_permute_ps(normals_sq, _MM_SHUFFLE(0, 0, 0, 0));
+				const __m256 y_sq = _mm256_permute_ps(normals_sq, _MM_SHUFFLE(1, 1, 1, 1));
+				const __m256 z_sq = _mm256_permute_ps(normals_sq, _MM_SHUFFLE(2, 2, 2, 2));
+				const __m256 len_sq = _mm256_add_ps(_mm256_add_ps(x_sq, y_sq), z_sq);
+				const __m256 inv_len = _mm256_div_ps(one, _mm256_sqrt_ps(len_sq));
+				const __m256 is_valid = _mm256_cmp_ps(len_sq, threshold, _CMP_GE_OQ);
+				const __m256 normalized_normals = _mm256_blendv_ps(normals, _mm256_mul_ps(skinned_normals, inv_len), is_valid);
+
+				vector_store3(_mm256_castps256_ps128(skinned_positions), output_positions + vertex_index);
+				vector_store3(_mm256_extractf128_ps(skinned_positions, 1), output_positions + vertex_index + 1);
+				vector_store3(_mm256_castps256_ps128(normalized_normals), output_normals + vertex_index);
+				vector_store3(_mm256_extractf128_ps(normalized_normals, 1), output_normals + vertex_index + 1);
+
+				bone_indices += num_influences * 2;
+				bone_weights += num_influences * 2;
+			}
+
+			// Avoid the AVX to SSE transition penalty in the caller
+			_mm256_zeroupper();
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Blends the palette matrices that influence a single vertex.
+	// The number of influences is a compile time constant and must be 1, 2, 4, or 8.
+	// Bone indices index into the matrix palette and can be any integral type.
+	// Bone weights are either floats or 8 bit unsigned normalized integers
+	// and they should sum to 1.0 (or 255).
+	// With a single influence, the weight is assumed to be 1.0 and it is not read.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_influences, typename index_type, typename weight_type>
+	inline matrix3x4f RTM_SIMD_CALL matrix_blend(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights) RTM_NO_EXCEPT
+	{
+		static_assert(num_influences == 1 || num_influences == 2 || num_influences == 4 || num_influences == 8, "Unsupported number of influences");
+
+		if (rtm_impl::static_condition<num_influences == 1>::test())
+			return palette[bone_indices[0]];
+
+		const matrix3x4f& mtx0 = palette[bone_indices[0]];
+		const vector4f weight0 = rtm_impl::skinning_weight_load(bone_weights + 0);
+
+		vector4f x_axis = vector_mul(mtx0.x_axis, weight0);
+		vector4f y_axis = vector_mul(mtx0.y_axis, weight0);
+		vector4f z_axis = vector_mul(mtx0.z_axis, weight0);
+		vector4f w_axis = vector_mul(mtx0.w_axis, weight0);
+
+		// The trip count is known at compile time, the loop is fully unrolled by the compiler
+		for (uint32_t influence_index = 1; influence_index < num_influences; ++influence_index)
+		{
+			const matrix3x4f& mtx = palette[bone_indices[influence_index]];
+			const vector4f weight = rtm_impl::skinning_weight_load(bone_weights + influence_index);
+
+			x_axis = vector_mul_add(mtx.x_axis, weight, x_axis);
+			y_axis = vector_mul_add(mtx.y_axis, weight, y_axis);
+			z_axis = vector_mul_add(mtx.z_axis, weight, z_axis);
+			w_axis = vector_mul_add(mtx.w_axis, weight, w_axis);
+		}
+
+		return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins a stream of 3D positions with linear blend skinning.
+	// Bone indices and weights are interleaved per vertex: vertex 'i' uses the
+	// entries [i * num_influences, (i + 1) * num_influences).
+	// The palette matrices are blended first and then used to transform the position.
+	// The output stream can alias the input stream.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_influences, typename index_type, typename weight_type>
+	inline void skin_positions(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights,
+		const float3f* input_positions, float3f* output_positions, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		if (rtm_impl::is_avx2_fma_supported())
+		{
+			// Vertices are processed in pairs, the last odd vertex falls through to the loop below
+			const uint32_t num_paired_vertices = num_vertices & ~1U;
+			rtm_impl::skin_positions_avx2_fma<num_influences>(palette, bone_indices, bone_weights, input_positions, output_positions, num_paired_vertices);
+
+			bone_indices += num_paired_vertices * num_influences;
+			bone_weights += num_paired_vertices * num_influences;
+			input_positions += num_paired_vertices;
+			output_positions += num_paired_vertices;
+			num_vertices -= num_paired_vertices;
+		}
+#endif
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const matrix3x4f skin_mtx = matrix_blend<num_influences>(palette, bone_indices, bone_weights);
+			const vector4f position = vector_load3(input_positions + vertex_index);
+			vector_store3(matrix_mul_point3(position, skin_mtx), output_positions + vertex_index);
+
+			bone_indices += num_influences;
+			bone_weights += num_influences;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins a stream of 3D positions and normals with linear blend skinning.
+	// Bone indices and weights are interleaved per vertex: vertex 'i' uses the
+	// entries [i * num_influences, (i + 1) * num_influences).
+	// The palette matrices are blended once per vertex and then used to transform
+	// both the position and the normal. Skinned normals are re-normalized.
+	// Note that normals are transformed by the blended matrix directly which
+	// is only correct if the palette does not contain non-uniform scale.
+	// The output streams can alias the input streams.
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_influences, typename index_type, typename weight_type>
+	inline void skin_positions_normals(const matrix3x4f* palette, const index_type* bone_indices, const weight_type* bone_weights,
+		const float3f* input_positions, const float3f* input_normals,
+		float3f* output_positions, float3f* output_normals, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		if (rtm_impl::is_avx2_fma_supported())
+		{
+			// Vertices are processed in pairs, the last odd vertex falls through to the loop below
+			const uint32_t num_paired_vertices = num_vertices & ~1U;
+			rtm_impl::skin_positions_normals_avx2_fma<num_influences>(palette, bone_indices, bone_weights, input_positions, input_normals, output_positions, output_normals, num_paired_vertices);
+
+			bone_indices += num_paired_vertices * num_influences;
+			bone_weights += num_paired_vertices * num_influences;
+			input_positions += num_paired_vertices;
+			input_normals += num_paired_vertices;
+			output_positions += num_paired_vertices;
+			output_normals += num_paired_vertices;
+			num_vertices -= num_paired_vertices;
+		}
+#endif
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const matrix3x4f skin_mtx = matrix_blend<num_influences>(palette, bone_indices, bone_weights);
+			const vector4f position = vector_load3(input_positions + vertex_index);
+			const vector4f normal = vector_load3(input_normals + vertex_index);
+
+			const vector4f skinned_position = matrix_mul_point3(position, skin_mtx);
+			const vector4f skinned_normal = vector_normalize3(matrix_mul_vector3(normal, skin_mtx), normal);
+
+			vector_store3(skinned_position, output_positions + vertex_index);
+			vector_store3(skinned_normal, output_normals + vertex_index);
+
+			bone_indices += num_influences;
+			bone_weights += num_influences;
+		}
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_END
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
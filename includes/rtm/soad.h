@@ -0,0 +1,351 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatd.h"
+#include "rtm/qvvd.h"
+#include "rtm/vector4d.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Batch kernels for double precision arrays in SoA form.
+//
+// A vector4d holds its [xy] and [zw] components in two separate registers with SSE2,
+// dot and cross products must shuffle between them. In SoA form, each register
+// instead holds the same component of consecutive entries and no shuffling is required.
+// Entries are processed 4 at a time with AVX, 2 at a time with SSE2, and one at a
+// time without intrinsics. The outputs may alias the inputs.
+// The results match their AoS counterparts except for the rotation of 3D vectors
+// (quat_mul_vector3 and the translation of qvv_mul), which uses a cheaper formulation
+// and can differ in rounding.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Describes how to load and store lanes of doubles.
+		//////////////////////////////////////////////////////////////////////////
+		struct soad_lanes_scalar
+		{
+			using type = double;
+			static constexpr uint32_t width = 1;
+
+			static inline double load(const double* input) RTM_NO_EXCEPT { return *input; }
+			static inline void store(double input, double* output) RTM_NO_EXCEPT { *output = input; }
+		};
+
+		inline double soad_add(double lhs, double rhs) RTM_NO_EXCEPT { return lhs + rhs; }
+		inline double soad_sub(double lhs, double rhs) RTM_NO_EXCEPT { return lhs - rhs; }
+		inline double soad_mul(double lhs, double rhs) RTM_NO_EXCEPT { return lhs * rhs; }
+		inline double soad_min(double lhs, double rhs) RTM_NO_EXCEPT { return scalar_min(lhs, rhs); }
+		inline bool soad_any_negative(double input) RTM_NO_EXCEPT { return input < 0.0; }
+
+#if defined(RTM_AVX_INTRINSICS)
+		struct soad_lanes_simd
+		{
+			using type = __m256d;
+			static constexpr uint32_t width = 4;
+
+			static inline __m256d RTM_SIMD_CALL load(const double* input) RTM_NO_EXCEPT { return _mm256_loadu_pd(input); }
+			static inline void RTM_SIMD_CALL store(__m256d input, double* output) RTM_NO_EXCEPT { _mm256_storeu_pd(output, input); }
+		};
+
+		inline __m256d RTM_SIMD_CALL soad_add(__m256d lhs, __m256d rhs) RTM_NO_EXCEPT { return _mm256_add_pd(lhs, rhs); }
+		inline __m256d RTM_SIMD_CALL soad_sub(__m256d lhs, __m256d rhs) RTM_NO_EXCEPT { return _mm256_sub_pd(lhs, rhs); }
+		inline __m256d RTM_SIMD_CALL soad_mul(__m256d lhs, __m256d rhs) RTM_NO_EXCEPT { return _mm256_mul_pd(lhs, rhs); }
+		inline __m256d RTM_SIMD_CALL soad_min(__m256d lhs, __m256d rhs) RTM_NO_EXCEPT { return _mm256_min_pd(lhs, rhs); }
+		inline bool RTM_SIMD_CALL soad_any_negative(__m256d input) RTM_NO_EXCEPT { return _mm256_movemask_pd(_mm256_cmp_pd(input, _mm256_setzero_pd(), _CMP_LT_OQ)) != 0; }
+#elif defined(RTM_SSE2_INTRINSICS)
+		struct soad_lanes_simd
+		{
+			using type = __m128d;
+			static constexpr uint32_t width = 2;
+
+			static inline __m128d RTM_SIMD_CALL load(const double* input) RTM_NO_EXCEPT { return _mm_loadu_pd(input); }
+			static inline void RTM_SIMD_CALL store(__m128d input, double* output) RTM_NO_EXCEPT { _mm_storeu_pd(output, input); }
+		};
+
+		inline __m128d RTM_SIMD_CALL soad_add(__m128d lhs, __m128d rhs) RTM_NO_EXCEPT { return _mm_add_pd(lhs, rhs); }
+		inline __m128d RTM_SIMD_CALL soad_sub(__m128d lhs, __m128d rhs) RTM_NO_EXCEPT { return _mm_sub_pd(lhs, rhs); }
+		inline __m128d RTM_SIMD_CALL soad_mul(__m128d lhs, __m128d rhs) RTM_NO_EXCEPT { return _mm_mul_pd(lhs, rhs); }
+		inline __m128d RTM_SIMD_CALL soad_min(__m128d lhs, __m128d rhs) RTM_NO_EXCEPT { return _mm_min_pd(lhs, rhs); }
+		inline bool RTM_SIMD_CALL soad_any_negative(__m128d input) RTM_NO_EXCEPT { return _mm_movemask_pd(_mm_cmplt_pd(input, _mm_setzero_pd())) != 0; }
+#else
+		using soad_lanes_simd = soad_lanes_scalar;
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// A 3D vector and a quaternion held in lanes.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lanes_type>
+		struct soad_vector3
+		{
+			typename lanes_type::type	x;
+			typename lanes_type::type	y;
+			typename lanes_type::type	z;
+		};
+
+		template<typename lanes_type>
+		struct soad_quat
+		{
+			typename lanes_type::type	x;
+			typename lanes_type::type	y;
+			typename lanes_type::type	z;
+			typename lanes_type::type	w;
+		};
+
+		template<typename lanes_type>
+		inline soad_vector3<lanes_type> soad_load(const vector3d_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return soad_vector3<lanes_type>{ lanes_type::load(input.x + index), lanes_type::load(input.y + index), lanes_type::load(input.z + index) };
+		}
+
+		template<typename lanes_type>
+		inline soad_quat<lanes_type> soad_load(const quatd_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return soad_quat<lanes_type>{ lanes_type::load(input.x + index), lanes_type::load(input.y + index), lanes_type::load(input.z + index), lanes_type::load(input.w + index) };
+		}
+
+		template<typename lanes_type>
+		inline void soad_store(const soad_vector3<lanes_type>& input, const vector3d_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			lanes_type::store(input.x, output.x + index);
+			lanes_type::store(input.y, output.y + index);
+			lanes_type::store(input.z, output.z + index);
+		}
+
+		template<typename lanes_type>
+		inline void soad_store(const soad_quat<lanes_type>& input, const quatd_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			lanes_type::store(input.x, output.x + index);
+			lanes_type::store(input.y, output.y + index);
+			lanes_type::store(input.z, output.z + index);
+			lanes_type::store(input.w, output.w + index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Lane versions of the AoS functions, they use the same operation order
+		// unless mentioned otherwise.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename lanes_type>
+		inline soad_vector3<lanes_type> soad_cross3(const soad_vector3<lanes_type>& lhs, const soad_vector3<lanes_type>& rhs) RTM_NO_EXCEPT
+		{
+			return soad_vector3<lanes_type>{
+				soad_sub(soad_mul(lhs.y, rhs.z), soad_mul(lhs.z, rhs.y)),
+				soad_sub(soad_mul(lhs.z, rhs.x), soad_mul(lhs.x, rhs.z)),
+				soad_sub(soad_mul(lhs.x, rhs.y), soad_mul(lhs.y, rhs.x)) };
+		}
+
+		template<typename lanes_type>
+		inline soad_quat<lanes_type> soad_quat_mul(const soad_quat<lanes_type>& lhs, const soad_quat<lanes_type>& rhs) RTM_NO_EXCEPT
+		{
+			// Same as quat_mul(..)
+			const typename lanes_type::type x = soad_sub(soad_add(soad_add(soad_mul(rhs.w, lhs.x), soad_mul(rhs.x, lhs.w)), soad_mul(rhs.y, lhs.z)), soad_mul(rhs.z, lhs.y));
+			const typename lanes_type::type y = soad_add(soad_add(soad_sub(soad_mul(rhs.w, lhs.y), soad_mul(rhs.x, lhs.z)), soad_mul(rhs.y, lhs.w)), soad_mul(rhs.z, lhs.x));
+			const typename lanes_type::type z = soad_add(soad_sub(soad_add(soad_mul(rhs.w, lhs.z), soad_mul(rhs.x, lhs.y)), soad_mul(rhs.y, lhs.x)), soad_mul(rhs.z, lhs.w));
+			const typename lanes_type::type w = soad_sub(soad_sub(soad_sub(soad_mul(rhs.w, lhs.w), soad_mul(rhs.x, lhs.x)), soad_mul(rhs.y, lhs.y)), soad_mul(rhs.z, lhs.z));
+			return soad_quat<lanes_type>{ x, y, z, w };
+		}
+
+		template<typename lanes_type>
+		inline soad_vector3<lanes_type> soad_quat_mul_vector3(const soad_vector3<lanes_type>& vector, const soad_quat<lanes_type>& rotation) RTM_NO_EXCEPT
+		{
+			// Unlike quat_mul_vector3(..) for quatd which uses the conjugate sandwich, this uses
+			// the cross product form and the results can differ in rounding
+			// t = 2 * cross(rotation.xyz, vector)
+			// result = vector + rotation.w * t + cross(rotation.xyz, t)
+			const soad_vector3<lanes_type> rotation_xyz{ rotation.x, rotation.y, rotation.z };
+			const soad_vector3<lanes_type> cross = soad_cross3(rotation_xyz, vector);
+			const soad_vector3<lanes_type> t{ soad_add(cross.x, cross.x), soad_add(cross.y, cross.y), soad_add(cross.z, cross.z) };
+			const soad_vector3<lanes_type> cross_t = soad_cross3(rotation_xyz, t);
+
+			return soad_vector3<lanes_type>{
+				soad_add(soad_add(vector.x, soad_mul(rotation.w, t.x)), cross_t.x),
+				soad_add(soad_add(vector.y, soad_mul(rotation.w, t.y)), cross_t.y),
+				soad_add(soad_add(vector.z, soad_mul(rotation.w, t.z)), cross_t.z) };
+		}
+
+		template<typename lanes_type>
+		inline void soad_mul_add(const vector3d_soa& v0, const vector3d_soa& v1, const vector3d_soa& v2, uint32_t index, const vector3d_soa& out) RTM_NO_EXCEPT
+		{
+			const soad_vector3<lanes_type> v0_ = soad_load<lanes_type>(v0, index);
+			const soad_vector3<lanes_type> v1_ = soad_load<lanes_type>(v1, index);
+			const soad_vector3<lanes_type> v2_ = soad_load<lanes_type>(v2, index);
+			soad_store(soad_vector3<lanes_type>{ soad_add(soad_mul(v0_.x, v1_.x), v2_.x), soad_add(soad_mul(v0_.y, v1_.y), v2_.y), soad_add(soad_mul(v0_.z, v1_.z), v2_.z) }, out, index);
+		}
+
+		template<typename lanes_type>
+		inline void soad_dot3(const vector3d_soa& lhs, const vector3d_soa& rhs, uint32_t index, double* out) RTM_NO_EXCEPT
+		{
+			const soad_vector3<lanes_type> lhs_ = soad_load<lanes_type>(lhs, index);
+			const soad_vector3<lanes_type> rhs_ = soad_load<lanes_type>(rhs, index);
+			const typename lanes_type::type dot = soad_add(soad_add(soad_mul(lhs_.x, rhs_.x), soad_mul(lhs_.y, rhs_.y)), soad_mul(lhs_.z, rhs_.z));
+			lanes_type::store(dot, out + index);
+		}
+
+		// Kept out of line to keep the lane kernel small, negative scale is rare
+		RTM_FORCE_NOINLINE inline void soad_qvv_mul_aos(const qvvd_soa& lhs, const qvvd_soa& rhs, uint32_t entry_index, const qvvd_soa& out) RTM_NO_EXCEPT
+		{
+			const qvvd lhs_qvv = qvv_set(
+				quat_set(lhs.rotation.x[entry_index], lhs.rotation.y[entry_index], lhs.rotation.z[entry_index], lhs.rotation.w[entry_index]),
+				vector_set(lhs.translation.x[entry_index], lhs.translation.y[entry_index], lhs.translation.z[entry_index]),
+				vector_set(lhs.scale.x[entry_index], lhs.scale.y[entry_index], lhs.scale.z[entry_index]));
+			const qvvd rhs_qvv = qvv_set(
+				quat_set(rhs.rotation.x[entry_index], rhs.rotation.y[entry_index], rhs.rotation.z[entry_index], rhs.rotation.w[entry_index]),
+				vector_set(rhs.translation.x[entry_index], rhs.translation.y[entry_index], rhs.translation.z[entry_index]),
+				vector_set(rhs.scale.x[entry_index], rhs.scale.y[entry_index], rhs.scale.z[entry_index]));
+
+			const qvvd result = qvv_mul(lhs_qvv, rhs_qvv);
+			out.rotation.x[entry_index] = quat_get_x(result.rotation);
+			out.rotation.y[entry_index] = quat_get_y(result.rotation);
+			out.rotation.z[entry_index] = quat_get_z(result.rotation);
+			out.rotation.w[entry_index] = quat_get_w(result.rotation);
+			out.translation.x[entry_index] = vector_get_x(result.translation);
+			out.translation.y[entry_index] = vector_get_y(result.translation);
+			out.translation.z[entry_index] = vector_get_z(result.translation);
+			out.scale.x[entry_index] = vector_get_x(result.scale);
+			out.scale.y[entry_index] = vector_get_y(result.scale);
+			out.scale.z[entry_index] = vector_get_z(result.scale);
+		}
+
+		template<typename lanes_type>
+		inline void soad_qvv_mul(const qvvd_soa& lhs, const qvvd_soa& rhs, uint32_t index, const qvvd_soa& out) RTM_NO_EXCEPT
+		{
+			const soad_quat<lanes_type> lhs_rotation = soad_load<lanes_type>(lhs.rotation, index);
+			const soad_vector3<lanes_type> lhs_translation = soad_load<lanes_type>(lhs.translation, index);
+			const soad_vector3<lanes_type> lhs_scale = soad_load<lanes_type>(lhs.scale, index);
+			const soad_quat<lanes_type> rhs_rotation = soad_load<lanes_type>(rhs.rotation, index);
+			const soad_vector3<lanes_type> rhs_translation = soad_load<lanes_type>(rhs.translation, index);
+			const soad_vector3<lanes_type> rhs_scale = soad_load<lanes_type>(rhs.scale, index);
+
+			// Negative scale goes through a matrix, see qvv_mul(..)
+			const typename lanes_type::type min_scale = soad_min(soad_min(soad_min(lhs_scale.x, lhs_scale.y), soad_min(lhs_scale.z, rhs_scale.x)), soad_min(rhs_scale.y, rhs_scale.z));
+			if (soad_any_negative(min_scale))
+			{
+				for (uint32_t lane_index = 0; lane_index < lanes_type::width; ++lane_index)
+					soad_qvv_mul_aos(lhs, rhs, index + lane_index, out);
+
+				return;
+			}
+
+			const soad_vector3<lanes_type> scaled_translation{ soad_mul(lhs_translation.x, rhs_scale.x), soad_mul(lhs_translation.y, rhs_scale.y), soad_mul(lhs_translation.z, rhs_scale.z) };
+			const soad_vector3<lanes_type> rotated_translation = soad_quat_mul_vector3(scaled_translation, rhs_rotation);
+
+			soad_store(soad_quat_mul(lhs_rotation, rhs_rotation), out.rotation, index);
+			soad_store(soad_vector3<lanes_type>{ soad_add(rotated_translation.x, rhs_translation.x), soad_add(rotated_translation.y, rhs_translation.y), soad_add(rotated_translation.z, rhs_translation.z) }, out.translation, index);
+			soad_store(soad_vector3<lanes_type>{ soad_mul(lhs_scale.x, rhs_scale.x), soad_mul(lhs_scale.y, rhs_scale.y), soad_mul(lhs_scale.z, rhs_scale.z) }, out.scale, index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component multiplication/addition of three arrays of 3D vectors: out = v2 + (v0 * v1)
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_mul_add(const vector3d_soa& v0, const vector3d_soa& v1, const vector3d_soa& v2, uint32_t num_vectors, const vector3d_soa& out_vectors) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_vectors; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_mul_add<rtm_impl::soad_lanes_simd>(v0, v1, v2, index, out_vectors);
+
+		for (; index < num_vectors; ++index)
+			rtm_impl::soad_mul_add<rtm_impl::soad_lanes_scalar>(v0, v1, v2, index, out_vectors);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D dot products of two arrays of 3D vectors.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_dot3(const vector3d_soa& lhs, const vector3d_soa& rhs, uint32_t num_vectors, double* out_dots) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_vectors; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_dot3<rtm_impl::soad_lanes_simd>(lhs, rhs, index, out_dots);
+
+		for (; index < num_vectors; ++index)
+			rtm_impl::soad_dot3<rtm_impl::soad_lanes_scalar>(lhs, rhs, index, out_dots);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D cross products of two arrays of 3D vectors.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_cross3(const vector3d_soa& lhs, const vector3d_soa& rhs, uint32_t num_vectors, const vector3d_soa& out_vectors) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_vectors; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_store(rtm_impl::soad_cross3(rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(lhs, index), rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(rhs, index)), out_vectors, index);
+
+		for (; index < num_vectors; ++index)
+			rtm_impl::soad_store(rtm_impl::soad_cross3(rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(lhs, index), rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(rhs, index)), out_vectors, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two arrays of quaternions, see quat_mul(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul(const quatd_soa& lhs, const quatd_soa& rhs, uint32_t num_rotations, const quatd_soa& out_rotations) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_rotations; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_store(rtm_impl::soad_quat_mul(rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(lhs, index), rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(rhs, index)), out_rotations, index);
+
+		for (; index < num_rotations; ++index)
+			rtm_impl::soad_store(rtm_impl::soad_quat_mul(rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(lhs, index), rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(rhs, index)), out_rotations, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates an array of 3D vectors by an array of quaternions, see quat_mul_vector3(..).
+	// The cross product form is used and the results can differ in rounding.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_vector3(const vector3d_soa& vectors, const quatd_soa& rotations, uint32_t num_vectors, const vector3d_soa& out_vectors) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_vectors; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_store(rtm_impl::soad_quat_mul_vector3(rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(vectors, index), rtm_impl::soad_load<rtm_impl::soad_lanes_simd>(rotations, index)), out_vectors, index);
+
+		for (; index < num_vectors; ++index)
+			rtm_impl::soad_store(rtm_impl::soad_quat_mul_vector3(rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(vectors, index), rtm_impl::soad_load<rtm_impl::soad_lanes_scalar>(rotations, index)), out_vectors, index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two arrays of QVV transforms, see qvv_mul(..).
+	// Entries with negative scale fall back to qvv_mul(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul(const qvvd_soa& lhs, const qvvd_soa& rhs, uint32_t num_transforms, const qvvd_soa& out_transforms) RTM_NO_EXCEPT
+	{
+		uint32_t index = 0;
+		for (; index + rtm_impl::soad_lanes_simd::width <= num_transforms; index += rtm_impl::soad_lanes_simd::width)
+			rtm_impl::soad_qvv_mul<rtm_impl::soad_lanes_simd>(lhs, rhs, index, out_transforms);
+
+		for (; index < num_transforms; ++index)
+			rtm_impl::soad_qvv_mul<rtm_impl::soad_lanes_scalar>(lhs, rhs, index, out_transforms);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,518 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2017 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/macros.h"
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Morton codes (Z-order curve) and grid cell hashing used by broadphases
+// and to sort points in a cache friendly order.
+//
+// A Morton code interleaves the bits of quantized coordinates with [x] in the
+// least significant bit. Sorting the codes (e.g. with a radix sort) keeps
+// points that are close in space close in memory.
+//  - 2D codes are 32 bits with 16 bits per axis
+//  - 3D codes are 30 bits with 10 bits per axis
+//  - 3D 64 bit codes are 63 bits with 21 bits per axis
+//
+// Points are quantized with: clamp((point - origin) * scale, 0, 2^bits - 1)
+// An origin at the minimum of a bounding box and a scale of 2^bits / (max - min)
+// span the full code range over that box.
+//
+// The scalar functions use the BMI2 PDEP/PEXT instructions when available
+// and magic bit masks otherwise. SIMD has no equivalent to PDEP and the
+// vector4i functions always use magic bit masks, 4 codes at a time.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the lower 16 bits of the input into the even bits of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t morton_part1by1(uint32_t input) RTM_NO_EXCEPT
+		{
+			uint32_t result = input & 0x0000FFFFU;
+			result = (result | (result << 8)) & 0x00FF00FFU;
+			result = (result | (result << 4)) & 0x0F0F0F0FU;
+			result = (result | (result << 2)) & 0x33333333U;
+			result = (result | (result << 1)) & 0x55555555U;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers the even bits of the input into the lower 16 bits of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t morton_compact1by1(uint32_t input) RTM_NO_EXCEPT
+		{
+			uint32_t result = input & 0x55555555U;
+			result = (result | (result >> 1)) & 0x33333333U;
+			result = (result | (result >> 2)) & 0x0F0F0F0FU;
+			result = (result | (result >> 4)) & 0x00FF00FFU;
+			result = (result | (result >> 8)) & 0x0000FFFFU;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the lower 10 bits of the input into every third bit of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t morton_part1by2(uint32_t input) RTM_NO_EXCEPT
+		{
+			uint32_t result = input & 0x000003FFU;
+			result = (result | (result << 16)) & 0x030000FFU;
+			result = (result | (result << 8)) & 0x0300F00FU;
+			result = (result | (result << 4)) & 0x030C30C3U;
+			result = (result | (result << 2)) & 0x09249249U;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers every third bit of the input into the lower 10 bits of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t morton_compact1by2(uint32_t input) RTM_NO_EXCEPT
+		{
+			uint32_t result = input & 0x09249249U;
+			result = (result | (result >> 2)) & 0x030C30C3U;
+			result = (result | (result >> 4)) & 0x0300F00FU;
+			result = (result | (result >> 8)) & 0x030000FFU;
+			result = (result | (result >> 16)) & 0x000003FFU;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the lower 21 bits of the input into every third bit of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint64_t morton_part1by2(uint64_t input) RTM_NO_EXCEPT
+		{
+			uint64_t result = input & 0x00000000001FFFFFULL;
+			result = (result | (result << 32)) & 0x001F00000000FFFFULL;
+			result = (result | (result << 16)) & 0x001F0000FF0000FFULL;
+			result = (result | (result << 8)) & 0x100F00F00F00F00FULL;
+			result = (result | (result << 4)) & 0x10C30C30C30C30C3ULL;
+			result = (result | (result << 2)) & 0x1249249249249249ULL;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers every third bit of the input into the lower 21 bits of the output.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint64_t morton_compact1by2(uint64_t input) RTM_NO_EXCEPT
+		{
+			uint64_t result = input & 0x1249249249249249ULL;
+			result = (result | (result >> 2)) & 0x10C30C30C30C30C3ULL;
+			result = (result | (result >> 4)) & 0x100F00F00F00F00FULL;
+			result = (result | (result >> 8)) & 0x001F0000FF0000FFULL;
+			result = (result | (result >> 16)) & 0x001F00000000FFFFULL;
+			result = (result | (result >> 32)) & 0x00000000001FFFFFULL;
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the lower 16 bits of every component into its even bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL morton_part1by1(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4i result = vector_and(input, vector_set_i32(0x0000FFFF));
+			result = vector_and(vector_or(result, vector_shift_left(result, 8)), vector_set_i32(0x00FF00FF));
+			result = vector_and(vector_or(result, vector_shift_left(result, 4)), vector_set_i32(0x0F0F0F0F));
+			result = vector_and(vector_or(result, vector_shift_left(result, 2)), vector_set_i32(0x33333333));
+			result = vector_and(vector_or(result, vector_shift_left(result, 1)), vector_set_i32(0x55555555));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers the even bits of every component into its lower 16 bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL morton_compact1by1(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4i result = vector_and(input, vector_set_i32(0x55555555));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 1)), vector_set_i32(0x33333333));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 2)), vector_set_i32(0x0F0F0F0F));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 4)), vector_set_i32(0x00FF00FF));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 8)), vector_set_i32(0x0000FFFF));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the lower 10 bits of every component into every third bit.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL morton_part1by2(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4i result = vector_and(input, vector_set_i32(0x000003FF));
+			result = vector_and(vector_or(result, vector_shift_left(result, 16)), vector_set_i32(0x030000FF));
+			result = vector_and(vector_or(result, vector_shift_left(result, 8)), vector_set_i32(0x0300F00F));
+			result = vector_and(vector_or(result, vector_shift_left(result, 4)), vector_set_i32(0x030C30C3));
+			result = vector_and(vector_or(result, vector_shift_left(result, 2)), vector_set_i32(0x09249249));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers every third bit of every component into its lower 10 bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL morton_compact1by2(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4i result = vector_and(input, vector_set_i32(0x09249249));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 2)), vector_set_i32(0x030C30C3));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 4)), vector_set_i32(0x0300F00F));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 8)), vector_set_i32(0x030000FF));
+			result = vector_and(vector_or(result, vector_shift_right_logical(result, 16)), vector_set_i32(0x000003FF));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Quantizes 4 coordinates into [0, max_value] grid cells.
+		// The clamping happens before the conversion to remain well defined
+		// with values far outside the grid.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL morton_quantize(vector4f_arg0 input, vector4f_arg1 origin, vector4f_arg2 scale, vector4f_arg3 max_value) RTM_NO_EXCEPT
+		{
+			const vector4f cell = vector_mul(vector_sub(input, origin), scale);
+			return vector_to_int_truncate(vector_clamp(cell, vector_zero(), max_value));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Scalar Morton codes
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the 32 bit Morton code of 2D coordinates with 16 bits per axis.
+	// Bits above the lower 16 are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t morton_encode2(uint32_t x, uint32_t y) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS)
+		return _pdep_u32(x, 0x55555555U) | _pdep_u32(y, 0xAAAAAAAAU);
+#else
+		return rtm_impl::morton_part1by1(x) | (rtm_impl::morton_part1by1(y) << 1);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the 30 bit Morton code of 3D coordinates with 10 bits per axis.
+	// Bits above the lower 10 are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t morton_encode3(uint32_t x, uint32_t y, uint32_t z) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS)
+		return _pdep_u32(x, 0x09249249U) | _pdep_u32(y, 0x12492492U) | _pdep_u32(z, 0x24924924U);
+#else
+		return rtm_impl::morton_part1by2(x) | (rtm_impl::morton_part1by2(y) << 1) | (rtm_impl::morton_part1by2(z) << 2);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the 63 bit Morton code of 3D coordinates with 21 bits per axis.
+	// Bits above the lower 21 are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t morton_encode3_64(uint32_t x, uint32_t y, uint32_t z) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS) && (defined(__x86_64__) || defined(_M_X64))
+		return _pdep_u64(x, 0x1249249249249249ULL) | _pdep_u64(y, 0x2492492492492492ULL) | _pdep_u64(z, 0x4924924924924924ULL);
+#else
+		return rtm_impl::morton_part1by2(uint64_t(x)) | (rtm_impl::morton_part1by2(uint64_t(y)) << 1) | (rtm_impl::morton_part1by2(uint64_t(z)) << 2);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 2D coordinates from a 32 bit Morton code.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_decode2(uint32_t code, uint32_t& out_x, uint32_t& out_y) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS)
+		out_x = _pext_u32(code, 0x55555555U);
+		out_y = _pext_u32(code, 0xAAAAAAAAU);
+#else
+		out_x = rtm_impl::morton_compact1by1(code);
+		out_y = rtm_impl::morton_compact1by1(code >> 1);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 3D coordinates from a 30 bit Morton code.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_decode3(uint32_t code, uint32_t& out_x, uint32_t& out_y, uint32_t& out_z) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS)
+		out_x = _pext_u32(code, 0x09249249U);
+		out_y = _pext_u32(code, 0x12492492U);
+		out_z = _pext_u32(code, 0x24924924U);
+#else
+		out_x = rtm_impl::morton_compact1by2(code);
+		out_y = rtm_impl::morton_compact1by2(code >> 1);
+		out_z = rtm_impl::morton_compact1by2(code >> 2);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 3D coordinates from a 63 bit Morton code.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_decode3_64(uint64_t code, uint32_t& out_x, uint32_t& out_y, uint32_t& out_z) RTM_NO_EXCEPT
+	{
+#if defined(RTM_BMI2_INTRINSICS) && (defined(__x86_64__) || defined(_M_X64))
+		out_x = uint32_t(_pext_u64(code, 0x1249249249249249ULL));
+		out_y = uint32_t(_pext_u64(code, 0x2492492492492492ULL));
+		out_z = uint32_t(_pext_u64(code, 0x4924924924924924ULL));
+#else
+		out_x = uint32_t(rtm_impl::morton_compact1by2(code));
+		out_y = uint32_t(rtm_impl::morton_compact1by2(code >> 1));
+		out_z = uint32_t(rtm_impl::morton_compact1by2(code >> 2));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hash of a 3D grid cell.
+	// The result spans 32 bits, mask it with a power of two table size minus one.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t grid_hash3(int32_t x, int32_t y, int32_t z) RTM_NO_EXCEPT
+	{
+		return (uint32_t(x) * 73856093U) ^ (uint32_t(y) * 19349663U) ^ (uint32_t(z) * 83492791U);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// SIMD Morton codes
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the 32 bit Morton codes of 4 2D coordinates with 16 bits per axis.
+	// Bits above the lower 16 are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL morton_encode2(vector4i_arg0 xxxx, vector4i_arg1 yyyy) RTM_NO_EXCEPT
+	{
+		return vector_or(rtm_impl::morton_part1by1(xxxx), vector_shift_left(rtm_impl::morton_part1by1(yyyy), 1));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the 30 bit Morton codes of 4 3D coordinates with 10 bits per axis.
+	// Bits above the lower 10 are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL morton_encode3(vector4i_arg0 xxxx, vector4i_arg1 yyyy, vector4i_arg2 zzzz) RTM_NO_EXCEPT
+	{
+		const vector4i xy = vector_or(rtm_impl::morton_part1by2(xxxx), vector_shift_left(rtm_impl::morton_part1by2(yyyy), 1));
+		return vector_or(xy, vector_shift_left(rtm_impl::morton_part1by2(zzzz), 2));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 2D coordinates from 4 32 bit Morton codes.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL morton_decode2(vector4i_arg0 codes, vector4i& out_xxxx, vector4i& out_yyyy) RTM_NO_EXCEPT
+	{
+		out_xxxx = rtm_impl::morton_compact1by1(codes);
+		out_yyyy = rtm_impl::morton_compact1by1(vector_shift_right_logical(codes, 1));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the 3D coordinates from 4 30 bit Morton codes.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL morton_decode3(vector4i_arg0 codes, vector4i& out_xxxx, vector4i& out_yyyy, vector4i& out_zzzz) RTM_NO_EXCEPT
+	{
+		out_xxxx = rtm_impl::morton_compact1by2(codes);
+		out_yyyy = rtm_impl::morton_compact1by2(vector_shift_right_logical(codes, 1));
+		out_zzzz = rtm_impl::morton_compact1by2(vector_shift_right_logical(codes, 2));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the hashes of 4 3D grid cells, see grid_hash3(..) above.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL grid_hash3(vector4i_arg0 xxxx, vector4i_arg1 yyyy, vector4i_arg2 zzzz) RTM_NO_EXCEPT
+	{
+		const vector4i x_hash = vector_mul(xxxx, vector_set_i32(73856093));
+		const vector4i y_hash = vector_mul(yyyy, vector_set_i32(19349663));
+		const vector4i z_hash = vector_mul(zzzz, vector_set_i32(83492791));
+		return vector_xor(vector_xor(x_hash, y_hash), z_hash);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Batch Morton codes and hashes
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Quantizes the [xy] components of a number of points and writes their 32 bit Morton codes.
+	// Points are processed 4 at a time in SoA form, see the top of this file for the quantization.
+	// The codes are ready to be fed to a radix sort.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_encode2(const vector4f* points, uint32_t num_points, vector4f_arg0 origin, vector4f_arg1 scale, uint32_t* out_codes) RTM_NO_EXCEPT
+	{
+		const vector4f origin_x = vector_dup_x(origin);
+		const vector4f origin_y = vector_dup_y(origin);
+		const vector4f scale_x = vector_dup_x(scale);
+		const vector4f scale_y = vector_dup_y(scale);
+		const vector4f max_value = vector_set(65535.0F);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const vector4f* inputs = points + point_index;
+
+			vector4f xxxx;
+			vector4f yyyy;
+			vector4f zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0], inputs[1], inputs[2], inputs[3], xxxx, yyyy, zzzz);
+			(void)zzzz;
+
+			const vector4i cell_x = rtm_impl::morton_quantize(xxxx, origin_x, scale_x, max_value);
+			const vector4i cell_y = rtm_impl::morton_quantize(yyyy, origin_y, scale_y, max_value);
+			vector_store(morton_encode2(cell_x, cell_y), reinterpret_cast<int32_t*>(out_codes + point_index));
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4i cell = rtm_impl::morton_quantize(points[point_index], origin, scale, max_value);
+			out_codes[point_index] = morton_encode2(uint32_t(vector_get_x(cell)), uint32_t(vector_get_y(cell)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Quantizes the [xyz] components of a number of points and writes their 30 bit Morton codes.
+	// Points are processed 4 at a time in SoA form, see the top of this file for the quantization.
+	// The codes are ready to be fed to a radix sort.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_encode3(const vector4f* points, uint32_t num_points, vector4f_arg0 origin, vector4f_arg1 scale, uint32_t* out_codes) RTM_NO_EXCEPT
+	{
+		const vector4f origin_x = vector_dup_x(origin);
+		const vector4f origin_y = vector_dup_y(origin);
+		const vector4f origin_z = vector_dup_z(origin);
+		const vector4f scale_x = vector_dup_x(scale);
+		const vector4f scale_y = vector_dup_y(scale);
+		const vector4f scale_z = vector_dup_z(scale);
+		const vector4f max_value = vector_set(1023.0F);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const vector4f* inputs = points + point_index;
+
+			vector4f xxxx;
+			vector4f yyyy;
+			vector4f zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0], inputs[1], inputs[2], inputs[3], xxxx, yyyy, zzzz);
+
+			const vector4i cell_x = rtm_impl::morton_quantize(xxxx, origin_x, scale_x, max_value);
+			const vector4i cell_y = rtm_impl::morton_quantize(yyyy, origin_y, scale_y, max_value);
+			const vector4i cell_z = rtm_impl::morton_quantize(zzzz, origin_z, scale_z, max_value);
+			vector_store(morton_encode3(cell_x, cell_y, cell_z), reinterpret_cast<int32_t*>(out_codes + point_index));
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4i cell = rtm_impl::morton_quantize(points[point_index], origin, scale, max_value);
+			out_codes[point_index] = morton_encode3(uint32_t(vector_get_x(cell)), uint32_t(vector_get_y(cell)), uint32_t(vector_get_z(cell)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Quantizes the [xyz] components of a number of points and writes their 63 bit Morton codes.
+	// The quantization is done 4 points at a time and the bits are interleaved one point
+	// at a time with morton_encode3_64(..) since vector4i has no 64 bit lanes.
+	// The codes are ready to be fed to a radix sort.
+	//////////////////////////////////////////////////////////////////////////
+	inline void morton_encode3_64(const vector4f* points, uint32_t num_points, vector4f_arg0 origin, vector4f_arg1 scale, uint64_t* out_codes) RTM_NO_EXCEPT
+	{
+		const vector4f origin_x = vector_dup_x(origin);
+		const vector4f origin_y = vector_dup_y(origin);
+		const vector4f origin_z = vector_dup_z(origin);
+		const vector4f scale_x = vector_dup_x(scale);
+		const vector4f scale_y = vector_dup_y(scale);
+		const vector4f scale_z = vector_dup_z(scale);
+		const vector4f max_value = vector_set(2097151.0F);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const vector4f* inputs = points + point_index;
+
+			vector4f xxxx;
+			vector4f yyyy;
+			vector4f zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0], inputs[1], inputs[2], inputs[3], xxxx, yyyy, zzzz);
+
+			int32_t cell_x[4];
+			int32_t cell_y[4];
+			int32_t cell_z[4];
+			vector_store(rtm_impl::morton_quantize(xxxx, origin_x, scale_x, max_value), &cell_x[0]);
+			vector_store(rtm_impl::morton_quantize(yyyy, origin_y, scale_y, max_value), &cell_y[0]);
+			vector_store(rtm_impl::morton_quantize(zzzz, origin_z, scale_z, max_value), &cell_z[0]);
+
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+				out_codes[point_index + lane_index] = morton_encode3_64(uint32_t(cell_x[lane_index]), uint32_t(cell_y[lane_index]), uint32_t(cell_z[lane_index]));
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4i cell = rtm_impl::morton_quantize(points[point_index], origin, scale, max_value);
+			out_codes[point_index] = morton_encode3_64(uint32_t(vector_get_x(cell)), uint32_t(vector_get_y(cell)), uint32_t(vector_get_z(cell)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the grid cell hash of a number of points, see grid_hash3(..) above.
+	// The grid cell of a point is floor(point * inv_cell_size) and it must fit
+	// in a 32 bit signed integer.
+	// Points are processed 4 at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void grid_hash3(const vector4f* points, uint32_t num_points, vector4f_arg0 inv_cell_size, uint32_t* out_hashes) RTM_NO_EXCEPT
+	{
+		const vector4f inv_cell_size_x = vector_dup_x(inv_cell_size);
+		const vector4f inv_cell_size_y = vector_dup_y(inv_cell_size);
+		const vector4f inv_cell_size_z = vector_dup_z(inv_cell_size);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const vector4f* inputs = points + point_index;
+
+			vector4f xxxx;
+			vector4f yyyy;
+			vector4f zzzz;
+			RTM_MATRIXF_TRANSPOSE_4X3(inputs[0], inputs[1], inputs[2], inputs[3], xxxx, yyyy, zzzz);
+
+			const vector4i cell_x = vector_to_int_floor(vector_mul(xxxx, inv_cell_size_x));
+			const vector4i cell_y = vector_to_int_floor(vector_mul(yyyy, inv_cell_size_y));
+			const vector4i cell_z = vector_to_int_floor(vector_mul(zzzz, inv_cell_size_z));
+			vector_store(grid_hash3(cell_x, cell_y, cell_z), reinterpret_cast<int32_t*>(out_hashes + point_index));
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4i cell = vector_to_int_floor(vector_mul(points[point_index], inv_cell_size));
+			out_hashes[point_index] = grid_hash3(vector_get_x(cell), vector_get_y(cell), vector_get_z(cell));
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
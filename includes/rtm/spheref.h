@@ -0,0 +1,333 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/aabbf.h"
+#include "rtm/macros.h"
+#include "rtm/mask4f.h"
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/planef.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/cpu_dispatch.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a bounding sphere from its center and radius.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_set(vector4f_arg0 center, float radius) RTM_NO_EXCEPT
+	{
+		return spheref{ vector_set_w(center, radius) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the center of a bounding sphere.
+	// Note: The [w] component contains the radius.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL sphere_get_center(spheref_arg0 sphere) RTM_NO_EXCEPT
+	{
+		return sphere.center_radius;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the radius of a bounding sphere.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL sphere_get_radius(spheref_arg0 sphere) RTM_NO_EXCEPT
+	{
+		return vector_get_w(sphere.center_radius);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest bounding sphere centered on the axis aligned bounding box
+	// that contains it.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_from_aabb(aabbf_arg0 aabb) RTM_NO_EXCEPT
+	{
+		return sphere_set(aabb.center, vector_length3(aabb.extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a bounding sphere that contains every point.
+	// The sphere is centered on the axis aligned bounding box of the points and
+	// its radius is the distance to the furthest point. It is not the minimal
+	// bounding sphere but it is tight in practice and cheap to compute.
+	// At least one point must be provided.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref sphere_from_points(const float3f* points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_points != 0, "At least one point is required");
+
+		const aabbf bounds = aabb_from_points(points, num_points);
+
+		float max_distance_sq = 0.0F;
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		{
+			const vector4f point = vector_load3(points + point_index);
+			const float distance_sq = vector_length_squared3(vector_sub(point, bounds.center));
+			max_distance_sq = scalar_max(max_distance_sq, distance_sq);
+		}
+
+		return sphere_set(bounds.center, scalar_sqrt(max_distance_sq));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the point is inside or on the surface of the bounding sphere.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL sphere_contains_point(spheref_arg0 sphere, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		const float radius = sphere_get_radius(sphere);
+		const float distance_sq = vector_length_squared3(vector_sub(point, sphere.center_radius));
+		return distance_sq <= radius * radius;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if both bounding spheres overlap or touch.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL sphere_intersects(spheref_arg0 lhs, spheref_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const float radius = sphere_get_radius(lhs) + sphere_get_radius(rhs);
+		const float distance_sq = vector_length_squared3(vector_sub(lhs.center_radius, rhs.center_radius));
+		return distance_sq <= radius * radius;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a bounding sphere by an affine matrix.
+	// The radius is scaled by the largest axis scale to remain conservative
+	// when non-uniform scale is present.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_transform(spheref_arg0 sphere, matrix3x4f_arg1 transform) RTM_NO_EXCEPT
+	{
+		const float x_scale_sq = vector_length_squared3(transform.x_axis);
+		const float y_scale_sq = vector_length_squared3(transform.y_axis);
+		const float z_scale_sq = vector_length_squared3(transform.z_axis);
+		const float max_scale = scalar_sqrt(scalar_max(scalar_max(x_scale_sq, y_scale_sq), z_scale_sq));
+
+		const vector4f center = matrix_mul_point3(sphere.center_radius, transform);
+		return sphere_set(center, sphere_get_radius(sphere) * max_scale);
+	}
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// AVX2 and FMA kernel for sphere_transform(..), 8 spheres are transformed per iteration
+		// as two groups of 4 in the 128 bit halves of each register.
+		// The number of spheres must be a multiple of 8.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_IMPL_TARGET_AVX2_FMA inline void sphere_transform_avx2_fma(matrix3x4f_arg0 transform, float max_scale, const spheref* input_spheres, spheref* output_spheres, uint32_t num_spheres) RTM_NO_EXCEPT
+		{
+			const __m256 x_axis = combine_x2_avx2_fma(transform.x_axis, transform.x_axis);
+			const __m256 y_axis = combine_x2_avx2_fma(transform.y_axis, transform.y_axis);
+			const __m256 z_axis = combine_x2_avx2_fma(transform.z_axis, transform.z_axis);
+			const __m256 w_axis = combine_x2_avx2_fma(transform.w_axis, transform.w_axis);
+			const __m256 x_axis_x = _mm256_permute_ps(x_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 x_axis_y = _mm256_permute_ps(x_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 x_axis_z = _mm256_permute_ps(x_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 y_axis_x = _mm256_permute_ps(y_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 y_axis_y = _mm256_permute_ps(y_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 y_axis_z = _mm256_permute_ps(y_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 z_axis_x = _mm256_permute_ps(z_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 z_axis_y = _mm256_permute_ps(z_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 z_axis_z = _mm256_permute_ps(z_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 w_axis_x = _mm256_permute_ps(w_axis, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m256 w_axis_y = _mm256_permute_ps(w_axis, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m256 w_axis_z = _mm256_permute_ps(w_axis, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m256 max_scale_v = _mm256_set1_ps(max_scale);
+
+			for (uint32_t sphere_index = 0; sphere_index < num_spheres; sphere_index += 8)
+			{
+				const spheref* inputs = input_spheres + sphere_index;
+
+				__m256 center_xxxx = combine_x2_avx2_fma(inputs[0].center_radius, inputs[4].center_radius);
+				__m256 center_yyyy = combine_x2_avx2_fma(inputs[1].center_radius, inputs[5].center_radius);
+				__m256 center_zzzz = combine_x2_avx2_fma(inputs[2].center_radius, inputs[6].center_radius);
+				__m256 radius_wwww = combine_x2_avx2_fma(inputs[3].center_radius, inputs[7].center_radius);
+				transpose_4x4_x2_avx2_fma(center_xxxx, center_yyyy, center_zzzz, radius_wwww);
+
+				__m256 new_center_xxxx = _mm256_fmadd_ps(center_zzzz, z_axis_x, _mm256_fmadd_ps(center_yyyy, y_axis_x, _mm256_fmadd_ps(center_xxxx, x_axis_x, w_axis_x)));
+				__m256 new_center_yyyy = _mm256_fmadd_ps(center_zzzz, z_axis_y, _mm256_fmadd_ps(center_yyyy, y_axis_y, _mm256_fmadd_ps(center_xxxx, x_axis_y, w_axis_y)));
+				__m256 new_center_zzzz = _mm256_fmadd_ps(center_zzzz, z_axis_z, _mm256_fmadd_ps(center_yyyy, y_axis_z, _mm256_fmadd_ps(center_xxxx, x_axis_z, w_axis_z)));
+				__m256 new_radius_wwww = _mm256_mul_ps(radius_wwww, max_scale_v);
+
+				// Back to one sphere per row
+				transpose_4x4_x2_avx2_fma(new_center_xxxx, new_center_yyyy, new_center_zzzz, new_radius_wwww);
+
+				// The inputs are fully read before writing since the output can alias the input
+				spheref* outputs = output_spheres + sphere_index;
+				outputs[0].center_radius = _mm256_castps256_ps128(new_center_xxxx);
+				outputs[1].center_radius = _mm256_castps256_ps128(new_center_yyyy);
+				outputs[2].center_radius = _mm256_castps256_ps128(new_center_zzzz);
+				outputs[3].center_radius = _mm256_castps256_ps128(new_radius_wwww);
+				outputs[4].center_radius = _mm256_extractf128_ps(new_center_xxxx, 1);
+				outputs[5].center_radius = _mm256_extractf128_ps(new_center_yyyy, 1);
+				outputs[6].center_radius = _mm256_extractf128_ps(new_center_zzzz, 1);
+				outputs[7].center_radius = _mm256_extractf128_ps(new_radius_wwww, 1);
+			}
+
+			// Avoid the AVX to SSE transition penalty in the caller
+			_mm256_zeroupper();
+		}
+	}
+#endif
+
+	RTM_IMPL_DISPATCH_NAMESPACE_BEGIN
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a number of bounding spheres by an affine matrix.
+	// See sphere_transform(..) above for details.
+	// Spheres are processed 4 at a time in SoA form.
+	// With RTM_RUNTIME_DISPATCH, 8 spheres are processed at a time when AVX2 and FMA are supported.
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void sphere_transform(matrix3x4f_arg0 transform, const spheref* input_spheres, spheref* output_spheres, uint32_t num_spheres) RTM_NO_EXCEPT
+	{
+		const float x_scale_sq = vector_length_squared3(transform.x_axis);
+		const float y_scale_sq = vector_length_squared3(transform.y_axis);
+		const float z_scale_sq = vector_length_squared3(transform.z_axis);
+		const vector4f max_scale = vector_set(scalar_sqrt(scalar_max(scalar_max(x_scale_sq, y_scale_sq), z_scale_sq)));
+
+		const vector4f x_axis_x = vector_dup_x(transform.x_axis);
+		const vector4f x_axis_y = vector_dup_y(transform.x_axis);
+		const vector4f x_axis_z = vector_dup_z(transform.x_axis);
+		const vector4f y_axis_x = vector_dup_x(transform.y_axis);
+		const vector4f y_axis_y = vector_dup_y(transform.y_axis);
+		const vector4f y_axis_z = vector_dup_z(transform.y_axis);
+		const vector4f z_axis_x = vector_dup_x(transform.z_axis);
+		const vector4f z_axis_y = vector_dup_y(transform.z_axis);
+		const vector4f z_axis_z = vector_dup_z(transform.z_axis);
+		const vector4f w_axis_x = vector_dup_x(transform.w_axis);
+		const vector4f w_axis_y = vector_dup_y(transform.w_axis);
+		const vector4f w_axis_z = vector_dup_z(transform.w_axis);
+
+		uint32_t sphere_index = 0;
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+		if (rtm_impl::is_avx2_fma_supported())
+		{
+			// Spheres are processed 8 at a time, the remaining ones fall through to the loops below
+			sphere_index = num_spheres & ~7U;
+			rtm_impl::sphere_transform_avx2_fma(transform, vector_get_x(max_scale), input_spheres, output_spheres, sphere_index);
+		}
+#endif
+
+		for (; sphere_index + 4 <= num_spheres; sphere_index += 4)
+		{
+			const spheref* inputs = input_spheres + sphere_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			vector4f radius_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(inputs[0].center_radius, inputs[1].center_radius, inputs[2].center_radius, inputs[3].center_radius, center_xxxx, center_yyyy, center_zzzz, radius_wwww);
+
+			const vector4f new_center_xxxx = vector_mul_add(center_zzzz, z_axis_x, vector_mul_add(center_yyyy, y_axis_x, vector_mul_add(center_xxxx, x_axis_x, w_axis_x)));
+			const vector4f new_center_yyyy = vector_mul_add(center_zzzz, z_axis_y, vector_mul_add(center_yyyy, y_axis_y, vector_mul_add(center_xxxx, x_axis_y, w_axis_y)));
+			const vector4f new_center_zzzz = vector_mul_add(center_zzzz, z_axis_z, vector_mul_add(center_yyyy, y_axis_z, vector_mul_add(center_xxxx, x_axis_z, w_axis_z)));
+			const vector4f new_radius_wwww = vector_mul(radius_wwww, max_scale);
+
+			spheref* outputs = output_spheres + sphere_index;
+			RTM_MATRIXF_TRANSPOSE_4X4(new_center_xxxx, new_center_yyyy, new_center_zzzz, new_radius_wwww, outputs[0].center_radius, outputs[1].center_radius, outputs[2].center_radius, outputs[3].center_radius);
+		}
+
+		for (; sphere_index < num_spheres; ++sphere_index)
+			output_spheres[sphere_index] = sphere_transform(input_spheres[sphere_index], transform);
+	}
+
+	RTM_IMPL_DISPATCH_NAMESPACE_END
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the bounding sphere is inside or intersects the volume
+	// delimited by the provided planes. It is only rejected when it lies entirely on the
+	// negative side of at least one plane. This is conservative and suitable for culling.
+	// See aabbf.h for the plane convention.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL sphere_intersects_planes(spheref_arg0 sphere, const vector4f* planes, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		const float radius = sphere_get_radius(sphere);
+
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+		{
+			const vector4f plane = planes[plane_index];
+			const float distance = plane_distance_point(planef{ plane }, sphere.center_radius);
+			if (distance + radius < 0.0F)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests a number of bounding spheres against the volume delimited by the
+	// provided planes and writes whether or not each sphere is inside or intersects it.
+	// See sphere_intersects_planes(..) above for details.
+	// Spheres are processed 4 at a time in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	inline void sphere_intersects_planes(const vector4f* planes, uint32_t num_planes, const spheref* input_spheres, bool* output_results, uint32_t num_spheres) RTM_NO_EXCEPT
+	{
+		uint32_t sphere_index = 0;
+		for (; sphere_index + 4 <= num_spheres; sphere_index += 4)
+		{
+			const spheref* inputs = input_spheres + sphere_index;
+
+			vector4f center_xxxx;
+			vector4f center_yyyy;
+			vector4f center_zzzz;
+			vector4f radius_wwww;
+			RTM_MATRIXF_TRANSPOSE_4X4(inputs[0].center_radius, inputs[1].center_radius, inputs[2].center_radius, inputs[3].center_radius, center_xxxx, center_yyyy, center_zzzz, radius_wwww);
+
+			// We track the smallest signed distance of the closest point to each plane, a negative value means we are outside
+			vector4f min_distance = vector_zero();
+			for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+			{
+				const vector4f plane = planes[plane_index];
+
+				vector4f distance = vector_mul_add(center_xxxx, vector_dup_x(plane), vector_add(vector_dup_w(plane), radius_wwww));
+				distance = vector_mul_add(center_yyyy, vector_dup_y(plane), distance);
+				distance = vector_mul_add(center_zzzz, vector_dup_z(plane), distance);
+
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			const mask4f is_inside = vector_greater_equal(min_distance, vector_zero());
+			output_results[sphere_index + 0] = mask_get_x(is_inside) != 0;
+			output_results[sphere_index + 1] = mask_get_y(is_inside) != 0;
+			output_results[sphere_index + 2] = mask_get_z(is_inside) != 0;
+			output_results[sphere_index + 3] = mask_get_w(is_inside) != 0;
+		}
+
+		for (; sphere_index < num_spheres; ++sphere_index)
+			output_results[sphere_index] = sphere_intersects_planes(input_spheres[sphere_index], planes, num_planes);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -81,6 +81,20 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	using mask4i = __m128i;
 
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of 32 bit signed integers.
+	// mask4i is also an __m128i, we wrap it to make sure both types remain distinct
+	// and do not implicitly convert into one another like they do not with NEON.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(16) vector4i
+	{
+		__m128i value;
+	};
+
+	// Helper macros to simplify usage
+	#define RTM_IMPL_VECTOR4i_GET(vec) vec.value
+	#define RTM_IMPL_VECTOR4i_SET(vec) vector4i{ vec }
+
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x64 bit vector comparison mask: ~0 if true, 0 otherwise.
 	//////////////////////////////////////////////////////////////////////////
@@ -155,6 +169,18 @@ namespace rtm
 	// Helper macros to simplify usage
 	#define RTM_IMPL_MASK4i_GET(mask) mask.value
 	#define RTM_IMPL_MASK4i_SET(mask) mask4i{ mask }
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of 32 bit signed integers.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(16) vector4i
+	{
+		int32x4_t value;
+	};
+
+	// Helper macros to simplify usage
+	#define RTM_IMPL_VECTOR4i_GET(vec) vec.value
+	#define RTM_IMPL_VECTOR4i_SET(vec) vector4i{ vec }
 #else
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x32 bit vector comparison mask: ~0 if true, 0 otherwise.
@@ -164,6 +190,15 @@ namespace rtm
 	// Helper macros to simplify usage
 	#define RTM_IMPL_MASK4i_GET(mask) mask
 	#define RTM_IMPL_MASK4i_SET(mask) mask
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of 32 bit signed integers.
+	//////////////////////////////////////////////////////////////////////////
+	using vector4i = int32x4_t;
+
+	// Helper macros to simplify usage
+	#define RTM_IMPL_VECTOR4i_GET(vec) vec
+	#define RTM_IMPL_VECTOR4i_SET(vec) vec
 #endif
 
 	//////////////////////////////////////////////////////////////////////////
@@ -256,6 +291,17 @@ namespace rtm
 		uint32_t w;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of 32 bit signed integers.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(16) vector4i
+	{
+		int32_t x;
+		int32_t y;
+		int32_t z;
+		int32_t w;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x64 bit vector comparison mask: ~0 if true, 0 otherwise.
 	//////////////////////////////////////////////////////////////////////////
@@ -373,6 +419,19 @@ namespace rtm
 		vector4d	scale;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A mixed precision QVV transform with a float32 rotation and scale and a float64 translation.
+	// Large worlds need the translation precision but rotations and scales remain
+	// well within float32 precision. Rotations and scales are processed as with qvvf
+	// while only the translation math uses float64.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvm
+	{
+		quatf		rotation;
+		vector4d	translation;
+		vector4f	scale;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// A generic 3x3 matrix.
 	// Note: The [w] component of every column vector is undefined.
@@ -459,6 +518,172 @@ namespace rtm
 		vector4d	w_axis;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// An axis aligned bounding box represented by its center and its half extent.
+	// Note: The [w] component of the center and extent is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	struct aabbf
+	{
+		vector4f	center;
+		vector4f	extent;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A bounding sphere. The center lives in [xyz] and the radius in [w].
+	// Keeping both in a single register allows a sphere to be loaded, stored,
+	// and transposed into SoA form without any extra shuffling.
+	//////////////////////////////////////////////////////////////////////////
+	struct spheref
+	{
+		vector4f	center_radius;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An oriented bounding box represented by its center, its half extent along
+	// its local axes, and a rotation quaternion that maps its local axes into
+	// the parent space.
+	// Note: The [w] component of the center and extent is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	struct obbf
+	{
+		quatf		rotation;
+		vector4f	center;
+		vector4f	extent;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A plane represented by its normal in [xyz] and its distance in [w].
+	// The signed distance of a point to the plane is: dot(normal, point) + distance
+	// Points on the side the normal points towards have a positive distance.
+	//////////////////////////////////////////////////////////////////////////
+	struct planef
+	{
+		vector4f	normal_distance;
+	};
+
+	struct planed
+	{
+		vector4d	normal_distance;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An infinite line represented by a point on it and its direction.
+	// The direction does not need to be normalized.
+	// Note: The [w] component of the origin and direction is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	struct linef
+	{
+		vector4f	origin;
+		vector4f	direction;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A ray represented by its origin and direction.
+	// The direction does not need to be normalized, distances along the ray
+	// are then expressed as a multiple of its length.
+	// Note: The [w] component of the origin and direction is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	struct rayf
+	{
+		vector4f	origin;
+		vector4f	direction;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A view frustum represented by its 6 planes in this order: left, right, bottom, top, near, far.
+	// Each plane is stored as [normal.xyz, distance] with its normal pointing inside the frustum.
+	//////////////////////////////////////////////////////////////////////////
+	struct frustumf
+	{
+		vector4f	planes[6];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A view frustum represented by its 6 planes in this order: left, right, bottom, top, near, far.
+	// Each plane is stored as [normal.xyz, distance] with its normal pointing inside the frustum.
+	//////////////////////////////////////////////////////////////////////////
+	struct frustumd
+	{
+		vector4d	planes[6];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Points to an array of 3D vectors in SoA form: every component lives in its
+	// own contiguous array, e.g. the [y] component of vector 'i' is y[i].
+	//////////////////////////////////////////////////////////////////////////
+	struct vector3d_soa
+	{
+		double*	x;
+		double*	y;
+		double*	z;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Points to an array of quaternions in SoA form: every component lives in its
+	// own contiguous array, e.g. the [w] component of quaternion 'i' is w[i].
+	//////////////////////////////////////////////////////////////////////////
+	struct quatd_soa
+	{
+		double*	x;
+		double*	y;
+		double*	z;
+		double*	w;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Points to an array of QVV transforms in SoA form.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvd_soa
+	{
+		quatd_soa		rotation;
+		vector3d_soa	translation;
+		vector3d_soa	scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The state of an array of rigid bodies in SoA form: every component lives in its
+	// own contiguous array indexed by body. Positions and rotations are in world space
+	// and velocities are world space units (or radians) per second.
+	//////////////////////////////////////////////////////////////////////////
+	struct rigid_bodies_soaf
+	{
+		float*	position_x;
+		float*	position_y;
+		float*	position_z;
+
+		float*	rotation_x;
+		float*	rotation_y;
+		float*	rotation_z;
+		float*	rotation_w;
+
+		float*	linear_velocity_x;
+		float*	linear_velocity_y;
+		float*	linear_velocity_z;
+
+		float*	angular_velocity_x;
+		float*	angular_velocity_y;
+		float*	angular_velocity_z;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Four IK chains with the same number of joints in SoA form: each SIMD lane
+	// holds the joints of a different chain so that they solve in lockstep.
+	// Joints are ordered from the root to the tip and are expressed in a common
+	// space (e.g. world or object space).
+	//////////////////////////////////////////////////////////////////////////
+	template<uint32_t num_joints>
+	struct ik_chain4f
+	{
+		vector4f	position_x[num_joints];
+		vector4f	position_y[num_joints];
+		vector4f	position_z[num_joints];
+
+		vector4f	rotation_x[num_joints];
+		vector4f	rotation_y[num_joints];
+		vector4f	rotation_z[num_joints];
+		vector4f	rotation_w[num_joints];
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// Represents a component when mixing/shuffling/permuting vectors.
 	// [xyzw] are used to refer to the first input while [abcd] refer to the second input.
@@ -497,6 +722,30 @@ namespace rtm
 		w = 3,
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Represents the order in which Euler angle rotations are applied.
+	// Rotations are applied left to right around the fixed (extrinsic) axes:
+	// euler_order::zyx rotates around Z first, then Y, and X last.
+	// The first six orders are Tait-Bryan angles and the last six are
+	// proper Euler angles where the first and last axes are the same.
+	//////////////////////////////////////////////////////////////////////////
+	enum class euler_order
+	{
+		xyz,
+		xzy,
+		yxz,
+		yzx,
+		zxy,
+		zyx,
+
+		xyx,
+		xzx,
+		yxy,
+		yzy,
+		zxz,
+		zyz,
+	};
+
 
 	//////////////////////////////////////////////////////////////////////////
 	// Various unaligned types suitable for interop. with GPUs, etc.
@@ -544,6 +793,35 @@ namespace rtm
 		double z;
 		double w;
 	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Various aligned types suitable to hold constant data.
+	// They can be initialized at compile time (see rtm/constexpr_math.h) and
+	// each vector loads with a single aligned load.
+	//////////////////////////////////////////////////////////////////////////
+
+	struct alignas(16) aligned_float4f
+	{
+		float x;
+		float y;
+		float z;
+		float w;
+	};
+
+	struct aligned_qvvf
+	{
+		aligned_float4f rotation;
+		aligned_float4f translation;
+		aligned_float4f scale;
+	};
+
+	struct aligned_matrix3x4f
+	{
+		aligned_float4f x_axis;
+		aligned_float4f y_axis;
+		aligned_float4f z_axis;
+		aligned_float4f w_axis;
+	};
 }
 
 // Always include the register passing typedefs
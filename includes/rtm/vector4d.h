@@ -618,7 +618,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_add_pd(lhs.xy, rhs.xy), _mm_add_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] + rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -630,7 +637,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_sub_pd(lhs.xy, rhs.xy), _mm_sub_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] - rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -642,7 +656,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_mul_pd(lhs.xy, rhs.xy), _mm_mul_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w);
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] * rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -673,7 +694,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_div_pd(lhs.xy, rhs.xy), _mm_div_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w);
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] / rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -685,7 +713,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_max_pd(lhs.xy, rhs.xy), _mm_max_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(scalar_max(lhs.x, rhs.x), scalar_max(lhs.y, rhs.y), scalar_max(lhs.z, rhs.z), scalar_max(lhs.w, rhs.w));
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_max(lhs_lanes.values[lane_index], rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -697,7 +732,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_min_pd(lhs.xy, rhs.xy), _mm_min_pd(lhs.zw, rhs.zw) };
 #else
-		return vector_set(scalar_min(lhs.x, rhs.x), scalar_min(lhs.y, rhs.y), scalar_min(lhs.z, rhs.z), scalar_min(lhs.w, rhs.w));
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<double> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_min(lhs_lanes.values[lane_index], rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -718,7 +760,11 @@ namespace rtm
 		vector4d zero{ _mm_setzero_pd(), _mm_setzero_pd() };
 		return vector_max(vector_sub(zero, input), input);
 #else
-		return vector_set(scalar_abs(input.x), scalar_abs(input.y), scalar_abs(input.z), scalar_abs(input.w));
+		rtm_impl::vector_lanes<double> result = rtm_impl::to_lanes<double>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_abs(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -738,6 +784,22 @@ namespace rtm
 		return vector_div(vector_set(1.0), input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_sqrt(const vector4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return vector4d{ _mm_sqrt_pd(input.xy), _mm_sqrt_pd(input.zw) };
+#else
+		rtm_impl::vector_lanes<double> result = rtm_impl::to_lanes<double>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_sqrt(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the smallest integer value not less than the input.
 	// vector_ceil([1.8, 1.0, -1.8, -1.0]) = [2.0, 1.0, -1.0, -1.0]
@@ -792,7 +854,11 @@ namespace rtm
 		__m128d result_zw = _mm_or_pd(_mm_and_pd(use_original_input_zw, input.zw), _mm_andnot_pd(use_original_input_zw, integer_part_zw));
 		return vector4d{ result_xy, result_zw };
 #else
-		return vector_set(scalar_ceil(vector_get_x(input)), scalar_ceil(vector_get_y(input)), scalar_ceil(vector_get_z(input)), scalar_ceil(vector_get_w(input)));
+		rtm_impl::vector_lanes<double> result = rtm_impl::to_lanes<double>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_ceil(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -852,7 +918,11 @@ namespace rtm
 		__m128d result_zw = _mm_or_pd(_mm_and_pd(use_original_input_zw, input.zw), _mm_andnot_pd(use_original_input_zw, integer_part_zw));
 		return vector4d{ result_xy, result_zw };
 #else
-		return vector_set(scalar_floor(vector_get_x(input)), scalar_floor(vector_get_y(input)), scalar_floor(vector_get_z(input)), scalar_floor(vector_get_w(input)));
+		rtm_impl::vector_lanes<double> result = rtm_impl::to_lanes<double>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_floor(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -871,6 +941,162 @@ namespace rtm
 		return vector_set((lhs_y * rhs_z) - (lhs_z * rhs_y), (lhs_z * rhs_x) - (lhs_x * rhs_z), (lhs_x * rhs_y) - (lhs_y * rhs_x));
 	}
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4d_vector_hadd
+		{
+			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d x_z = _mm_unpacklo_pd(input.xy, input.zw);
+				const __m128d y_w = _mm_unpackhi_pd(input.xy, input.zw);
+				const __m128d xy_zw = _mm_add_pd(x_z, y_w);
+				return _mm_cvtsd_f64(_mm_add_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)));
+#else
+				return (input.x + input.y) + (input.z + input.w);
+#endif
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
+			{
+				const __m128d x_z = _mm_unpacklo_pd(input.xy, input.zw);
+				const __m128d y_w = _mm_unpackhi_pd(input.xy, input.zw);
+				const __m128d xy_zw = _mm_add_pd(x_z, y_w);
+				return scalard{ _mm_add_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4d() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d x_z = _mm_unpacklo_pd(input.xy, input.zw);
+				const __m128d y_w = _mm_unpackhi_pd(input.xy, input.zw);
+				const __m128d xy_zw = _mm_add_pd(x_z, y_w);
+				const __m128d sum = _mm_add_pd(xy_zw, _mm_shuffle_pd(xy_zw, xy_zw, 1));
+				return vector4d{ sum, sum };
+#else
+				const double sum = *this;
+				return vector_set(sum);
+#endif
+			}
+
+			vector4d input;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4d_vector_hmin
+		{
+			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d xy_zw = _mm_min_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				return _mm_cvtsd_f64(_mm_min_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)));
+#else
+				return scalar_min(scalar_min(input.x, input.y), scalar_min(input.z, input.w));
+#endif
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
+			{
+				const __m128d xy_zw = _mm_min_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				return scalard{ _mm_min_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4d() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d xy_zw = _mm_min_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				const __m128d result = _mm_min_pd(xy_zw, _mm_shuffle_pd(xy_zw, xy_zw, 1));
+				return vector4d{ result, result };
+#else
+				const double result = *this;
+				return vector_set(result);
+#endif
+			}
+
+			vector4d input;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4d_vector_hmax
+		{
+			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d xy_zw = _mm_max_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				return _mm_cvtsd_f64(_mm_max_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)));
+#else
+				return scalar_max(scalar_max(input.x, input.y), scalar_max(input.z, input.w));
+#endif
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
+			{
+				const __m128d xy_zw = _mm_max_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				return scalard{ _mm_max_sd(xy_zw, _mm_unpackhi_pd(xy_zw, xy_zw)) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4d() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128d xy_zw = _mm_max_pd(_mm_unpacklo_pd(input.xy, input.zw), _mm_unpackhi_pd(input.xy, input.zw));
+				const __m128d result = _mm_max_pd(xy_zw, _mm_shuffle_pd(xy_zw, xy_zw, 1));
+				return vector4d{ result, result };
+#else
+				const double result = *this;
+				return vector_set(result);
+#endif
+			}
+
+			vector4d input;
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal sum of all components: (x + y) + (z + w)
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4d_vector_hadd vector_hadd(const vector4d& input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4d_vector_hadd{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal minimum of all components: min(min(x, y), min(z, w))
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4d_vector_hmin vector_hmin(const vector4d& input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4d_vector_hmin{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal maximum of all components: max(max(x, y), max(z, w))
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4d_vector_hmax vector_hmax(const vector4d& input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4d_vector_hmax{ input };
+	}
+
 	namespace rtm_impl
 	{
 		//////////////////////////////////////////////////////////////////////////
@@ -974,7 +1200,8 @@ namespace rtm
 				__m128d x2y2 = _mm_add_sd(x2_y2, y2);
 				return _mm_cvtsd_f64(_mm_add_sd(x2y2, z2_w2));
 #else
-				return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs));
+				const vector4d x2_y2_z2_w2 = vector_mul(lhs, rhs);
+				return (x2_y2_z2_w2.x + x2_y2_z2_w2.y) + x2_y2_z2_w2.z;
 #endif
 			}
 
@@ -1307,7 +1534,14 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmpeq_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_lt_pd, zw_lt_pd };
 #else
-		return mask4d{ rtm_impl::get_mask_value(lhs.x == rhs.x), rtm_impl::get_mask_value(lhs.y == rhs.y), rtm_impl::get_mask_value(lhs.z == rhs.z), rtm_impl::get_mask_value(lhs.w == rhs.w) };
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint64_t>(lhs_lanes.values[lane_index] == rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4d>(result);
 #endif
 	}
 
@@ -1321,7 +1555,14 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return mask4d{xy_lt_pd, zw_lt_pd};
 #else
-		return mask4d{rtm_impl::get_mask_value(lhs.x < rhs.x), rtm_impl::get_mask_value(lhs.y < rhs.y), rtm_impl::get_mask_value(lhs.z < rhs.z), rtm_impl::get_mask_value(lhs.w < rhs.w)};
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint64_t>(lhs_lanes.values[lane_index] < rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4d>(result);
 #endif
 	}
 
@@ -1335,7 +1576,14 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_lt_pd, zw_lt_pd };
 #else
-		return mask4d{ rtm_impl::get_mask_value(lhs.x <= rhs.x), rtm_impl::get_mask_value(lhs.y <= rhs.y), rtm_impl::get_mask_value(lhs.z <= rhs.z), rtm_impl::get_mask_value(lhs.w <= rhs.w) };
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint64_t>(lhs_lanes.values[lane_index] <= rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4d>(result);
 #endif
 	}
 
@@ -1349,7 +1597,14 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_ge_pd, zw_ge_pd };
 #else
-		return mask4d{ rtm_impl::get_mask_value(lhs.x > rhs.x), rtm_impl::get_mask_value(lhs.y > rhs.y), rtm_impl::get_mask_value(lhs.z > rhs.z), rtm_impl::get_mask_value(lhs.w > rhs.w) };
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint64_t>(lhs_lanes.values[lane_index] > rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4d>(result);
 #endif
 	}
 
@@ -1363,7 +1618,14 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_ge_pd, zw_ge_pd };
 #else
-		return mask4d{ rtm_impl::get_mask_value(lhs.x >= rhs.x), rtm_impl::get_mask_value(lhs.y >= rhs.y), rtm_impl::get_mask_value(lhs.z >= rhs.z), rtm_impl::get_mask_value(lhs.w >= rhs.w) };
+		const rtm_impl::vector_lanes<double> lhs_lanes = rtm_impl::to_lanes<double>(lhs);
+		const rtm_impl::vector_lanes<double> rhs_lanes = rtm_impl::to_lanes<double>(rhs);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint64_t>(lhs_lanes.values[lane_index] >= rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4d>(result);
 #endif
 	}
 
@@ -1377,7 +1639,8 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) & _mm_movemask_pd(zw_lt_pd)) == 3;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z && lhs.w < rhs.w;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1390,7 +1653,8 @@ namespace rtm
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_lt_pd) == 3;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1404,7 +1668,8 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) == 3 && (_mm_movemask_pd(zw_lt_pd) & 1) == 1;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1418,7 +1683,8 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) | _mm_movemask_pd(zw_lt_pd)) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z || lhs.w < rhs.w;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1431,7 +1697,8 @@ namespace rtm
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_lt_pd) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1445,7 +1712,8 @@ namespace rtm
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) != 0 || (_mm_movemask_pd(zw_lt_pd) & 0x1) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z;
+		const mask4d mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1459,7 +1727,8 @@ namespace rtm
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) & _mm_movemask_pd(zw_le_pd)) == 3;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z && lhs.w <= rhs.w;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1472,7 +1741,8 @@ namespace rtm
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_le_pd) == 3;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1486,7 +1756,8 @@ namespace rtm
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) == 3 && (_mm_movemask_pd(zw_le_pd) & 1) != 0;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1500,7 +1771,8 @@ namespace rtm
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) | _mm_movemask_pd(zw_le_pd)) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z || lhs.w <= rhs.w;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1513,7 +1785,8 @@ namespace rtm
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_le_pd) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1527,7 +1800,8 @@ namespace rtm
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) != 0 || (_mm_movemask_pd(zw_le_pd) & 1) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z;
+		const mask4d mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1541,7 +1815,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) & _mm_movemask_pd(zw_ge_pd)) == 3;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y && lhs.z > rhs.z && lhs.w > rhs.w;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1554,7 +1829,8 @@ namespace rtm
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) == 3;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1568,7 +1844,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) == 3 && (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y && lhs.z > rhs.z;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1582,7 +1859,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) | _mm_movemask_pd(zw_ge_pd)) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y || lhs.z > rhs.z || lhs.w > rhs.w;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1595,7 +1873,8 @@ namespace rtm
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1609,7 +1888,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) != 0 || (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y || lhs.z > rhs.z;
+		const mask4d mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1623,7 +1903,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) & _mm_movemask_pd(zw_ge_pd)) == 3;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z && lhs.w >= rhs.w;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1636,7 +1917,8 @@ namespace rtm
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) == 3;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1650,7 +1932,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) == 3 && (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1664,7 +1947,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) | _mm_movemask_pd(zw_ge_pd)) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z || lhs.w >= rhs.w;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1677,7 +1961,8 @@ namespace rtm
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1691,7 +1976,8 @@ namespace rtm
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) != 0 || (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z;
+		const mask4d mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1823,7 +2109,7 @@ namespace rtm
 
 
 	//////////////////////////////////////////////////////////////////////////
-	// Per component selection depending on the mask: mask != 0 ? if_true : if_false
+	// Per component bitwise selection depending on the mask: (if_true & mask) | (if_false & ~mask)
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_select(const mask4d& mask, const vector4d& if_true, const vector4d& if_false) RTM_NO_EXCEPT
 	{
@@ -1832,7 +2118,16 @@ namespace rtm
 		__m128d zw = _mm_or_pd(_mm_andnot_pd(mask.zw, if_false.zw), _mm_and_pd(if_true.zw, mask.zw));
 		return vector4d{ xy, zw };
 #else
-		return vector4d{ rtm_impl::select(mask.x, if_true.x, if_false.x), rtm_impl::select(mask.y, if_true.y, if_false.y), rtm_impl::select(mask.z, if_true.z, if_false.z), rtm_impl::select(mask.w, if_true.w, if_false.w) };
+		// Select with bitwise logic, a branch per lane would prevent vectorization
+		const rtm_impl::vector_lanes<uint64_t> mask_lanes = rtm_impl::to_lanes<uint64_t>(mask);
+		const rtm_impl::vector_lanes<uint64_t> if_true_lanes = rtm_impl::to_lanes<uint64_t>(if_true);
+		const rtm_impl::vector_lanes<uint64_t> if_false_lanes = rtm_impl::to_lanes<uint64_t>(if_false);
+
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = (if_true_lanes.values[lane_index] & mask_lanes.values[lane_index]) | (if_false_lanes.values[lane_index] & ~mask_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
@@ -1843,12 +2138,34 @@ namespace rtm
 	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
 	inline vector4d vector_mix(const vector4d& input0, const vector4d& input1) RTM_NO_EXCEPT
 	{
-		// Slow code path, not yet optimized or not using intrinsics
+#if defined(RTM_SSE2_INTRINSICS)
+		// Each output half is built with a single shuffle from the two source halves it reads from
+		// The source halves are indexed as: 0 = input0.xy, 1 = input0.zw, 2 = input1.xy, 3 = input1.zw
+		constexpr uint32_t half0 = uint32_t(comp0) / 2;
+		constexpr uint32_t half1 = uint32_t(comp1) / 2;
+		constexpr uint32_t half2 = uint32_t(comp2) / 2;
+		constexpr uint32_t half3 = uint32_t(comp3) / 2;
+
+		const __m128d src_comp0 = half0 == 0 ? input0.xy : (half0 == 1 ? input0.zw : (half0 == 2 ? input1.xy : input1.zw));
+		const __m128d src_comp1 = half1 == 0 ? input0.xy : (half1 == 1 ? input0.zw : (half1 == 2 ? input1.xy : input1.zw));
+		const __m128d src_comp2 = half2 == 0 ? input0.xy : (half2 == 1 ? input0.zw : (half2 == 2 ? input1.xy : input1.zw));
+		const __m128d src_comp3 = half3 == 0 ? input0.xy : (half3 == 1 ? input0.zw : (half3 == 2 ? input1.xy : input1.zw));
+
+		constexpr int shuffle_xy = int(uint32_t(comp0) % 2) | (int(uint32_t(comp1) % 2) << 1);
+		constexpr int shuffle_zw = int(uint32_t(comp2) % 2) | (int(uint32_t(comp3) % 2) << 1);
+
+		// When a half is read in order from a single source half, it is used as is
+		const __m128d xy = (half0 == half1 && shuffle_xy == 2) ? src_comp0 : _mm_shuffle_pd(src_comp0, src_comp1, shuffle_xy);
+		const __m128d zw = (half2 == half3 && shuffle_zw == 2) ? src_comp2 : _mm_shuffle_pd(src_comp2, src_comp3, shuffle_zw);
+		return vector4d{ xy, zw };
+#else
+		// Slow code path, not using intrinsics
 		const double x = rtm_impl::is_mix_xyzw(comp0) ? vector_get_component<comp0>(input0) : vector_get_component<comp0>(input1);
 		const double y = rtm_impl::is_mix_xyzw(comp1) ? vector_get_component<comp1>(input0) : vector_get_component<comp1>(input1);
 		const double z = rtm_impl::is_mix_xyzw(comp2) ? vector_get_component<comp2>(input0) : vector_get_component<comp2>(input1);
 		const double w = rtm_impl::is_mix_xyzw(comp3) ? vector_get_component<comp3>(input0) : vector_get_component<comp3>(input1);
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1901,17 +2218,15 @@ namespace rtm
 		__m128d zw = _mm_or_pd(abs_input_zw, signs_zw);
 		return vector4d{ xy, zw };
 #else
-		double x = vector_get_x(input);
-		double y = vector_get_y(input);
-		double z = vector_get_z(input);
-		double w = vector_get_w(input);
+		// Copy the sign bit with bitwise logic, std::copysign isn't vectorized by every compiler
+		const rtm_impl::vector_lanes<uint64_t> input_lanes = rtm_impl::to_lanes<uint64_t>(input);
+		const rtm_impl::vector_lanes<uint64_t> control_sign_lanes = rtm_impl::to_lanes<uint64_t>(control_sign);
 
-		double x_sign = vector_get_x(control_sign);
-		double y_sign = vector_get_y(control_sign);
-		double z_sign = vector_get_z(control_sign);
-		double w_sign = vector_get_w(control_sign);
+		rtm_impl::vector_lanes<uint64_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = (input_lanes.values[lane_index] & 0x7FFFFFFFFFFFFFFFULL) | (control_sign_lanes.values[lane_index] & 0x8000000000000000ULL);
 
-		return vector_set(std::copysign(x, x_sign), std::copysign(y, y_sign), std::copysign(z, z_sign), std::copysign(w, w_sign));
+		return rtm_impl::from_lanes<vector4d>(result);
 #endif
 	}
 
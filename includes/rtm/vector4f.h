@@ -98,6 +98,20 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an aligned vector4 from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_load(const aligned_float4f* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_load_ps(&input->x);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vld1q_f32(&input->x);
+#else
+		return vector_set(input->x, input->y, input->z, input->w);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an unaligned vector2 from memory and sets the [zw] components to zero.
 	//////////////////////////////////////////////////////////////////////////
@@ -693,7 +707,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vaddq_f32(lhs, rhs);
 #else
-		return vector_set(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] + rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -707,7 +728,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vsubq_f32(lhs, rhs);
 #else
-		return vector_set(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] - rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -721,7 +749,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmulq_f32(lhs, rhs);
 #else
-		return vector_set(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w);
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] * rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -770,7 +805,14 @@ namespace rtm
 		result = vsetq_lane_f32(w, result, 3);
 		return result;
 #else
-		return vector_set(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w);
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = lhs_lanes.values[lane_index] / rhs_lanes.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -784,7 +826,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmaxq_f32(lhs, rhs);
 #else
-		return vector_set(scalar_max(lhs.x, rhs.x), scalar_max(lhs.y, rhs.y), scalar_max(lhs.z, rhs.z), scalar_max(lhs.w, rhs.w));
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_max(lhs_lanes.values[lane_index], rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -798,7 +847,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vminq_f32(lhs, rhs);
 #else
-		return vector_set(scalar_min(lhs.x, rhs.x), scalar_min(lhs.y, rhs.y), scalar_min(lhs.z, rhs.z), scalar_min(lhs.w, rhs.w));
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<float> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_min(lhs_lanes.values[lane_index], rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -821,7 +877,11 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vabsq_f32(input);
 #else
-		return vector_set(scalar_abs(input.x), scalar_abs(input.y), scalar_abs(input.z), scalar_abs(input.w));
+		rtm_impl::vector_lanes<float> result = rtm_impl::to_lanes<float>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_abs(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -836,7 +896,11 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vnegq_f32(input);
 #else
-		return vector_mul(input, -1.0f);
+		rtm_impl::vector_lanes<float> result = rtm_impl::to_lanes<float>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = -result.values[lane_index];
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -845,7 +909,10 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_reciprocal(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use a full precision division
+		return vector_div(vector_set(1.0F), input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		__m128 x0 = _mm_rcp_ps(input);
 
@@ -870,6 +937,65 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component hardware estimate of the reciprocal of the input: 1.0 / input
+	// See scalar_reciprocal_approx(..) for the precision of the estimate.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_reciprocal_approx(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return vector_reciprocal(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_rcp_ps(input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vrecpeq_f32(input);
+#else
+		return vector_div(vector_set(1.0F), input);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component reciprocal of the input with a single Newton-Raphson
+	// iteration on the hardware estimate: 1.0 / input
+	// See scalar_reciprocal_nr1(..) for the precision of the result.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_reciprocal_nr1(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between processors, use the full precision implementation
+		return vector_reciprocal(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		__m128 x0 = _mm_rcp_ps(input);
+		return _mm_sub_ps(_mm_add_ps(x0, x0), _mm_mul_ps(input, _mm_mul_ps(x0, x0)));
+#elif defined(RTM_NEON_INTRINSICS)
+		float32x4_t x0 = vrecpeq_f32(input);
+		return vmulq_f32(x0, vrecpsq_f32(x0, input));
+#else
+		return vector_div(vector_set(1.0F), input);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sqrt(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sqrt_ps(input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vsqrtq_f32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vector_set(scalar_sqrt(vector_get_x(input)), scalar_sqrt(vector_get_y(input)), scalar_sqrt(vector_get_z(input)), scalar_sqrt(vector_get_w(input)));
+#else
+		rtm_impl::vector_lanes<float> result = rtm_impl::to_lanes<float>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_sqrt(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the smallest integer value not less than the input.
 	// vector_ceil([1.8, 1.0, -1.8, -1.0]) = [2.0, 1.0, -1.0, -1.0]
@@ -911,8 +1037,14 @@ namespace rtm
 		integer_part = _mm_sub_ps(integer_part, bias);
 
 		return _mm_or_ps(_mm_and_ps(use_original_input, input), _mm_andnot_ps(use_original_input, integer_part));
-#else
+#elif defined(RTM_NEON_INTRINSICS)
 		return vector_set(scalar_ceil(vector_get_x(input)), scalar_ceil(vector_get_y(input)), scalar_ceil(vector_get_z(input)), scalar_ceil(vector_get_w(input)));
+#else
+		rtm_impl::vector_lanes<float> result = rtm_impl::to_lanes<float>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_ceil(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -957,8 +1089,14 @@ namespace rtm
 		integer_part = _mm_add_ps(integer_part, bias);
 
 		return _mm_or_ps(_mm_and_ps(use_original_input, input), _mm_andnot_ps(use_original_input, integer_part));
-#else
+#elif defined(RTM_NEON_INTRINSICS)
 		return vector_set(scalar_floor(vector_get_x(input)), scalar_floor(vector_get_y(input)), scalar_floor(vector_get_z(input)), scalar_floor(vector_get_w(input)));
+#else
+		rtm_impl::vector_lanes<float> result = rtm_impl::to_lanes<float>(input);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = scalar_floor(result.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -989,73 +1127,279 @@ namespace rtm
 
 	namespace rtm_impl
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns [y, x, w, z], a single non-destructive instruction when available.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_swap_pairs(__m128 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			return _mm_permute_ps(input, _MM_SHUFFLE(2, 3, 0, 1));
+#else
+			return _mm_shuffle_ps(input, input, _MM_SHUFFLE(2, 3, 0, 1));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns [z, w, x, y], a single non-destructive instruction when available.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_swap_halves(__m128 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			return _mm_permute_ps(input, _MM_SHUFFLE(1, 0, 3, 2));
+#else
+			return _mm_shuffle_ps(input, input, _MM_SHUFFLE(1, 0, 3, 2));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns [y, y, w, w], SSE3 has a dedicated non-destructive instruction.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_dup_odd(__m128 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE3_INTRINSICS)
+			return _mm_movehdup_ps(input);
+#else
+			return _mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 3, 1, 1));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns (x + y) + (z + w) in the first lane, the other lanes are undefined.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_hadd_ss(__m128 input) RTM_NO_EXCEPT
+		{
+			const __m128 xy_xy_zw_zw = _mm_add_ps(input, vector_dup_odd(input));
+			const __m128 zw_zw_zw_zw = _mm_movehl_ps(xy_xy_zw_zw, xy_xy_zw_zw);
+			return _mm_add_ss(xy_xy_zw_zw, zw_zw_zw_zw);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns min(min(x, y), min(z, w)) in the first lane, the other lanes are undefined.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_hmin_ss(__m128 input) RTM_NO_EXCEPT
+		{
+			const __m128 xy_xy_zw_zw = _mm_min_ps(input, vector_dup_odd(input));
+			const __m128 zw_zw_zw_zw = _mm_movehl_ps(xy_xy_zw_zw, xy_xy_zw_zw);
+			return _mm_min_ss(xy_xy_zw_zw, zw_zw_zw_zw);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns max(max(x, y), max(z, w)) in the first lane, the other lanes are undefined.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_hmax_ss(__m128 input) RTM_NO_EXCEPT
+		{
+			const __m128 xy_xy_zw_zw = _mm_max_ps(input, vector_dup_odd(input));
+			const __m128 zw_zw_zw_zw = _mm_movehl_ps(xy_xy_zw_zw, xy_xy_zw_zw);
+			return _mm_max_ss(xy_xy_zw_zw, zw_zw_zw_zw);
+		}
+#endif
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to allow a single consistent API between
 		// various vector types when the semantics are identical but the return
 		// type differs. Implicit coercion is used to return the desired value
 		// at the call site.
 		//////////////////////////////////////////////////////////////////////////
-		struct vector4f_vector_dot
+		struct vector4f_vector_hadd
 		{
 			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-				// SSE4 dot product instruction isn't precise enough
-				return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF));
-#elif defined(RTM_SSE2_INTRINSICS)
-				__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-				__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-				__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-				return _mm_cvtss_f32(x2y2z2w2_0_0_0);
+#if defined(RTM_SSE2_INTRINSICS)
+				return _mm_cvtss_f32(vector_hadd_ss(input));
+#elif defined(RTM_NEON64_INTRINSICS)
+				return vaddvq_f32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+				const float32x2_t xy_zw = vpadd_f32(vget_low_f32(input), vget_high_f32(input));
+				return vget_lane_f32(vpadd_f32(xy_zw, xy_zw), 0);
 #else
-				return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs));
+				return (input.x + input.y) + (input.z + input.w);
 #endif
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-				// SSE4 dot product instruction isn't precise enough
-				return scalarf{ _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF)) };
+				return scalarf{ vector_hadd_ss(input) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				// Summing the swapped pairs then the swapped halves leaves the sum in every lane
+				const __m128 xy_xy_zw_zw = _mm_add_ps(input, vector_swap_pairs(input));
+				return _mm_add_ps(xy_xy_zw_zw, vector_swap_halves(xy_xy_zw_zw));
+#elif defined(RTM_NEON64_INTRINSICS)
+				const float32x4_t xy_zw_xy_zw = vpaddq_f32(input, input);
+				return vpaddq_f32(xy_zw_xy_zw, xy_zw_xy_zw);
+#elif defined(RTM_NEON_INTRINSICS)
+				const float32x2_t xy_zw = vpadd_f32(vget_low_f32(input), vget_high_f32(input));
+				const float32x2_t sum = vpadd_f32(xy_zw, xy_zw);
+				return vcombine_f32(sum, sum);
 #else
-				__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-				__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-				__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-				return scalarf{ x2y2z2w2_0_0_0 };
+				const float sum = *this;
+				return vector_set(sum);
+#endif
+			}
+
+			vector4f input;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4f_vector_hmin
+		{
+			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				return _mm_cvtss_f32(vector_hmin_ss(input));
+#elif defined(RTM_NEON64_INTRINSICS)
+				return vminvq_f32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+				const float32x2_t xy_zw = vpmin_f32(vget_low_f32(input), vget_high_f32(input));
+				return vget_lane_f32(vpmin_f32(xy_zw, xy_zw), 0);
+#else
+				return scalar_min(scalar_min(input.x, input.y), scalar_min(input.z, input.w));
+#endif
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			{
+				return scalarf{ vector_hmin_ss(input) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128 xy_xy_zw_zw = _mm_min_ps(input, vector_swap_pairs(input));
+				return _mm_min_ps(xy_xy_zw_zw, vector_swap_halves(xy_xy_zw_zw));
+#elif defined(RTM_NEON64_INTRINSICS)
+				const float32x4_t xy_zw_xy_zw = vpminq_f32(input, input);
+				return vpminq_f32(xy_zw_xy_zw, xy_zw_xy_zw);
+#elif defined(RTM_NEON_INTRINSICS)
+				const float32x2_t xy_zw = vpmin_f32(vget_low_f32(input), vget_high_f32(input));
+				const float32x2_t result = vpmin_f32(xy_zw, xy_zw);
+				return vcombine_f32(result, result);
+#else
+				const float result = *this;
+				return vector_set(result);
+#endif
+			}
+
+			vector4f input;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4f_vector_hmax
+		{
+			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				return _mm_cvtss_f32(vector_hmax_ss(input));
+#elif defined(RTM_NEON64_INTRINSICS)
+				return vmaxvq_f32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+				const float32x2_t xy_zw = vpmax_f32(vget_low_f32(input), vget_high_f32(input));
+				return vget_lane_f32(vpmax_f32(xy_zw, xy_zw), 0);
+#else
+				return scalar_max(scalar_max(input.x, input.y), scalar_max(input.z, input.w));
 #endif
 			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			{
+				return scalarf{ vector_hmax_ss(input) };
+			}
 #endif
 
 			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-				// SSE4 dot product instruction isn't precise enough
-				return _mm_dp_ps(lhs, rhs, 0xFF);
-#elif defined(RTM_SSE2_INTRINSICS)
-				__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-				__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-				__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-				return _mm_shuffle_ps(x2y2z2w2_0_0_0, x2y2z2w2_0_0_0, _MM_SHUFFLE(0, 0, 0, 0));
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128 xy_xy_zw_zw = _mm_max_ps(input, vector_swap_pairs(input));
+				return _mm_max_ps(xy_xy_zw_zw, vector_swap_halves(xy_xy_zw_zw));
+#elif defined(RTM_NEON64_INTRINSICS)
+				const float32x4_t xy_zw_xy_zw = vpmaxq_f32(input, input);
+				return vpmaxq_f32(xy_zw_xy_zw, xy_zw_xy_zw);
 #elif defined(RTM_NEON_INTRINSICS)
-				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
-				float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
-				float32x2_t z2_w2 = vget_high_f32(x2_y2_z2_w2);
-				float32x2_t x2z2_y2w2 = vadd_f32(x2_y2, z2_w2);
-				float32x2_t x2y2z2w2 = vpadd_f32(x2z2_y2w2, x2z2_y2w2);
-				return vcombine_f32(x2y2z2w2, x2y2z2w2);
+				const float32x2_t xy_zw = vpmax_f32(vget_low_f32(input), vget_high_f32(input));
+				const float32x2_t result = vpmax_f32(xy_zw, xy_zw);
+				return vcombine_f32(result, result);
 #else
-				scalarf result = *this;
+				const float result = *this;
 				return vector_set(result);
 #endif
 			}
 
+			vector4f input;
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal sum of all components: (x + y) + (z + w)
+	// The summation order is identical on every platform.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4f_vector_hadd RTM_SIMD_CALL vector_hadd(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4f_vector_hadd{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal minimum of all components: min(min(x, y), min(z, w))
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4f_vector_hmin RTM_SIMD_CALL vector_hmin(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4f_vector_hmin{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Horizontal maximum of all components: max(max(x, y), max(z, w))
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::vector4f_vector_hmax RTM_SIMD_CALL vector_hmax(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::vector4f_vector_hmax{ input };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct vector4f_vector_dot
+		{
+			// The SSE4 dot product instruction isn't precise enough, we multiply and sum horizontally instead
+			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			{
+				return vector4f_vector_hadd{ vector_mul(lhs, rhs) };
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			{
+				return vector4f_vector_hadd{ vector_mul(lhs, rhs) };
+			}
+#endif
+
+			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
+			{
+				return vector4f_vector_hadd{ vector_mul(lhs, rhs) };
+			}
+
 			vector4f lhs;
 			vector4f rhs;
 		};
@@ -1075,26 +1419,7 @@ namespace rtm
 	RTM_DEPRECATED("Use vector_dot instead, to be removed in v2.0")
 	inline scalarf RTM_SIMD_CALL vector_dot_as_scalar(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-		// SSE4 dot product instruction isn't precise enough
-		return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF));
-#elif defined(RTM_SSE2_INTRINSICS)
-		__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-		__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-		__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-		__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-		__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-		return scalarf{ x2y2z2w2_0_0_0 };
-#elif defined(RTM_NEON_INTRINSICS)
-		float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
-		float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
-		float32x2_t z2_w2 = vget_high_f32(x2_y2_z2_w2);
-		float32x2_t x2z2_y2w2 = vadd_f32(x2_y2, z2_w2);
-		float32x2_t x2y2z2w2 = vpadd_f32(x2z2_y2w2, x2z2_y2w2);
-		return vget_lane_f32(x2y2z2w2, 0);
-#else
-		return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs));
-#endif
+		return vector_dot(lhs, rhs);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1103,26 +1428,7 @@ namespace rtm
 	RTM_DEPRECATED("Use vector_dot instead, to be removed in v2.0")
 	inline vector4f RTM_SIMD_CALL vector_dot_as_vector(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE4_INTRINSICS) && 0
-		// SSE4 dot product instruction isn't precise enough
-		return _mm_dp_ps(lhs, rhs, 0xFF);
-#elif defined(RTM_SSE2_INTRINSICS)
-		__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
-		__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
-		__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
-		__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
-		__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
-		return _mm_shuffle_ps(x2y2z2w2_0_0_0, x2y2z2w2_0_0_0, _MM_SHUFFLE(0, 0, 0, 0));
-#elif defined(RTM_NEON_INTRINSICS)
-		float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
-		float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
-		float32x2_t z2_w2 = vget_high_f32(x2_y2_z2_w2);
-		float32x2_t x2z2_y2w2 = vadd_f32(x2_y2, z2_w2);
-		float32x2_t x2y2z2w2 = vpadd_f32(x2z2_y2w2, x2z2_y2w2);
-		return vcombine_f32(x2y2z2w2, x2y2z2w2);
-#else
-		return vector_set(vector_dot(lhs, rhs));
-#endif
+		return vector_dot(lhs, rhs);
 	}
 
 	namespace rtm_impl
@@ -1156,7 +1462,8 @@ namespace rtm
 				float32x2_t x2y2z2_x2y2z2 = vadd_f32(x2y2_x2y2, z2_z2);
 				return vget_lane_f32(x2y2z2_x2y2z2, 0);
 #else
-				return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs));
+				const vector4f x2_y2_z2_w2 = vector_mul(lhs, rhs);
+				return (x2_y2_z2_w2.x + x2_y2_z2_w2.y) + x2_y2_z2_w2.z;
 #endif
 			}
 
@@ -1380,6 +1687,29 @@ namespace rtm
 			return fallback;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized vector3 using the hardware estimate of the
+	// reciprocal square root. See scalar_sqrt_reciprocal_approx(..) for its precision.
+	// If the length of the input is not finite or zero, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_normalize3_approx(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf len_sq = vector_length_squared3(input);
+		return vector_mul(input, scalar_sqrt_reciprocal_approx(len_sq));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized vector3 using a single Newton-Raphson iteration on the
+	// hardware estimate of the reciprocal square root. See scalar_sqrt_reciprocal_nr1(..)
+	// for its precision.
+	// If the length of the input is not finite or zero, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_normalize3_nr1(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf len_sq = vector_length_squared3(input);
+		return vector_mul(input, scalar_sqrt_reciprocal_nr1(len_sq));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the fractional part of the input.
 	//////////////////////////////////////////////////////////////////////////
@@ -1393,9 +1723,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmaq_f32(v2, v0, v1);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vmlaq_f32(v2, v0, v1);
 #else
 		return vector_add(vector_mul(v0, v1), v2);
@@ -1407,9 +1737,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmaq_n_f32(v2, v0, s1);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vmlaq_n_f32(v2, v0, s1);
 #else
 		return vector_add(vector_mul(v0, s1), v2);
@@ -1432,9 +1762,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmsq_f32(v2, v0, v1);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vmlsq_f32(v2, v0, v1);
 #else
 		return vector_sub(v2, vector_mul(v0, v1));
@@ -1447,9 +1777,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmsq_n_f32(v2, v0, s1);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vmlsq_n_f32(v2, v0, s1);
 #else
 		return vector_sub(v2, vector_mul(v0, s1));
@@ -1513,7 +1843,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vreinterpretq_f32_u32(vceqq_f32(lhs, rhs));
 #else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x == rhs.x), rtm_impl::get_mask_value(lhs.y == rhs.y), rtm_impl::get_mask_value(lhs.z == rhs.z), rtm_impl::get_mask_value(lhs.w == rhs.w) };
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint32_t>(lhs_lanes.values[lane_index] == rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4f>(result);
 #endif
 	}
 
@@ -1527,7 +1864,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vreinterpretq_f32_u32(vcltq_f32(lhs, rhs));
 #else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x < rhs.x), rtm_impl::get_mask_value(lhs.y < rhs.y), rtm_impl::get_mask_value(lhs.z < rhs.z), rtm_impl::get_mask_value(lhs.w < rhs.w) };
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint32_t>(lhs_lanes.values[lane_index] < rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4f>(result);
 #endif
 	}
 
@@ -1541,7 +1885,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vreinterpretq_f32_u32(vcleq_f32(lhs, rhs));
 #else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x <= rhs.x), rtm_impl::get_mask_value(lhs.y <= rhs.y), rtm_impl::get_mask_value(lhs.z <= rhs.z), rtm_impl::get_mask_value(lhs.w <= rhs.w) };
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint32_t>(lhs_lanes.values[lane_index] <= rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4f>(result);
 #endif
 	}
 
@@ -1555,7 +1906,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vreinterpretq_f32_u32(vcgtq_f32(lhs, rhs));
 #else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x > rhs.x), rtm_impl::get_mask_value(lhs.y > rhs.y), rtm_impl::get_mask_value(lhs.z > rhs.z), rtm_impl::get_mask_value(lhs.w > rhs.w) };
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint32_t>(lhs_lanes.values[lane_index] > rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4f>(result);
 #endif
 	}
 
@@ -1569,7 +1927,14 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vreinterpretq_f32_u32(vcgeq_f32(lhs, rhs));
 #else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x >= rhs.x), rtm_impl::get_mask_value(lhs.y >= rhs.y), rtm_impl::get_mask_value(lhs.z >= rhs.z), rtm_impl::get_mask_value(lhs.w >= rhs.w) };
+		const rtm_impl::vector_lanes<float> lhs_lanes = rtm_impl::to_lanes<float>(lhs);
+		const rtm_impl::vector_lanes<float> rhs_lanes = rtm_impl::to_lanes<float>(rhs);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = rtm_impl::get_mask_lane<uint32_t>(lhs_lanes.values[lane_index] >= rhs_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<mask4f>(result);
 #endif
 	}
 
@@ -1586,7 +1951,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) == 0xFFFFFFFFU;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z && lhs.w < rhs.w;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1601,7 +1967,8 @@ namespace rtm
 		uint32x2_t mask = vclt_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) == 0xFFFFFFFFFFFFFFFFu;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1618,7 +1985,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) == 0x00FFFFFFU;
 #else
-		return lhs.x < rhs.x && lhs.y < rhs.y && lhs.z < rhs.z;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1635,7 +2003,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z || lhs.w < rhs.w;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1650,7 +2019,8 @@ namespace rtm
 		uint32x2_t mask = vclt_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1667,7 +2037,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) != 0;
 #else
-		return lhs.x < rhs.x || lhs.y < rhs.y || lhs.z < rhs.z;
+		const mask4f mask = vector_less_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1684,7 +2055,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) == 0xFFFFFFFFU;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z && lhs.w <= rhs.w;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1699,7 +2071,8 @@ namespace rtm
 		uint32x2_t mask = vcle_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) == 0xFFFFFFFFFFFFFFFFULL;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1716,7 +2089,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) == 0x00FFFFFFU;
 #else
-		return lhs.x <= rhs.x && lhs.y <= rhs.y && lhs.z <= rhs.z;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1733,7 +2107,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z || lhs.w <= rhs.w;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1748,7 +2123,8 @@ namespace rtm
 		uint32x2_t mask = vcle_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1765,7 +2141,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) != 0;
 #else
-		return lhs.x <= rhs.x || lhs.y <= rhs.y || lhs.z <= rhs.z;
+		const mask4f mask = vector_less_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1782,7 +2159,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) == 0xFFFFFFFFU;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y && lhs.z > rhs.z && lhs.w > rhs.w;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1797,7 +2175,8 @@ namespace rtm
 		uint32x2_t mask = vcgt_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) == 0xFFFFFFFFFFFFFFFFULL;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1814,7 +2193,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) == 0x00FFFFFFU;
 #else
-		return lhs.x > rhs.x && lhs.y > rhs.y && lhs.z > rhs.z;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1831,7 +2211,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y || lhs.z > rhs.z || lhs.w > rhs.w;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1846,7 +2227,8 @@ namespace rtm
 		uint32x2_t mask = vcgt_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1863,7 +2245,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) != 0;
 #else
-		return lhs.x > rhs.x || lhs.y > rhs.y || lhs.z > rhs.z;
+		const mask4f mask = vector_greater_than(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -1880,7 +2263,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) == 0xFFFFFFFFU;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z && lhs.w >= rhs.w;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z & mask.w) != 0;
 #endif
 	}
 
@@ -1895,7 +2279,8 @@ namespace rtm
 		uint32x2_t mask = vcge_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) == 0xFFFFFFFFFFFFFFFFULL;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y) != 0;
 #endif
 	}
 
@@ -1912,7 +2297,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) == 0x00FFFFFFU;
 #else
-		return lhs.x >= rhs.x && lhs.y >= rhs.y && lhs.z >= rhs.z;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x & mask.y & mask.z) != 0;
 #endif
 	}
 
@@ -1929,7 +2315,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z || lhs.w >= rhs.w;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z | mask.w) != 0;
 #endif
 	}
 
@@ -1944,7 +2331,8 @@ namespace rtm
 		uint32x2_t mask = vcge_f32(vget_low_f32(lhs), vget_low_f32(rhs));
 		return vget_lane_u64(mask, 0) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y) != 0;
 #endif
 	}
 
@@ -1961,7 +2349,8 @@ namespace rtm
 		uint16x4x2_t mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15 = vzip_u16(mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[0], mask_0_8_1_9_2_10_3_11_4_12_5_13_6_14_7_15.val[1]);
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) != 0;
 #else
-		return lhs.x >= rhs.x || lhs.y >= rhs.y || lhs.z >= rhs.z;
+		const mask4f mask = vector_greater_equal(lhs, rhs);
+		return (mask.x | mask.y | mask.z) != 0;
 #endif
 	}
 
@@ -2084,7 +2473,9 @@ namespace rtm
 
 
 	//////////////////////////////////////////////////////////////////////////
-	// Per component selection depending on the mask: mask != 0 ? if_true : if_false
+	// Per component bitwise selection depending on the mask: (if_true & mask) | (if_false & ~mask)
+	// The mask is expected to have every bit of a component set or cleared (e.g. from a comparison),
+	// other mask values do not select the same bits on every platform.
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_select(mask4f_arg0 mask, vector4f_arg1 if_true, vector4f_arg2 if_false) RTM_NO_EXCEPT
 	{
@@ -2095,7 +2486,16 @@ namespace rtm
 #elif defined(RTM_NEON_INTRINSICS)
 		return vbslq_f32(mask, if_true, if_false);
 #else
-		return vector4f{ rtm_impl::select(mask.x, if_true.x, if_false.x), rtm_impl::select(mask.y, if_true.y, if_false.y), rtm_impl::select(mask.z, if_true.z, if_false.z), rtm_impl::select(mask.w, if_true.w, if_false.w) };
+		// Select with bitwise logic, a branch per lane would prevent vectorization
+		const rtm_impl::vector_lanes<uint32_t> mask_lanes = rtm_impl::to_lanes<uint32_t>(mask);
+		const rtm_impl::vector_lanes<uint32_t> if_true_lanes = rtm_impl::to_lanes<uint32_t>(if_true);
+		const rtm_impl::vector_lanes<uint32_t> if_false_lanes = rtm_impl::to_lanes<uint32_t>(if_false);
+
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = (if_true_lanes.values[lane_index] & mask_lanes.values[lane_index]) | (if_false_lanes.values[lane_index] & ~mask_lanes.values[lane_index]);
+
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -2106,22 +2506,42 @@ namespace rtm
 	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
 	inline vector4f RTM_SIMD_CALL vector_mix(vector4f_arg0 input0, vector4f_arg1 input1) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS)
+		// The intrinsic code paths below are selected at compile time, every pattern is covered
+		constexpr uint32_t lane0 = rtm_impl::get_mix_lane(comp0);
+		constexpr uint32_t lane1 = rtm_impl::get_mix_lane(comp1);
+		constexpr uint32_t lane2 = rtm_impl::get_mix_lane(comp2);
+		constexpr uint32_t lane3 = rtm_impl::get_mix_lane(comp3);
+
+		// The input each component reads from
+		const vector4f input_comp0 = rtm_impl::is_mix_xyzw(comp0) ? input0 : input1;
+		const vector4f input_comp1 = rtm_impl::is_mix_xyzw(comp1) ? input0 : input1;
+		const vector4f input_comp2 = rtm_impl::is_mix_xyzw(comp2) ? input0 : input1;
+		const vector4f input_comp3 = rtm_impl::is_mix_xyzw(comp3) ? input0 : input1;
+#endif
+
 #if defined(RTM_SSE2_INTRINSICS)
 		// All four components come from input 0
-		if (rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3))
-			return _mm_shuffle_ps(input0, input0, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3)>::test())
+		{
+			if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::z && comp3 == mix4::w>::test())
+				return input0;
+
+			return _mm_shuffle_ps(input0, input0, _MM_SHUFFLE(lane3, lane2, lane1, lane0));
+		}
 
 		// All four components come from input 1
-		if (rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3))
-			return _mm_shuffle_ps(input1, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3)>::test())
+		{
+			if (rtm_impl::static_condition<comp0 == mix4::a && comp1 == mix4::b && comp2 == mix4::c && comp3 == mix4::d>::test())
+				return input1;
 
-		// First two components come from input 0, second two come from input 1
-		if (rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3))
-			return _mm_shuffle_ps(input0, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+			return _mm_shuffle_ps(input1, input1, _MM_SHUFFLE(lane3, lane2, lane1, lane0));
+		}
 
-		// First two components come from input 1, second two come from input 0
-		if (rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3))
-			return _mm_shuffle_ps(input1, input0, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		// First two components come from one input, second two come from one input
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) == rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) == rtm_impl::is_mix_xyzw(comp3)>::test())
+			return _mm_shuffle_ps(input_comp0, input_comp2, _MM_SHUFFLE(lane3, lane2, lane1, lane0));
 
 		// Low words from both inputs are interleaved
 		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::a && comp2 == mix4::y && comp3 == mix4::b>::test())
@@ -2138,14 +2558,178 @@ namespace rtm
 		// High words from both inputs are interleaved
 		if (rtm_impl::static_condition<comp0 == mix4::c && comp1 == mix4::z && comp2 == mix4::d && comp3 == mix4::w>::test())
 			return _mm_unpackhi_ps(input1, input0);
-#endif	// defined(RTM_SSE2_INTRINSICS)
 
-		// Slow code path, not yet optimized or not using intrinsics
+#if defined(RTM_SSE4_INTRINSICS)
+		// Must be a constant expression, the blend intrinsic requires an immediate even without optimizations
+		constexpr int blend_mask = rtm_impl::get_mix_blend_mask(comp0, comp1, comp2, comp3);
+
+		// Every component is read from the lane it is written to, a single blend suffices
+		if (rtm_impl::static_condition<rtm_impl::is_mix_in_place(comp0, comp1, comp2, comp3)>::test())
+			return _mm_blend_ps(input0, input1, blend_mask);
+
+		// A single component differs from input 0 or input 1, insert it
+		if (rtm_impl::static_condition<rtm_impl::get_mix_num_matching(comp0, comp1, comp2, comp3, mix4::x, mix4::y, mix4::z, mix4::w) == 3>::test())
+		{
+			constexpr int dst_lane = comp0 != mix4::x ? 0 : (comp1 != mix4::y ? 1 : (comp2 != mix4::z ? 2 : 3));
+			constexpr int src_lane = comp0 != mix4::x ? lane0 : (comp1 != mix4::y ? lane1 : (comp2 != mix4::z ? lane2 : lane3));
+			const vector4f src = comp0 != mix4::x ? input_comp0 : (comp1 != mix4::y ? input_comp1 : (comp2 != mix4::z ? input_comp2 : input_comp3));
+			return _mm_insert_ps(input0, src, (src_lane << 6) | (dst_lane << 4));
+		}
+
+		if (rtm_impl::static_condition<rtm_impl::get_mix_num_matching(comp0, comp1, comp2, comp3, mix4::a, mix4::b, mix4::c, mix4::d) == 3>::test())
+		{
+			constexpr int dst_lane = comp0 != mix4::a ? 0 : (comp1 != mix4::b ? 1 : (comp2 != mix4::c ? 2 : 3));
+			constexpr int src_lane = comp0 != mix4::a ? lane0 : (comp1 != mix4::b ? lane1 : (comp2 != mix4::c ? lane2 : lane3));
+			const vector4f src = comp0 != mix4::a ? input_comp0 : (comp1 != mix4::b ? input_comp1 : (comp2 != mix4::c ? input_comp2 : input_comp3));
+			return _mm_insert_ps(input1, src, (src_lane << 6) | (dst_lane << 4));
+		}
+
+		// Components from input 1 are in place, shuffle input 0 and blend
+		if (rtm_impl::static_condition<rtm_impl::is_mix_abcd_in_place(comp0, comp1, comp2, comp3)>::test())
+			return _mm_blend_ps(_mm_shuffle_ps(input0, input0, _MM_SHUFFLE(lane3, lane2, lane1, lane0)), input1, blend_mask);
+
+		// Components from input 0 are in place, shuffle input 1 and blend
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw_in_place(comp0, comp1, comp2, comp3)>::test())
+			return _mm_blend_ps(input0, _mm_shuffle_ps(input1, input1, _MM_SHUFFLE(lane3, lane2, lane1, lane0)), blend_mask);
+#endif
+
+		// First two components come from the same input, gather the last two as [z, z, w, w] then merge
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) == rtm_impl::is_mix_xyzw(comp1)>::test())
+		{
+			const __m128 zzww = _mm_shuffle_ps(input_comp2, input_comp3, _MM_SHUFFLE(lane3, lane3, lane2, lane2));
+			return _mm_shuffle_ps(input_comp0, zzww, _MM_SHUFFLE(2, 0, lane1, lane0));
+		}
+
+		// Last two components come from the same input, gather the first two as [x, x, y, y] then merge
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp2) == rtm_impl::is_mix_xyzw(comp3)>::test())
+		{
+			const __m128 xxyy = _mm_shuffle_ps(input_comp0, input_comp1, _MM_SHUFFLE(lane1, lane1, lane0, lane0));
+			return _mm_shuffle_ps(xxyy, input_comp2, _MM_SHUFFLE(lane3, lane2, 2, 0));
+		}
+
+#if defined(RTM_SSE4_INTRINSICS)
+		// Shuffle both inputs and blend
+		const __m128 shuffled0 = _mm_shuffle_ps(input0, input0, _MM_SHUFFLE(lane3, lane2, lane1, lane0));
+		const __m128 shuffled1 = _mm_shuffle_ps(input1, input1, _MM_SHUFFLE(lane3, lane2, lane1, lane0));
+		return _mm_blend_ps(shuffled0, shuffled1, blend_mask);
+#else
+		// Gather [x, x, y, y] and [z, z, w, w] then merge
+		const __m128 xxyy = _mm_shuffle_ps(input_comp0, input_comp1, _MM_SHUFFLE(lane1, lane1, lane0, lane0));
+		const __m128 zzww = _mm_shuffle_ps(input_comp2, input_comp3, _MM_SHUFFLE(lane3, lane3, lane2, lane2));
+		return _mm_shuffle_ps(xxyy, zzww, _MM_SHUFFLE(2, 0, 2, 0));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+		constexpr bool is_input0_comp0 = rtm_impl::is_mix_xyzw(comp0);
+		constexpr bool is_input0_comp1 = rtm_impl::is_mix_xyzw(comp1);
+		constexpr bool is_input0_comp3 = rtm_impl::is_mix_xyzw(comp3);
+
+		// Identity
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::z && comp3 == mix4::w>::test())
+			return input0;
+
+		if (rtm_impl::static_condition<comp0 == mix4::a && comp1 == mix4::b && comp2 == mix4::c && comp3 == mix4::d>::test())
+			return input1;
+
+		// Every component is the same
+		if (rtm_impl::static_condition<comp0 == comp1 && comp1 == comp2 && comp2 == comp3>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vdupq_laneq_f32(input_comp0, lane0);
+#else
+			return vdupq_lane_f32(lane0 < 2 ? vget_low_f32(input_comp0) : vget_high_f32(input_comp0), lane0 % 2);
+#endif
+		}
+
+		// A single component differs from input 0 or input 1, insert it
+		if (rtm_impl::static_condition<rtm_impl::get_mix_num_matching(comp0, comp1, comp2, comp3, mix4::x, mix4::y, mix4::z, mix4::w) == 3 || rtm_impl::get_mix_num_matching(comp0, comp1, comp2, comp3, mix4::a, mix4::b, mix4::c, mix4::d) == 3>::test())
+		{
+			constexpr bool is_input0_base = rtm_impl::get_mix_num_matching(comp0, comp1, comp2, comp3, mix4::x, mix4::y, mix4::z, mix4::w) == 3;
+			const vector4f base = is_input0_base ? input0 : input1;
+
+			constexpr uint32_t base_offset = is_input0_base ? 0 : 4;
+			constexpr int dst_lane = uint32_t(comp0) != base_offset + 0 ? 0 : (uint32_t(comp1) != base_offset + 1 ? 1 : (uint32_t(comp2) != base_offset + 2 ? 2 : 3));
+			constexpr int src_lane = dst_lane == 0 ? lane0 : (dst_lane == 1 ? lane1 : (dst_lane == 2 ? lane2 : lane3));
+			const vector4f src = dst_lane == 0 ? input_comp0 : (dst_lane == 1 ? input_comp1 : (dst_lane == 2 ? input_comp2 : input_comp3));
+
+#if defined(RTM_NEON64_INTRINSICS)
+			return vcopyq_laneq_f32(base, dst_lane, src, src_lane);
+#else
+			return vsetq_lane_f32(vgetq_lane_f32(src, src_lane), base, dst_lane);
+#endif
+		}
+
+		// Reverse pairs: [y, x, w, z]
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 1, 0, 3, 2, is_input0_comp0, is_input0_comp0)>::test())
+			return vrev64q_f32(input_comp0);
+
+		// Extract from the concatenated inputs: [input0[n], ..., input1[n - 1]]
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 1, 2, 3, 4, is_input0_comp0, is_input0_comp3)>::test())
+			return vextq_f32(input_comp0, input_comp3, 1);
+
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 2, 3, 4, 5, is_input0_comp0, is_input0_comp3)>::test())
+			return vextq_f32(input_comp0, input_comp3, 2);
+
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 3, 4, 5, 6, is_input0_comp0, is_input0_comp3)>::test())
+			return vextq_f32(input_comp0, input_comp3, 3);
+
+		// Interleave: [x, a, y, b] and [z, c, w, d]
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 0, 4, 1, 5, is_input0_comp0, is_input0_comp1)>::test())
+			return vzipq_f32(input_comp0, input_comp1).val[0];
+
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 2, 6, 3, 7, is_input0_comp0, is_input0_comp1)>::test())
+			return vzipq_f32(input_comp0, input_comp1).val[1];
+
+		// De-interleave: [x, z, a, c] and [y, w, b, d]
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 0, 2, 4, 6, is_input0_comp0, is_input0_comp3)>::test())
+			return vuzpq_f32(input_comp0, input_comp3).val[0];
+
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 1, 3, 5, 7, is_input0_comp0, is_input0_comp3)>::test())
+			return vuzpq_f32(input_comp0, input_comp3).val[1];
+
+		// Transpose: [x, a, z, c] and [y, b, w, d]
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 0, 4, 2, 6, is_input0_comp0, is_input0_comp1)>::test())
+			return vtrnq_f32(input_comp0, input_comp1).val[0];
+
+		if (rtm_impl::static_condition<rtm_impl::is_mix_concat_permutation(comp0, comp1, comp2, comp3, 1, 5, 3, 7, is_input0_comp0, is_input0_comp1)>::test())
+			return vtrnq_f32(input_comp0, input_comp1).val[1];
+
+		// Both halves read a single 64 bit half of an input, optionally reversed or duplicated
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) == rtm_impl::is_mix_xyzw(comp1) && lane0 / 2 == lane1 / 2 && rtm_impl::is_mix_xyzw(comp2) == rtm_impl::is_mix_xyzw(comp3) && lane2 / 2 == lane3 / 2>::test())
+		{
+			const float32x2_t half01 = lane0 < 2 ? vget_low_f32(input_comp0) : vget_high_f32(input_comp0);
+			const float32x2_t half23 = lane2 < 2 ? vget_low_f32(input_comp2) : vget_high_f32(input_comp2);
+			const float32x2_t xy = lane0 == lane1 ? vdup_lane_f32(half01, lane0 % 2) : (lane0 < lane1 ? half01 : vrev64_f32(half01));
+			const float32x2_t zw = lane2 == lane3 ? vdup_lane_f32(half23, lane2 % 2) : (lane2 < lane3 ? half23 : vrev64_f32(half23));
+			return vcombine_f32(xy, zw);
+		}
+
+#if defined(RTM_NEON64_INTRINSICS)
+		// Generic permutation with a table lookup
+		alignas(16) static constexpr uint8_t byte_indices[16] =
+		{
+			uint8_t(uint32_t(comp0) * 4 + 0), uint8_t(uint32_t(comp0) * 4 + 1), uint8_t(uint32_t(comp0) * 4 + 2), uint8_t(uint32_t(comp0) * 4 + 3),
+			uint8_t(uint32_t(comp1) * 4 + 0), uint8_t(uint32_t(comp1) * 4 + 1), uint8_t(uint32_t(comp1) * 4 + 2), uint8_t(uint32_t(comp1) * 4 + 3),
+			uint8_t(uint32_t(comp2) * 4 + 0), uint8_t(uint32_t(comp2) * 4 + 1), uint8_t(uint32_t(comp2) * 4 + 2), uint8_t(uint32_t(comp2) * 4 + 3),
+			uint8_t(uint32_t(comp3) * 4 + 0), uint8_t(uint32_t(comp3) * 4 + 1), uint8_t(uint32_t(comp3) * 4 + 2), uint8_t(uint32_t(comp3) * 4 + 3),
+		};
+
+		const uint8x16x2_t table = { { vreinterpretq_u8_f32(input0), vreinterpretq_u8_f32(input1) } };
+		return vreinterpretq_f32_u8(vqtbl2q_u8(table, vld1q_u8(&byte_indices[0])));
+#else
+		// Generic permutation with lane moves, they remain in registers
+		float32x4_t result = vdupq_n_f32(vgetq_lane_f32(input_comp0, lane0));
+		result = vsetq_lane_f32(vgetq_lane_f32(input_comp1, lane1), result, 1);
+		result = vsetq_lane_f32(vgetq_lane_f32(input_comp2, lane2), result, 2);
+		return vsetq_lane_f32(vgetq_lane_f32(input_comp3, lane3), result, 3);
+#endif
+#else
+		// No intrinsics, select each component
 		const float x = rtm_impl::is_mix_xyzw(comp0) ? vector_get_component<comp0>(input0) : vector_get_component<comp0>(input1);
 		const float y = rtm_impl::is_mix_xyzw(comp1) ? vector_get_component<comp1>(input0) : vector_get_component<comp1>(input1);
 		const float z = rtm_impl::is_mix_xyzw(comp2) ? vector_get_component<comp2>(input0) : vector_get_component<comp2>(input1);
 		const float w = rtm_impl::is_mix_xyzw(comp3) ? vector_get_component<comp3>(input0) : vector_get_component<comp3>(input1);
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2199,18 +2783,18 @@ namespace rtm
 		__m128 signs = _mm_and_ps(sign_bit, control_sign);
 		__m128 abs_input = _mm_andnot_ps(sign_bit, input);
 		return _mm_or_ps(abs_input, signs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vbslq_f32(vdupq_n_u32(0x80000000U), control_sign, input);
 #else
-		float x = vector_get_x(input);
-		float y = vector_get_y(input);
-		float z = vector_get_z(input);
-		float w = vector_get_w(input);
+		// Copy the sign bit with bitwise logic, std::copysign isn't vectorized by every compiler
+		const rtm_impl::vector_lanes<uint32_t> input_lanes = rtm_impl::to_lanes<uint32_t>(input);
+		const rtm_impl::vector_lanes<uint32_t> control_sign_lanes = rtm_impl::to_lanes<uint32_t>(control_sign);
 
-		float x_sign = vector_get_x(control_sign);
-		float y_sign = vector_get_y(control_sign);
-		float z_sign = vector_get_z(control_sign);
-		float w_sign = vector_get_w(control_sign);
+		rtm_impl::vector_lanes<uint32_t> result;
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			result.values[lane_index] = (input_lanes.values[lane_index] & 0x7FFFFFFFU) | (control_sign_lanes.values[lane_index] & 0x80000000U);
 
-		return vector_set(std::copysign(x, x_sign), std::copysign(y, y_sign), std::copysign(z, z_sign), std::copysign(w, w_sign));
+		return rtm_impl::from_lanes<vector4f>(result);
 #endif
 	}
 
@@ -2315,6 +2899,9 @@ namespace rtm
 		__m128 truncating_offset = _mm_or_ps(sign, fractional_limit);
 		__m128 integer_part = _mm_sub_ps(_mm_add_ps(input, truncating_offset), truncating_offset);
 
+		// Restore the sign to return -0.0 when a negative input rounds to zero, like the SSE4 instruction
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		// If our input was so large that it had no fractional part, return it unchanged
 		// Otherwise return our integer part
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
@@ -2479,6 +3066,63 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component both the sine and the cosine of the input angle.
+	// This is faster than calling vector_sin and vector_cos since the range
+	// reduction is shared between both.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos(vector4f_arg0 input, vector4f& out_sine, vector4f& out_cosine) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Remap our input in the [-pi, pi] range
+		__m128 quotient = _mm_mul_ps(input, _mm_set_ps1(rtm::constants::one_div_two_pi()));
+		quotient = vector_round_bankers(quotient);
+		quotient = _mm_mul_ps(quotient, _mm_set_ps1(rtm::constants::two_pi()));
+		__m128 x = _mm_sub_ps(input, quotient);
+
+		// Remap our input in the [-pi/2, pi/2] range
+		const __m128 sign_mask = _mm_set_ps(-0.0F, -0.0F, -0.0F, -0.0F);
+		__m128 x_sign = _mm_and_ps(x, sign_mask);
+		__m128 reference = _mm_or_ps(x_sign, _mm_set_ps1(rtm::constants::pi()));
+		const __m128 reflection = _mm_sub_ps(reference, x);
+
+		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
+		__m128 x_abs = _mm_and_ps(x, _mm_castsi128_ps(abs_mask));
+		__m128 is_less_equal_than_half_pi = _mm_cmple_ps(x_abs, _mm_set_ps1(rtm::constants::half_pi()));
+
+#if defined(RTM_AVX_INTRINSICS)
+		x = _mm_blendv_ps(reflection, x, is_less_equal_than_half_pi);
+#else
+		x = _mm_or_ps(_mm_andnot_ps(is_less_equal_than_half_pi, reflection), _mm_and_ps(x, is_less_equal_than_half_pi));
+#endif
+
+		const __m128 x2 = _mm_mul_ps(x, x);
+
+		// Use a degree 11 minimax approximation polynomial for the sine
+		// See: GPGPU Programming for Games and Science (David H. Eberly)
+		__m128 sin_result = _mm_add_ps(_mm_mul_ps(x2, _mm_set_ps1(-2.3828544692960918e-8F)), _mm_set_ps1(2.7521557770526783e-6F));
+		sin_result = _mm_add_ps(_mm_mul_ps(sin_result, x2), _mm_set_ps1(-1.9840782426250314e-4F));
+		sin_result = _mm_add_ps(_mm_mul_ps(sin_result, x2), _mm_set_ps1(8.3333303183525942e-3F));
+		sin_result = _mm_add_ps(_mm_mul_ps(sin_result, x2), _mm_set_ps1(-1.6666666601721269e-1F));
+		sin_result = _mm_add_ps(_mm_mul_ps(sin_result, x2), _mm_set_ps1(1.0F));
+		out_sine = _mm_mul_ps(sin_result, x);
+
+		// Use a degree 10 minimax approximation polynomial for the cosine
+		// See: GPGPU Programming for Games and Science (David H. Eberly)
+		__m128 cos_result = _mm_add_ps(_mm_mul_ps(x2, _mm_set_ps1(-2.6051615464872668e-7F)), _mm_set_ps1(2.4760495088926859e-5F));
+		cos_result = _mm_add_ps(_mm_mul_ps(cos_result, x2), _mm_set_ps1(-1.3888377661039897e-3F));
+		cos_result = _mm_add_ps(_mm_mul_ps(cos_result, x2), _mm_set_ps1(4.1666638865338612e-2F));
+		cos_result = _mm_add_ps(_mm_mul_ps(cos_result, x2), _mm_set_ps1(-4.9999999508695869e-1F));
+		cos_result = _mm_add_ps(_mm_mul_ps(cos_result, x2), _mm_set_ps1(1.0F));
+
+		// The reflection flips the sign of the cosine
+		out_cosine = _mm_or_ps(cos_result, _mm_andnot_ps(is_less_equal_than_half_pi, sign_mask));
+#else
+		out_sine = vector_sin(input);
+		out_cosine = vector_cos(input);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the arc-cosine of the input.
 	// Input value must be in the range [-1.0, 1.0].
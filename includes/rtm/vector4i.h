@@ -0,0 +1,818 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2017 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4i.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+//////////////////////////////////////////////////////////////////////////
+// A vector4i holds 4x 32 bit signed integers for quantized data and grid math
+// alongside the vector4f math.
+//
+// Arithmetic wraps around on overflow like unsigned integers do and shifts expect
+// a count in [0, 31]. Conversions from vector4f expect the input to fit in a 32 bit
+// signed integer. Otherwise, NaN and out of range values become INT32_MIN with SSE2
+// and without intrinsics while NEON saturates them (and NaN becomes 0).
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector4i from all 4 components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_set_i32(int32_t x, int32_t y, int32_t z, int32_t w) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_set_epi32(w, z, y, x));
+#elif defined(RTM_NEON_INTRINSICS)
+		alignas(16) const int32_t data[4] = { x, y, z, w };
+		return RTM_IMPL_VECTOR4i_SET(vld1q_s32(data));
+#else
+		return vector4i{ x, y, z, w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector4i with all 4 components set to the same value.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_set_i32(int32_t xyzw) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_set1_epi32(xyzw));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vdupq_n_s32(xyzw));
+#else
+		return vector4i{ xyzw, xyzw, xyzw, xyzw };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned vector4i from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_load(const int32_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vld1q_s32(input));
+#else
+		return vector4i{ input[0], input[1], input[2], input[3] };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector4i to unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector4i_arg0 input, int32_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), RTM_IMPL_VECTOR4i_GET(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_s32(output, RTM_IMPL_VECTOR4i_GET(input));
+#else
+		output[0] = input.x;
+		output[1] = input.y;
+		output[2] = input.z;
+		output[3] = input.w;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [x] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_x(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(RTM_IMPL_VECTOR4i_GET(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 0);
+#else
+		return input.x;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [y] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_y(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(RTM_IMPL_VECTOR4i_GET(input), _MM_SHUFFLE(1, 1, 1, 1)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 1);
+#else
+		return input.y;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [z] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_z(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(RTM_IMPL_VECTOR4i_GET(input), _MM_SHUFFLE(2, 2, 2, 2)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 2);
+#else
+		return input.z;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [w] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_w(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(RTM_IMPL_VECTOR4i_GET(input), _MM_SHUFFLE(3, 3, 3, 3)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 3);
+#else
+		return input.w;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4i into a vector4f.
+	// Values larger than 2^24 in magnitude are rounded to the nearest float.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_cast(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtepi32_ps(RTM_IMPL_VECTOR4i_GET(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vcvtq_f32_s32(RTM_IMPL_VECTOR4i_GET(input));
+#else
+		return vector_set(float(input.x), float(input.y), float(input.z), float(input.w));
+#endif
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Truncates like _mm_cvttps_epi32: NaN and out of range values become INT32_MIN
+		// instead of triggering undefined behavior.
+		//////////////////////////////////////////////////////////////////////////
+		inline int32_t vector4i_truncate(float input) RTM_NO_EXCEPT
+		{
+			return (input >= -2147483648.0F && input < 2147483648.0F) ? int32_t(input) : (-2147483647 - 1);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into a vector4i, rounding towards zero like a C cast.
+	// vector_to_int_truncate(2.7) = 2
+	// vector_to_int_truncate(-2.7) = -2
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_to_int_truncate(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvttps_epi32(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtq_s32_f32(input));
+#else
+		return vector4i{ rtm_impl::vector4i_truncate(input.x), rtm_impl::vector4i_truncate(input.y), rtm_impl::vector4i_truncate(input.z), rtm_impl::vector4i_truncate(input.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into a vector4i, rounding towards negative infinity.
+	// vector_to_int_floor(2.7) = 2
+	// vector_to_int_floor(-2.2) = -3
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_to_int_floor(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtmq_s32_f32(input));
+#else
+		return vector_to_int_truncate(vector_floor(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into a vector4i, rounding towards positive infinity.
+	// vector_to_int_ceil(2.2) = 3
+	// vector_to_int_ceil(-2.7) = -2
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_to_int_ceil(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtpq_s32_f32(input));
+#else
+		return vector_to_int_truncate(vector_ceil(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into a vector4i, rounding to the nearest integer with halfway
+	// values rounded away from zero, see vector_round_symmetric(..).
+	// vector_to_int_round_symmetric(2.5) = 3
+	// vector_to_int_round_symmetric(-2.5) = -3
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_to_int_round_symmetric(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_NEON64_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtaq_s32_f32(input));
+#else
+		return vector_to_int_truncate(vector_round_symmetric(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into a vector4i, rounding to the nearest integer with halfway
+	// values rounded to even, see vector_round_bankers(..).
+	// vector_to_int_round_bankers(2.5) = 2
+	// vector_to_int_round_bankers(-1.5) = -2
+	// Note: With SSE2, this function relies on the default floating point rounding mode (banker's rounding).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_to_int_round_bankers(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvtps_epi32(input));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtnq_s32_f32(input));
+#else
+		return vector_to_int_truncate(vector_round_bankers(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_add(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_add_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vaddq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{
+			int32_t(uint32_t(lhs.x) + uint32_t(rhs.x)),
+			int32_t(uint32_t(lhs.y) + uint32_t(rhs.y)),
+			int32_t(uint32_t(lhs.z) + uint32_t(rhs.z)),
+			int32_t(uint32_t(lhs.w) + uint32_t(rhs.w)) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_sub(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_sub_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vsubq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{
+			int32_t(uint32_t(lhs.x) - uint32_t(rhs.x)),
+			int32_t(uint32_t(lhs.y) - uint32_t(rhs.y)),
+			int32_t(uint32_t(lhs.z) - uint32_t(rhs.z)),
+			int32_t(uint32_t(lhs.w) - uint32_t(rhs.w)) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component multiplication of the two inputs: lhs * rhs
+	// Only the lower 32 bits of each product are kept.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_mul(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_mullo_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		// SSE2 only multiplies the even components into 64 bit results, the lower 32 bits are the same signed or not
+		const __m128i xz = _mm_mul_epu32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+		const __m128i yw = _mm_mul_epu32(_mm_srli_si128(RTM_IMPL_VECTOR4i_GET(lhs), 4), _mm_srli_si128(RTM_IMPL_VECTOR4i_GET(rhs), 4));
+		return RTM_IMPL_VECTOR4i_SET(_mm_unpacklo_epi32(_mm_shuffle_epi32(xz, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(yw, _MM_SHUFFLE(0, 0, 2, 0))));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vmulq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{
+			int32_t(uint32_t(lhs.x) * uint32_t(rhs.x)),
+			int32_t(uint32_t(lhs.y) * uint32_t(rhs.y)),
+			int32_t(uint32_t(lhs.z) * uint32_t(rhs.z)),
+			int32_t(uint32_t(lhs.w) * uint32_t(rhs.w)) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_neg(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vnegq_s32(RTM_IMPL_VECTOR4i_GET(input)));
+#else
+		return vector_sub(vector_set_i32(0), input);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component absolute value of the input: abs(input)
+	// abs(INT32_MIN) remains INT32_MIN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_abs(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_abs_epi32(RTM_IMPL_VECTOR4i_GET(input)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i sign = _mm_srai_epi32(RTM_IMPL_VECTOR4i_GET(input), 31);
+		return RTM_IMPL_VECTOR4i_SET(_mm_sub_epi32(_mm_xor_si128(RTM_IMPL_VECTOR4i_GET(input), sign), sign));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vabsq_s32(RTM_IMPL_VECTOR4i_GET(input)));
+#else
+		return vector4i{
+			input.x < 0 ? int32_t(0U - uint32_t(input.x)) : input.x,
+			input.y < 0 ? int32_t(0U - uint32_t(input.y)) : input.y,
+			input.z < 0 ? int32_t(0U - uint32_t(input.z)) : input.z,
+			input.w < 0 ? int32_t(0U - uint32_t(input.w)) : input.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component minimum of the two inputs: min(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_min(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_min_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i is_lhs_greater = _mm_cmpgt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+		return RTM_IMPL_VECTOR4i_SET(_mm_or_si128(_mm_and_si128(is_lhs_greater, RTM_IMPL_VECTOR4i_GET(rhs)), _mm_andnot_si128(is_lhs_greater, RTM_IMPL_VECTOR4i_GET(lhs))));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vminq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x < rhs.x ? lhs.x : rhs.x, lhs.y < rhs.y ? lhs.y : rhs.y, lhs.z < rhs.z ? lhs.z : rhs.z, lhs.w < rhs.w ? lhs.w : rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component maximum of the two inputs: max(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_max(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_max_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i is_lhs_greater = _mm_cmpgt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+		return RTM_IMPL_VECTOR4i_SET(_mm_or_si128(_mm_and_si128(is_lhs_greater, RTM_IMPL_VECTOR4i_GET(lhs)), _mm_andnot_si128(is_lhs_greater, RTM_IMPL_VECTOR4i_GET(rhs))));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vmaxq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x > rhs.x ? lhs.x : rhs.x, lhs.y > rhs.y ? lhs.y : rhs.y, lhs.z > rhs.z ? lhs.z : rhs.z, lhs.w > rhs.w ? lhs.w : rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component clamping of an input between a minimum and a maximum value: min(max_value, max(min_value, input))
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_clamp(vector4i_arg0 input, vector4i_arg1 min_value, vector4i_arg2 max_value) RTM_NO_EXCEPT
+	{
+		return vector_min(max_value, vector_max(min_value, input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Bitwise logic and shifts
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component logical AND between the inputs: lhs & rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_and(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_and_si128(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vandq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x & rhs.x, lhs.y & rhs.y, lhs.z & rhs.z, lhs.w & rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component logical OR between the inputs: lhs | rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_or(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_or_si128(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vorrq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x | rhs.x, lhs.y | rhs.y, lhs.z | rhs.z, lhs.w | rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component logical XOR between the inputs: lhs ^ rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_xor(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_xor_si128(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(veorq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x ^ rhs.x, lhs.y ^ rhs.y, lhs.z ^ rhs.z, lhs.w ^ rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component left shift of the input: input << count
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_left(vector4i_arg0 input, int32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_sll_epi32(RTM_IMPL_VECTOR4i_GET(input), _mm_cvtsi32_si128(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vshlq_s32(RTM_IMPL_VECTOR4i_GET(input), vdupq_n_s32(count)));
+#else
+		return vector4i{
+			int32_t(uint32_t(input.x) << count),
+			int32_t(uint32_t(input.y) << count),
+			int32_t(uint32_t(input.z) << count),
+			int32_t(uint32_t(input.w) << count) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component arithmetic right shift of the input, the sign bit is replicated: input >> count
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_right(vector4i_arg0 input, int32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_sra_epi32(RTM_IMPL_VECTOR4i_GET(input), _mm_cvtsi32_si128(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vshlq_s32(RTM_IMPL_VECTOR4i_GET(input), vdupq_n_s32(-count)));
+#else
+		// Written without relying on the implementation defined behavior of >> on negative values
+		const auto shift = [count](int32_t value) { return value < 0 ? int32_t(~(~uint32_t(value) >> count)) : int32_t(uint32_t(value) >> count); };
+		return vector4i{ shift(input.x), shift(input.y), shift(input.z), shift(input.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component logical right shift of the input, zeroes are shifted in: uint32_t(input) >> count
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_right_logical(vector4i_arg0 input, int32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_srl_epi32(RTM_IMPL_VECTOR4i_GET(input), _mm_cvtsi32_si128(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vshlq_u32(vreinterpretq_u32_s32(RTM_IMPL_VECTOR4i_GET(input)), vdupq_n_s32(-count))));
+#else
+		return vector4i{
+			int32_t(uint32_t(input.x) >> count),
+			int32_t(uint32_t(input.y) >> count),
+			int32_t(uint32_t(input.z) >> count),
+			int32_t(uint32_t(input.w) >> count) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if equal, otherwise 0: lhs == rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmpeq_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vceqq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ lhs.x == rhs.x ? ~0U : 0U, lhs.y == rhs.y ? ~0U : 0U, lhs.z == rhs.z ? ~0U : 0U, lhs.w == rhs.w ? ~0U : 0U };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_less_than(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmplt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcltq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ lhs.x < rhs.x ? ~0U : 0U, lhs.y < rhs.y ? ~0U : 0U, lhs.z < rhs.z ? ~0U : 0U, lhs.w < rhs.w ? ~0U : 0U };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if less equal, otherwise 0: lhs <= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_less_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_xor_si128(_mm_cmpgt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)), _mm_set1_epi32(-1));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcleq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ lhs.x <= rhs.x ? ~0U : 0U, lhs.y <= rhs.y ? ~0U : 0U, lhs.z <= rhs.z ? ~0U : 0U, lhs.w <= rhs.w ? ~0U : 0U };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if greater than, otherwise 0: lhs > rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_greater_than(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmpgt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcgtq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ lhs.x > rhs.x ? ~0U : 0U, lhs.y > rhs.y ? ~0U : 0U, lhs.z > rhs.z ? ~0U : 0U, lhs.w > rhs.w ? ~0U : 0U };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if greater equal, otherwise 0: lhs >= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_greater_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_xor_si128(_mm_cmplt_epi32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)), _mm_set1_epi32(-1));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcgeq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ lhs.x >= rhs.x ? ~0U : 0U, lhs.y >= rhs.y ? ~0U : 0U, lhs.z >= rhs.z ? ~0U : 0U, lhs.w >= rhs.w ? ~0U : 0U };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component selection depending on the mask: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_select(mask4i_arg0 mask, vector4i_arg1 if_true, vector4i_arg2 if_false) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_blendv_epi8(RTM_IMPL_VECTOR4i_GET(if_false), RTM_IMPL_VECTOR4i_GET(if_true), mask));
+#elif defined(RTM_SSE2_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_or_si128(_mm_and_si128(mask, RTM_IMPL_VECTOR4i_GET(if_true)), _mm_andnot_si128(mask, RTM_IMPL_VECTOR4i_GET(if_false))));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vbslq_s32(RTM_IMPL_MASK4i_GET(mask), RTM_IMPL_VECTOR4i_GET(if_true), RTM_IMPL_VECTOR4i_GET(if_false)));
+#else
+		return vector4i{ mask.x != 0 ? if_true.x : if_false.x, mask.y != 0 ? if_true.y : if_false.y, mask.z != 0 ? if_true.z : if_false.z, mask.w != 0 ? if_true.w : if_false.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packing and unpacking
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4x unsigned 8 bit integers from unaligned memory and zero extends them.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_unpack_u8(const uint8_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		int32_t packed;
+		std::memcpy(&packed, input, sizeof(packed));
+		const __m128i bytes = _mm_cvtsi32_si128(packed);
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvtepu8_epi32(bytes));
+#else
+		const __m128i zero = _mm_setzero_si128();
+		return RTM_IMPL_VECTOR4i_SET(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+		uint32_t packed;
+		std::memcpy(&packed, input, sizeof(packed));
+		const uint16x8_t shorts = vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed)));
+		return RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(shorts))));
+#else
+		return vector4i{ int32_t(input[0]), int32_t(input[1]), int32_t(input[2]), int32_t(input[3]) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4x signed 8 bit integers from unaligned memory and sign extends them.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_unpack_i8(const int8_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		int32_t packed;
+		std::memcpy(&packed, input, sizeof(packed));
+		const __m128i bytes = _mm_cvtsi32_si128(packed);
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvtepi8_epi32(bytes));
+#else
+		// Move each byte into the top of its component and shift it back down with sign extension
+		const __m128i shorts = _mm_unpacklo_epi8(bytes, bytes);
+		return RTM_IMPL_VECTOR4i_SET(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 24));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+		uint32_t packed;
+		std::memcpy(&packed, input, sizeof(packed));
+		const int16x8_t shorts = vmovl_s8(vreinterpret_s8_u32(vdup_n_u32(packed)));
+		return RTM_IMPL_VECTOR4i_SET(vmovl_s16(vget_low_s16(shorts)));
+#else
+		return vector4i{ int32_t(input[0]), int32_t(input[1]), int32_t(input[2]), int32_t(input[3]) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4x unsigned 16 bit integers from unaligned memory and zero extends them.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_unpack_u16(const uint16_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvtepu16_epi32(shorts));
+#else
+		return RTM_IMPL_VECTOR4i_SET(_mm_unpacklo_epi16(shorts, _mm_setzero_si128()));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vld1_u16(input))));
+#else
+		return vector4i{ int32_t(input[0]), int32_t(input[1]), int32_t(input[2]), int32_t(input[3]) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4x signed 16 bit integers from unaligned memory and sign extends them.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_unpack_i16(const int16_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i shorts = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+#if defined(RTM_SSE4_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(_mm_cvtepi16_epi32(shorts));
+#else
+		return RTM_IMPL_VECTOR4i_SET(_mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vmovl_s16(vld1_s16(input)));
+#else
+		return vector4i{ int32_t(input[0]), int32_t(input[1]), int32_t(input[2]), int32_t(input[3]) };
+#endif
+	}
+
+	namespace rtm_impl
+	{
+		inline int32_t vector4i_saturate(int32_t input, int32_t min_value, int32_t max_value) RTM_NO_EXCEPT
+		{
+			return input < min_value ? min_value : (input > max_value ? max_value : input);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 16x unsigned 8 bit integers to unaligned memory, saturated to [0, 255].
+	// The components of v0 are written first, then v1, v2, and v3.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_pack_u8(vector4i_arg0 v0, vector4i_arg1 v1, vector4i_arg2 v2, vector4i_arg3 v3, uint8_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Saturating to 16 bits first does not change the final 8 bit result
+		const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(RTM_IMPL_VECTOR4i_GET(v0), RTM_IMPL_VECTOR4i_GET(v1)), _mm_packs_epi32(RTM_IMPL_VECTOR4i_GET(v2), RTM_IMPL_VECTOR4i_GET(v3)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+#elif defined(RTM_NEON_INTRINSICS)
+		const int16x8_t shorts01 = vcombine_s16(vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v0)), vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v1)));
+		const int16x8_t shorts23 = vcombine_s16(vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v2)), vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v3)));
+		vst1q_u8(output, vcombine_u8(vqmovun_s16(shorts01), vqmovun_s16(shorts23)));
+#else
+		const vector4i* inputs[4] = { &v0, &v1, &v2, &v3 };
+		for (uint32_t input_index = 0; input_index < 4; ++input_index)
+		{
+			const vector4i& input = *inputs[input_index];
+			output[input_index * 4 + 0] = uint8_t(rtm_impl::vector4i_saturate(input.x, 0, 255));
+			output[input_index * 4 + 1] = uint8_t(rtm_impl::vector4i_saturate(input.y, 0, 255));
+			output[input_index * 4 + 2] = uint8_t(rtm_impl::vector4i_saturate(input.z, 0, 255));
+			output[input_index * 4 + 3] = uint8_t(rtm_impl::vector4i_saturate(input.w, 0, 255));
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 16x signed 8 bit integers to unaligned memory, saturated to [-128, 127].
+	// The components of v0 are written first, then v1, v2, and v3.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_pack_i8(vector4i_arg0 v0, vector4i_arg1 v1, vector4i_arg2 v2, vector4i_arg3 v3, int8_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(RTM_IMPL_VECTOR4i_GET(v0), RTM_IMPL_VECTOR4i_GET(v1)), _mm_packs_epi32(RTM_IMPL_VECTOR4i_GET(v2), RTM_IMPL_VECTOR4i_GET(v3)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+#elif defined(RTM_NEON_INTRINSICS)
+		const int16x8_t shorts01 = vcombine_s16(vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v0)), vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v1)));
+		const int16x8_t shorts23 = vcombine_s16(vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v2)), vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v3)));
+		vst1q_s8(output, vcombine_s8(vqmovn_s16(shorts01), vqmovn_s16(shorts23)));
+#else
+		const vector4i* inputs[4] = { &v0, &v1, &v2, &v3 };
+		for (uint32_t input_index = 0; input_index < 4; ++input_index)
+		{
+			const vector4i& input = *inputs[input_index];
+			output[input_index * 4 + 0] = int8_t(rtm_impl::vector4i_saturate(input.x, -128, 127));
+			output[input_index * 4 + 1] = int8_t(rtm_impl::vector4i_saturate(input.y, -128, 127));
+			output[input_index * 4 + 2] = int8_t(rtm_impl::vector4i_saturate(input.z, -128, 127));
+			output[input_index * 4 + 3] = int8_t(rtm_impl::vector4i_saturate(input.w, -128, 127));
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8x unsigned 16 bit integers to unaligned memory, saturated to [0, 65535].
+	// The components of v0 are written first, then v1.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_pack_u16(vector4i_arg0 v0, vector4i_arg1 v1, uint16_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi32(RTM_IMPL_VECTOR4i_GET(v0), RTM_IMPL_VECTOR4i_GET(v1)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		// SSE2 only packs with signed saturation, clamp and bias the values into the signed range
+		const vector4i min_value = vector_set_i32(0);
+		const vector4i max_value = vector_set_i32(65535);
+		const __m128i bias = _mm_set1_epi32(32768);
+		const __m128i biased0 = _mm_sub_epi32(RTM_IMPL_VECTOR4i_GET(vector_clamp(v0, min_value, max_value)), bias);
+		const __m128i biased1 = _mm_sub_epi32(RTM_IMPL_VECTOR4i_GET(vector_clamp(v1, min_value, max_value)), bias);
+		const __m128i shorts = _mm_xor_si128(_mm_packs_epi32(biased0, biased1), _mm_set1_epi16(-32768));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), shorts);
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_u16(output, vcombine_u16(vqmovun_s32(RTM_IMPL_VECTOR4i_GET(v0)), vqmovun_s32(RTM_IMPL_VECTOR4i_GET(v1))));
+#else
+		const vector4i* inputs[2] = { &v0, &v1 };
+		for (uint32_t input_index = 0; input_index < 2; ++input_index)
+		{
+			const vector4i& input = *inputs[input_index];
+			output[input_index * 4 + 0] = uint16_t(rtm_impl::vector4i_saturate(input.x, 0, 65535));
+			output[input_index * 4 + 1] = uint16_t(rtm_impl::vector4i_saturate(input.y, 0, 65535));
+			output[input_index * 4 + 2] = uint16_t(rtm_impl::vector4i_saturate(input.z, 0, 65535));
+			output[input_index * 4 + 3] = uint16_t(rtm_impl::vector4i_saturate(input.w, 0, 65535));
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8x signed 16 bit integers to unaligned memory, saturated to [-32768, 32767].
+	// The components of v0 are written first, then v1.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_pack_i16(vector4i_arg0 v0, vector4i_arg1 v1, int16_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(RTM_IMPL_VECTOR4i_GET(v0), RTM_IMPL_VECTOR4i_GET(v1)));
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_s16(output, vcombine_s16(vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v0)), vqmovn_s32(RTM_IMPL_VECTOR4i_GET(v1))));
+#else
+		const vector4i* inputs[2] = { &v0, &v1 };
+		for (uint32_t input_index = 0; input_index < 2; ++input_index)
+		{
+			const vector4i& input = *inputs[input_index];
+			output[input_index * 4 + 0] = int16_t(rtm_impl::vector4i_saturate(input.x, -32768, 32767));
+			output[input_index * 4 + 1] = int16_t(rtm_impl::vector4i_saturate(input.y, -32768, 32767));
+			output[input_index * 4 + 2] = int16_t(rtm_impl::vector4i_saturate(input.z, -32768, 32767));
+			output[input_index * 4 + 3] = int16_t(rtm_impl::vector4i_saturate(input.w, -32768, 32767));
+		}
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
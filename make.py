@@ -14,6 +14,7 @@ def parse_argv():
 	actions.add_argument('-clean', action='store_true')
 	actions.add_argument('-unit_test', action='store_true')
 	actions.add_argument('-bench', action='store_true')
+	actions.add_argument('-accuracy', action='store_true')
 
 	target = parser.add_argument_group(title='Target')
 	target.add_argument('-compiler', choices=['vs2015', 'vs2017', 'vs2019', 'vs2019-clang', 'android', 'clang4', 'clang5', 'clang6', 'clang7', 'clang8', 'clang9', 'clang10', 'gcc5', 'gcc6', 'gcc7', 'gcc8', 'gcc9', 'gcc10', 'osx', 'ios', 'emscripten'], help='Defaults to the host system\'s default compiler')
@@ -24,6 +25,8 @@ def parse_argv():
 	misc.add_argument('-avx', dest='use_avx', action='store_true', help='Compile using AVX instructions on Windows, OS X, and Linux')
 	misc.add_argument('-avx2', dest='use_avx2', action='store_true', help='Compile using AVX2 instructions on Windows, OS X, and Linux')
 	misc.add_argument('-nosimd', dest='use_simd', action='store_false', help='Compile without SIMD instructions')
+	misc.add_argument('-deterministic', dest='use_deterministic', action='store_true', help='Compile with the deterministic math mode (RTM_DETERMINISTIC)')
+	misc.add_argument('-cpp_version', choices=['11', '14', '17'], help='C++ version used to compile the unit tests and tools, defaults to 11')
 	misc.add_argument('-num_threads', help='No. to use while compiling and regressing')
 	misc.add_argument('-tests_matching', help='Only run tests whose names match this regex')
 	misc.add_argument('-help', action='help', help='Display this usage information')
@@ -34,7 +37,7 @@ def parse_argv():
 	if not num_threads or num_threads == 0:
 		num_threads = 4
 
-	parser.set_defaults(build=False, clean=False, unit_test=False, compiler=None, config='Release', cpu=None, use_avx=False, use_avx2=False, use_simd=True, num_threads=num_threads, tests_matching='')
+	parser.set_defaults(build=False, clean=False, unit_test=False, compiler=None, config='Release', cpu=None, use_avx=False, use_avx2=False, use_simd=True, use_deterministic=False, cpp_version='11', num_threads=num_threads, tests_matching='')
 
 	args = parser.parse_args()
 
@@ -258,9 +261,20 @@ def do_generate_solution(build_dir, cmake_script_dir, args):
 		print('Disabling SIMD instruction usage')
 		extra_switches.append('-DUSE_SIMD_INSTRUCTIONS:BOOL=false')
 
+	if args.use_deterministic:
+		print('Enabling deterministic math')
+		extra_switches.append('-DUSE_DETERMINISTIC_MATH:BOOL=true')
+
+	if args.cpp_version != '11':
+		print('Compiling with C++{}'.format(args.cpp_version))
+	extra_switches.append('-DCPP_VERSION:STRING={}'.format(args.cpp_version))
+
 	if args.bench:
 		extra_switches.append('-DBUILD_BENCHMARK_EXE:BOOL=true')
 
+	if args.accuracy:
+		extra_switches.append('-DBUILD_ACCURACY_EXE:BOOL=true')
+
 	if not platform.system() == 'Windows':
 		extra_switches.append('-DCMAKE_BUILD_TYPE={}'.format(config.upper()))
 
@@ -348,8 +362,8 @@ def do_tests_android(build_dir, args):
 def do_tests_cmake(args):
 	ctest_cmd = 'ctest --output-on-failure --parallel {}'.format(args.num_threads)
 
-	if platform.system() == 'Windows' or platform.system() == 'Darwin':
-		ctest_cmd += ' -C {}'.format(args.config)
+	# Always specify the configuration, some tests only run in Release
+	ctest_cmd += ' -C {}'.format(args.config)
 	if args.tests_matching:
 		ctest_cmd += ' --tests-regex {}'.format(args.tests_matching)
 
@@ -416,6 +430,24 @@ def do_bench():
 	else:
 		do_bench_native()
 
+def do_accuracy():
+	if args.compiler in ['ios', 'android', 'emscripten']:
+		print('Accuracy measurements are only supported on Windows, OS X, and Linux')
+		return
+
+	print('Measuring accuracy ...')
+
+	if platform.system() == 'Windows':
+		accuracy_exe = os.path.join(os.getcwd(), 'bin/rtm_accuracy.exe')
+	else:
+		accuracy_exe = os.path.join(os.getcwd(), 'bin/rtm_accuracy')
+
+	accuracy_cmd = '{} -threads={}'.format(accuracy_exe, args.num_threads)
+
+	result = subprocess.call(accuracy_cmd, shell=True)
+	if result != 0:
+		sys.exit(result)
+
 if __name__ == "__main__":
 	args = parse_argv()
 
@@ -448,4 +480,7 @@ if __name__ == "__main__":
 	if args.bench:
 		do_bench()
 
+	if args.accuracy:
+		do_accuracy()
+
 	sys.exit(0)
@@ -0,0 +1,92 @@
+cmake_minimum_required (VERSION 3.2)
+
+# Validates the code generated for the expression layer by disassembling the unit test executable.
+# The functions inspected live in tests/sources/test_expression.cpp, each expression version is
+# compared against its eager counterpart.
+# Usage: cmake -DOBJDUMP=<path> -DBINARY=<path> -P check_codegen.cmake
+
+if(NOT OBJDUMP OR NOT BINARY)
+	message(FATAL_ERROR "OBJDUMP and BINARY must be provided")
+endif()
+
+# Sets _num_instructions and _num_sqrt_instructions in the parent scope for the function named _symbol
+# including the functions it calls
+function(count_instructions _symbol)
+	execute_process(COMMAND ${OBJDUMP} -d --no-show-raw-insn --disassemble=${_symbol} ${BINARY}
+		OUTPUT_VARIABLE _disassembly
+		RESULT_VARIABLE _result)
+
+	if(NOT _result EQUAL 0)
+		message(FATAL_ERROR "Failed to disassemble ${BINARY}")
+	endif()
+
+	# Every instruction line starts with its address followed by a colon and a tab
+	string(REGEX MATCHALL "\n *[0-9a-f]+:\t[^\n]*" _instructions "${_disassembly}")
+	list(LENGTH _instructions _count)
+	if(_count EQUAL 0)
+		message(FATAL_ERROR "Function ${_symbol} not found in ${BINARY}, objdump 2.32 or later is required")
+	endif()
+
+	# Square roots (and calls to sqrtf) are the expensive part of a normalization
+	set(_sqrt_count 0)
+	foreach(_instruction IN LISTS _instructions)
+		if(_instruction MATCHES "sqrt")
+			math(EXPR _sqrt_count "${_sqrt_count} + 1")
+		endif()
+	endforeach()
+
+	# Functions that are not inlined are counted at every call site, calls within the
+	# function (e.g. to a slow path) and to shared libraries (e.g. sqrtf@plt) are not followed
+	foreach(_instruction IN LISTS _instructions)
+		if(_instruction MATCHES "\tcall[q]? +[0-9a-f]+ <([^+@>]+)>")
+			set(_callee ${CMAKE_MATCH_1})
+			if(NOT _callee STREQUAL _symbol)
+				count_instructions(${_callee})
+				math(EXPR _count "${_count} + ${_num_instructions}")
+				math(EXPR _sqrt_count "${_sqrt_count} + ${_num_sqrt_instructions}")
+			endif()
+		endif()
+	endforeach()
+
+	message(STATUS "${_symbol}: ${_count} instructions, ${_sqrt_count} square roots")
+	set(_num_instructions ${_count} PARENT_SCOPE)
+	set(_num_sqrt_instructions ${_sqrt_count} PARENT_SCOPE)
+endfunction()
+
+set(_failed false)
+
+# a * b + c * d must never be worse than the eager version, it uses at least one FMA when available
+count_instructions(rtm_codegen_eager_mul_add)
+set(_eager_count ${_num_instructions})
+count_instructions(rtm_codegen_expr_mul_add)
+if(_num_instructions GREATER _eager_count)
+	message(SEND_ERROR "rtm_codegen_expr_mul_add has more instructions than its eager version")
+	set(_failed true)
+endif()
+
+# normalize(rotate(normalize(v))) must skip the second normalization entirely and be cheaper overall
+count_instructions(rtm_codegen_eager_normalize_rotate)
+set(_eager_count ${_num_instructions})
+set(_eager_sqrt_count ${_num_sqrt_instructions})
+count_instructions(rtm_codegen_expr_normalize_rotate)
+if(NOT _num_sqrt_instructions LESS _eager_sqrt_count)
+	message(SEND_ERROR "rtm_codegen_expr_normalize_rotate does not have fewer square roots than its eager version")
+	set(_failed true)
+endif()
+if(NOT _num_instructions LESS _eager_count)
+	message(SEND_ERROR "rtm_codegen_expr_normalize_rotate does not have fewer instructions than its eager version")
+	set(_failed true)
+endif()
+
+# Rotating several vectors with a cached rotation must be cheaper than with the quaternion
+count_instructions(rtm_codegen_eager_rotate4)
+set(_eager_count ${_num_instructions})
+count_instructions(rtm_codegen_expr_rotate4)
+if(NOT _num_instructions LESS _eager_count)
+	message(SEND_ERROR "rtm_codegen_expr_rotate4 does not have fewer instructions than its eager version")
+	set(_failed true)
+endif()
+
+if(_failed)
+	message(FATAL_ERROR "Expression codegen validation failed")
+endif()
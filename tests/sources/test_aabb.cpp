@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/aabbf.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static matrix3x4f make_test_aabb_transform()
+{
+	const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-50.0F), scalar_deg_to_rad(125.0F));
+	return matrix_from_qvv(rotation, vector_set(1.0F, -2.0F, 3.5F), vector_set(1.5F, 0.5F, 2.0F));
+}
+
+static aabbf aabb_transform_reference(const aabbf& aabb, const matrix3x4f& transform)
+{
+	// Transform all 8 corners and merge them
+	const float3f min = { vector_get_x(aabb_get_min(aabb)), vector_get_y(aabb_get_min(aabb)), vector_get_z(aabb_get_min(aabb)) };
+	const float3f max = { vector_get_x(aabb_get_max(aabb)), vector_get_y(aabb_get_max(aabb)), vector_get_z(aabb_get_max(aabb)) };
+
+	float3f corners[8];
+	for (uint32_t corner_index = 0; corner_index < 8; ++corner_index)
+	{
+		const float x = (corner_index & 1) != 0 ? max.x : min.x;
+		const float y = (corner_index & 2) != 0 ? max.y : min.y;
+		const float z = (corner_index & 4) != 0 ? max.z : min.z;
+		vector_store3(matrix_mul_point3(vector_set(x, y, z), transform), &corners[corner_index]);
+	}
+
+	return aabb_from_points(corners, 8);
+}
+
+TEST_CASE("aabbf math", "[math][aabb]")
+{
+	const float threshold = 1.0E-4F;
+
+	{
+		const aabbf aabb = aabb_from_min_max(vector_set(-1.0F, 2.0F, 3.0F), vector_set(3.0F, 4.0F, 9.0F));
+		CHECK(vector_all_near_equal3(aabb.center, vector_set(1.0F, 3.0F, 6.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb.extent, vector_set(2.0F, 1.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_min(aabb), vector_set(-1.0F, 2.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(aabb), vector_set(3.0F, 4.0F, 9.0F), threshold));
+
+		CHECK(aabb_contains_point(aabb, vector_set(0.0F, 3.0F, 4.0F)));
+		CHECK(aabb_contains_point(aabb, vector_set(3.0F, 4.0F, 9.0F)));
+		CHECK(!aabb_contains_point(aabb, vector_set(3.5F, 3.0F, 4.0F)));
+
+		CHECK(aabb_intersects(aabb, aabb_set(vector_set(4.0F, 3.0F, 6.0F), vector_set(1.5F))));
+		CHECK(!aabb_intersects(aabb, aabb_set(vector_set(4.0F, 3.0F, 6.0F), vector_set(0.5F))));
+
+		const aabbf merged = aabb_merge(aabb, aabb_set(vector_set(10.0F, 0.0F, 0.0F), vector_set(1.0F)));
+		CHECK(vector_all_near_equal3(aabb_get_min(merged), vector_set(-1.0F, -1.0F, -1.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(merged), vector_set(11.0F, 4.0F, 9.0F), threshold));
+	}
+
+	{
+		const float3f points[5] = { { 1.0F, 2.0F, 3.0F }, { -4.0F, 5.0F, 0.0F }, { 0.0F, -1.0F, 7.0F }, { 2.0F, 2.0F, 2.0F }, { 0.5F, 8.0F, -3.0F } };
+
+		// Odd and even number of points exercise both accumulators
+		const aabbf aabb5 = aabb_from_points(points, 5);
+		CHECK(vector_all_near_equal3(aabb_get_min(aabb5), vector_set(-4.0F, -1.0F, -3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(aabb5), vector_set(2.0F, 8.0F, 7.0F), threshold));
+
+		const aabbf aabb4 = aabb_from_points(points, 4);
+		CHECK(vector_all_near_equal3(aabb_get_min(aabb4), vector_set(-4.0F, -1.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(aabb4), vector_set(2.0F, 5.0F, 7.0F), threshold));
+
+		const aabbf aabb1 = aabb_from_points(points, 1);
+		CHECK(vector_all_near_equal3(aabb1.center, vector_set(1.0F, 2.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb1.extent, vector_zero(), threshold));
+	}
+
+	{
+		const matrix3x4f transform = make_test_aabb_transform();
+
+		aabbf aabbs[7];
+		for (uint32_t aabb_index = 0; aabb_index < 7; ++aabb_index)
+		{
+			const float value = float(aabb_index);
+			aabbs[aabb_index] = aabb_set(vector_set(value, -value, value * 0.5F), vector_set(1.0F + value, 0.5F, 2.0F));
+		}
+
+		aabbf transformed[7];
+		aabb_transform(transform, aabbs, transformed, 7);
+
+		for (uint32_t aabb_index = 0; aabb_index < 7; ++aabb_index)
+		{
+			const aabbf reference = aabb_transform_reference(aabbs[aabb_index], transform);
+			const aabbf single = aabb_transform(aabbs[aabb_index], transform);
+
+			CHECK(vector_all_near_equal3(reference.center, single.center, threshold));
+			CHECK(vector_all_near_equal3(reference.extent, single.extent, threshold));
+			CHECK(vector_all_near_equal3(reference.center, transformed[aabb_index].center, threshold));
+			CHECK(vector_all_near_equal3(reference.extent, transformed[aabb_index].extent, threshold));
+		}
+
+		// In place
+		aabb_transform(transform, aabbs, aabbs, 7);
+		for (uint32_t aabb_index = 0; aabb_index < 7; ++aabb_index)
+		{
+			CHECK(vector_all_near_equal3(aabbs[aabb_index].center, transformed[aabb_index].center, threshold));
+			CHECK(vector_all_near_equal3(aabbs[aabb_index].extent, transformed[aabb_index].extent, threshold));
+		}
+	}
+
+	{
+		// A unit cube centered at the origin: planes point inwards
+		const vector4f planes[6] =
+		{
+			vector_set(1.0F, 0.0F, 0.0F, 1.0F),
+			vector_set(-1.0F, 0.0F, 0.0F, 1.0F),
+			vector_set(0.0F, 1.0F, 0.0F, 1.0F),
+			vector_set(0.0F, -1.0F, 0.0F, 1.0F),
+			vector_set(0.0F, 0.0F, 1.0F, 1.0F),
+			vector_set(0.0F, 0.0F, -1.0F, 1.0F),
+		};
+
+		const aabbf aabbs[6] =
+		{
+			aabb_set(vector_zero(), vector_set(0.5F)),								// Inside
+			aabb_set(vector_set(1.2F, 0.0F, 0.0F), vector_set(0.5F)),				// Intersecting
+			aabb_set(vector_set(1.6F, 0.0F, 0.0F), vector_set(0.5F)),				// Outside
+			aabb_set(vector_set(0.0F, -3.0F, 0.0F), vector_set(0.5F, 2.5F, 0.5F)),	// Touching
+			aabb_set(vector_set(0.0F, 0.0F, 4.0F), vector_set(10.0F, 10.0F, 2.0F)),	// Outside
+			aabb_set(vector_zero(), vector_set(10.0F)),								// Contains the volume
+		};
+		const bool expected[6] = { true, true, false, true, false, true };
+
+		bool results[6];
+		aabb_intersects_planes(planes, 6, aabbs, results, 6);
+
+		for (uint32_t aabb_index = 0; aabb_index < 6; ++aabb_index)
+		{
+			CHECK(aabb_intersects_planes(aabbs[aabb_index], planes, 6) == expected[aabb_index]);
+			CHECK(results[aabb_index] == expected[aabb_index]);
+		}
+	}
+}
@@ -0,0 +1,208 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/impl/compiler_utils.h>
+
+// The unit test projects that register test cases with CTest leave this file out before C++14,
+// the others (Android, iOS) compile it empty
+#if RTM_CPP_VERSION >= 201402L
+
+#include <rtm/constexpr_math.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+namespace
+{
+	// Evaluated at compile time, these end up in read-only data
+	constexpr aligned_float4f k_sin_table[] =
+	{
+		constexpr_math::vector_set(constexpr_math::scalar_sin(0.0F), constexpr_math::scalar_sin(0.5F), constexpr_math::scalar_sin(1.0F), constexpr_math::scalar_sin(1.5F)),
+		constexpr_math::vector_set(constexpr_math::scalar_sin(2.0F), constexpr_math::scalar_sin(2.5F), constexpr_math::scalar_sin(3.0F), constexpr_math::scalar_sin(3.5F)),
+	};
+
+	constexpr aligned_qvvf k_pose = constexpr_math::qvv_set(
+		constexpr_math::quat_from_euler(constexpr_math::scalar_deg_to_rad(30.0F), constexpr_math::scalar_deg_to_rad(-60.0F), constexpr_math::scalar_deg_to_rad(120.0F)),
+		constexpr_math::vector_set(1.0F, -2.0F, 3.0F),
+		constexpr_math::vector_set(2.0F, 0.5F, 1.5F));
+
+	constexpr aligned_matrix3x4f k_pose_mtx = constexpr_math::matrix_from_qvv(k_pose);
+
+	static_assert(constexpr_math::scalar_sqrt(4.0F) == 2.0F, "Unexpected constexpr sqrt");
+	static_assert(constexpr_math::scalar_sin(0.0F) == 0.0F, "Unexpected constexpr sin");
+	static_assert(constexpr_math::scalar_cos(0.0F) == 1.0F, "Unexpected constexpr cos");
+	static_assert(constexpr_math::vector_dot3(constexpr_math::vector_set(1.0F, 2.0F, 3.0F), constexpr_math::vector_set(4.0F, 5.0F, 6.0F)) == 32.0F, "Unexpected constexpr dot3");
+	static_assert(constexpr_math::quat_mul(constexpr_math::quat_identity(), constexpr_math::quat_identity()).w == 1.0F, "Unexpected constexpr quat_mul");
+	static_assert(k_pose_mtx.w_axis.y == -2.0F, "Unexpected constexpr matrix_from_qvv");
+	static_assert(alignof(aligned_float4f) == 16, "Aligned storage must be 16 bytes aligned");
+
+	vector4f load_vector(const aligned_float4f& input)
+	{
+		return vector_load(&input);
+	}
+
+	quatf load_quat(const aligned_float4f& input)
+	{
+		return quat_load(&input);
+	}
+}
+
+TEST_CASE("constexpr_math scalar", "[math][constexpr]")
+{
+	const float threshold = 1.0E-6F;
+
+	for (int32_t angle_index = -100; angle_index <= 100; ++angle_index)
+	{
+		const double angle = double(angle_index) * 0.1;
+		CHECK(scalar_near_equal(constexpr_math::scalar_sin(angle), std::sin(angle), 1.0E-12));
+		CHECK(scalar_near_equal(constexpr_math::scalar_cos(angle), std::cos(angle), 1.0E-12));
+		CHECK(scalar_near_equal(constexpr_math::scalar_sin(float(angle)), std::sin(float(angle)), threshold));
+		CHECK(scalar_near_equal(constexpr_math::scalar_cos(float(angle)), std::cos(float(angle)), threshold));
+	}
+
+	for (uint32_t value_index = 0; value_index < 100; ++value_index)
+	{
+		const float value = float(value_index) * 12.345F + 0.001F;
+		CHECK(constexpr_math::scalar_sqrt(value) == std::sqrt(value));
+	}
+
+	CHECK(constexpr_math::scalar_sqrt(0.0F) == 0.0F);
+	CHECK(std::isnan(constexpr_math::scalar_sqrt(-1.0F)));
+	CHECK(constexpr_math::scalar_sqrt(1.0E-30F) == std::sqrt(1.0E-30F));
+	CHECK(constexpr_math::scalar_sqrt(1.0E30F) == std::sqrt(1.0E30F));
+}
+
+TEST_CASE("constexpr_math vector4f", "[math][constexpr]")
+{
+	const float threshold = 1.0E-6F;
+
+	CHECK(vector_all_near_equal(vector_load(&k_sin_table[0]), vector_set(scalar_sin(0.0F), scalar_sin(0.5F), scalar_sin(1.0F), scalar_sin(1.5F)), threshold));
+	CHECK(vector_all_near_equal(vector_load(&k_sin_table[1]), vector_set(scalar_sin(2.0F), scalar_sin(2.5F), scalar_sin(3.0F), scalar_sin(3.5F)), threshold));
+
+	constexpr aligned_float4f v0 = constexpr_math::vector_set(-1.5F, 2.25F, 3.0F, 4.5F);
+	constexpr aligned_float4f v1 = constexpr_math::vector_set(0.5F, -4.0F, 1.25F, -2.0F);
+	constexpr aligned_float4f v2 = constexpr_math::vector_set(7.0F, 0.5F, -3.0F, 1.0F);
+
+	const vector4f rv0 = vector_load(&v0);
+	const vector4f rv1 = vector_load(&v1);
+	const vector4f rv2 = vector_load(&v2);
+
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_set(1.0F, 2.0F, 3.0F)), vector_set(1.0F, 2.0F, 3.0F, 0.0F), 0.0F));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_set(2.0F)), vector_set(2.0F), 0.0F));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_zero()), vector_zero(), 0.0F));
+
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_add(v0, v1)), vector_add(rv0, rv1), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_sub(v0, v1)), vector_sub(rv0, rv1), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_mul(v0, v1)), vector_mul(rv0, rv1), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_mul(v0, 2.5F)), vector_mul(rv0, 2.5F), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_div(v0, v1)), vector_div(rv0, rv1), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_neg(v0)), vector_neg(rv0), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_mul_add(v0, v1, v2)), vector_mul_add(rv0, rv1, rv2), threshold));
+	CHECK(vector_all_near_equal(load_vector(constexpr_math::vector_lerp(v0, v1, 0.33F)), vector_lerp(rv0, rv1, 0.33F), threshold));
+	CHECK(vector_all_near_equal3(load_vector(constexpr_math::vector_cross3(v0, v1)), vector_cross3(rv0, rv1), threshold));
+	CHECK(vector_all_near_equal3(load_vector(constexpr_math::vector_normalize3(v0)), vector_normalize3(rv0), threshold));
+
+	CHECK(scalar_near_equal(constexpr_math::vector_dot(v0, v1), float(vector_dot(rv0, rv1)), threshold));
+	CHECK(scalar_near_equal(constexpr_math::vector_dot3(v0, v1), float(vector_dot3(rv0, rv1)), threshold));
+	CHECK(scalar_near_equal(constexpr_math::vector_length(v0), float(vector_length(rv0)), threshold));
+	CHECK(scalar_near_equal(constexpr_math::vector_length3(v0), float(vector_length3(rv0)), threshold));
+}
+
+TEST_CASE("constexpr_math quatf", "[math][constexpr]")
+{
+	const float threshold = 1.0E-5F;
+
+	constexpr aligned_float4f q0 = constexpr_math::quat_from_euler(constexpr_math::scalar_deg_to_rad(30.0F), constexpr_math::scalar_deg_to_rad(-60.0F), constexpr_math::scalar_deg_to_rad(120.0F));
+	constexpr aligned_float4f q1 = constexpr_math::quat_from_axis_angle(constexpr_math::vector_normalize3(constexpr_math::vector_set(1.0F, 2.0F, -0.5F)), 2.5F);
+	constexpr aligned_float4f v0 = constexpr_math::vector_set(-1.5F, 2.25F, 3.0F);
+
+	const quatf rq0 = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-60.0F), scalar_deg_to_rad(120.0F));
+	const quatf rq1 = quat_from_axis_angle(vector_normalize3(vector_set(1.0F, 2.0F, -0.5F)), 2.5F);
+
+	CHECK(quat_near_equal(quat_load(&q0), rq0, threshold));
+	CHECK(quat_near_equal(quat_load(&q1), rq1, threshold));
+	CHECK(quat_near_equal(load_quat(constexpr_math::quat_identity()), quat_identity(), 0.0F));
+	CHECK(quat_near_equal(load_quat(constexpr_math::quat_set(1.0F, 2.0F, 3.0F, 4.0F)), quat_set(1.0F, 2.0F, 3.0F, 4.0F), 0.0F));
+	CHECK(quat_near_equal(load_quat(constexpr_math::quat_conjugate(q0)), quat_conjugate(rq0), threshold));
+	CHECK(quat_near_equal(load_quat(constexpr_math::quat_mul(q0, q1)), quat_mul(rq0, rq1), threshold));
+	CHECK(quat_near_equal(load_quat(constexpr_math::quat_normalize(constexpr_math::quat_set(1.0F, 2.0F, 3.0F, 4.0F))), quat_normalize(quat_set(1.0F, 2.0F, 3.0F, 4.0F)), threshold));
+	CHECK(vector_all_near_equal3(load_vector(constexpr_math::quat_mul_vector3(v0, q0)), quat_mul_vector3(vector_load(&v0), rq0), threshold));
+}
+
+TEST_CASE("constexpr_math qvvf and matrix3x4f", "[math][constexpr]")
+{
+	const float threshold = 1.0E-5F;
+
+	const qvvf pose = qvv_load(&k_pose);
+	const matrix3x4f pose_mtx = matrix_load(&k_pose_mtx);
+	const matrix3x4f ref_pose_mtx = matrix_from_qvv(pose);
+
+	CHECK(quat_near_equal(pose.rotation, quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-60.0F), scalar_deg_to_rad(120.0F)), threshold));
+	CHECK(vector_all_near_equal3(pose.translation, vector_set(1.0F, -2.0F, 3.0F), 0.0F));
+	CHECK(vector_all_near_equal3(pose.scale, vector_set(2.0F, 0.5F, 1.5F), 0.0F));
+
+	CHECK(vector_all_near_equal(pose_mtx.x_axis, ref_pose_mtx.x_axis, threshold));
+	CHECK(vector_all_near_equal(pose_mtx.y_axis, ref_pose_mtx.y_axis, threshold));
+	CHECK(vector_all_near_equal(pose_mtx.z_axis, ref_pose_mtx.z_axis, threshold));
+	CHECK(vector_all_near_equal(pose_mtx.w_axis, ref_pose_mtx.w_axis, threshold));
+
+	{
+		constexpr aligned_qvvf identity = constexpr_math::qvv_identity();
+		const qvvf rt_identity = qvv_load(&identity);
+		CHECK(quat_near_equal(rt_identity.rotation, quat_identity(), 0.0F));
+		CHECK(vector_all_near_equal(rt_identity.translation, vector_zero(), 0.0F));
+		CHECK(vector_all_near_equal(rt_identity.scale, vector_set(1.0F), 0.0F));
+	}
+
+	{
+		constexpr aligned_matrix3x4f mtx = constexpr_math::matrix_mul(k_pose_mtx, constexpr_math::matrix_from_qvv(constexpr_math::quat_from_euler(0.5F, 0.25F, -1.0F), constexpr_math::vector_set(-5.0F, 0.5F, 2.0F), constexpr_math::vector_set(1.0F)));
+		const matrix3x4f ref_mtx = matrix_mul(pose_mtx, matrix_from_qvv(quat_from_euler(0.5F, 0.25F, -1.0F), vector_set(-5.0F, 0.5F, 2.0F), vector_set(1.0F)));
+		const matrix3x4f rt_mtx = matrix_load(&mtx);
+
+		CHECK(vector_all_near_equal(rt_mtx.x_axis, ref_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal(rt_mtx.y_axis, ref_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal(rt_mtx.z_axis, ref_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal(rt_mtx.w_axis, ref_mtx.w_axis, threshold));
+
+		constexpr aligned_float4f point = constexpr_math::matrix_mul_point3(constexpr_math::vector_set(1.0F, -2.0F, 0.5F), mtx);
+		CHECK(vector_all_near_equal3(vector_load(&point), matrix_mul_point3(vector_set(1.0F, -2.0F, 0.5F), ref_mtx), threshold));
+
+		constexpr aligned_matrix3x4f identity = constexpr_math::matrix_identity();
+		const matrix3x4f rt_identity = matrix_load(&identity);
+		CHECK(vector_all_near_equal(rt_identity.x_axis, vector_set(1.0F, 0.0F, 0.0F, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(rt_identity.y_axis, vector_set(0.0F, 1.0F, 0.0F, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(rt_identity.z_axis, vector_set(0.0F, 0.0F, 1.0F, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(rt_identity.w_axis, vector_zero(), 0.0F));
+	}
+}
+
+#endif
@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+// Runtime dispatch is opt-in and must be enabled before including RTM
+// It cannot be used with deterministic math since the dispatched kernels use FMA
+#if !defined(RTM_DETERMINISTIC)
+	#define RTM_RUNTIME_DISPATCH
+#endif
+
+#include <rtm/aabbf.h>
+#include <rtm/skinningf.h>
+#include <rtm/spheref.h>
+#include <rtm/qvvf.h>
+#include <rtm/rigid_bodyf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+template<uint32_t num_influences>
+static void test_skinning_dispatch()
+{
+	constexpr uint32_t num_bones = 8;
+	constexpr uint32_t num_vertices = 7;
+	const float threshold = 1.0E-4F;
+
+	matrix3x4f palette[num_bones];
+	for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const float angle = float(bone_index) * 13.0F;
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(angle), scalar_deg_to_rad(-angle), scalar_deg_to_rad(angle * 0.25F));
+		palette[bone_index] = matrix_from_qvv(rotation, vector_set(float(bone_index), 2.0F, -1.0F), vector_set(1.0F));
+	}
+
+	// The dispatching entry points have their own symbols, sharing instantiations with the other skinning tests is safe
+	uint32_t bone_indices[num_vertices * num_influences];
+	float bone_weights[num_vertices * num_influences];
+	for (uint32_t index = 0; index < num_vertices * num_influences; ++index)
+	{
+		bone_indices[index] = (index * 5) % num_bones;
+		bone_weights[index] = 1.0F / float(num_influences);
+	}
+
+	float3f positions[num_vertices];
+	float3f normals[num_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const float value = float(vertex_index);
+		vector_store3(vector_set(value, value * -0.5F, 3.0F), &positions[vertex_index]);
+		vector_store3(vector_normalize3(vector_set(value, 1.0F, -2.0F)), &normals[vertex_index]);
+	}
+
+	// The last normal is degenerate and must fall back to the input normal
+	vector_store3(vector_zero(), &normals[num_vertices - 1]);
+
+	float3f skinned_positions[num_vertices];
+	float3f skinned_normals[num_vertices];
+	skin_positions_normals<num_influences>(palette, bone_indices, bone_weights, positions, normals, skinned_positions, skinned_normals, num_vertices);
+
+	float3f skinned_positions_only[num_vertices];
+	skin_positions<num_influences>(palette, bone_indices, bone_weights, positions, skinned_positions_only, num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const matrix3x4f skin_mtx = matrix_blend<num_influences>(palette, bone_indices + vertex_index * num_influences, bone_weights + vertex_index * num_influences);
+		const vector4f position = vector_load3(&positions[vertex_index]);
+		const vector4f normal = vector_load3(&normals[vertex_index]);
+
+		const vector4f ref_position = matrix_mul_point3(position, skin_mtx);
+		const vector4f ref_normal = vector_normalize3(matrix_mul_vector3(normal, skin_mtx), normal);
+
+		CHECK(vector_all_near_equal3(ref_position, vector_load3(&skinned_positions[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(ref_position, vector_load3(&skinned_positions_only[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(ref_normal, vector_load3(&skinned_normals[vertex_index]), threshold));
+	}
+}
+
+static void test_bounding_volume_dispatch()
+{
+	// 2 groups of 8, a group of 4, and a remainder
+	constexpr uint32_t num_volumes = 23;
+	const float threshold = 1.0E-4F;
+
+	const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-65.0F), scalar_deg_to_rad(12.0F));
+	const matrix3x4f transform = matrix_from_qvv(rotation, vector_set(1.0F, -2.0F, 3.5F), vector_set(1.5F, 0.5F, 2.0F));
+
+	aabbf aabbs[num_volumes];
+	spheref spheres[num_volumes];
+	for (uint32_t volume_index = 0; volume_index < num_volumes; ++volume_index)
+	{
+		const float value = float(volume_index);
+		aabbs[volume_index] = aabb_set(vector_set(value, value * -0.5F, 3.0F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F));
+		spheres[volume_index] = sphere_set(vector_set(value * 0.25F, -value, 1.0F), 0.5F + value);
+	}
+
+	aabbf transformed_aabbs[num_volumes];
+	spheref transformed_spheres[num_volumes];
+	aabb_transform(transform, aabbs, transformed_aabbs, num_volumes);
+	sphere_transform(transform, spheres, transformed_spheres, num_volumes);
+
+	for (uint32_t volume_index = 0; volume_index < num_volumes; ++volume_index)
+	{
+		const aabbf ref_aabb = aabb_transform(aabbs[volume_index], transform);
+		const spheref ref_sphere = sphere_transform(spheres[volume_index], transform);
+
+		CHECK(vector_all_near_equal3(ref_aabb.center, transformed_aabbs[volume_index].center, threshold));
+		CHECK(vector_all_near_equal3(ref_aabb.extent, transformed_aabbs[volume_index].extent, threshold));
+		CHECK(vector_all_near_equal(ref_sphere.center_radius, transformed_spheres[volume_index].center_radius, threshold));
+	}
+
+	// The output can alias the input
+	aabb_transform(transform, aabbs, aabbs, num_volumes);
+	sphere_transform(transform, spheres, spheres, num_volumes);
+
+	for (uint32_t volume_index = 0; volume_index < num_volumes; ++volume_index)
+	{
+		CHECK(vector_all_near_equal3(aabbs[volume_index].center, transformed_aabbs[volume_index].center, 0.0F));
+		CHECK(vector_all_near_equal3(aabbs[volume_index].extent, transformed_aabbs[volume_index].extent, 0.0F));
+		CHECK(vector_all_near_equal(spheres[volume_index].center_radius, transformed_spheres[volume_index].center_radius, 0.0F));
+	}
+}
+
+static void test_rigid_body_dispatch()
+{
+	// 2 groups of 8, a group of 4, and a remainder
+	constexpr uint32_t num_bodies = 23;
+	const float threshold = 1.0E-5F;
+
+	float state[13][num_bodies];
+	uint32_t seed = 12345;
+	for (uint32_t component_index = 0; component_index < 13; ++component_index)
+	{
+		for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+		{
+			seed = seed * 1664525 + 1013904223;
+			state[component_index][body_index] = float(seed % 2000) / 100.0F - 10.0F;
+		}
+	}
+
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		const quatf rotation = quat_normalize(quat_set(state[3][body_index], state[4][body_index], state[5][body_index], state[6][body_index]));
+		state[3][body_index] = quat_get_x(rotation);
+		state[4][body_index] = quat_get_y(rotation);
+		state[5][body_index] = quat_get_z(rotation);
+		state[6][body_index] = quat_get_w(rotation);
+	}
+
+	// A few bodies do not spin to exercise the small angle approximation
+	for (uint32_t body_index = 0; body_index < num_bodies; body_index += 5)
+	{
+		state[10][body_index] = 0.0F;
+		state[11][body_index] = 0.0F;
+		state[12][body_index] = 0.0F;
+	}
+
+	float expected[13][num_bodies];
+	for (uint32_t component_index = 0; component_index < 13; ++component_index)
+		for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+			expected[component_index][body_index] = state[component_index][body_index];
+
+	rigid_bodies_soaf bodies;
+	bodies.position_x = state[0];
+	bodies.position_y = state[1];
+	bodies.position_z = state[2];
+	bodies.rotation_x = state[3];
+	bodies.rotation_y = state[4];
+	bodies.rotation_z = state[5];
+	bodies.rotation_w = state[6];
+	bodies.linear_velocity_x = state[7];
+	bodies.linear_velocity_y = state[8];
+	bodies.linear_velocity_z = state[9];
+	bodies.angular_velocity_x = state[10];
+	bodies.angular_velocity_y = state[11];
+	bodies.angular_velocity_z = state[12];
+
+	rigid_bodies_soaf expected_bodies;
+	expected_bodies.position_x = expected[0];
+	expected_bodies.position_y = expected[1];
+	expected_bodies.position_z = expected[2];
+	expected_bodies.rotation_x = expected[3];
+	expected_bodies.rotation_y = expected[4];
+	expected_bodies.rotation_z = expected[5];
+	expected_bodies.rotation_w = expected[6];
+	expected_bodies.linear_velocity_x = expected[7];
+	expected_bodies.linear_velocity_y = expected[8];
+	expected_bodies.linear_velocity_z = expected[9];
+	expected_bodies.angular_velocity_x = expected[10];
+	expected_bodies.angular_velocity_y = expected[11];
+	expected_bodies.angular_velocity_z = expected[12];
+
+	// The first group of 8 is fully asleep, a few bodies sleep in the others
+	const uint32_t sleep_bits[1] = { 0x00FF | (1 << 9) | (1 << 14) | (1 << 17) };
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	rigid_body_integrate(bodies, num_bodies, gravity, delta_time, sleep_bits);
+
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		const bool is_sleeping = ((sleep_bits[0] >> body_index) & 1) != 0;
+		if (!is_sleeping)
+			rtm_impl::rigid_body_integrate1(expected_bodies, body_index, gravity, delta_time);
+
+		for (uint32_t component_index = 0; component_index < 13; ++component_index)
+		{
+			if (is_sleeping)
+				CHECK(state[component_index][body_index] == expected[component_index][body_index]);
+			else
+				CHECK(scalar_near_equal(state[component_index][body_index], expected[component_index][body_index], threshold));
+		}
+	}
+}
+#endif
+
+TEST_CASE("cpu dispatch", "[math][dispatch]")
+{
+#if defined(RTM_IMPL_DISPATCH_AVX2_FMA)
+	const rtm_impl::cpu_features& features = rtm_impl::get_cpu_features();
+
+	// Features are only detected once
+	CHECK(&features == &rtm_impl::get_cpu_features());
+
+	// Newer instruction sets imply the older ones
+	CHECK((!features.avx2 || features.avx));
+	CHECK((!features.fma || features.avx));
+	CHECK((!features.avx || features.sse4));
+	CHECK((!features.sse4 || features.sse3));
+
+#if defined(RTM_AVX2_INTRINSICS)
+	CHECK(rtm_impl::is_avx2_fma_supported());
+#endif
+
+	// The dispatched kernels must match the generic code path when they can run
+	// Otherwise, this validates that the fallback is used
+	test_skinning_dispatch<1>();
+	test_skinning_dispatch<2>();
+	test_skinning_dispatch<4>();
+	test_skinning_dispatch<8>();
+	test_bounding_volume_dispatch();
+	test_rigid_body_dispatch();
+#endif
+}
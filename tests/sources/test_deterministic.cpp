@@ -0,0 +1,276 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+#include <cstring>
+
+using namespace rtm;
+
+// These tests only make sense when RTM_DETERMINISTIC is defined for the whole build, it cannot
+// be defined for a single translation unit since every function is inline.
+// The expected outputs below were generated once and must be bit identical with every
+// instruction set (scalar, SSE2, SSE4, AVX, AVX2, NEON64, etc).
+// The unit test projects that register test cases with CTest leave this file out otherwise,
+// the others (Android, iOS) compile it empty.
+#if defined(RTM_DETERMINISTIC)
+
+static constexpr uint32_t k_max_num_golden_outputs = 128;
+
+static uint32_t compute_golden_outputs(vector4f* outputs)
+{
+	const vector4f inputs0[] =
+	{
+		vector_set(1.25F, -2.5F, 0.33333334F, 7.1F),
+		vector_set(-0.0078125F, 123.456F, -98.7654F, 0.5F),
+		vector_set(3.1415927F, -1.5707964F, 0.70710677F, -0.1F),
+	};
+
+	const vector4f inputs1[] =
+	{
+		vector_set(0.75F, 1.9F, -4.2F, 2.0F),
+		vector_set(-17.0F, 0.001F, 6.25F, -3.3F),
+		vector_set(0.2F, 0.3F, -0.4F, 0.9F),
+	};
+
+	const float alphas[] = { 0.25F, 0.61F, 0.9F };
+
+	uint32_t num_outputs = 0;
+	for (uint32_t input_index = 0; input_index < 3; ++input_index)
+	{
+		const vector4f lhs = inputs0[input_index];
+		const vector4f rhs = inputs1[input_index];
+		const float alpha = alphas[input_index];
+
+		// Inputs in the [-1.0, 1.0] range for the inverse trigonometric functions
+		const vector4f unit_lhs = vector_mul(vector_sin(lhs), 0.999F);
+
+		outputs[num_outputs++] = vector_add(lhs, rhs);
+		outputs[num_outputs++] = vector_div(lhs, rhs);
+		outputs[num_outputs++] = vector_reciprocal(rhs);
+		outputs[num_outputs++] = vector_reciprocal_approx(rhs);
+		outputs[num_outputs++] = vector_reciprocal_nr1(rhs);
+		outputs[num_outputs++] = vector_sqrt(vector_abs(lhs));
+		outputs[num_outputs++] = vector_mul_add(lhs, rhs, lhs);
+		outputs[num_outputs++] = vector_neg_mul_sub(lhs, alpha, rhs);
+		outputs[num_outputs++] = vector_lerp(lhs, rhs, alpha);
+		outputs[num_outputs++] = vector_set(float(vector_dot(lhs, rhs)), float(vector_dot3(lhs, rhs)), float(vector_length3(lhs)), float(vector_length_reciprocal3(rhs)));
+		outputs[num_outputs++] = vector_cross3(lhs, rhs);
+		outputs[num_outputs++] = vector_normalize3(lhs);
+		outputs[num_outputs++] = vector_normalize3_approx(lhs);
+		outputs[num_outputs++] = vector_normalize3_nr1(lhs);
+		outputs[num_outputs++] = vector_round_bankers(vector_mul(lhs, 4.5F));
+		outputs[num_outputs++] = vector_sin(lhs);
+		outputs[num_outputs++] = vector_cos(lhs);
+		outputs[num_outputs++] = vector_tan(rhs);
+		outputs[num_outputs++] = vector_asin(unit_lhs);
+		outputs[num_outputs++] = vector_acos(unit_lhs);
+		outputs[num_outputs++] = vector_atan(lhs);
+		outputs[num_outputs++] = vector_atan2(lhs, rhs);
+		const float lhs_x = vector_get_x(lhs);
+		const float lhs_y = vector_get_y(lhs);
+		const float rhs_z = vector_get_z(rhs);
+		const float rhs_w = vector_get_w(rhs);
+		outputs[num_outputs++] = vector_set(scalar_sqrt_reciprocal(scalar_abs(lhs_x)), scalar_reciprocal(rhs_z), scalar_sin(lhs_y), scalar_atan2(lhs_y, rhs_w));
+
+		const quatf rotation0 = quat_from_euler(vector_get_x(lhs), vector_get_y(lhs), vector_get_z(lhs));
+		const quatf rotation1 = quat_from_euler(vector_get_x(rhs), vector_get_y(rhs), vector_get_z(rhs));
+
+		outputs[num_outputs++] = quat_to_vector(rotation0);
+		outputs[num_outputs++] = quat_to_vector(quat_mul(rotation0, rotation1));
+		outputs[num_outputs++] = quat_to_vector(quat_normalize(vector_to_quat(lhs)));
+		outputs[num_outputs++] = quat_to_vector(quat_normalize_approx(vector_to_quat(lhs)));
+		outputs[num_outputs++] = quat_mul_vector3(lhs, rotation1);
+		outputs[num_outputs++] = quat_to_vector(quat_lerp(rotation0, rotation1, alpha));
+		outputs[num_outputs++] = quat_to_vector(quat_slerp(rotation0, rotation1, alpha));
+
+		const qvvf transform0 = qvv_set(rotation0, rhs, vector_set(1.5F, 0.5F, 2.0F));
+		const qvvf transform1 = qvv_set(rotation1, lhs, vector_set(1.0F));
+		const qvvf transform01 = qvv_mul(transform0, transform1);
+
+		outputs[num_outputs++] = quat_to_vector(transform01.rotation);
+		outputs[num_outputs++] = transform01.translation;
+		outputs[num_outputs++] = qvv_inverse(transform0).translation;
+
+		const matrix3x4f matrix0 = matrix_from_qvv(transform0);
+		const matrix3x4f matrix01 = matrix_mul(matrix0, matrix_from_qvv(transform1));
+		const matrix3x4f matrix0_inv = matrix_inverse(matrix0);
+
+		outputs[num_outputs++] = matrix01.x_axis;
+		outputs[num_outputs++] = matrix01.w_axis;
+		outputs[num_outputs++] = matrix0_inv.y_axis;
+		outputs[num_outputs++] = matrix0_inv.w_axis;
+		outputs[num_outputs++] = matrix_mul_point3(lhs, matrix01);
+	}
+
+	return num_outputs;
+}
+
+TEST_CASE("deterministic golden outputs", "[math][deterministic]")
+{
+	static const uint32_t k_golden_outputs[][4] =
+	{
+		{ 0x40000000U, 0xBF19999AU, 0xC0777777U, 0x4111999AU },
+		{ 0x3FD55555U, 0xBFA86BCAU, 0xBDA28A29U, 0x40633333U },
+		{ 0x3FAAAAABU, 0x3F06BCA2U, 0xBE73CF3EU, 0x3F000000U },
+		{ 0x3FAAAAABU, 0x3F06BCA2U, 0xBE73CF3EU, 0x3F000000U },
+		{ 0x3FAAAAABU, 0x3F06BCA2U, 0xBE73CF3EU, 0x3F000000U },
+		{ 0x3F8F1BBDU, 0x3FCA62C2U, 0x3F13CD3AU, 0x402A8885U },
+		{ 0x400C0000U, 0xC0E80000U, 0xBF888888U, 0x41AA6666U },
+		{ 0x3EE00000U, 0x4021999AU, 0xC0891111U, 0x3E666668U },
+		{ 0x3F900000U, 0xBFB33333U, 0xBF4CCCCCU, 0x40BA6666U },
+		{ 0x410FCCCDU, 0xC0A6CCCDU, 0x4034272CU, 0x3E5B40FEU },
+		{ 0x411DDDDEU, 0x40B00000U, 0x40880000U, 0x00000000U },
+		{ 0x3EE35CBEU, 0xBF635CBEU, 0x3DF2850FU, 0x40216D5EU },
+		{ 0x3EE35CBEU, 0xBF635CBEU, 0x3DF2850FU, 0x40216D5EU },
+		{ 0x3EE35CBEU, 0xBF635CBEU, 0x3DF2850FU, 0x40216D5EU },
+		{ 0x40C00000U, 0xC1300000U, 0x40000000U, 0x42000000U },
+		{ 0x3F72F0A8U, 0xBF193579U, 0x3EA78610U, 0x3F3A9DB4U },
+		{ 0x3EA171EEU, 0xBF4D17BFU, 0x3F71E8B3U, 0x3F2F3E77U },
+		{ 0x3F6E7D1CU, 0xC03B5595U, 0xBFE38E41U, 0xC00BD7B4U },
+		{ 0x3F9F9DD4U, 0xBF240E7AU, 0x3EAA7D48U, 0x3F50D500U },
+		{ 0x3EA5C81CU, 0x400D8B8CU, 0x3F9E7089U, 0x3F414AB6U },
+		{ 0x3F6563E9U, 0xBF985B6EU, 0x3EA4BC82U, 0x3FB726CCU },
+		{ 0x3F83E362U, 0xBF6BC1D2U, 0x4043FE42U, 0x3FA5EA90U },
+		{ 0x3F64F92EU, 0xBE73CF3EU, 0xBF193579U, 0xBF6563E9U },
+		{ 0xBF1708B3U, 0xBD5E4578U, 0xBF4A1EECU, 0x3E23E634U },
+		{ 0xBE7DD27CU, 0x3F048436U, 0x3F519CCCU, 0xBC5801B8U },
+		{ 0x3E279748U, 0xBEA79748U, 0x3D32C380U, 0x3F6DFAA9U },
+		{ 0x3E279748U, 0xBEA79748U, 0x3D32C380U, 0x3F6DFAA9U },
+		{ 0xBFA4A52CU, 0xBF6CBC47U, 0x4014E9FCU, 0x34000000U },
+		{ 0xBF218330U, 0xBE8EFD3CU, 0xBF27FCD9U, 0x3E9C70B6U },
+		{ 0xBF21D4D5U, 0xBEA10DA0U, 0xBF20C29AU, 0x3EA78CC2U },
+		{ 0xBE7DD27CU, 0x3F048436U, 0x3F519CCCU, 0xBC5801B8U },
+		{ 0x40B038D6U, 0xBF419210U, 0x3F91DB6AU, 0x40E33333U },
+		{ 0x403585A1U, 0x404D4DC4U, 0xBF5FEB1CU, 0x34000000U },
+		{ 0xBFA85701U, 0xBED5AA31U, 0xBF16A17AU, 0x00000000U },
+		{ 0x40B038D5U, 0xBF419216U, 0x3F91DB72U, 0x40E33333U },
+		{ 0xBE00D3C0U, 0xBFF16029U, 0x3E0C91C6U, 0x3ED4983CU },
+		{ 0x404170A7U, 0x400F6E74U, 0x3CB4C2E0U, 0xBF374914U },
+		{ 0x407821E8U, 0xBE0C9F80U, 0xBEDF62D8U, 0x40E33333U },
+		{ 0xC1881000U, 0x42F6E9FCU, 0xC2B907E3U, 0xC0333333U },
+		{ 0x39F0F0F1U, 0x47F11FFFU, 0xC17CD6E5U, 0xBE1B26CAU },
+		{ 0xBD70F0F1U, 0x4479FFFFU, 0x3E23D70AU, 0xBE9B26CAU },
+		{ 0xBD70F0F1U, 0x4479FFFFU, 0x3E23D70AU, 0xBE9B26CAU },
+		{ 0xBD70F0F1U, 0x4479FFFFU, 0x3E23D70AU, 0xBE9B26CAU },
+		{ 0x3DB504F3U, 0x4131C6F7U, 0x411F025FU, 0x3F3504F3U },
+		{ 0x3E000000U, 0x42F728AFU, 0xC4330325U, 0xBF933333U },
+		{ 0xC187F63DU, 0xC2969D44U, 0x4284FE6AU, 0xC066B852U },
+		{ 0xC125F800U, 0x42409804U, 0xC20AD2F3U, 0xBFE8B43AU },
+		{ 0xC41AAB5CU, 0xC41A41C2U, 0x431E19E8U, 0x3D622469U },
+		{ 0x4440ECB9U, 0x44D1E1F1U, 0x45032C08U, 0x00000000U },
+		{ 0xB84F4279U, 0x3F47E6E6U, 0xBF1FEC2BU, 0x3B4F4279U },
+		{ 0xB84F4279U, 0x3F47E6E6U, 0xBF1FEC2BU, 0x3B4F4279U },
+		{ 0xB84F4279U, 0x3F47E6E6U, 0xBF1FEC2BU, 0x3B4F4279U },
+		{ 0x80000000U, 0x440B0000U, 0xC3DE0000U, 0x40000000U },
+		{ 0xBBFFFF55U, 0xBF4DCEAEU, 0x3F7B28E4U, 0x3EF57744U },
+		{ 0x3F7FFE00U, 0xBF183F63U, 0xBE462EF4U, 0x3F60A940U },
+		{ 0xC05F9C52U, 0x3A831271U, 0xBD07FA47U, 0xBE23945AU },
+		{ 0xBBFFBF00U, 0xBF6EBA69U, 0x3FAF7DAFU, 0x3EFFB868U },
+		{ 0x3FCA0F9AU, 0x40203688U, 0x3E4C915DU, 0x3F8921C1U },
+		{ 0xBBFFFEABU, 0x3FC80670U, 0xBFC7C417U, 0x3EED632EU },
+		{ 0xC0490853U, 0x3FC90F97U, 0xBFC0F904U, 0x403F702BU },
+		{ 0x413504F3U, 0x3E23D70AU, 0xBF4DCEAEU, 0x3FCC7B8BU },
+		{ 0xBEB0E9A4U, 0x3F30E049U, 0xBF10CF5FU, 0x3E93BC0FU },
+		{ 0x3E72F4F8U, 0x3E3F30E9U, 0xBF1AF27EU, 0x3F3C8E69U },
+		{ 0xB84F4235U, 0x3F47E6A4U, 0xBF1FEBF6U, 0x3B4F4235U },
+		{ 0xB84F4235U, 0x3F47E6A4U, 0xBF1FEBF6U, 0x3B4F4235U },
+		{ 0x42B5AD00U, 0x42FD8306U, 0x41D0376CU, 0xB7000000U },
+		{ 0xBE2B8AD6U, 0x3F65ED95U, 0xBE8B21F4U, 0xBE9ACBBBU },
+		{ 0xBE30F4A8U, 0x3F66087AU, 0xBE8F9638U, 0xBE947360U },
+		{ 0x3E72F4F8U, 0x3E3F30E9U, 0xBF1AF27EU, 0x3F3C8E69U },
+		{ 0xBFAAEA68U, 0x42F67F21U, 0xC2E9A7EFU, 0x3F000000U },
+		{ 0xC0D6D84CU, 0x3FAD4B41U, 0x4118E1DAU, 0x35000000U },
+		{ 0x3E97C060U, 0xBF9A2D9FU, 0xBF57E7DBU, 0x80000000U },
+		{ 0xBFAAEA74U, 0x42F67F21U, 0xC2E9A7EFU, 0x3F000000U },
+		{ 0xBF09335FU, 0x3E785894U, 0xBE950ECFU, 0x3B1F82A7U },
+		{ 0xC0D69E61U, 0x40E41794U, 0x40EA2495U, 0xBFE0D58CU },
+		{ 0x42764A80U, 0x43767E41U, 0xC3875BDFU, 0x3F000000U },
+		{ 0x4055DCA8U, 0xBFA2A974U, 0x3E9D3D19U, 0x3F4CCCCCU },
+		{ 0x417B53D2U, 0xC0A78D36U, 0xBFE24630U, 0xBDE38E3AU },
+		{ 0x40A00000U, 0x40555555U, 0xC0200000U, 0x3F8E38E4U },
+		{ 0x40A00000U, 0x40555555U, 0xC0200000U, 0x3F8E38E4U },
+		{ 0x40A00000U, 0x40555555U, 0xC0200000U, 0x3F8E38E4U },
+		{ 0x3FE2DFC5U, 0x3FA06C99U, 0x3F5744FDU, 0x3EA1E89BU },
+		{ 0x4071463AU, 0xC002B0B5U, 0x3ED93923U, 0xBE428F5CU },
+		{ 0xC02827DEU, 0x3FDB5B12U, 0xBF84A8A0U, 0x3F7D70A3U },
+		{ 0x3EFD0276U, 0x3DE742C4U, 0xBE941DB9U, 0x3F4CCCCCU },
+		{ 0xBE5CF102U, 0xBE00C80CU, 0x40654DDBU, 0x3FEDB0A5U },
+		{ 0x3ED51666U, 0x3FB2F394U, 0x3FA0D97CU, 0x00000000U },
+		{ 0x3F607846U, 0xBEE07846U, 0x3E4A1805U, 0xBCE4A4A0U },
+		{ 0x3F607846U, 0xBEE07846U, 0x3E4A1805U, 0xBCE4A4A0U },
+		{ 0x3F607846U, 0xBEE07846U, 0x3E4A1805U, 0xBCE4A4A0U },
+		{ 0x41600000U, 0xC0E00000U, 0x40400000U, 0x80000000U },
+		{ 0x00000000U, 0xBF7FFFFEU, 0x3F264E9BU, 0xBDCC7577U },
+		{ 0xBF800000U, 0xB4000000U, 0x3F429F64U, 0x3F7EB898U },
+		{ 0x3E4F9338U, 0x3E9E6152U, 0xBED8785AU, 0x3FA14CDCU },
+		{ 0x00000000U, 0xBFC3563AU, 0x3F34CCF8U, 0xBDCC9830U },
+		{ 0x3FC90FDBU, 0x4046330AU, 0x3F5D52BEU, 0x3FD5D95EU },
+		{ 0x3FA19DC4U, 0xBF807F4AU, 0x3F1D9016U, 0xBDCC1F1EU },
+		{ 0x3FC0EC97U, 0xBFB0E816U, 0x40057A82U, 0xBDE2A04EU },
+		{ 0x3F106EBAU, 0xC0200000U, 0xBF7FFFFEU, 0xBF8676B9U },
+		{ 0xBF29D2AEU, 0xBF29D2ADU, 0xBE7AB325U, 0xBE7AB331U },
+		{ 0xBF101EA7U, 0xBF2DF169U, 0xBEEB6588U, 0xBDCCF75AU },
+		{ 0x3F6061E8U, 0xBEE061E8U, 0x3E4A03E2U, 0xBCE48DD8U },
+		{ 0x3F6061E8U, 0xBEE061E8U, 0x3E4A03E2U, 0xBCE48DD8U },
+		{ 0x405C5803U, 0xBF3CD7D9U, 0x3F29B678U, 0x33000000U },
+		{ 0xBE8ADF30U, 0xBBCBAF45U, 0xBE3C7105U, 0xBF71DA4CU },
+		{ 0xBE912750U, 0xBCAEC140U, 0xBE4027A4U, 0xBF70B050U },
+		{ 0xBF101EA7U, 0xBF2DF169U, 0xBEEB6588U, 0xBDCCF75AU },
+		{ 0x404FEE34U, 0xBF8AEB7EU, 0x3F0010D6U, 0xBDCCCCCDU },
+		{ 0xBF199998U, 0x3CE9F9B0U, 0xBE74651CU, 0xB2000000U },
+		{ 0xBF04E72EU, 0x3FA48E37U, 0x3F128E48U, 0x00000000U },
+		{ 0x404FEE34U, 0xBF8AEB7EU, 0x3F0010D8U, 0xBDCCCCCDU },
+		{ 0x3F2AAAAEU, 0xB4F3BA04U, 0xB47B7466U, 0x34D4DE5EU },
+		{ 0xBE4CCCD8U, 0x3E5CC970U, 0xBE5E3892U, 0xB4DD6B45U },
+		{ 0x4000E1E5U, 0x406E380EU, 0x3F6E79FCU, 0xBDCCCCCDU },
+	};
+
+	vector4f outputs[k_max_num_golden_outputs];
+	const uint32_t num_outputs = compute_golden_outputs(outputs);
+	REQUIRE(num_outputs == sizeof(k_golden_outputs) / sizeof(k_golden_outputs[0]));
+
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		float values[4];
+		vector_store(outputs[output_index], &values[0]);
+
+		uint32_t value_bits[4];
+		std::memcpy(&value_bits[0], &values[0], sizeof(values));
+
+		INFO("Output index: " << output_index);
+		CHECK(value_bits[0] == k_golden_outputs[output_index][0]);
+		CHECK(value_bits[1] == k_golden_outputs[output_index][1]);
+		CHECK(value_bits[2] == k_golden_outputs[output_index][2]);
+		CHECK(value_bits[3] == k_golden_outputs[output_index][3]);
+	}
+}
+#endif
@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/expression.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <type_traits>
+
+using namespace rtm;
+
+// These pairs are kept out of line with C linkage so that check_codegen.cmake can find
+// them in the disassembly of the unit test executable and compare their instructions.
+extern "C"
+{
+	RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL rtm_codegen_eager_mul_add(vector4f_arg0 a, vector4f_arg1 b, vector4f_arg2 c, vector4f_arg3 d) RTM_NO_EXCEPT
+	{
+		return vector_add(vector_mul(a, b), vector_mul(c, d));
+	}
+
+	RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL rtm_codegen_expr_mul_add(vector4f_arg0 a, vector4f_arg1 b, vector4f_arg2 c, vector4f_arg3 d) RTM_NO_EXCEPT
+	{
+		return expr::vector_add(expr::vector_mul(a, b), expr::vector_mul(c, d));
+	}
+
+	RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL rtm_codegen_eager_normalize_rotate(vector4f_arg0 input, quatf_arg1 rotation) RTM_NO_EXCEPT
+	{
+		return vector_normalize3(quat_mul_vector3(vector_normalize3(input), rotation));
+	}
+
+	RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL rtm_codegen_expr_normalize_rotate(vector4f_arg0 input, quatf_arg1 rotation) RTM_NO_EXCEPT
+	{
+		return expr::vector_normalize3(expr::quat_mul_vector3(expr::vector_normalize3(input), rotation));
+	}
+
+	// No loops here, the instructions are counted statically
+	RTM_FORCE_NOINLINE void RTM_SIMD_CALL rtm_codegen_eager_rotate4(const vector4f* inputs, quatf_arg0 rotation, vector4f* outputs) RTM_NO_EXCEPT
+	{
+		outputs[0] = quat_mul_vector3(inputs[0], rotation);
+		outputs[1] = quat_mul_vector3(inputs[1], rotation);
+		outputs[2] = quat_mul_vector3(inputs[2], rotation);
+		outputs[3] = quat_mul_vector3(inputs[3], rotation);
+	}
+
+	RTM_FORCE_NOINLINE void RTM_SIMD_CALL rtm_codegen_expr_rotate4(const vector4f* inputs, quatf_arg0 rotation, vector4f* outputs) RTM_NO_EXCEPT
+	{
+		const auto rotation_expr = expr::quat_rotation(rotation);
+		outputs[0] = expr::quat_mul_vector3(inputs[0], rotation_expr);
+		outputs[1] = expr::quat_mul_vector3(inputs[1], rotation_expr);
+		outputs[2] = expr::quat_mul_vector3(inputs[2], rotation_expr);
+		outputs[3] = expr::quat_mul_vector3(inputs[3], rotation_expr);
+	}
+}
+
+TEST_CASE("expression vector4f arithmetic", "[math][vector4][expression]")
+{
+	const float threshold = 1.0E-5F;
+
+	const vector4f a = vector_set(-1.5F, 2.25F, 3.0F, 4.5F);
+	const vector4f b = vector_set(0.5F, -4.0F, 1.25F, -2.0F);
+	const vector4f c = vector_set(7.0F, 0.5F, -3.0F, 1.0F);
+	const vector4f d = vector_set(-0.25F, 1.5F, 2.0F, -6.0F);
+
+	CHECK(vector_all_near_equal(expr::vector_mul(a, b), vector_mul(a, b), 0.0F));
+	CHECK(vector_all_near_equal(expr::vector_mul(a, 2.5F), vector_mul(a, 2.5F), 0.0F));
+	CHECK(vector_all_near_equal(expr::vector_add(a, b), vector_add(a, b), 0.0F));
+	CHECK(vector_all_near_equal(expr::vector_sub(a, b), vector_sub(a, b), 0.0F));
+
+	// Fused multiplications
+	CHECK(vector_all_near_equal(expr::vector_add(expr::vector_mul(a, b), c), vector_add(vector_mul(a, b), c), threshold));
+	CHECK(vector_all_near_equal(expr::vector_add(c, expr::vector_mul(a, b)), vector_add(c, vector_mul(a, b)), threshold));
+	CHECK(vector_all_near_equal(expr::vector_add(expr::vector_mul(a, b), expr::vector_mul(c, d)), vector_add(vector_mul(a, b), vector_mul(c, d)), threshold));
+	CHECK(vector_all_near_equal(expr::vector_sub(c, expr::vector_mul(a, b)), vector_sub(c, vector_mul(a, b)), threshold));
+	CHECK(vector_all_near_equal(expr::vector_sub(expr::vector_mul(a, b), c), vector_sub(vector_mul(a, b), c), threshold));
+	CHECK(vector_all_near_equal(expr::vector_add(expr::vector_mul(a, 0.5F), expr::vector_mul(b, -2.0F)), vector_add(vector_mul(a, 0.5F), vector_mul(b, -2.0F)), threshold));
+
+	// Nested expressions
+	const auto nested = expr::vector_sub(expr::vector_add(expr::vector_mul(a, b), expr::vector_mul(c, d)), expr::vector_mul(expr::vector_add(a, c), d));
+	const vector4f nested_ref = vector_sub(vector_add(vector_mul(a, b), vector_mul(c, d)), vector_mul(vector_add(a, c), d));
+	CHECK(vector_all_near_equal(nested.eval(), nested_ref, threshold));
+	CHECK(vector_all_near_equal(expr::eval(nested), nested_ref, threshold));
+	CHECK(vector_all_near_equal(expr::eval(a), a, 0.0F));
+}
+
+TEST_CASE("expression vector4f normalize and rotate", "[math][vector4][expression]")
+{
+	const float threshold = 1.0E-5F;
+
+	const vector4f a = vector_set(-1.5F, 2.25F, 3.0F, 0.0F);
+	const vector4f b = vector_set(0.5F, -4.0F, 1.25F, 0.0F);
+	const quatf rotation0 = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-60.0F), scalar_deg_to_rad(120.0F));
+	const quatf rotation1 = quat_from_euler(scalar_deg_to_rad(-10.0F), scalar_deg_to_rad(45.0F), scalar_deg_to_rad(5.0F));
+
+	const auto rotation0_expr = expr::quat_rotation(rotation0);
+	const auto rotation1_expr = expr::quat_rotation(rotation1);
+
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(a, rotation0_expr), quat_mul_vector3(a, rotation0), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(b, rotation1_expr), quat_mul_vector3(b, rotation1), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(expr::quat_mul_vector3(a, rotation0_expr), rotation1_expr), quat_mul_vector3(quat_mul_vector3(a, rotation0), rotation1), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(expr::vector_add(a, b), rotation0_expr), quat_mul_vector3(vector_add(a, b), rotation0), threshold));
+	CHECK(scalar_near_equal(vector_get_w(expr::eval(expr::quat_mul_vector3(a, rotation0_expr))), 0.0F, 0.0F));
+
+	// A single vector is rotated with the quaternion directly
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(a, rotation0), quat_mul_vector3(a, rotation0), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(b, rotation1), quat_mul_vector3(b, rotation1), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(expr::quat_mul_vector3(a, rotation0), rotation1_expr), quat_mul_vector3(quat_mul_vector3(a, rotation0), rotation1), threshold));
+	CHECK(vector_all_near_equal3(expr::quat_mul_vector3(expr::vector_add(a, b), rotation1), quat_mul_vector3(vector_add(a, b), rotation1), threshold));
+
+	CHECK(vector_all_near_equal3(expr::vector_normalize3(a), vector_normalize3(a), threshold));
+	CHECK(vector_all_near_equal3(expr::vector_normalize3(expr::vector_add(a, b)), vector_normalize3(vector_add(a, b)), threshold));
+
+	// Normalizing an expression known to be normalized does nothing
+	const auto normalized = expr::vector_normalize3(a);
+	using normalized_type = std::decay<decltype(normalized)>::type;
+	static_assert(std::is_same<decltype(expr::vector_normalize3(normalized)), normalized_type>::value, "Normalization should be skipped");
+
+	const auto rotated = expr::quat_mul_vector3(normalized, rotation0_expr);
+	using rotated_type = std::decay<decltype(rotated)>::type;
+	static_assert(std::is_same<decltype(expr::vector_normalize3(rotated)), rotated_type>::value, "Normalization should be skipped");
+	CHECK(vector_all_near_equal3(expr::vector_normalize3(rotated), vector_normalize3(quat_mul_vector3(vector_normalize3(a), rotation0)), threshold));
+
+	const auto quat_rotated = expr::quat_mul_vector3(normalized, rotation0);
+	using quat_rotated_type = std::decay<decltype(quat_rotated)>::type;
+	static_assert(std::is_same<decltype(expr::vector_normalize3(quat_rotated)), quat_rotated_type>::value, "Normalization should be skipped");
+	CHECK(vector_all_near_equal3(expr::vector_normalize3(quat_rotated), vector_normalize3(quat_mul_vector3(vector_normalize3(a), rotation0)), threshold));
+
+	const auto unit = expr::vector_unit3(vector_set(0.0F, 1.0F, 0.0F));
+	static_assert(std::is_same<decltype(expr::vector_normalize3(expr::quat_mul_vector3(unit, rotation0_expr))), decltype(expr::quat_mul_vector3(unit, rotation0_expr))>::value, "Normalization should be skipped");
+	CHECK(vector_all_near_equal3(expr::vector_normalize3(expr::quat_mul_vector3(unit, rotation0_expr)), quat_mul_vector3(vector_set(0.0F, 1.0F, 0.0F), rotation0), threshold));
+
+	// Normalizing an arbitrary expression still normalizes
+	const auto scaled = expr::vector_mul(normalized, 2.0F);
+	CHECK(scalar_near_equal(float(vector_length3(expr::eval(expr::vector_normalize3(scaled)))), 1.0F, threshold));
+}
+
+TEST_CASE("expression codegen functions", "[math][vector4][expression]")
+{
+	// The instruction counts are validated by check_codegen.cmake, here we only make sure the results match
+	const float threshold = 1.0E-5F;
+
+	const vector4f a = vector_set(-1.5F, 2.25F, 3.0F, 0.0F);
+	const vector4f b = vector_set(0.5F, -4.0F, 1.25F, 0.0F);
+	const vector4f c = vector_set(7.0F, 0.5F, -3.0F, 1.0F);
+	const vector4f d = vector_set(-0.25F, 1.5F, 2.0F, -6.0F);
+	const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-60.0F), scalar_deg_to_rad(120.0F));
+
+	CHECK(vector_all_near_equal(rtm_codegen_expr_mul_add(a, b, c, d), rtm_codegen_eager_mul_add(a, b, c, d), threshold));
+	CHECK(vector_all_near_equal3(rtm_codegen_expr_normalize_rotate(a, rotation), rtm_codegen_eager_normalize_rotate(a, rotation), threshold));
+
+	const vector4f inputs[4] = { a, b, c, d };
+	vector4f eager_outputs[4];
+	vector4f expr_outputs[4];
+	rtm_codegen_eager_rotate4(inputs, rotation, eager_outputs);
+	rtm_codegen_expr_rotate4(inputs, rotation, expr_outputs);
+	for (uint32_t vector_index = 0; vector_index < 4; ++vector_index)
+		CHECK(vector_all_near_equal3(expr_outputs[vector_index], eager_outputs[vector_index], threshold));
+}
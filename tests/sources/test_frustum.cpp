@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/frustumd.h>
+#include <rtm/frustumf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+template<typename FloatType>
+static typename float_traits<FloatType>::matrix4x4 make_perspective_matrix(FloatType near_distance, FloatType far_distance)
+{
+	using Vector4Type = typename float_traits<FloatType>::vector4;
+
+	// Left handed perspective projection with a 90 degree field of view, depth maps to [0, 1]
+	const FloatType depth_scale = far_distance / (far_distance - near_distance);
+	const Vector4Type x_axis = vector_set(FloatType(1.0), FloatType(0.0), FloatType(0.0), FloatType(0.0));
+	const Vector4Type y_axis = vector_set(FloatType(0.0), FloatType(1.0), FloatType(0.0), FloatType(0.0));
+	const Vector4Type z_axis = vector_set(FloatType(0.0), FloatType(0.0), depth_scale, FloatType(1.0));
+	const Vector4Type w_axis = vector_set(FloatType(0.0), FloatType(0.0), -near_distance * depth_scale, FloatType(0.0));
+	return matrix_set(x_axis, y_axis, z_axis, w_axis);
+}
+
+template<typename FloatType, typename FrustumType>
+static void test_frustum_planes(const FrustumType& frustum, const FloatType threshold)
+{
+	const FloatType inv_sqrt2 = FloatType(0.70710678118654752);
+	CHECK(vector_all_near_equal(frustum.planes[0], vector_set(inv_sqrt2, FloatType(0.0), inv_sqrt2, FloatType(0.0)), threshold));
+	CHECK(vector_all_near_equal(frustum.planes[1], vector_set(-inv_sqrt2, FloatType(0.0), inv_sqrt2, FloatType(0.0)), threshold));
+	CHECK(vector_all_near_equal(frustum.planes[2], vector_set(FloatType(0.0), inv_sqrt2, inv_sqrt2, FloatType(0.0)), threshold));
+	CHECK(vector_all_near_equal(frustum.planes[3], vector_set(FloatType(0.0), -inv_sqrt2, inv_sqrt2, FloatType(0.0)), threshold));
+	CHECK(vector_all_near_equal(frustum.planes[4], vector_set(FloatType(0.0), FloatType(0.0), FloatType(1.0), FloatType(-1.0)), threshold));
+	// The far plane distance is large and loses precision when normalized
+	CHECK(vector_all_near_equal(frustum.planes[5], vector_set(FloatType(0.0), FloatType(0.0), FloatType(-1.0), FloatType(100.0)), threshold * FloatType(100.0)));
+}
+
+TEST_CASE("frustumf math", "[math][frustum]")
+{
+	const frustumf frustum = frustum_from_matrix(make_perspective_matrix(1.0F, 100.0F));
+	test_frustum_planes<float>(frustum, 1.0E-4F);
+
+	{
+		CHECK(frustum_intersects(frustum, sphere_set(vector_set(0.0F, 0.0F, 10.0F), 1.0F)));
+		CHECK(frustum_intersects(frustum, sphere_set(vector_set(0.0F, 0.0F, 0.5F), 1.0F)));
+		CHECK(!frustum_intersects(frustum, sphere_set(vector_set(0.0F, 0.0F, -1.5F), 1.0F)));
+		CHECK(!frustum_intersects(frustum, sphere_set(vector_set(20.0F, 0.0F, 10.0F), 1.0F)));
+		CHECK(!frustum_intersects(frustum, sphere_set(vector_set(0.0F, 0.0F, 102.0F), 1.0F)));
+
+		CHECK(frustum_intersects(frustum, aabb_set(vector_set(0.0F, 0.0F, 10.0F), vector_set(1.0F))));
+		CHECK(frustum_intersects(frustum, aabb_set(vector_set(11.5F, 0.0F, 10.0F), vector_set(1.0F))));
+		CHECK(!frustum_intersects(frustum, aabb_set(vector_set(13.0F, 0.0F, 10.0F), vector_set(1.0F))));
+	}
+
+	{
+		constexpr uint32_t num_volumes = 29;
+
+		spheref spheres[num_volumes];
+		aabbf aabbs[num_volumes];
+		for (uint32_t volume_index = 0; volume_index < num_volumes; ++volume_index)
+		{
+			// Objects along a line that sweeps in and out of the frustum
+			const float value = float(volume_index);
+			const vector4f center = vector_set(value * 3.0F - 40.0F, value - 10.0F, value * 4.0F - 20.0F);
+			spheres[volume_index] = sphere_set(center, 2.0F);
+			aabbs[volume_index] = aabb_set(center, vector_set(2.0F, 1.0F, 0.5F));
+		}
+
+		// Test various counts to cover the 8 wide, 4 wide, and padded paths
+		const uint32_t counts[] = { 0, 1, 3, 4, 7, 8, 12, 13, 29 };
+		for (uint32_t count : counts)
+		{
+			uint32_t visible_indices[num_volumes];
+
+			{
+				const uint32_t num_visible = frustum_cull(frustum, spheres, count, visible_indices);
+
+				uint32_t expected_index = 0;
+				for (uint32_t volume_index = 0; volume_index < count; ++volume_index)
+				{
+					if (!frustum_intersects(frustum, spheres[volume_index]))
+						continue;
+
+					REQUIRE(expected_index < num_visible);
+					CHECK(visible_indices[expected_index] == volume_index);
+					expected_index++;
+				}
+
+				CHECK(num_visible == expected_index);
+			}
+
+			{
+				const uint32_t num_visible = frustum_cull(frustum, aabbs, count, visible_indices);
+
+				uint32_t expected_index = 0;
+				for (uint32_t volume_index = 0; volume_index < count; ++volume_index)
+				{
+					if (!frustum_intersects(frustum, aabbs[volume_index]))
+						continue;
+
+					REQUIRE(expected_index < num_visible);
+					CHECK(visible_indices[expected_index] == volume_index);
+					expected_index++;
+				}
+
+				CHECK(num_visible == expected_index);
+			}
+		}
+
+		// Some must be visible and some culled for the test to be meaningful
+		uint32_t visible_indices[num_volumes];
+		const uint32_t num_visible = frustum_cull(frustum, spheres, num_volumes, visible_indices);
+		CHECK(num_visible > 0);
+		CHECK(num_visible < num_volumes);
+	}
+}
+
+TEST_CASE("frustumd math", "[math][frustum]")
+{
+	const frustumd frustum = frustum_from_matrix(make_perspective_matrix(1.0, 100.0));
+	test_frustum_planes<double>(frustum, 1.0E-9);
+
+	const frustumf frustum_flt = frustum_cast(frustum);
+	test_frustum_planes<float>(frustum_flt, 1.0E-4F);
+
+	test_frustum_planes<double>(frustum_cast(frustum_flt), 1.0E-4);
+}
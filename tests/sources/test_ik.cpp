@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/ikf.h>
+#include <rtm/qvvf.h>
+
+using namespace rtm;
+
+template<uint32_t num_joints>
+static void make_ik_chain(qvvf (&chain)[num_joints], float bone_length, float bend_angle)
+{
+	// A chain along the X axis that bends around the Z axis at every joint
+	const quatf bend = quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), bend_angle);
+
+	quatf rotation = bend;
+	vector4f position = vector_zero();
+	for (uint32_t joint_index = 0; joint_index < num_joints; ++joint_index)
+	{
+		chain[joint_index] = qvv_set(rotation, position, vector_set(1.0F));
+		position = vector_add(position, quat_mul_vector3(vector_set(bone_length, 0.0F, 0.0F), rotation));
+		rotation = quat_mul(bend, rotation);
+	}
+}
+
+template<uint32_t num_joints>
+static void check_ik_chain(const qvvf (&chain)[num_joints], float bone_length, float threshold)
+{
+	// Bones must retain their length and every joint must still point at its child
+	for (uint32_t joint_index = 0; joint_index + 1 < num_joints; ++joint_index)
+	{
+		const vector4f bone = vector_sub(chain[joint_index + 1].translation, chain[joint_index].translation);
+		CHECK(scalar_near_equal(float(vector_length3(bone)), bone_length, threshold));
+
+		const vector4f local_bone = quat_mul_vector3(vector_set(bone_length, 0.0F, 0.0F), chain[joint_index].rotation);
+		CHECK(vector_all_near_equal3(local_bone, bone, threshold));
+		CHECK(quat_is_normalized(chain[joint_index].rotation));
+	}
+}
+
+TEST_CASE("ik two bone", "[math][ik]")
+{
+	const float threshold = 1.0E-4F;
+	const vector4f bend_direction = vector_set(0.0F, 0.0F, 1.0F);
+
+	{
+		// Reachable target, the middle joint bends towards the bend direction
+		qvvf chain[3];
+		make_ik_chain(chain, 1.0F, 0.0F);
+
+		const vector4f target = vector_set(1.0F, 1.0F, 0.0F);
+		ik_two_bone(chain, target, bend_direction);
+
+		CHECK(vector_all_near_equal3(chain[2].translation, target, threshold));
+		CHECK(float(vector_get_z(chain[1].translation)) > 0.0F);
+		CHECK(vector_all_near_equal3(chain[0].translation, vector_zero(), threshold));
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// Unreachable target, the chain fully extends towards it
+		qvvf chain[3];
+		make_ik_chain(chain, 1.0F, 0.5F);
+
+		ik_two_bone(chain, vector_set(0.0F, 10.0F, 0.0F), bend_direction);
+
+		CHECK(vector_all_near_equal3(chain[1].translation, vector_set(0.0F, 1.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(chain[2].translation, vector_set(0.0F, 2.0F, 0.0F), threshold));
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// Bend direction aligned with the target, the current bend is retained
+		qvvf chain[3];
+		make_ik_chain(chain, 1.0F, 1.0F);
+
+		const vector4f target = vector_set(1.5F, 0.0F, 0.0F);
+		ik_two_bone(chain, target, vector_set(1.0F, 0.0F, 0.0F));
+
+		CHECK(vector_all_near_equal3(chain[2].translation, target, threshold));
+		CHECK(float(vector_get_y(chain[1].translation)) > 0.0F);
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// SoA chains match their AoS counterparts
+		qvvf chains[4][3];
+		qvvf expected[4][3];
+		const vector4f targets[4] = { vector_set(1.0F, 1.0F, 0.0F), vector_set(0.2F, -0.5F, 1.2F), vector_set(5.0F, 1.0F, -1.0F), vector_set(1.5F, 0.0F, 0.0F) };
+		const vector4f bends[4] = { vector_set(0.0F, 0.0F, 1.0F), vector_set(0.0F, 1.0F, 0.0F), vector_set(1.0F, 0.0F, 0.0F), vector_set(1.0F, 0.0F, 0.0F) };
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			make_ik_chain(chains[chain_index], 1.0F, 0.25F * float(chain_index));
+			make_ik_chain(expected[chain_index], 1.0F, 0.25F * float(chain_index));
+			ik_two_bone(expected[chain_index], targets[chain_index], bends[chain_index]);
+		}
+
+		vector4f target_x, target_y, target_z;
+		vector4f bend_x, bend_y, bend_z;
+		RTM_MATRIXF_TRANSPOSE_4X3(targets[0], targets[1], targets[2], targets[3], target_x, target_y, target_z);
+		RTM_MATRIXF_TRANSPOSE_4X3(bends[0], bends[1], bends[2], bends[3], bend_x, bend_y, bend_z);
+
+		ik_chain4f<3> soa_chains;
+		ik_chain_load(chains[0], chains[1], chains[2], chains[3], soa_chains);
+		ik_two_bone(soa_chains, target_x, target_y, target_z, bend_x, bend_y, bend_z);
+		ik_chain_store(soa_chains, chains[0], chains[1], chains[2], chains[3]);
+
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			for (uint32_t joint_index = 0; joint_index < 3; ++joint_index)
+			{
+				CHECK(vector_all_near_equal3(chains[chain_index][joint_index].translation, expected[chain_index][joint_index].translation, threshold));
+				CHECK(quat_near_equal(chains[chain_index][joint_index].rotation, expected[chain_index][joint_index].rotation, threshold));
+			}
+		}
+	}
+}
+
+TEST_CASE("ik ccd", "[math][ik]")
+{
+	const float threshold = 1.0E-3F;
+
+	{
+		qvvf chain[5];
+		make_ik_chain(chain, 1.0F, 0.3F);
+
+		const vector4f target = vector_set(1.0F, 2.0F, 1.5F);
+		ik_ccd(chain, 5, target, 64);
+
+		CHECK(vector_all_near_equal3(chain[4].translation, target, threshold));
+		CHECK(vector_all_near_equal3(chain[0].translation, vector_zero(), threshold));
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// SoA chains match their AoS counterparts
+		qvvf chains[4][5];
+		qvvf expected[4][5];
+		const vector4f targets[4] = { vector_set(1.0F, 2.0F, 1.5F), vector_set(-2.0F, 0.5F, 0.0F), vector_set(3.0F, 0.0F, -1.0F), vector_set(8.0F, 0.0F, 0.0F) };
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			make_ik_chain(chains[chain_index], 1.0F, 0.1F + 0.2F * float(chain_index));
+			make_ik_chain(expected[chain_index], 1.0F, 0.1F + 0.2F * float(chain_index));
+
+			// The SoA version does not stop early
+			for (uint32_t iteration = 0; iteration < 4; ++iteration)
+				ik_ccd_iteration(expected[chain_index], 5, targets[chain_index]);
+		}
+
+		vector4f target_x, target_y, target_z;
+		RTM_MATRIXF_TRANSPOSE_4X3(targets[0], targets[1], targets[2], targets[3], target_x, target_y, target_z);
+
+		ik_chain4f<5> soa_chains;
+		ik_chain_load(chains[0], chains[1], chains[2], chains[3], soa_chains);
+		ik_ccd(soa_chains, target_x, target_y, target_z, 4);
+		ik_chain_store(soa_chains, chains[0], chains[1], chains[2], chains[3]);
+
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			for (uint32_t joint_index = 0; joint_index < 5; ++joint_index)
+			{
+				CHECK(vector_all_near_equal3(chains[chain_index][joint_index].translation, expected[chain_index][joint_index].translation, threshold));
+				CHECK(quat_near_equal(chains[chain_index][joint_index].rotation, expected[chain_index][joint_index].rotation, threshold));
+			}
+
+			check_ik_chain(chains[chain_index], 1.0F, threshold);
+		}
+	}
+}
+
+TEST_CASE("ik fabrik", "[math][ik]")
+{
+	const float threshold = 1.0E-3F;
+
+	vector4f positions[5];
+	float bone_lengths[4];
+
+	{
+		qvvf chain[5];
+		make_ik_chain(chain, 1.0F, 0.3F);
+
+		const vector4f target = vector_set(1.0F, 2.0F, 1.5F);
+		ik_fabrik(chain, 5, target, 32, positions, bone_lengths);
+
+		CHECK(vector_all_near_equal3(chain[4].translation, target, threshold));
+		CHECK(vector_all_near_equal3(chain[0].translation, vector_zero(), threshold));
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// Unreachable target, the chain fully extends towards it
+		qvvf chain[5];
+		make_ik_chain(chain, 1.0F, 0.3F);
+
+		ik_fabrik(chain, 5, vector_set(0.0F, 0.0F, 10.0F), 8, positions, bone_lengths);
+
+		CHECK(vector_all_near_equal3(chain[4].translation, vector_set(0.0F, 0.0F, 4.0F), threshold));
+		check_ik_chain(chain, 1.0F, threshold);
+	}
+
+	{
+		// SoA chains match their AoS counterparts
+		qvvf chains[4][5];
+		qvvf expected[4][5];
+		const vector4f targets[4] = { vector_set(1.0F, 2.0F, 1.5F), vector_set(-2.0F, 0.5F, 0.0F), vector_set(3.0F, 0.0F, -1.0F), vector_set(8.0F, 0.0F, 0.0F) };
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			make_ik_chain(chains[chain_index], 1.0F, 0.1F + 0.2F * float(chain_index));
+			make_ik_chain(expected[chain_index], 1.0F, 0.1F + 0.2F * float(chain_index));
+			ik_fabrik(expected[chain_index], 5, targets[chain_index], 4, positions, bone_lengths);
+		}
+
+		vector4f target_x, target_y, target_z;
+		RTM_MATRIXF_TRANSPOSE_4X3(targets[0], targets[1], targets[2], targets[3], target_x, target_y, target_z);
+
+		ik_chain4f<5> soa_chains;
+		ik_chain_load(chains[0], chains[1], chains[2], chains[3], soa_chains);
+		ik_fabrik(soa_chains, target_x, target_y, target_z, 4);
+		ik_chain_store(soa_chains, chains[0], chains[1], chains[2], chains[3]);
+
+		for (uint32_t chain_index = 0; chain_index < 4; ++chain_index)
+		{
+			for (uint32_t joint_index = 0; joint_index < 5; ++joint_index)
+			{
+				CHECK(vector_all_near_equal3(chains[chain_index][joint_index].translation, expected[chain_index][joint_index].translation, threshold));
+				CHECK(quat_near_equal(chains[chain_index][joint_index].rotation, expected[chain_index][joint_index].rotation, threshold));
+			}
+
+			check_ik_chain(chains[chain_index], 1.0F, threshold);
+		}
+	}
+}
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/linef.h>
+
+using namespace rtm;
+
+TEST_CASE("linef math", "[math][line]")
+{
+	const float threshold = 1.0E-4F;
+
+	{
+		const linef line = line_from_points(vector_set(1.0F, 2.0F, 3.0F), vector_set(1.0F, 2.0F, 5.0F));
+		CHECK(vector_all_near_equal3(line.origin, vector_set(1.0F, 2.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(line.direction, vector_set(0.0F, 0.0F, 2.0F), threshold));
+		CHECK(vector_all_near_equal3(line_get_point(line, 1.5F), vector_set(1.0F, 2.0F, 6.0F), threshold));
+
+		// The line extends in both directions
+		CHECK(vector_all_near_equal3(line_project_point(line, vector_set(4.0F, 6.0F, -7.0F)), vector_set(1.0F, 2.0F, -7.0F), threshold));
+		CHECK(scalar_near_equal(line_distance_point(line, vector_set(4.0F, 6.0F, -7.0F)), 5.0F, threshold));
+		CHECK(scalar_near_equal(line_distance_point(line, vector_set(1.0F, 2.0F, 10.0F)), 0.0F, threshold));
+	}
+
+	{
+		const linef line = line_set(vector_set(0.0F, 0.0F, -4.0F), vector_set(1.0F, 0.0F, 2.0F));
+		const planef plane = plane_set(vector_set(0.0F, 0.0F, 1.0F), -2.0F);
+
+		float t = -1.0F;
+		CHECK(line_intersect_plane(line, plane, t));
+		CHECK(scalar_near_equal(t, 3.0F, threshold));
+		CHECK(scalar_near_equal(plane_distance_point(plane, line_get_point(line, t)), 0.0F, threshold));
+
+		// Behind the origin is fine as well
+		CHECK(line_intersect_plane(line_set(vector_set(0.0F, 0.0F, 6.0F), vector_set(1.0F, 0.0F, 2.0F)), plane, t));
+		CHECK(scalar_near_equal(t, -2.0F, threshold));
+
+		t = -1.0F;
+		CHECK(!line_intersect_plane(line_set(vector_set(0.0F, 0.0F, 6.0F), vector_set(1.0F, 1.0F, 0.0F)), plane, t));
+		CHECK(t == -1.0F);
+	}
+}
@@ -127,6 +127,12 @@ static void test_mask_impl()
 TEST_CASE("mask4f math", "[math][mask]")
 {
 	test_mask_impl<mask4f, uint32_t>();
+
+	for (uint32_t bits = 0; bits < 16; ++bits)
+	{
+		const mask4f mask = mask_set((bits & 1) != 0, (bits & 2) != 0, (bits & 4) != 0, (bits & 8) != 0);
+		CHECK(mask_get_bits(mask) == bits);
+	}
 }
 
 TEST_CASE("mask4d math", "[math][mask]")
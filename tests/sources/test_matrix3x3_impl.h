@@ -306,3 +306,44 @@ static void test_matrix3x3_misc(const FloatType threshold)
 		CHECK(scalar_near_equal(adj_zz, FloatType(41.4168), threshold));
 	}
 }
+
+template<typename FloatType>
+static void test_matrix3x3_inertia(const FloatType threshold)
+{
+	using QuatType = typename float_traits<FloatType>::quat;
+	using Vector4Type = typename float_traits<FloatType>::vector4;
+	using Matrix3x3Type = typename float_traits<FloatType>::matrix3x3;
+
+	// 4 + 3 tensors to exercise the SoA and remainder paths
+	QuatType rotations[7];
+	Vector4Type diagonals[7];
+	for (uint32_t tensor_index = 0; tensor_index < 7; ++tensor_index)
+	{
+		const FloatType index = FloatType(tensor_index);
+		rotations[tensor_index] = quat_normalize(quat_set(FloatType(0.1) * index, FloatType(0.3), FloatType(-0.2) * index, FloatType(1.0)));
+		diagonals[tensor_index] = vector_set(FloatType(1.0) + index, FloatType(2.0), FloatType(0.5) * index + FloatType(0.25));
+	}
+
+	Matrix3x3Type tensors[7];
+	matrix_rotate_inertia(rotations, diagonals, 7, tensors);
+
+	for (uint32_t tensor_index = 0; tensor_index < 7; ++tensor_index)
+	{
+		const Matrix3x3Type rotation_mtx = matrix_from_quat(rotations[tensor_index]);
+		const Matrix3x3Type diagonal_mtx = matrix_from_scale(diagonals[tensor_index]);
+		const Matrix3x3Type expected = matrix_mul(matrix_mul(matrix_transpose(rotation_mtx), diagonal_mtx), rotation_mtx);
+
+		const Matrix3x3Type tensor = matrix_rotate_inertia(rotations[tensor_index], diagonals[tensor_index]);
+		CHECK(vector_all_near_equal3(expected.x_axis, tensor.x_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.y_axis, tensor.y_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.z_axis, tensor.z_axis, threshold));
+
+		CHECK(vector_all_near_equal3(expected.x_axis, tensors[tensor_index].x_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.y_axis, tensors[tensor_index].y_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.z_axis, tensors[tensor_index].z_axis, threshold));
+
+		// A rotated principal axis is scaled by its principal moment
+		const Vector4Type rotated_x_axis = matrix_mul_vector3(rotation_mtx.x_axis, tensor);
+		CHECK(vector_all_near_equal3(rotated_x_axis, vector_mul(rotation_mtx.x_axis, vector_dup_x(diagonals[tensor_index])), threshold));
+	}
+}
@@ -39,6 +39,11 @@ TEST_CASE("matrix3x3d math transformations", "[math][matrix3x3]")
 	test_matrix3x3_transformations<double>(1.0E-4);
 }
 
+TEST_CASE("matrix3x3d math inertia", "[math][matrix3x3]")
+{
+	test_matrix3x3_inertia<double>(1.0E-4);
+}
+
 TEST_CASE("matrix3x3d math misc", "[math][matrix3x3]")
 {
 	test_matrix3x3_misc<double>(1.0E-4);
@@ -39,6 +39,11 @@ TEST_CASE("matrix3x3f math transformations", "[math][matrix3x3]")
 	test_matrix3x3_transformations<float>(1.0E-4F);
 }
 
+TEST_CASE("matrix3x3f math inertia", "[math][matrix3x3]")
+{
+	test_matrix3x3_inertia<float>(1.0E-4F);
+}
+
 TEST_CASE("matrix3x3f math misc", "[math][matrix3x3]")
 {
 	test_matrix3x3_misc<float>(1.0E-4F);
@@ -443,6 +443,47 @@ TEST_CASE("matrix3x4f math", "[math][matrix3x4]")
 		CHECK(vector_all_near_equal3(vector_cast(src.z_axis), dst.z_axis, 1.0E-4));
 		CHECK(vector_all_near_equal3(vector_cast(src.w_axis), dst.w_axis, 1.0E-4));
 	}
+
+	{
+		// Each rotation ends up selecting a different largest quaternion component
+		const quatf rotations[] =
+		{
+			quat_identity(),
+			quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), scalar_deg_to_rad(180.0F)),
+			quat_from_axis_angle(vector_set(0.0F, 1.0F, 0.0F), scalar_deg_to_rad(180.0F)),
+			quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), scalar_deg_to_rad(180.0F)),
+			quat_from_axis_angle(vector_normalize3(vector_set(0.2F, -0.9F, 0.3F)), scalar_deg_to_rad(170.0F)),
+			quat_from_axis_angle(vector_normalize3(vector_set(-0.1F, 0.3F, 0.8F)), scalar_deg_to_rad(-160.0F)),
+			quat_from_euler(scalar_deg_to_rad(12.3F), scalar_deg_to_rad(42.8F), scalar_deg_to_rad(33.41F)),
+			quat_from_euler(scalar_deg_to_rad(-172.0F), scalar_deg_to_rad(85.0F), scalar_deg_to_rad(131.0F)),
+			quat_from_euler(scalar_deg_to_rad(93.0F), scalar_deg_to_rad(-178.0F), scalar_deg_to_rad(-47.0F)),
+		};
+		constexpr uint32_t num_rotations = sizeof(rotations) / sizeof(rotations[0]);
+
+		matrix3x4f matrices[num_rotations];
+		for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index)
+			matrices[rotation_index] = matrix_from_quat(rotations[rotation_index]);
+
+		const vector4f test_vector = vector_set(1.5F, -2.0F, 3.25F);
+
+		quatf results[num_rotations];
+		quat_from_matrices(matrices, num_rotations, results);
+
+		for (uint32_t rotation_index = 0; rotation_index < num_rotations; ++rotation_index)
+		{
+			INFO("Rotation index: " << rotation_index);
+			const quatf rotation = quat_from_matrix(matrices[rotation_index]);
+			CHECK(quat_is_normalized(rotation));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(test_vector, rotation), quat_mul_vector3(test_vector, rotations[rotation_index]), 1.0E-4F));
+			CHECK(quat_near_equal(results[rotation_index], rotation, 1.0E-6F));
+		}
+
+		// Zero scale isn't supported and returns the identity
+		matrices[0] = matrix_from_qvv(rotations[6], vector_zero(), vector_set(0.0F, 1.0F, 1.0F));
+		CHECK(quat_near_identity(quat_from_matrix(matrices[0])));
+		quat_from_matrices(matrices, 4, results);
+		CHECK(quat_near_identity(results[0]));
+	}
 }
 
 TEST_CASE("matrix3x4d math", "[math][matrix3x4]")
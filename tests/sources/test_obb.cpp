@@ -0,0 +1,83 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/obbf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+TEST_CASE("obbf math", "[math][obb]")
+{
+	const float threshold = 1.0E-4F;
+
+	const quatf rotation_around_z = quat_from_euler(scalar_deg_to_rad(0.0F), scalar_deg_to_rad(45.0F), scalar_deg_to_rad(0.0F));
+	const obbf obb = obb_set(vector_set(1.0F, 2.0F, 3.0F), vector_set(2.0F, 1.0F, 0.5F), rotation_around_z);
+
+	{
+		const aabbf aabb = aabb_from_obb(obb);
+		const float half_diagonal = (2.0F + 1.0F) * 0.70710678F;
+		CHECK(vector_all_near_equal3(aabb.center, vector_set(1.0F, 2.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb.extent, vector_set(half_diagonal, half_diagonal, 0.5F), threshold));
+
+		const obbf from_aabb = obb_from_aabb(aabb);
+		CHECK(quat_near_identity(from_aabb.rotation));
+		CHECK(vector_all_near_equal3(aabb_from_obb(from_aabb).extent, aabb.extent, threshold));
+	}
+
+	{
+		// The local X axis points along the XY diagonal
+		CHECK(obb_contains_point(obb, vector_set(1.0F + 1.4F, 2.0F + 1.4F, 3.0F)));
+		CHECK(!obb_contains_point(obb, vector_set(1.0F + 1.4F, 2.0F - 1.4F, 3.0F)));
+		CHECK(!obb_contains_point(obb, vector_set(1.0F, 2.0F, 3.6F)));
+	}
+
+	{
+		const qvvf transform = qvv_set(rotation_around_z, vector_set(-1.0F, 0.0F, 2.0F), vector_set(2.0F));
+		const obbf transformed = obb_transform(obb, transform);
+
+		CHECK(vector_all_near_equal3(transformed.center, qvv_mul_point3(obb.center, transform), threshold));
+		CHECK(vector_all_near_equal3(transformed.extent, vector_set(4.0F, 2.0F, 1.0F), threshold));
+		CHECK(quat_near_equal(transformed.rotation, quat_mul(rotation_around_z, rotation_around_z), threshold));
+
+		const vector4f local_point = vector_set(1.5F, -0.5F, 0.25F);
+		const vector4f world_point = qvv_mul_point3(vector_add(quat_mul_vector3(local_point, obb.rotation), obb.center), transform);
+		CHECK(obb_contains_point(transformed, world_point));
+	}
+
+	{
+		const vector4f planes[2] =
+		{
+			vector_set(1.0F, 0.0F, 0.0F, 0.0F),		// x >= 0
+			vector_set(0.0F, 0.0F, -1.0F, 3.6F),	// z <= 3.6
+		};
+
+		CHECK(obb_intersects_planes(obb, planes, 2));
+		CHECK(obb_intersects_planes(obb_set(vector_set(-1.5F, 0.0F, 0.0F), vector_set(2.0F, 1.0F, 0.5F), rotation_around_z), planes, 2));
+		CHECK(!obb_intersects_planes(obb_set(vector_set(-2.5F, 0.0F, 0.0F), vector_set(2.0F, 1.0F, 0.5F), rotation_around_z), planes, 2));
+		CHECK(!obb_intersects_planes(obb_set(vector_set(1.0F, 0.0F, 4.2F), vector_set(2.0F, 1.0F, 0.5F), rotation_around_z), planes, 2));
+	}
+}
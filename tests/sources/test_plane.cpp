@@ -0,0 +1,165 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/planed.h>
+#include <rtm/planef.h>
+#include <rtm/quatd.h>
+#include <rtm/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+template<typename FloatType>
+static void test_plane_impl(const FloatType threshold)
+{
+	using Vector4Type = typename float_traits<FloatType>::vector4;
+	using QuatType = typename float_traits<FloatType>::quat;
+
+	{
+		const Vector4Type point0 = vector_set(FloatType(1.0), FloatType(2.0), FloatType(3.0));
+		const Vector4Type point1 = vector_set(FloatType(2.0), FloatType(2.0), FloatType(3.0));
+		const Vector4Type point2 = vector_set(FloatType(1.0), FloatType(3.0), FloatType(3.0));
+		const auto plane = plane_from_points(point0, point1, point2);
+
+		CHECK(vector_all_near_equal3(plane_get_normal(plane), vector_set(FloatType(0.0), FloatType(0.0), FloatType(1.0)), threshold));
+		CHECK(scalar_near_equal(plane_get_distance(plane), FloatType(-3.0), threshold));
+
+		CHECK(scalar_near_equal(plane_distance_point(plane, point0), FloatType(0.0), threshold));
+		CHECK(scalar_near_equal(plane_distance_point(plane, vector_set(FloatType(5.0), FloatType(-2.0), FloatType(7.0))), FloatType(4.0), threshold));
+		CHECK(scalar_near_equal(plane_distance_point(plane, vector_set(FloatType(5.0), FloatType(-2.0), FloatType(1.0))), FloatType(-2.0), threshold));
+
+		CHECK(vector_all_near_equal3(plane_project_point(plane, vector_set(FloatType(5.0), FloatType(-2.0), FloatType(7.0))), vector_set(FloatType(5.0), FloatType(-2.0), FloatType(3.0)), threshold));
+
+		const auto scaled_plane = plane_set(vector_set(FloatType(0.0), FloatType(0.0), FloatType(2.0)), FloatType(-6.0));
+		const auto normalized_plane = plane_normalize(scaled_plane);
+		CHECK(vector_all_near_equal(normalized_plane.normal_distance, plane.normal_distance, threshold));
+
+		const auto point_normal_plane = plane_from_point_normal(point2, vector_set(FloatType(0.0), FloatType(0.0), FloatType(1.0)));
+		CHECK(vector_all_near_equal(point_normal_plane.normal_distance, plane.normal_distance, threshold));
+	}
+
+	{
+		// A plane transformed must contain the transformed points, even with non-uniform scale
+		const Vector4Type point0 = vector_set(FloatType(1.0), FloatType(-2.0), FloatType(0.5));
+		const Vector4Type point1 = vector_set(FloatType(3.0), FloatType(1.0), FloatType(-1.0));
+		const Vector4Type point2 = vector_set(FloatType(-1.0), FloatType(4.0), FloatType(2.0));
+		const auto plane = plane_from_points(point0, point1, point2);
+
+		const QuatType rotation = quat_from_euler(scalar_deg_to_rad(FloatType(30.0)), scalar_deg_to_rad(FloatType(-45.0)), scalar_deg_to_rad(FloatType(60.0)));
+		const Vector4Type translation = vector_set(FloatType(10.0), FloatType(-5.0), FloatType(2.0));
+		const Vector4Type scale = vector_set(FloatType(2.0), FloatType(0.5), FloatType(3.0));
+		const auto transform = matrix_from_qvv(rotation, translation, scale);
+
+		const Vector4Type transformed_point0 = matrix_mul_point3(point0, transform);
+		const Vector4Type transformed_point1 = matrix_mul_point3(point1, transform);
+		const Vector4Type transformed_point2 = matrix_mul_point3(point2, transform);
+		const auto expected_plane = plane_from_points(transformed_point0, transformed_point1, transformed_point2);
+
+		const auto transformed_plane = plane_transform(plane, transform);
+		CHECK(vector_all_near_equal(transformed_plane.normal_distance, expected_plane.normal_distance, threshold));
+		CHECK(scalar_near_equal(plane_distance_point(transformed_plane, transformed_point0), FloatType(0.0), threshold));
+		CHECK(scalar_near_equal(plane_distance_point(transformed_plane, transformed_point1), FloatType(0.0), threshold));
+		CHECK(scalar_near_equal(plane_distance_point(transformed_plane, transformed_point2), FloatType(0.0), threshold));
+	}
+}
+
+TEST_CASE("planef math", "[math][plane]")
+{
+	const float threshold = 1.0E-4F;
+	test_plane_impl<float>(threshold);
+
+	{
+		const planed plane_dbl = plane_set(vector_set(0.0, 0.6, 0.8), 2.5);
+		const planef plane = plane_cast(plane_dbl);
+		CHECK(vector_all_near_equal(plane.normal_distance, vector_set(0.0F, 0.6F, 0.8F, 2.5F), threshold));
+	}
+
+	{
+		constexpr uint32_t num_points = 11;
+		const planef plane = plane_normalize(plane_set(vector_set(1.0F, -2.0F, 0.5F), 1.5F));
+
+		float3f points[num_points];
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		{
+			const float value = float(point_index);
+			points[point_index] = float3f{ value * 1.5F - 4.0F, 3.0F - value, value * value * 0.25F };
+		}
+
+		float distances[num_points];
+		plane_distance_point(plane, points, distances, num_points);
+
+		float3f projected_points[num_points];
+		plane_project_point(plane, points, projected_points, num_points);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		{
+			const vector4f point = vector_load3(points + point_index);
+			CHECK(scalar_near_equal(distances[point_index], plane_distance_point(plane, point), threshold));
+
+			const vector4f projected_point = vector_load3(projected_points + point_index);
+			CHECK(vector_all_near_equal3(projected_point, plane_project_point(plane, point), threshold));
+			CHECK(scalar_near_equal(plane_distance_point(plane, projected_point), 0.0F, threshold));
+		}
+
+		// In place
+		plane_project_point(plane, points, points, num_points);
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+			CHECK(vector_all_near_equal3(vector_load3(points + point_index), vector_load3(projected_points + point_index), threshold));
+	}
+
+	{
+		constexpr uint32_t num_planes = 7;
+		const matrix3x4f transform = matrix_from_qvv(quat_from_euler(0.5F, -1.0F, 2.0F), vector_set(-3.0F, 4.0F, 1.0F), vector_set(1.5F, 0.25F, 2.0F));
+
+		planef planes[num_planes];
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+		{
+			const float value = float(plane_index);
+			planes[plane_index] = plane_normalize(plane_set(vector_set(value - 3.0F, 1.0F, value * 0.5F), value * 2.0F - 5.0F));
+		}
+
+		planef transformed_planes[num_planes];
+		plane_transform(transform, planes, transformed_planes, num_planes);
+
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+			CHECK(vector_all_near_equal(transformed_planes[plane_index].normal_distance, plane_transform(planes[plane_index], transform).normal_distance, threshold));
+
+		// In place
+		plane_transform(transform, planes, planes, num_planes);
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+			CHECK(vector_all_near_equal(planes[plane_index].normal_distance, transformed_planes[plane_index].normal_distance, threshold));
+	}
+}
+
+TEST_CASE("planed math", "[math][plane]")
+{
+	test_plane_impl<double>(1.0E-9);
+
+	const planef plane_flt = plane_set(vector_set(0.0F, 0.6F, 0.8F), 2.5F);
+	const planed plane = plane_cast(plane_flt);
+	CHECK(vector_all_near_equal(plane.normal_distance, vector_set(0.0, 0.6, 0.8, 2.5), 1.0E-6));
+}
@@ -475,3 +475,215 @@ TEST_CASE("quatd math", "[math][quat]")
 	CHECK(scalar_near_equal(float(quat_get_z(dst)), 0.22768840967675355F, 1.0E-6F));
 	CHECK(scalar_near_equal(float(quat_get_w(dst)), 0.88863059760894492F, 1.0E-6F));
 }
+
+TEST_CASE("quatf approximate math", "[math][quat]")
+{
+	// Relative error bounds documented for the hardware estimates
+#if defined(RTM_NEON_INTRINSICS)
+	const double approx_threshold = 1.0 / 256.0;
+	const double nr1_threshold = 3.0E-5;
+#else
+	const double approx_threshold = 1.5 / 4096.0;
+	const double nr1_threshold = 1.0E-6;
+#endif
+
+	for (float scale = 1.0E-3F; scale < 1.0E3F; scale *= 1.0371F)
+	{
+		const quatf input = quat_set(0.39564531F * scale, 0.04425424F * scale, -0.22768841F * scale, 0.8886306F * scale);
+		const quatf approx = quat_normalize_approx(input);
+		const quatf nr1 = quat_normalize_nr1(input);
+		const quatf reference = quat_normalize(input);
+
+		CHECK(scalar_abs(std::sqrt(double(quat_length_squared(approx))) - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(std::sqrt(double(quat_length_squared(nr1))) - 1.0) <= nr1_threshold);
+		CHECK(quat_near_equal(approx, reference, float(approx_threshold)));
+		CHECK(quat_near_equal(nr1, reference, float(nr1_threshold)));
+	}
+}
+
+template<euler_order order, int first_axis, int second_axis, int third_axis>
+static void test_quat_euler_impl()
+{
+	const vector4f axes[3] = { vector_set(1.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F) };
+	const vector4f test_vector = vector_set(1.5F, -2.0F, 3.25F);
+	const bool is_proper = first_axis == third_axis;
+	const float pi = float(rtm::constants::pi()) + 1.0E-6F;
+	const float half_pi = float(rtm::constants::half_pi()) + 1.0E-6F;
+
+	// The last two entries are in gimbal lock
+	const float3f angles[7] =
+	{
+		{ 0.0F, 0.0F, 0.0F },
+		{ 0.3F, 0.4F, -0.2F },
+		{ -2.5F, 1.2F, 2.9F },
+		{ 1.7F, -0.9F, -3.0F },
+		{ -0.6F, 1.5F, 0.1F },
+		{ 0.3F, is_proper ? 0.0F : 1.5707963F, 0.2F },
+		{ -0.8F, is_proper ? 3.1415927F : -1.5707963F, 1.4F },
+	};
+
+	quatf rotations[7];
+	for (uint32_t index = 0; index < 7; ++index)
+	{
+		const float3f& angle = angles[index];
+		const quatf first = quat_from_axis_angle(axes[first_axis], angle.x);
+		const quatf second = quat_from_axis_angle(axes[second_axis], angle.y);
+		const quatf third = quat_from_axis_angle(axes[third_axis], angle.z);
+		const quatf reference = quat_mul(quat_mul(first, second), third);
+
+		const quatf rotation = quat_from_euler<order>(vector_load3(&angle));
+		CHECK(quat_is_normalized(rotation));
+		CHECK(vector_all_near_equal3(quat_mul_vector3(test_vector, rotation), quat_mul_vector3(test_vector, reference), 1.0E-4F));
+		rotations[index] = rotation;
+
+		const vector4f euler = quat_to_euler<order>(rotation);
+		CHECK(vector_all_greater_equal3(euler, vector_set(-pi, is_proper ? 0.0F : -half_pi, -pi)));
+		CHECK(vector_all_less_equal3(euler, vector_set(pi, is_proper ? pi : half_pi, pi)));
+		CHECK(vector_all_near_equal3(quat_mul_vector3(test_vector, quat_from_euler<order>(euler)), quat_mul_vector3(test_vector, rotation), 1.0E-4F));
+	}
+
+	// Regular angles round trip exactly
+	CHECK(vector_all_near_equal3(quat_to_euler<order>(rotations[1]), vector_load3(&angles[1]), 1.0E-4F));
+	CHECK(vector_all_near_equal3(quat_to_euler<order>(rotations[2]), vector_load3(&angles[2]), 1.0E-4F));
+
+	// In gimbal lock, the third angle is folded into the first
+	CHECK(scalar_near_equal(float(vector_get_z(quat_to_euler<order>(rotations[5]))), 0.0F, 1.0E-6F));
+	CHECK(scalar_near_equal(float(vector_get_z(quat_to_euler<order>(rotations[6]))), 0.0F, 1.0E-6F));
+
+	// Batch conversions use a SoA path for groups of 4 and must match the single versions
+	quatf batch_rotations[7];
+	quat_from_euler<order>(angles, 7, batch_rotations);
+
+	float3f batch_angles[7];
+	quat_to_euler<order>(rotations, 7, batch_angles);
+
+	for (uint32_t index = 0; index < 7; ++index)
+	{
+		CHECK(quat_near_equal(batch_rotations[index], rotations[index], 1.0E-6F));
+		CHECK(vector_all_near_equal3(vector_load3(&batch_angles[index]), quat_to_euler<order>(rotations[index]), 1.0E-5F));
+	}
+}
+
+TEST_CASE("quatf euler math", "[math][quat]")
+{
+	test_quat_euler_impl<euler_order::xyz, 0, 1, 2>();
+	test_quat_euler_impl<euler_order::xzy, 0, 2, 1>();
+	test_quat_euler_impl<euler_order::yxz, 1, 0, 2>();
+	test_quat_euler_impl<euler_order::yzx, 1, 2, 0>();
+	test_quat_euler_impl<euler_order::zxy, 2, 0, 1>();
+	test_quat_euler_impl<euler_order::zyx, 2, 1, 0>();
+	test_quat_euler_impl<euler_order::xyx, 0, 1, 0>();
+	test_quat_euler_impl<euler_order::xzx, 0, 2, 0>();
+	test_quat_euler_impl<euler_order::yxy, 1, 0, 1>();
+	test_quat_euler_impl<euler_order::yzy, 1, 2, 1>();
+	test_quat_euler_impl<euler_order::zxz, 2, 0, 2>();
+	test_quat_euler_impl<euler_order::zyz, 2, 1, 2>();
+}
+
+TEST_CASE("quatf swing twist math", "[math][quat]")
+{
+	const vector4f test_vector = vector_set(1.5F, -2.0F, 3.25F);
+	const vector4f x_axis = vector_set(1.0F, 0.0F, 0.0F);
+	const vector4f y_axis = vector_set(0.0F, 1.0F, 0.0F);
+	const vector4f z_axis = vector_set(0.0F, 0.0F, 1.0F);
+
+	{
+		// Shortest arc, including opposite vectors
+		const vector4f from[5] = { x_axis, vector_set(1.0F, 2.0F, -0.5F), vector_set(0.0F, 0.0F, 2.0F), vector_set(-1.0F, 0.5F, 0.25F), y_axis };
+		const vector4f to[5] = { y_axis, vector_set(-3.0F, 0.1F, 0.7F), vector_set(0.0F, 0.0F, -1.0F), vector_set(2.0F, -1.0F, -0.5F), y_axis };
+
+		quatf batch_rotations[5];
+		quat_from_to(from, to, 5, batch_rotations);
+
+		for (uint32_t index = 0; index < 5; ++index)
+		{
+			const quatf rotation = quat_from_to(from[index], to[index]);
+			CHECK(quat_is_normalized(rotation));
+			CHECK(vector_all_near_equal3(vector_normalize3(quat_mul_vector3(from[index], rotation)), vector_normalize3(to[index]), 1.0E-4F));
+			CHECK(quat_near_equal(batch_rotations[index], rotation, 1.0E-5F));
+		}
+
+		CHECK(quat_near_identity(quat_from_to(y_axis, y_axis)));
+	}
+
+	const quatf rotations[6] =
+	{
+		quat_identity(),
+		quat_from_axis_angle(x_axis, 1.2F),
+		quat_from_axis_angle(y_axis, -2.5F),
+		quat_mul(quat_from_axis_angle(x_axis, -0.7F), quat_from_axis_angle(z_axis, 0.4F)),
+		quat_from_euler(0.3F, -1.4F, 2.2F),
+		quat_from_axis_angle(z_axis, rtm::constants::pi()),		// 180 degree swing, undefined twist
+	};
+	const vector4f twist_axes[6] = { x_axis, x_axis, x_axis, x_axis, vector_normalize3(vector_set(1.0F, 1.0F, 0.0F)), x_axis };
+
+	{
+		quatf batch_swings[6];
+		quatf batch_twists[6];
+		quat_swing_twist(rotations, twist_axes, 6, batch_swings, batch_twists);
+
+		for (uint32_t index = 0; index < 6; ++index)
+		{
+			quatf swing;
+			quatf twist;
+			quat_swing_twist(rotations[index], twist_axes[index], swing, twist);
+
+			CHECK(quat_is_normalized(swing));
+			CHECK(quat_is_normalized(twist));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(test_vector, quat_mul(twist, swing)), quat_mul_vector3(test_vector, rotations[index]), 1.0E-4F));
+			CHECK(scalar_near_equal(float(vector_dot3(quat_to_vector(swing), twist_axes[index])), 0.0F, 1.0E-5F));
+			CHECK(vector_all_near_equal3(vector_cross3(quat_to_vector(twist), twist_axes[index]), vector_zero(), 1.0E-5F));
+
+			CHECK(quat_near_equal(batch_swings[index], swing, 1.0E-5F));
+			CHECK(quat_near_equal(batch_twists[index], twist, 1.0E-5F));
+		}
+
+		// A pure twist has no swing and vice versa
+		quatf swing;
+		quatf twist;
+		quat_swing_twist(rotations[1], x_axis, swing, twist);
+		CHECK(quat_near_identity(swing));
+		CHECK(quat_near_equal(twist, rotations[1], 1.0E-5F));
+
+		quat_swing_twist(rotations[2], x_axis, swing, twist);
+		CHECK(quat_near_identity(twist));
+		CHECK(quat_near_equal(swing, rotations[2], 1.0E-5F));
+	}
+
+	{
+		// Clamping within the limits does nothing
+		CHECK(quat_near_equal(quat_clamp_swing(rotations[2], 3.0F), rotations[2], 1.0E-5F));
+		CHECK(quat_near_equal(quat_clamp_swing(quat_neg(rotations[2]), 3.0F), rotations[2], 1.0E-5F));
+		CHECK(quat_near_equal(quat_clamp_twist(rotations[1], x_axis, -1.3F, 1.3F), rotations[1], 1.0E-5F));
+
+		// Clamping outside the limits snaps to the limit
+		CHECK(quat_near_equal(quat_clamp_swing(quat_from_axis_angle(z_axis, 1.0F), 0.5F), quat_from_axis_angle(z_axis, 0.5F), 1.0E-5F));
+		CHECK(quat_near_equal(quat_clamp_twist(rotations[1], x_axis, -0.5F, 0.25F), quat_from_axis_angle(x_axis, 0.25F), 1.0E-5F));
+		CHECK(quat_near_equal(quat_clamp_twist(quat_conjugate(rotations[1]), x_axis, -0.5F, 0.25F), quat_from_axis_angle(x_axis, -0.5F), 1.0E-5F));
+		CHECK(quat_near_equal(quat_clamp_twist(quat_from_axis_angle(x_axis, 3.0F), x_axis, -0.5F, 2.0F), quat_from_axis_angle(x_axis, 2.0F), 1.0E-5F));
+
+		const float max_swing_angles[6] = { 0.1F, 0.5F, 1.0F, 0.2F, 3.0F, 1.5F };
+		const float min_twist_angles[6] = { -0.1F, -0.5F, -3.0F, 0.0F, -0.5F, -1.0F };
+		const float max_twist_angles[6] = { 0.1F, 0.5F, 3.0F, 0.0F, 0.5F, 1.0F };
+
+		quatf batch_rotations[6];
+		quat_clamp_swing_twist(rotations, twist_axes, max_swing_angles, min_twist_angles, max_twist_angles, 6, batch_rotations);
+
+		for (uint32_t index = 0; index < 6; ++index)
+		{
+			const quatf rotation = quat_clamp_swing_twist(rotations[index], twist_axes[index], max_swing_angles[index], min_twist_angles[index], max_twist_angles[index]);
+			CHECK(quat_is_normalized(rotation));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(test_vector, batch_rotations[index]), quat_mul_vector3(test_vector, rotation), 1.0E-4F));
+
+			quatf swing;
+			quatf twist;
+			quat_swing_twist(rotation, twist_axes[index], swing, twist);
+			CHECK(scalar_abs(float(quat_get_w(swing))) >= scalar_cos(max_swing_angles[index] * 0.5F) - 1.0E-5F);
+
+			const quatf shortest_twist = float(quat_get_w(twist)) >= 0.0F ? twist : quat_neg(twist);
+			const float twist_angle = scalar_atan2(float(vector_dot3(quat_to_vector(shortest_twist), twist_axes[index])), float(quat_get_w(shortest_twist))) * 2.0F;
+			CHECK(twist_angle >= min_twist_angles[index] - 1.0E-4F);
+			CHECK(twist_angle <= max_twist_angles[index] + 1.0E-4F);
+		}
+	}
+}
@@ -27,6 +27,7 @@
 
 #include <rtm/qvvf.h>
 #include <rtm/qvvd.h>
+#include <rtm/qvvm.h>
 
 using namespace rtm;
 
@@ -191,3 +192,71 @@ TEST_CASE("qvvd math", "[math][qvv]")
 	CHECK(vector_all_near_equal3(src.translation, vector_cast(dst.translation), 1.0E-6));
 	CHECK(vector_all_near_equal3(src.scale, vector_cast(dst.scale), 1.0E-6));
 }
+
+// The float32 rotation is not exactly normalized, qvvm rotates translations by the exact
+// rotation it represents and we do the same in float64 for the reference
+static qvvd qvv_cast_normalized(const qvvm& input)
+{
+	const qvvd result = qvv_cast(input);
+	return qvv_set(quat_normalize(result.rotation), result.translation, result.scale);
+}
+
+TEST_CASE("qvvm math", "[math][qvv]")
+{
+	const quatf rotation = quat_from_euler(scalar_deg_to_rad(12.0F), scalar_deg_to_rad(-51.0F), scalar_deg_to_rad(83.0F));
+	const vector4f scale = vector_set(1.2F, 0.8F, 2.1F);
+
+	// Far away from the origin, float32 spacing is 1.0 while float64 retains sub-millimeter precision
+	const vector4d world_translation = vector_set(16777216.0, -33554432.25, 8388608.125);
+	const qvvm object_to_world = qvv_set(rotation, world_translation, scale);
+	const qvvd object_to_world_d = qvv_cast_normalized(object_to_world);
+
+	{
+		const qvvm identity = qvv_identity();
+		CHECK(quat_near_identity(identity.rotation, 1.0E-6F));
+		CHECK(vector_all_near_equal3(identity.translation, vector_zero(), 0.0));
+		CHECK(vector_all_near_equal3(identity.scale, vector_set(1.0F), 0.0F));
+	}
+
+	{
+		const qvvm local_to_object = qvv_set(quat_from_euler(scalar_deg_to_rad(-4.0F), scalar_deg_to_rad(33.0F), 0.0F), vector_set(1.5, -0.25, 3.125), vector_set(0.5F, 1.5F, 1.0F));
+		const qvvm result = qvv_mul(local_to_object, object_to_world);
+		const qvvd expected = qvv_mul(qvv_cast_normalized(local_to_object), object_to_world_d);
+
+		CHECK(quat_near_equal(result.rotation, quat_cast(expected.rotation), 1.0E-6F));
+		CHECK(vector_all_near_equal3(result.translation, expected.translation, 1.0E-6));
+		CHECK(vector_all_near_equal3(result.scale, vector_cast(expected.scale), 1.0E-6F));
+
+		// Negative scale goes through a matrix
+		const qvvm mirrored = qvv_set(local_to_object.rotation, local_to_object.translation, vector_set(-0.5F, 1.5F, 1.0F));
+		const qvvm mirrored_result = qvv_mul(mirrored, object_to_world);
+		const qvvd mirrored_expected = qvv_mul(qvv_cast(mirrored), qvv_cast(object_to_world));
+		CHECK(vector_all_near_equal3(mirrored_result.translation, mirrored_expected.translation, 1.0E-6));
+		CHECK(vector_all_near_equal3(mirrored_result.scale, vector_cast(mirrored_expected.scale), 1.0E-6F));
+	}
+
+	{
+		const vector4f local_point = vector_set(0.125F, -2.5F, 1.75F);
+		const vector4d expected = qvv_mul_point3(vector_cast(local_point), object_to_world_d);
+		CHECK(vector_all_near_equal3(qvv_mul_point3(local_point, object_to_world), expected, 1.0E-5));
+		CHECK(vector_all_near_equal3(qvv_mul_point3(vector_cast(local_point), object_to_world), expected, 1.0E-6));
+
+		const qvvm world_to_object = qvv_inverse(object_to_world);
+		CHECK(quat_near_equal(world_to_object.rotation, quat_conjugate(rotation), 0.0F));
+		CHECK(vector_all_near_equal3(world_to_object.translation, qvv_inverse(object_to_world_d).translation, 1.0E-6));
+
+		// A uniform power of two scale has an exact reciprocal and round trips far away points
+		const qvvm uniform_object_to_world = qvv_set(rotation, world_translation, vector_set(2.0F));
+		const vector4d world_point = qvv_mul_point3(local_point, uniform_object_to_world);
+		CHECK(vector_all_near_equal3(qvv_mul_point3(world_point, qvv_inverse(uniform_object_to_world)), vector_cast(local_point), 1.0E-6));
+	}
+
+	{
+		const vector4d camera_position = vector_add(world_translation, vector_set(10.0, -3.0, 0.5));
+		const matrix3x4f object_to_camera = matrix_from_qvv(object_to_world, camera_position);
+
+		const vector4f local_point = vector_set(0.125F, -2.5F, 1.75F);
+		const vector4d expected = vector_sub(qvv_mul_point3(vector_cast(local_point), object_to_world_d), camera_position);
+		CHECK(vector_all_near_equal3(vector_cast(matrix_mul_point3(local_point, object_to_camera)), expected, 1.0E-5));
+	}
+}
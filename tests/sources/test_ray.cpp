@@ -0,0 +1,334 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/rayf.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+namespace
+{
+	struct double3
+	{
+		double x;
+		double y;
+		double z;
+	};
+
+	double3 sub(const double3& lhs, const double3& rhs) { return double3{ lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z }; }
+	double dot(const double3& lhs, const double3& rhs) { return lhs.x * rhs.x + lhs.y * rhs.y + lhs.z * rhs.z; }
+	double3 cross(const double3& lhs, const double3& rhs) { return double3{ lhs.y * rhs.z - lhs.z * rhs.y, lhs.z * rhs.x - lhs.x * rhs.z, lhs.x * rhs.y - lhs.y * rhs.x }; }
+	double3 to_double3(const float3f& value) { return double3{ value.x, value.y, value.z }; }
+
+	// Double precision reference, returns the smallest barycentric coordinate or a negative value on a miss
+	double reference_intersect_triangle(const double3& origin, const double3& direction, const double3& vertex0, const double3& vertex1, const double3& vertex2, double& out_t)
+	{
+		const double3 edge1 = sub(vertex1, vertex0);
+		const double3 edge2 = sub(vertex2, vertex0);
+		const double3 p = cross(direction, edge2);
+		const double inv_det = 1.0 / dot(edge1, p);
+		const double3 s = sub(origin, vertex0);
+		const double u = dot(s, p) * inv_det;
+		const double3 q = cross(s, edge1);
+		const double v = dot(direction, q) * inv_det;
+		out_t = dot(edge2, q) * inv_det;
+		return std::fmin(std::fmin(u, v), std::fmin(1.0 - u - v, out_t));
+	}
+
+	// Simple deterministic generator in [-1, 1)
+	struct random_generator
+	{
+		uint32_t state = 0x12345678U;
+
+		float next()
+		{
+			state = state * 1664525U + 1013904223U;
+			return float(state >> 8) * (2.0F / 16777216.0F) - 1.0F;
+		}
+
+		float3f next3(float scale)
+		{
+			const float x = next() * scale;
+			const float y = next() * scale;
+			const float z = next() * scale;
+			return float3f{ x, y, z };
+		}
+	};
+}
+
+TEST_CASE("rayf math", "[math][ray]")
+{
+	const float threshold = 1.0E-4F;
+
+	{
+		const rayf ray = ray_set(vector_set(1.0F, 2.0F, 3.0F), vector_set(0.0F, 0.0F, 2.0F));
+		CHECK(vector_all_near_equal3(ray_get_point(ray, 1.5F), vector_set(1.0F, 2.0F, 6.0F), threshold));
+	}
+
+	{
+		const rayf ray = ray_set(vector_set(0.25F, 0.25F, -5.0F), vector_set(0.0F, 0.0F, 1.0F));
+		const vector4f vertex0 = vector_set(0.0F, 0.0F, 2.0F);
+		const vector4f vertex1 = vector_set(1.0F, 0.0F, 2.0F);
+		const vector4f vertex2 = vector_set(0.0F, 1.0F, 2.0F);
+
+		float t = -1.0F;
+		CHECK(ray_intersect_triangle(ray, vertex0, vertex1, vertex2, t));
+		CHECK(scalar_near_equal(t, 7.0F, threshold));
+
+		// Both faces are hit
+		t = -1.0F;
+		CHECK(ray_intersect_triangle(ray, vertex0, vertex2, vertex1, t));
+		CHECK(scalar_near_equal(t, 7.0F, threshold));
+
+		// Behind the origin
+		t = -1.0F;
+		CHECK(!ray_intersect_triangle(ray_set(vector_set(0.25F, 0.25F, 5.0F), vector_set(0.0F, 0.0F, 1.0F)), vertex0, vertex1, vertex2, t));
+		CHECK(t == -1.0F);
+
+		// Outside of the triangle
+		CHECK(!ray_intersect_triangle(ray_set(vector_set(0.75F, 0.75F, -5.0F), vector_set(0.0F, 0.0F, 1.0F)), vertex0, vertex1, vertex2, t));
+
+		// Parallel to the triangle
+		CHECK(!ray_intersect_triangle(ray_set(vector_set(-1.0F, 0.25F, 2.0F), vector_set(1.0F, 0.0F, 0.0F)), vertex0, vertex1, vertex2, t));
+	}
+
+	{
+		const aabbf aabb = aabb_set(vector_set(0.0F, 0.0F, 10.0F), vector_set(1.0F, 2.0F, 3.0F));
+
+		float t = -1.0F;
+		CHECK(ray_intersect_aabb(ray_set(vector_set(0.5F, -1.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F)), aabb, t));
+		CHECK(scalar_near_equal(t, 7.0F, threshold));
+
+		CHECK(ray_intersect_aabb(ray_set(vector_set(0.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 2.0F)), aabb, t));
+		CHECK(scalar_near_equal(t, 3.5F, threshold));
+
+		// Inside
+		CHECK(ray_intersect_aabb(ray_set(vector_set(0.0F, 0.0F, 10.0F), vector_set(1.0F, 1.0F, 0.0F)), aabb, t));
+		CHECK(t == 0.0F);
+
+		// Diagonal
+		CHECK(ray_intersect_aabb(ray_set(vector_set(-5.0F, -5.0F, 5.0F), vector_set(1.0F, 1.0F, 1.0F)), aabb, t));
+		CHECK(scalar_near_equal(t, 4.0F, threshold));
+
+		t = -1.0F;
+		CHECK(!ray_intersect_aabb(ray_set(vector_set(1.5F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F)), aabb, t));
+		CHECK(!ray_intersect_aabb(ray_set(vector_set(0.0F, 0.0F, 20.0F), vector_set(0.0F, 0.0F, 1.0F)), aabb, t));
+		CHECK(!ray_intersect_aabb(ray_set(vector_set(-5.0F, 0.0F, 0.0F), vector_set(1.0F, 0.0F, 1.0F)), aabb, t));
+		CHECK(t == -1.0F);
+	}
+
+	{
+		const spheref sphere = sphere_set(vector_set(0.0F, 0.0F, 10.0F), 2.0F);
+
+		float t = -1.0F;
+		CHECK(ray_intersect_sphere(ray_set(vector_zero(), vector_set(0.0F, 0.0F, 1.0F)), sphere, t));
+		CHECK(scalar_near_equal(t, 8.0F, threshold));
+
+		CHECK(ray_intersect_sphere(ray_set(vector_zero(), vector_set(0.0F, 0.0F, 4.0F)), sphere, t));
+		CHECK(scalar_near_equal(t, 2.0F, threshold));
+
+		// Inside, we exit through the far side
+		CHECK(ray_intersect_sphere(ray_set(vector_set(0.0F, 0.0F, 9.0F), vector_set(0.0F, 0.0F, 1.0F)), sphere, t));
+		CHECK(scalar_near_equal(t, 3.0F, threshold));
+
+		t = -1.0F;
+		CHECK(!ray_intersect_sphere(ray_set(vector_set(0.0F, 2.5F, 0.0F), vector_set(0.0F, 0.0F, 1.0F)), sphere, t));
+		CHECK(!ray_intersect_sphere(ray_set(vector_set(0.0F, 0.0F, 13.0F), vector_set(0.0F, 0.0F, 1.0F)), sphere, t));
+		CHECK(t == -1.0F);
+	}
+}
+
+TEST_CASE("rayf triangle reference", "[math][ray]")
+{
+	random_generator generator;
+
+	uint32_t num_hits = 0;
+	uint32_t num_misses = 0;
+	for (uint32_t iteration = 0; iteration < 10000; ++iteration)
+	{
+		const float3f origin = generator.next3(10.0F);
+		const float3f vertices[3] = { generator.next3(5.0F), generator.next3(5.0F), generator.next3(5.0F) };
+
+		// Aim somewhere around the triangle centroid so we get a good mix of hits and misses
+		const float3f target = generator.next3(2.0F);
+		const float3f direction = {
+			(vertices[0].x + vertices[1].x + vertices[2].x) * (1.0F / 3.0F) + target.x - origin.x,
+			(vertices[0].y + vertices[1].y + vertices[2].y) * (1.0F / 3.0F) + target.y - origin.y,
+			(vertices[0].z + vertices[1].z + vertices[2].z) * (1.0F / 3.0F) + target.z - origin.z };
+
+		double expected_t;
+		const double min_coordinate = reference_intersect_triangle(to_double3(origin), to_double3(direction), to_double3(vertices[0]), to_double3(vertices[1]), to_double3(vertices[2]), expected_t);
+
+		// Skip rays that graze an edge or the origin, single precision can go either way
+		if (std::fabs(min_coordinate) < 1.0E-3)
+			continue;
+
+		const rayf ray = ray_set(vector_load3(&origin), vector_load3(&direction));
+
+		float t = -1.0F;
+		const bool is_hit = ray_intersect_triangle(ray, vector_load3(&vertices[0]), vector_load3(&vertices[1]), vector_load3(&vertices[2]), t);
+		REQUIRE(is_hit == (min_coordinate > 0.0));
+
+		if (is_hit)
+		{
+			CHECK(scalar_near_equal(t, float(expected_t), 1.0E-3F * scalar_max(1.0F, float(expected_t))));
+			num_hits++;
+		}
+		else
+			num_misses++;
+
+		// The batch version must agree
+		uint32_t batch_index = ~0U;
+		float batch_t = -1.0F;
+		CHECK(ray_intersect_triangles(ray, &vertices[0], 1, batch_t, batch_index) == is_hit);
+		if (is_hit)
+		{
+			CHECK(batch_index == 0);
+			CHECK(batch_t == t);
+		}
+	}
+
+	CHECK(num_hits > 1000);
+	CHECK(num_misses > 1000);
+}
+
+TEST_CASE("rayf batch closest hit", "[math][ray]")
+{
+	constexpr uint32_t num_primitives = 27;
+
+	random_generator generator;
+
+	float3f vertices[num_primitives * 3];
+	aabbf aabbs[num_primitives];
+	spheref spheres[num_primitives];
+	for (uint32_t primitive_index = 0; primitive_index < num_primitives; ++primitive_index)
+	{
+		// Primitives spread along the z axis
+		const float3f center = generator.next3(3.0F);
+		const vector4f center_offset = vector_set(center.x, center.y, center.z + float(primitive_index) * 2.0F);
+
+		for (uint32_t vertex_index = 0; vertex_index < 3; ++vertex_index)
+		{
+			const float3f offset = generator.next3(3.0F);
+			vector_store3(vector_add(center_offset, vector_set(offset.x, offset.y, offset.z)), &vertices[primitive_index * 3 + vertex_index]);
+		}
+
+		aabbs[primitive_index] = aabb_set(center_offset, vector_set(generator.next() * 0.5F + 1.0F, generator.next() * 0.5F + 1.0F, 0.5F));
+		spheres[primitive_index] = sphere_set(center_offset, generator.next() * 0.5F + 1.0F);
+	}
+
+	// Test various counts to cover the 4 wide and remainder paths
+	const uint32_t counts[] = { 0, 1, 3, 4, 7, 8, 13, 27 };
+	uint32_t num_hits = 0;
+	for (uint32_t ray_index = 0; ray_index < 50; ++ray_index)
+	{
+		const float3f origin = generator.next3(4.0F);
+		const float3f direction = generator.next3(0.2F);
+		const rayf ray = ray_set(vector_set(origin.x, origin.y, origin.z - 10.0F), vector_set(direction.x, direction.y, 1.0F));
+
+		for (uint32_t count : counts)
+		{
+			{
+				float expected_t = std::numeric_limits<float>::infinity();
+				uint32_t expected_index = ~0U;
+				for (uint32_t primitive_index = 0; primitive_index < count; ++primitive_index)
+				{
+					float t;
+					if (ray_intersect_triangle(ray, vector_load3(&vertices[primitive_index * 3 + 0]), vector_load3(&vertices[primitive_index * 3 + 1]), vector_load3(&vertices[primitive_index * 3 + 2]), t) && t < expected_t)
+					{
+						expected_t = t;
+						expected_index = primitive_index;
+					}
+				}
+
+				float t = -1.0F;
+				uint32_t index = ~0U;
+				const bool is_hit = ray_intersect_triangles(ray, vertices, count, t, index);
+				CHECK(is_hit == (expected_index != ~0U));
+				if (is_hit)
+				{
+					CHECK(index == expected_index);
+					CHECK(scalar_near_equal(t, expected_t, 1.0E-4F));
+					num_hits++;
+				}
+			}
+
+			{
+				float expected_t = std::numeric_limits<float>::infinity();
+				uint32_t expected_index = ~0U;
+				for (uint32_t primitive_index = 0; primitive_index < count; ++primitive_index)
+				{
+					float t;
+					if (ray_intersect_aabb(ray, aabbs[primitive_index], t) && t < expected_t)
+					{
+						expected_t = t;
+						expected_index = primitive_index;
+					}
+				}
+
+				float t = -1.0F;
+				uint32_t index = ~0U;
+				const bool is_hit = ray_intersect_aabbs(ray, aabbs, count, t, index);
+				CHECK(is_hit == (expected_index != ~0U));
+				if (is_hit)
+				{
+					CHECK(index == expected_index);
+					CHECK(scalar_near_equal(t, expected_t, 1.0E-4F));
+					num_hits++;
+				}
+			}
+
+			{
+				float expected_t = std::numeric_limits<float>::infinity();
+				uint32_t expected_index = ~0U;
+				for (uint32_t primitive_index = 0; primitive_index < count; ++primitive_index)
+				{
+					float t;
+					if (ray_intersect_sphere(ray, spheres[primitive_index], t) && t < expected_t)
+					{
+						expected_t = t;
+						expected_index = primitive_index;
+					}
+				}
+
+				float t = -1.0F;
+				uint32_t index = ~0U;
+				const bool is_hit = ray_intersect_spheres(ray, spheres, count, t, index);
+				CHECK(is_hit == (expected_index != ~0U));
+				if (is_hit)
+				{
+					CHECK(index == expected_index);
+					CHECK(scalar_near_equal(t, expected_t, 1.0E-4F));
+					num_hits++;
+				}
+			}
+		}
+	}
+
+	CHECK(num_hits > 100);
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/rigid_bodyf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+TEST_CASE("quatf integrate", "[math][quat][rigid_body]")
+{
+	const float threshold = 1.0E-5F;
+	const vector4f z_axis = vector_set(0.0F, 0.0F, 1.0F);
+	const float half_pi = rtm::constants::half_pi();
+
+	{
+		// A constant angular velocity integrates exactly regardless of the number of steps
+		quatf rotation = quat_identity();
+		for (uint32_t step_index = 0; step_index < 10; ++step_index)
+			rotation = quat_integrate(rotation, vector_mul(z_axis, half_pi), 0.1F);
+
+		CHECK(quat_near_equal(rotation, quat_from_axis_angle(z_axis, half_pi), threshold));
+	}
+
+	{
+		const quatf rotation = quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), 0.5F);
+		CHECK(quat_near_equal(quat_integrate(rotation, vector_zero(), 0.1F), rotation, threshold));
+		CHECK(quat_near_equal(quat_integrate(rotation, vector_set(1.0E-6F, 0.0F, 0.0F), 0.1F), rotation, threshold));
+
+		// The angular velocity is in world space, it applies after the current rotation
+		const vector4f angular_velocity = vector_set(0.0F, 2.0F, 0.0F);
+		const quatf expected = quat_mul(rotation, quat_from_axis_angle(vector_set(0.0F, 1.0F, 0.0F), 0.2F));
+		CHECK(quat_near_equal(quat_integrate(rotation, angular_velocity, 0.1F), expected, threshold));
+	}
+
+	{
+		// A negative time step rotates backwards and must not use the small angle approximation
+		const quatf rotation = quat_integrate(quat_identity(), vector_mul(z_axis, 3.0F), -0.5F);
+		CHECK(quat_near_equal(rotation, quat_from_axis_angle(z_axis, -1.5F), threshold));
+	}
+}
+
+TEST_CASE("rigid body integrate", "[math][rigid_body]")
+{
+	const float threshold = 1.0E-5F;
+
+	// 3 groups of 4 and 3 single bodies to exercise every path
+	constexpr uint32_t num_bodies = 15;
+	float state[13][num_bodies];
+	float expected[13][num_bodies];
+
+	uint32_t seed = 12345;
+	for (uint32_t component_index = 0; component_index < 13; ++component_index)
+	{
+		for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+		{
+			seed = seed * 1664525 + 1013904223;
+			state[component_index][body_index] = float(seed % 2000) / 100.0F - 10.0F;
+		}
+	}
+
+	rigid_bodies_soaf bodies;
+	bodies.position_x = state[0];
+	bodies.position_y = state[1];
+	bodies.position_z = state[2];
+	bodies.rotation_x = state[3];
+	bodies.rotation_y = state[4];
+	bodies.rotation_z = state[5];
+	bodies.rotation_w = state[6];
+	bodies.linear_velocity_x = state[7];
+	bodies.linear_velocity_y = state[8];
+	bodies.linear_velocity_z = state[9];
+	bodies.angular_velocity_x = state[10];
+	bodies.angular_velocity_y = state[11];
+	bodies.angular_velocity_z = state[12];
+
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		const quatf rotation = quat_normalize(quat_set(state[3][body_index], state[4][body_index], state[5][body_index], state[6][body_index]));
+		state[3][body_index] = quat_get_x(rotation);
+		state[4][body_index] = quat_get_y(rotation);
+		state[5][body_index] = quat_get_z(rotation);
+		state[6][body_index] = quat_get_w(rotation);
+	}
+
+	// The first group is fully asleep, a few bodies sleep in the other groups
+	const uint32_t sleep_bits[1] = { 0x000F | (1 << 5) | (1 << 9) | (1 << 13) };
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (uint32_t component_index = 0; component_index < 13; ++component_index)
+		for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+			expected[component_index][body_index] = state[component_index][body_index];
+
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		if ((sleep_bits[0] >> body_index) & 1)
+			continue;
+
+		const vector4f position = vector_set(state[0][body_index], state[1][body_index], state[2][body_index]);
+		const quatf rotation = quat_set(state[3][body_index], state[4][body_index], state[5][body_index], state[6][body_index]);
+		const vector4f linear_velocity = vector_set(state[7][body_index], state[8][body_index], state[9][body_index]);
+		const vector4f angular_velocity = vector_set(state[10][body_index], state[11][body_index], state[12][body_index]);
+
+		const vector4f new_linear_velocity = vector_add(linear_velocity, vector_mul(gravity, delta_time));
+		const vector4f new_position = vector_add(position, vector_mul(new_linear_velocity, delta_time));
+		const quatf new_rotation = quat_integrate(rotation, angular_velocity, delta_time);
+
+		expected[0][body_index] = vector_get_x(new_position);
+		expected[1][body_index] = vector_get_y(new_position);
+		expected[2][body_index] = vector_get_z(new_position);
+		expected[3][body_index] = quat_get_x(new_rotation);
+		expected[4][body_index] = quat_get_y(new_rotation);
+		expected[5][body_index] = quat_get_z(new_rotation);
+		expected[6][body_index] = quat_get_w(new_rotation);
+		expected[7][body_index] = vector_get_x(new_linear_velocity);
+		expected[8][body_index] = vector_get_y(new_linear_velocity);
+		expected[9][body_index] = vector_get_z(new_linear_velocity);
+	}
+
+	rigid_body_integrate(bodies, num_bodies, gravity, delta_time, sleep_bits);
+
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		const bool is_sleeping = ((sleep_bits[0] >> body_index) & 1) != 0;
+		for (uint32_t component_index = 0; component_index < 13; ++component_index)
+		{
+			if (is_sleeping)
+				CHECK(state[component_index][body_index] == expected[component_index][body_index]);
+			else
+				CHECK(scalar_near_equal(state[component_index][body_index], expected[component_index][body_index], threshold));
+		}
+	}
+
+	// Without sleep bits, every body is integrated
+	const float old_position_z = state[2][0];
+	rigid_body_integrate(bodies, num_bodies, gravity, delta_time);
+	CHECK(state[2][0] != old_position_z);
+
+	// A negative time step rotates backwards and must not use the small angle approximation
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		state[3][body_index] = 0.0F;
+		state[4][body_index] = 0.0F;
+		state[5][body_index] = 0.0F;
+		state[6][body_index] = 1.0F;
+		state[10][body_index] = 0.0F;
+		state[11][body_index] = 0.0F;
+		state[12][body_index] = 3.0F;
+	}
+
+	rigid_body_integrate(bodies, num_bodies, gravity, -0.5F);
+
+	const quatf expected_rotation = quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), -1.5F);
+	for (uint32_t body_index = 0; body_index < num_bodies; ++body_index)
+	{
+		const quatf rotation = quat_set(state[3][body_index], state[4][body_index], state[5][body_index], state[6][body_index]);
+		CHECK(quat_near_equal(rotation, expected_rotation, threshold));
+	}
+}
@@ -500,3 +500,33 @@ TEST_CASE("scalard math", "[math][scalar]")
 	CHECK(scalar_cast(scalar_round_bankers(scalar_set(36028797018963968.5))) == 36028797018963968.5);
 	CHECK(scalar_cast(scalar_round_bankers(scalar_set(-36028797018963968.5))) == -36028797018963968.5);
 }
+
+TEST_CASE("scalarf approximate math", "[math][scalar]")
+{
+	// Relative error bounds documented for the hardware estimates
+#if defined(RTM_NEON_INTRINSICS)
+	const double approx_threshold = 1.0 / 256.0;
+	const double nr1_threshold = 3.0E-5;
+#else
+	const double approx_threshold = 1.5 / 4096.0;
+	const double nr1_threshold = 1.0E-6;
+#endif
+
+	for (float value = 1.0E-3F; value < 1.0E3F; value *= 1.0371F)
+	{
+		const double reference_rcp = 1.0 / double(value);
+		const double reference_rsqrt = 1.0 / std::sqrt(double(value));
+
+		CHECK(scalar_abs(double(scalar_reciprocal_approx(value)) / reference_rcp - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(scalar_reciprocal_approx(-value)) / -reference_rcp - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(scalar_reciprocal_nr1(value)) / reference_rcp - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(scalar_reciprocal_nr1(-value)) / -reference_rcp - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(scalar_cast(scalar_reciprocal_approx(scalar_set(value)))) / reference_rcp - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(scalar_cast(scalar_reciprocal_nr1(scalar_set(value)))) / reference_rcp - 1.0) <= nr1_threshold);
+
+		CHECK(scalar_abs(double(scalar_sqrt_reciprocal_approx(value)) / reference_rsqrt - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(scalar_sqrt_reciprocal_nr1(value)) / reference_rsqrt - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(scalar_cast(scalar_sqrt_reciprocal_approx(scalar_set(value)))) / reference_rsqrt - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(scalar_cast(scalar_sqrt_reciprocal_nr1(scalar_set(value)))) / reference_rsqrt - 1.0) <= nr1_threshold);
+	}
+}
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/skinningf.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static void setup_skinning_palette(matrix3x4f* palette, uint32_t num_bones)
+{
+	for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const float angle = float(bone_index) * 11.0F;
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(angle), scalar_deg_to_rad(angle * 0.5F), scalar_deg_to_rad(-angle));
+		const vector4f translation = vector_set(float(bone_index), float(bone_index) * -2.0F, 0.5F);
+		const vector4f scale = vector_set(1.0F + float(bone_index) * 0.1F);
+		palette[bone_index] = matrix_from_qvv(rotation, translation, scale);
+	}
+}
+
+template<uint32_t num_influences, typename weight_type>
+static void test_skinning_impl(const weight_type* bone_weights, const float* bone_weights_flt)
+{
+	constexpr uint32_t num_bones = 16;
+	constexpr uint32_t num_vertices = 5;
+	const float threshold = 1.0E-4F;
+
+	matrix3x4f palette[num_bones];
+	setup_skinning_palette(palette, num_bones);
+
+	uint16_t bone_indices[num_vertices * num_influences];
+	for (uint32_t index = 0; index < num_vertices * num_influences; ++index)
+		bone_indices[index] = uint16_t((index * 7) % num_bones);
+
+	float3f positions[num_vertices];
+	float3f normals[num_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const float value = float(vertex_index);
+		vector_store3(vector_set(value, 1.0F - value, value * 2.0F), &positions[vertex_index]);
+		vector_store3(vector_normalize3(vector_set(1.0F, value, 0.5F)), &normals[vertex_index]);
+	}
+
+	float3f skinned_positions[num_vertices];
+	float3f skinned_normals[num_vertices];
+	skin_positions_normals<num_influences>(palette, bone_indices, bone_weights, positions, normals, skinned_positions, skinned_normals, num_vertices);
+
+	float3f skinned_positions_only[num_vertices];
+	skin_positions<num_influences>(palette, bone_indices, bone_weights, positions, skinned_positions_only, num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const vector4f position = vector_load3(&positions[vertex_index]);
+		const vector4f normal = vector_load3(&normals[vertex_index]);
+
+		// Reference: transform by every influence and blend the results
+		vector4f ref_position = vector_zero();
+		vector4f ref_normal = vector_zero();
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+		{
+			const uint32_t offset = vertex_index * num_influences + influence_index;
+			const float weight = num_influences == 1 ? 1.0F : bone_weights_flt[offset];
+			const matrix3x4f& mtx = palette[bone_indices[offset]];
+
+			ref_position = vector_mul_add(matrix_mul_point3(position, mtx), weight, ref_position);
+			ref_normal = vector_mul_add(matrix_mul_vector3(normal, mtx), weight, ref_normal);
+		}
+
+		ref_normal = vector_normalize3(ref_normal);
+
+		CHECK(vector_all_near_equal3(ref_position, vector_load3(&skinned_positions[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(ref_position, vector_load3(&skinned_positions_only[vertex_index]), threshold));
+		CHECK(vector_all_near_equal3(ref_normal, vector_load3(&skinned_normals[vertex_index]), threshold));
+	}
+
+	// In place skinning
+	skin_positions<num_influences>(palette, bone_indices, bone_weights, positions, positions, num_vertices);
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		CHECK(vector_all_near_equal3(vector_load3(&skinned_positions[vertex_index]), vector_load3(&positions[vertex_index]), threshold));
+}
+
+template<uint32_t num_influences>
+static void test_skinning()
+{
+	constexpr uint32_t num_vertices = 5;
+
+	float weights_flt[num_vertices * num_influences];
+	uint8_t weights_u8[num_vertices * num_influences];
+	float weights_u8_flt[num_vertices * num_influences];
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		// Build weights that sum to 255 and normalize them for the float variant
+		uint32_t remaining = 255;
+		for (uint32_t influence_index = 0; influence_index < num_influences; ++influence_index)
+		{
+			const uint32_t offset = vertex_index * num_influences + influence_index;
+			const bool is_last = influence_index == num_influences - 1;
+			const uint32_t weight = is_last ? remaining : ((remaining * (vertex_index + 1)) / (vertex_index + 3));
+			remaining -= weight;
+
+			weights_u8[offset] = uint8_t(weight);
+			weights_u8_flt[offset] = float(weight) / 255.0F;
+			weights_flt[offset] = float(weight) / 255.0F;
+		}
+	}
+
+	test_skinning_impl<num_influences>(weights_flt, weights_flt);
+	test_skinning_impl<num_influences>(weights_u8, weights_u8_flt);
+}
+
+TEST_CASE("skinning", "[math][skinning]")
+{
+	test_skinning<1>();
+	test_skinning<2>();
+	test_skinning<4>();
+	test_skinning<8>();
+
+	{
+		matrix3x4f palette[4];
+		setup_skinning_palette(palette, 4);
+
+		const uint32_t bone_indices[2] = { 1, 3 };
+		const float bone_weights[2] = { 0.25F, 0.75F };
+		const matrix3x4f blended = matrix_blend<2>(palette, bone_indices, bone_weights);
+
+		const float threshold = 1.0E-5F;
+		CHECK(vector_all_near_equal(vector_add(vector_mul(palette[1].x_axis, 0.25F), vector_mul(palette[3].x_axis, 0.75F)), blended.x_axis, threshold));
+		CHECK(vector_all_near_equal(vector_add(vector_mul(palette[1].y_axis, 0.25F), vector_mul(palette[3].y_axis, 0.75F)), blended.y_axis, threshold));
+		CHECK(vector_all_near_equal(vector_add(vector_mul(palette[1].z_axis, 0.25F), vector_mul(palette[3].z_axis, 0.75F)), blended.z_axis, threshold));
+		CHECK(vector_all_near_equal(vector_add(vector_mul(palette[1].w_axis, 0.25F), vector_mul(palette[3].w_axis, 0.75F)), blended.w_axis, threshold));
+	}
+}
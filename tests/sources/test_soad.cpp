@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quatd.h>
+#include <rtm/qvvd.h>
+#include <rtm/soad.h>
+#include <rtm/vector4d.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+namespace
+{
+	// Enough entries for a partial group to remain after the SIMD lanes:
+	// 4 + 3 with AVX, 2 + 2 + 2 + 1 with SSE2, and one at a time without intrinsics
+	constexpr uint32_t k_num_entries = 7;
+
+	struct soad_test_data
+	{
+		double components[30][k_num_entries];
+
+		soad_test_data()
+		{
+			uint32_t seed = 12345;
+			for (auto& component : components)
+			{
+				for (double& value : component)
+				{
+					seed = seed * 1664525 + 1013904223;
+					value = double(seed % 2000) / 100.0 - 10.0;
+				}
+			}
+
+			for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+			{
+				store_quat(quat_normalize(load_quat(0, entry_index)), 0, entry_index);
+				store_quat(quat_normalize(load_quat(4, entry_index)), 4, entry_index);
+
+				for (uint32_t component_index = 8; component_index < 14; ++component_index)
+					components[component_index][entry_index] = scalar_abs(components[component_index][entry_index]) + 0.5;
+			}
+		}
+
+		vector3d_soa vector3(uint32_t offset) { return vector3d_soa{ components[offset], components[offset + 1], components[offset + 2] }; }
+		quatd_soa quat(uint32_t offset) { return quatd_soa{ components[offset], components[offset + 1], components[offset + 2], components[offset + 3] }; }
+
+		vector4d load_vector3(uint32_t offset, uint32_t entry_index) const { return vector_set(components[offset][entry_index], components[offset + 1][entry_index], components[offset + 2][entry_index]); }
+		quatd load_quat(uint32_t offset, uint32_t entry_index) const { return quat_set(components[offset][entry_index], components[offset + 1][entry_index], components[offset + 2][entry_index], components[offset + 3][entry_index]); }
+
+		void store_quat(const quatd& input, uint32_t offset, uint32_t entry_index)
+		{
+			components[offset][entry_index] = quat_get_x(input);
+			components[offset + 1][entry_index] = quat_get_y(input);
+			components[offset + 2][entry_index] = quat_get_z(input);
+			components[offset + 3][entry_index] = quat_get_w(input);
+		}
+	};
+}
+
+TEST_CASE("soad vector math", "[math][vector4][soa]")
+{
+	const double threshold = 1.0E-9;
+
+	soad_test_data data;
+	const vector3d_soa v0 = data.vector3(14);
+	const vector3d_soa v1 = data.vector3(17);
+	const vector3d_soa v2 = data.vector3(20);
+	const vector3d_soa out = data.vector3(23);
+
+	vector_mul_add(v0, v1, v2, k_num_entries, out);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(vector_all_near_equal3(data.load_vector3(23, entry_index), vector_mul_add(data.load_vector3(14, entry_index), data.load_vector3(17, entry_index), data.load_vector3(20, entry_index)), threshold));
+
+	vector_cross3(v0, v1, k_num_entries, out);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(vector_all_near_equal3(data.load_vector3(23, entry_index), vector_cross3(data.load_vector3(14, entry_index), data.load_vector3(17, entry_index)), threshold));
+
+	double dots[k_num_entries];
+	vector_dot3(v0, v1, k_num_entries, dots);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(scalar_near_equal(dots[entry_index], double(vector_dot3(data.load_vector3(14, entry_index), data.load_vector3(17, entry_index))), threshold));
+
+	// The output can alias an input
+	vector_cross3(v0, v1, k_num_entries, v0);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(vector_all_near_equal3(data.load_vector3(14, entry_index), data.load_vector3(23, entry_index), 0.0));
+}
+
+TEST_CASE("soad quat math", "[math][quat][soa]")
+{
+	const double threshold = 1.0E-9;
+
+	soad_test_data data;
+	const quatd_soa lhs = data.quat(0);
+	const quatd_soa rhs = data.quat(4);
+	const quatd_soa out_rotations = data.quat(20);
+	const vector3d_soa vectors = data.vector3(14);
+	const vector3d_soa out_vectors = data.vector3(24);
+
+	quat_mul(lhs, rhs, k_num_entries, out_rotations);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(quat_near_equal(data.load_quat(20, entry_index), quat_mul(data.load_quat(0, entry_index), data.load_quat(4, entry_index)), threshold));
+
+	quat_mul_vector3(vectors, lhs, k_num_entries, out_vectors);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+		CHECK(vector_all_near_equal3(data.load_vector3(24, entry_index), quat_mul_vector3(data.load_vector3(14, entry_index), data.load_quat(0, entry_index)), threshold));
+}
+
+TEST_CASE("soad qvv math", "[math][qvv][soa]")
+{
+	const double threshold = 1.0E-9;
+
+	soad_test_data data;
+
+	// Negative scale in the first group and the remainder falls back to qvv_mul(..)
+	data.components[9][1] = -data.components[9][1];
+	data.components[13][6] = -data.components[13][6];
+
+	const qvvd_soa lhs{ data.quat(0), data.vector3(14), data.vector3(8) };
+	const qvvd_soa rhs{ data.quat(4), data.vector3(17), data.vector3(11) };
+	const qvvd_soa out{ data.quat(20), data.vector3(24), data.vector3(27) };
+
+	qvvd expected[k_num_entries];
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+	{
+		const qvvd lhs_qvv = qvv_set(data.load_quat(0, entry_index), data.load_vector3(14, entry_index), data.load_vector3(8, entry_index));
+		const qvvd rhs_qvv = qvv_set(data.load_quat(4, entry_index), data.load_vector3(17, entry_index), data.load_vector3(11, entry_index));
+		expected[entry_index] = qvv_mul(lhs_qvv, rhs_qvv);
+	}
+
+	qvv_mul(lhs, rhs, k_num_entries, out);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+	{
+		CHECK(quat_near_equal(data.load_quat(20, entry_index), expected[entry_index].rotation, threshold));
+		CHECK(vector_all_near_equal3(data.load_vector3(24, entry_index), expected[entry_index].translation, threshold));
+		CHECK(vector_all_near_equal3(data.load_vector3(27, entry_index), expected[entry_index].scale, threshold));
+	}
+
+	// The output can alias an input
+	qvv_mul(lhs, rhs, k_num_entries, lhs);
+	for (uint32_t entry_index = 0; entry_index < k_num_entries; ++entry_index)
+	{
+		CHECK(quat_near_equal(data.load_quat(0, entry_index), expected[entry_index].rotation, threshold));
+		CHECK(vector_all_near_equal3(data.load_vector3(14, entry_index), expected[entry_index].translation, threshold));
+		CHECK(vector_all_near_equal3(data.load_vector3(8, entry_index), expected[entry_index].scale, threshold));
+	}
+}
@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/spatial_hashf.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector4i.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Interleaves one bit at a time, the textbook definition of a Morton code
+static uint64_t morton_encode_reference(const uint32_t* coords, uint32_t num_axes, uint32_t num_bits)
+{
+	uint64_t code = 0;
+	for (uint32_t bit_index = 0; bit_index < num_bits; ++bit_index)
+	{
+		for (uint32_t axis_index = 0; axis_index < num_axes; ++axis_index)
+			code |= uint64_t((coords[axis_index] >> bit_index) & 1) << (bit_index * num_axes + axis_index);
+	}
+
+	return code;
+}
+
+static uint32_t next_random(uint32_t& seed)
+{
+	seed = seed * 1664525 + 1013904223;
+	return seed;
+}
+
+static uint32_t quantize_reference(float value, float origin, float scale, float max_value)
+{
+	return uint32_t(scalar_clamp((value - origin) * scale, 0.0F, max_value));
+}
+
+TEST_CASE("morton scalar", "[math][spatial_hash]")
+{
+	CHECK(morton_encode2(0, 0) == 0);
+	CHECK(morton_encode2(1, 0) == 1);
+	CHECK(morton_encode2(0, 1) == 2);
+	CHECK(morton_encode2(0xFFFF, 0xFFFF) == 0xFFFFFFFFU);
+	CHECK(morton_encode3(1, 0, 0) == 1);
+	CHECK(morton_encode3(0, 1, 0) == 2);
+	CHECK(morton_encode3(0, 0, 1) == 4);
+	CHECK(morton_encode3(1023, 1023, 1023) == 0x3FFFFFFFU);
+	CHECK(morton_encode3_64(0x1FFFFF, 0x1FFFFF, 0x1FFFFF) == 0x7FFFFFFFFFFFFFFFULL);
+
+	uint32_t seed = 12345;
+	for (uint32_t iteration = 0; iteration < 1000; ++iteration)
+	{
+		const uint32_t x = next_random(seed);
+		const uint32_t y = next_random(seed);
+		const uint32_t z = next_random(seed);
+
+		// Upper bits are ignored
+		const uint32_t coords16[2] = { x & 0xFFFF, y & 0xFFFF };
+		const uint32_t coords10[3] = { x & 0x3FF, y & 0x3FF, z & 0x3FF };
+		const uint32_t coords21[3] = { x & 0x1FFFFF, y & 0x1FFFFF, z & 0x1FFFFF };
+
+		const uint32_t code2 = morton_encode2(x, y);
+		const uint32_t code3 = morton_encode3(x, y, z);
+		const uint64_t code3_64 = morton_encode3_64(x, y, z);
+		CHECK(code2 == morton_encode_reference(coords16, 2, 16));
+		CHECK(code3 == morton_encode_reference(coords10, 3, 10));
+		CHECK(code3_64 == morton_encode_reference(coords21, 3, 21));
+
+		uint32_t decoded_x;
+		uint32_t decoded_y;
+		uint32_t decoded_z;
+		morton_decode2(code2, decoded_x, decoded_y);
+		CHECK(decoded_x == coords16[0]);
+		CHECK(decoded_y == coords16[1]);
+
+		morton_decode3(code3, decoded_x, decoded_y, decoded_z);
+		CHECK(decoded_x == coords10[0]);
+		CHECK(decoded_y == coords10[1]);
+		CHECK(decoded_z == coords10[2]);
+
+		morton_decode3_64(code3_64, decoded_x, decoded_y, decoded_z);
+		CHECK(decoded_x == coords21[0]);
+		CHECK(decoded_y == coords21[1]);
+		CHECK(decoded_z == coords21[2]);
+	}
+}
+
+TEST_CASE("morton vector4i", "[math][spatial_hash]")
+{
+	uint32_t seed = 5678;
+	for (uint32_t iteration = 0; iteration < 1000; ++iteration)
+	{
+		uint32_t x[4];
+		uint32_t y[4];
+		uint32_t z[4];
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+		{
+			x[lane_index] = next_random(seed);
+			y[lane_index] = next_random(seed);
+			z[lane_index] = next_random(seed);
+		}
+
+		const vector4i xxxx = vector_load(reinterpret_cast<const int32_t*>(&x[0]));
+		const vector4i yyyy = vector_load(reinterpret_cast<const int32_t*>(&y[0]));
+		const vector4i zzzz = vector_load(reinterpret_cast<const int32_t*>(&z[0]));
+
+		uint32_t codes2[4];
+		uint32_t codes3[4];
+		vector_store(morton_encode2(xxxx, yyyy), reinterpret_cast<int32_t*>(&codes2[0]));
+		vector_store(morton_encode3(xxxx, yyyy, zzzz), reinterpret_cast<int32_t*>(&codes3[0]));
+
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+		{
+			CHECK(codes2[lane_index] == morton_encode2(x[lane_index], y[lane_index]));
+			CHECK(codes3[lane_index] == morton_encode3(x[lane_index], y[lane_index], z[lane_index]));
+		}
+
+		vector4i decoded_x;
+		vector4i decoded_y;
+		vector4i decoded_z;
+		morton_decode2(vector_load(reinterpret_cast<const int32_t*>(&codes2[0])), decoded_x, decoded_y);
+		CHECK(vector_get_x(decoded_x) == int32_t(x[0] & 0xFFFF));
+		CHECK(vector_get_y(decoded_x) == int32_t(x[1] & 0xFFFF));
+		CHECK(vector_get_z(decoded_y) == int32_t(y[2] & 0xFFFF));
+		CHECK(vector_get_w(decoded_y) == int32_t(y[3] & 0xFFFF));
+
+		morton_decode3(vector_load(reinterpret_cast<const int32_t*>(&codes3[0])), decoded_x, decoded_y, decoded_z);
+		CHECK(vector_get_x(decoded_x) == int32_t(x[0] & 0x3FF));
+		CHECK(vector_get_y(decoded_y) == int32_t(y[1] & 0x3FF));
+		CHECK(vector_get_z(decoded_z) == int32_t(z[2] & 0x3FF));
+		CHECK(vector_get_w(decoded_z) == int32_t(z[3] & 0x3FF));
+	}
+}
+
+TEST_CASE("morton batch", "[math][spatial_hash]")
+{
+	// 4 full groups and a remainder, with points outside the grid to test clamping
+	constexpr uint32_t k_num_points = 19;
+	vector4f points[k_num_points];
+
+	uint32_t seed = 42;
+	for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+	{
+		const float x = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 24.0F - 12.0F;
+		const float y = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 24.0F - 12.0F;
+		const float z = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 24.0F - 12.0F;
+		points[point_index] = vector_set(x, y, z, 1.0F);
+	}
+
+	const vector4f aabb_min = vector_set(-10.0F, -8.0F, -10.0F);
+	const vector4f aabb_max = vector_set(10.0F, 8.0F, 12.0F);
+	const vector4f extent = vector_sub(aabb_max, aabb_min);
+
+	{
+		const vector4f scale = vector_div(vector_set(65536.0F), extent);
+
+		uint32_t codes[k_num_points];
+		morton_encode2(points, k_num_points, aabb_min, scale, codes);
+
+		for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+		{
+			const float x = vector_get_x(points[point_index]);
+			const float y = vector_get_y(points[point_index]);
+			const uint32_t cell_x = quantize_reference(x, -10.0F, vector_get_x(scale), 65535.0F);
+			const uint32_t cell_y = quantize_reference(y, -8.0F, vector_get_y(scale), 65535.0F);
+			CHECK(codes[point_index] == morton_encode2(cell_x, cell_y));
+		}
+	}
+
+	{
+		const vector4f scale = vector_div(vector_set(1024.0F), extent);
+
+		uint32_t codes[k_num_points];
+		morton_encode3(points, k_num_points, aabb_min, scale, codes);
+
+		for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+		{
+			const float x = vector_get_x(points[point_index]);
+			const float y = vector_get_y(points[point_index]);
+			const float z = vector_get_z(points[point_index]);
+			const uint32_t cell_x = quantize_reference(x, -10.0F, vector_get_x(scale), 1023.0F);
+			const uint32_t cell_y = quantize_reference(y, -8.0F, vector_get_y(scale), 1023.0F);
+			const uint32_t cell_z = quantize_reference(z, -10.0F, vector_get_z(scale), 1023.0F);
+			CHECK(codes[point_index] == morton_encode3(cell_x, cell_y, cell_z));
+		}
+	}
+
+	{
+		const vector4f scale = vector_div(vector_set(2097152.0F), extent);
+
+		uint64_t codes[k_num_points];
+		morton_encode3_64(points, k_num_points, aabb_min, scale, codes);
+
+		for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+		{
+			const float x = vector_get_x(points[point_index]);
+			const float y = vector_get_y(points[point_index]);
+			const float z = vector_get_z(points[point_index]);
+			const uint32_t cell_x = quantize_reference(x, -10.0F, vector_get_x(scale), 2097151.0F);
+			const uint32_t cell_y = quantize_reference(y, -8.0F, vector_get_y(scale), 2097151.0F);
+			const uint32_t cell_z = quantize_reference(z, -10.0F, vector_get_z(scale), 2097151.0F);
+			CHECK(codes[point_index] == morton_encode3_64(cell_x, cell_y, cell_z));
+		}
+	}
+
+	// The corners of the grid map to the first and last codes
+	const vector4f corners[2] = { aabb_min, aabb_max };
+	uint32_t corner_codes[2];
+	morton_encode3(corners, 2, aabb_min, vector_div(vector_set(1024.0F), extent), corner_codes);
+	CHECK(corner_codes[0] == 0);
+	CHECK(corner_codes[1] == 0x3FFFFFFFU);
+}
+
+TEST_CASE("grid hash", "[math][spatial_hash]")
+{
+	CHECK(grid_hash3(0, 0, 0) == 0);
+	CHECK(grid_hash3(1, 0, 0) == 73856093U);
+	CHECK(grid_hash3(-1, 0, 0) == 0U - 73856093U);
+
+	const vector4i hashes = grid_hash3(vector_set_i32(1, -1, 7, -300), vector_set_i32(2, -5, 0, 11), vector_set_i32(3, 9, -2, 123456));
+	CHECK(uint32_t(vector_get_x(hashes)) == grid_hash3(1, 2, 3));
+	CHECK(uint32_t(vector_get_y(hashes)) == grid_hash3(-1, -5, 9));
+	CHECK(uint32_t(vector_get_z(hashes)) == grid_hash3(7, 0, -2));
+	CHECK(uint32_t(vector_get_w(hashes)) == grid_hash3(-300, 11, 123456));
+
+	constexpr uint32_t k_num_points = 11;
+	vector4f points[k_num_points];
+
+	uint32_t seed = 7;
+	for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+	{
+		const float x = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 200.0F - 100.0F;
+		const float y = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 200.0F - 100.0F;
+		const float z = float(next_random(seed) >> 8) * (1.0F / 16777216.0F) * 200.0F - 100.0F;
+		points[point_index] = vector_set(x, y, z, 0.0F);
+	}
+
+	const float inv_cell_size = 1.0F / 2.5F;
+
+	uint32_t batch_hashes[k_num_points];
+	grid_hash3(points, k_num_points, vector_set(inv_cell_size), batch_hashes);
+
+	for (uint32_t point_index = 0; point_index < k_num_points; ++point_index)
+	{
+		const int32_t cell_x = int32_t(scalar_floor(float(vector_get_x(points[point_index])) * inv_cell_size));
+		const int32_t cell_y = int32_t(scalar_floor(float(vector_get_y(points[point_index])) * inv_cell_size));
+		const int32_t cell_z = int32_t(scalar_floor(float(vector_get_z(points[point_index])) * inv_cell_size));
+		CHECK(batch_hashes[point_index] == grid_hash3(cell_x, cell_y, cell_z));
+	}
+}
@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/spheref.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+TEST_CASE("spheref math", "[math][sphere]")
+{
+	const float threshold = 1.0E-4F;
+
+	{
+		const spheref sphere = sphere_set(vector_set(1.0F, 2.0F, 3.0F), 2.0F);
+		CHECK(vector_all_near_equal3(sphere_get_center(sphere), vector_set(1.0F, 2.0F, 3.0F), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(sphere), 2.0F, threshold));
+
+		CHECK(sphere_contains_point(sphere, vector_set(1.0F, 2.0F, 3.0F)));
+		CHECK(sphere_contains_point(sphere, vector_set(3.0F, 2.0F, 3.0F)));
+		CHECK(!sphere_contains_point(sphere, vector_set(2.5F, 3.5F, 3.0F)));
+
+		CHECK(sphere_intersects(sphere, sphere_set(vector_set(4.0F, 2.0F, 3.0F), 1.5F)));
+		CHECK(!sphere_intersects(sphere, sphere_set(vector_set(4.0F, 2.0F, 3.0F), 0.5F)));
+
+		const spheref from_aabb = sphere_from_aabb(aabb_set(vector_set(1.0F, 2.0F, 3.0F), vector_set(1.0F, 2.0F, 2.0F)));
+		CHECK(vector_all_near_equal3(sphere_get_center(from_aabb), vector_set(1.0F, 2.0F, 3.0F), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(from_aabb), 3.0F, threshold));
+	}
+
+	{
+		const float3f points[5] = { { 1.0F, 2.0F, 3.0F }, { -4.0F, 5.0F, 0.0F }, { 0.0F, -1.0F, 7.0F }, { 2.0F, 2.0F, 2.0F }, { 0.5F, 8.0F, -3.0F } };
+		const spheref sphere = sphere_from_points(points, 5);
+
+		CHECK(vector_all_near_equal3(sphere_get_center(sphere), vector_set(-1.0F, 3.5F, 2.0F), threshold));
+		for (uint32_t point_index = 0; point_index < 5; ++point_index)
+			CHECK(sphere_contains_point(sphere, vector_mul(vector_load3(points + point_index), 0.999F)));
+
+		// The furthest point lies on the surface
+		CHECK(scalar_near_equal(sphere_get_radius(sphere), vector_length3(vector_sub(vector_set(0.5F, 8.0F, -3.0F), vector_set(-1.0F, 3.5F, 2.0F))), threshold));
+	}
+
+	{
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-50.0F), scalar_deg_to_rad(125.0F));
+		const matrix3x4f transform = matrix_from_qvv(rotation, vector_set(1.0F, -2.0F, 3.5F), vector_set(1.5F, 0.5F, 2.0F));
+
+		spheref spheres[7];
+		for (uint32_t sphere_index = 0; sphere_index < 7; ++sphere_index)
+		{
+			const float value = float(sphere_index);
+			spheres[sphere_index] = sphere_set(vector_set(value, -value, value * 0.5F), 1.0F + value);
+		}
+
+		spheref transformed[7];
+		sphere_transform(transform, spheres, transformed, 7);
+
+		for (uint32_t sphere_index = 0; sphere_index < 7; ++sphere_index)
+		{
+			const vector4f expected_center = matrix_mul_point3(sphere_get_center(spheres[sphere_index]), transform);
+			const float expected_radius = sphere_get_radius(spheres[sphere_index]) * 2.0F;
+
+			const spheref single = sphere_transform(spheres[sphere_index], transform);
+			CHECK(vector_all_near_equal3(expected_center, sphere_get_center(single), threshold));
+			CHECK(scalar_near_equal(expected_radius, sphere_get_radius(single), threshold));
+			CHECK(vector_all_near_equal3(expected_center, sphere_get_center(transformed[sphere_index]), threshold));
+			CHECK(scalar_near_equal(expected_radius, sphere_get_radius(transformed[sphere_index]), threshold));
+		}
+	}
+
+	{
+		// A unit cube centered at the origin: planes point inwards
+		const vector4f planes[6] =
+		{
+			vector_set(1.0F, 0.0F, 0.0F, 1.0F),
+			vector_set(-1.0F, 0.0F, 0.0F, 1.0F),
+			vector_set(0.0F, 1.0F, 0.0F, 1.0F),
+			vector_set(0.0F, -1.0F, 0.0F, 1.0F),
+			vector_set(0.0F, 0.0F, 1.0F, 1.0F),
+			vector_set(0.0F, 0.0F, -1.0F, 1.0F),
+		};
+
+		const spheref spheres[6] =
+		{
+			sphere_set(vector_zero(), 0.5F),						// Inside
+			sphere_set(vector_set(1.2F, 0.0F, 0.0F), 0.5F),			// Intersecting
+			sphere_set(vector_set(1.6F, 0.0F, 0.0F), 0.5F),			// Outside
+			sphere_set(vector_set(0.0F, -3.0F, 0.0F), 2.0F),		// Touching
+			sphere_set(vector_set(0.0F, 0.0F, 4.0F), 2.0F),			// Outside
+			sphere_set(vector_zero(), 10.0F),						// Contains the volume
+		};
+		const bool expected[6] = { true, true, false, true, false, true };
+
+		bool results[6];
+		sphere_intersects_planes(planes, 6, spheres, results, 6);
+
+		for (uint32_t sphere_index = 0; sphere_index < 6; ++sphere_index)
+		{
+			CHECK(sphere_intersects_planes(spheres[sphere_index], planes, 6) == expected[sphere_index]);
+			CHECK(results[sphere_index] == expected[sphere_index]);
+		}
+	}
+}
@@ -450,6 +450,11 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	CHECK(scalar_near_equal(vector_get_z(vector_reciprocal(test_value0)), scalar_reciprocal(test_value0_flt[2]), threshold));
 	CHECK(scalar_near_equal(vector_get_w(vector_reciprocal(test_value0)), scalar_reciprocal(test_value0_flt[3]), threshold));
 
+	CHECK(scalar_near_equal(vector_get_x(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[0])), threshold));
+	CHECK(scalar_near_equal(vector_get_y(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[1])), threshold));
+	CHECK(scalar_near_equal(vector_get_z(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[2])), threshold));
+	CHECK(scalar_near_equal(vector_get_w(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[3])), threshold));
+
 	CHECK(FloatType(vector_get_x(vector_floor(test_value0))) == scalar_floor(test_value0_flt[0]));
 	CHECK(FloatType(vector_get_y(vector_floor(test_value0))) == scalar_floor(test_value0_flt[1]));
 	CHECK(FloatType(vector_get_z(vector_floor(test_value0))) == scalar_floor(test_value0_flt[2]));
@@ -495,6 +500,44 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	const FloatType test_value11_flt[4] = { FloatType(0.1138), FloatType(-0.623), FloatType(1.4598), FloatType(-0.5671) };
 	const Vector4Type test_value10 = vector_set(test_value10_flt[0], test_value10_flt[1], test_value10_flt[2], test_value10_flt[3]);
 	const Vector4Type test_value11 = vector_set(test_value11_flt[0], test_value11_flt[1], test_value11_flt[2], test_value11_flt[3]);
+	{
+		const FloatType scalar_hadd_result = (test_value10_flt[0] + test_value10_flt[1]) + (test_value10_flt[2] + test_value10_flt[3]);
+		const FloatType vector_hadd_result = vector_hadd(test_value10);
+		CHECK(vector_hadd_result == scalar_hadd_result);
+		const ScalarType vector_shadd_result = vector_hadd(test_value10);
+		CHECK(scalar_cast(vector_shadd_result) == scalar_hadd_result);
+		const Vector4Type vector_vhadd_result = vector_hadd(test_value10);
+		CHECK(vector_all_near_equal(vector_vhadd_result, vector_set(scalar_hadd_result), FloatType(0.0)));
+
+		const FloatType vector_hmin_result = vector_hmin(test_value10);
+		CHECK(vector_hmin_result == test_value10_flt[2]);
+		const ScalarType vector_shmin_result = vector_hmin(test_value10);
+		CHECK(scalar_cast(vector_shmin_result) == test_value10_flt[2]);
+		const Vector4Type vector_vhmin_result = vector_hmin(test_value10);
+		CHECK(vector_all_near_equal(vector_vhmin_result, vector_set(test_value10_flt[2]), FloatType(0.0)));
+
+		const FloatType vector_hmax_result = vector_hmax(test_value10);
+		CHECK(vector_hmax_result == test_value10_flt[1]);
+		const ScalarType vector_shmax_result = vector_hmax(test_value10);
+		CHECK(scalar_cast(vector_shmax_result) == test_value10_flt[1]);
+		const Vector4Type vector_vhmax_result = vector_hmax(test_value10);
+		CHECK(vector_all_near_equal(vector_vhmax_result, vector_set(test_value10_flt[1]), FloatType(0.0)));
+
+		// Every lane position must be reduced
+		for (int lane_index = 0; lane_index < 4; ++lane_index)
+		{
+			FloatType values[4] = { FloatType(1.0), FloatType(2.0), FloatType(3.0), FloatType(4.0) };
+			values[lane_index] = FloatType(-8.0);
+			const Vector4Type value = vector_set(values[0], values[1], values[2], values[3]);
+			CHECK(FloatType(vector_hmin(value)) == FloatType(-8.0));
+			CHECK(FloatType(vector_hadd(value)) == (values[0] + values[1]) + (values[2] + values[3]));
+
+			values[lane_index] = FloatType(8.0);
+			const Vector4Type value2 = vector_set(values[0], values[1], values[2], values[3]);
+			CHECK(FloatType(vector_hmax(value2)) == FloatType(8.0));
+		}
+	}
+
 	const FloatType scalar_dot_result = scalar_dot<Vector4Type, FloatType>(test_value10, test_value11);
 	const FloatType vector_dot_result = vector_dot(test_value10, test_value11);
 	CHECK(scalar_near_equal(vector_dot_result, scalar_dot_result, threshold));
@@ -79,4 +79,53 @@ TEST_CASE("vector4f math misc", "[math][vector4]")
 	CHECK(float(vector_get_y(vector_ceil(large_values))) == scalar_ceil(float(vector_get_y(large_values))));
 	CHECK(float(vector_get_z(vector_ceil(large_values))) == scalar_ceil(float(vector_get_z(large_values))));
 	CHECK(float(vector_get_w(vector_ceil(large_values))) == scalar_ceil(float(vector_get_w(large_values))));
+
+	// vector_sincos shares its range reduction and must match vector_sin/vector_cos
+	for (float angle = -10.0F; angle <= 10.0F; angle += 0.1F)
+	{
+		const vector4f angles = vector_set(angle, angle + 0.025F, angle + 0.05F, angle + 0.075F);
+
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos(angles, sin_, cos_);
+
+		CHECK(vector_all_near_equal(sin_, vector_sin(angles), 1.0E-6F));
+		CHECK(vector_all_near_equal(cos_, vector_cos(angles), 1.0E-6F));
+	}
+}
+
+TEST_CASE("vector4f approximate math", "[math][vector4]")
+{
+	// Relative error bounds documented for the hardware estimates
+#if defined(RTM_NEON_INTRINSICS)
+	const double approx_threshold = 1.0 / 256.0;
+	const double nr1_threshold = 3.0E-5;
+#else
+	const double approx_threshold = 1.5 / 4096.0;
+	const double nr1_threshold = 1.0E-6;
+#endif
+
+	for (float value = 1.0E-3F; value < 1.0E3F; value *= 1.0371F)
+	{
+		const vector4f input = vector_set(value, -value, value * 1.5F, -value * 0.75F);
+		const vector4f approx = vector_reciprocal_approx(input);
+		const vector4f nr1 = vector_reciprocal_nr1(input);
+
+		CHECK(scalar_abs(double(vector_get_x(approx)) * double(vector_get_x(input)) - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(vector_get_y(approx)) * double(vector_get_y(input)) - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(vector_get_z(approx)) * double(vector_get_z(input)) - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(double(vector_get_w(approx)) * double(vector_get_w(input)) - 1.0) <= approx_threshold);
+
+		CHECK(scalar_abs(double(vector_get_x(nr1)) * double(vector_get_x(input)) - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(vector_get_y(nr1)) * double(vector_get_y(input)) - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(vector_get_z(nr1)) * double(vector_get_z(input)) - 1.0) <= nr1_threshold);
+		CHECK(scalar_abs(double(vector_get_w(nr1)) * double(vector_get_w(input)) - 1.0) <= nr1_threshold);
+
+		// The length error of a normalized vector matches the relative error of the reciprocal square root
+		const vector4f vector = vector_set(value, value * -0.5F, value * 2.0F, 0.0F);
+		const double approx_length = std::sqrt(double(vector_length_squared3(vector_normalize3_approx(vector))));
+		const double nr1_length = std::sqrt(double(vector_length_squared3(vector_normalize3_nr1(vector))));
+		CHECK(scalar_abs(approx_length - 1.0) <= approx_threshold);
+		CHECK(scalar_abs(nr1_length - 1.0) <= nr1_threshold);
+	}
 }
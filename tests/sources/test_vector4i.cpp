@@ -0,0 +1,172 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/mask4i.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector4i.h>
+
+#include <cstdint>
+#include <limits>
+
+using namespace rtm;
+
+static constexpr int32_t k_int32_min = -2147483647 - 1;
+static constexpr int32_t k_int32_max = 2147483647;
+
+// vector4i and mask4i are distinct types and can overload one another
+static int get_type_id(vector4i_arg0) { return 0; }
+static int get_type_id(mask4i_arg0) { return 1; }
+
+static bool vector_all_equal(vector4i_arg0 input, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	return vector_get_x(input) == x && vector_get_y(input) == y && vector_get_z(input) == z && vector_get_w(input) == w;
+}
+
+static bool mask_all_equal(mask4i_arg0 input, bool x, bool y, bool z, bool w)
+{
+	return (mask_get_x(input) != 0) == x && (mask_get_y(input) != 0) == y && (mask_get_z(input) != 0) == z && (mask_get_w(input) != 0) == w;
+}
+
+TEST_CASE("vector4i math get/set", "[math][vector4]")
+{
+	const vector4i input = vector_set_i32(7, -3, k_int32_max, k_int32_min);
+	CHECK(vector_all_equal(input, 7, -3, k_int32_max, k_int32_min));
+	CHECK(vector_all_equal(vector_set_i32(-5), -5, -5, -5, -5));
+
+	int32_t buffer[4];
+	vector_store(input, buffer);
+	CHECK(buffer[0] == 7);
+	CHECK(buffer[3] == k_int32_min);
+	CHECK(vector_all_equal(vector_load(buffer), 7, -3, k_int32_max, k_int32_min));
+}
+
+TEST_CASE("vector4i math arithmetic", "[math][vector4]")
+{
+	const vector4i lhs = vector_set_i32(7, -3, k_int32_max, k_int32_min);
+	const vector4i rhs = vector_set_i32(-2, 5, 1, -1);
+
+	// Overflow wraps around
+	CHECK(vector_all_equal(vector_add(lhs, rhs), 5, 2, k_int32_min, k_int32_max));
+	CHECK(vector_all_equal(vector_sub(lhs, rhs), 9, -8, k_int32_max - 1, k_int32_min + 1));
+	CHECK(vector_all_equal(vector_sub(rhs, lhs), -9, 8, -k_int32_max + 1, k_int32_max));
+	CHECK(vector_all_equal(vector_mul(lhs, rhs), -14, -15, k_int32_max, k_int32_min));
+	CHECK(vector_all_equal(vector_neg(lhs), -7, 3, -k_int32_max, k_int32_min));
+	CHECK(vector_all_equal(vector_abs(lhs), 7, 3, k_int32_max, k_int32_min));
+
+	// Products larger than 32 bits keep their lower 32 bits
+	const vector4i large_lhs = vector_set_i32(65537, -70000, 123456, 3);
+	const vector4i large_rhs = vector_set_i32(65537, 70001, -654321, -5);
+	CHECK(vector_all_equal(vector_mul(large_lhs, large_rhs), int32_t(65537U * 65537U), int32_t(uint32_t(-70000) * 70001U), int32_t(123456U * uint32_t(-654321)), -15));
+
+	CHECK(vector_all_equal(vector_min(lhs, rhs), -2, -3, 1, k_int32_min));
+	CHECK(vector_all_equal(vector_max(lhs, rhs), 7, 5, k_int32_max, -1));
+	CHECK(vector_all_equal(vector_clamp(lhs, vector_set_i32(-2), vector_set_i32(5)), 5, -2, 5, -2));
+}
+
+TEST_CASE("vector4i math bitwise", "[math][vector4]")
+{
+	const vector4i lhs = vector_set_i32(0x0F0F, -1, 0, 0x1234);
+	const vector4i rhs = vector_set_i32(0x00FF, 0x5555, -1, 0x1234);
+	CHECK(vector_all_equal(vector_and(lhs, rhs), 0x000F, 0x5555, 0, 0x1234));
+	CHECK(vector_all_equal(vector_or(lhs, rhs), 0x0FFF, -1, -1, 0x1234));
+	CHECK(vector_all_equal(vector_xor(lhs, rhs), 0x0FF0, ~0x5555, -1, 0));
+
+	const vector4i values = vector_set_i32(-9, 9, -1, 256);
+	CHECK(vector_all_equal(vector_shift_left(values, 4), -144, 144, -16, 4096));
+	CHECK(vector_all_equal(vector_shift_right(values, 2), -3, 2, -1, 64));
+	CHECK(vector_all_equal(vector_shift_right_logical(values, 28), 15, 0, 15, 0));
+	CHECK(vector_all_equal(vector_shift_right(values, 0), -9, 9, -1, 256));
+}
+
+TEST_CASE("vector4i math comparisons", "[math][vector4]")
+{
+	const vector4i lhs = vector_set_i32(7, -3, 2, k_int32_min);
+	const vector4i rhs = vector_set_i32(7, 5, 1, -1);
+
+	CHECK(mask_all_equal(vector_equal(lhs, rhs), true, false, false, false));
+	CHECK(mask_all_equal(vector_less_than(lhs, rhs), false, true, false, true));
+	CHECK(mask_all_equal(vector_less_equal(lhs, rhs), true, true, false, true));
+	CHECK(mask_all_equal(vector_greater_than(lhs, rhs), false, false, true, false));
+	CHECK(mask_all_equal(vector_greater_equal(lhs, rhs), true, false, true, false));
+
+	CHECK(vector_all_equal(vector_select(vector_less_than(lhs, rhs), lhs, rhs), 7, -3, 1, k_int32_min));
+
+	CHECK(get_type_id(lhs) == 0);
+	CHECK(get_type_id(vector_equal(lhs, rhs)) == 1);
+}
+
+TEST_CASE("vector4i math conversions", "[math][vector4]")
+{
+	const vector4f input = vector_set(2.5F, -1.5F, -2.7F, 3.2F);
+	CHECK(vector_all_equal(vector_to_int_truncate(input), 2, -1, -2, 3));
+	CHECK(vector_all_equal(vector_to_int_floor(input), 2, -2, -3, 3));
+	CHECK(vector_all_equal(vector_to_int_ceil(input), 3, -1, -2, 4));
+	CHECK(vector_all_equal(vector_to_int_round_symmetric(input), 3, -2, -3, 3));
+	CHECK(vector_all_equal(vector_to_int_round_bankers(input), 2, -2, -3, 3));
+
+	const vector4f large_input = vector_set(16777216.0F, -16777216.0F, 1073741824.0F, -2147483648.0F);
+	CHECK(vector_all_equal(vector_to_int_round_bankers(large_input), 16777216, -16777216, 1073741824, k_int32_min));
+
+	const vector4f output = vector_cast(vector_set_i32(-3, 0, 16777216, k_int32_min));
+	CHECK(vector_all_near_equal(output, vector_set(-3.0F, 0.0F, 16777216.0F, -2147483648.0F), 0.0F));
+
+#if !defined(RTM_NEON_INTRINSICS)
+	// NaN and out of range values behave like _mm_cvttps_epi32
+	// The values are volatile to prevent the compiler from folding the conversion, it can assume they are in range
+	volatile float invalid_values[4] = { std::numeric_limits<float>::quiet_NaN(), 2147483648.0F, -4294967296.0F, std::numeric_limits<float>::infinity() };
+	const vector4f invalid_input = vector_set(invalid_values[0], invalid_values[1], invalid_values[2], invalid_values[3]);
+	CHECK(vector_all_equal(vector_to_int_truncate(invalid_input), k_int32_min, k_int32_min, k_int32_min, k_int32_min));
+#endif
+}
+
+TEST_CASE("vector4i math pack/unpack", "[math][vector4]")
+{
+	uint8_t u8[16];
+	vector_pack_u8(vector_set_i32(-5, 0, 255, 256), vector_set_i32(1, 2, 3, 4), vector_set_i32(100000), vector_set_i32(k_int32_min, 128, 127, 200), u8);
+	CHECK(u8[0] == 0);
+	CHECK(u8[2] == 255);
+	CHECK(u8[3] == 255);
+	CHECK(u8[4] == 1);
+	CHECK(u8[8] == 255);
+	CHECK(vector_all_equal(vector_unpack_u8(u8 + 12), 0, 128, 127, 200));
+
+	int8_t i8[16];
+	vector_pack_i8(vector_set_i32(-500, -128, 127, 128), vector_set_i32(1), vector_set_i32(-1), vector_set_i32(0), i8);
+	CHECK(vector_all_equal(vector_unpack_i8(i8), -128, -128, 127, 127));
+	CHECK(vector_all_equal(vector_unpack_i8(i8 + 4), 1, 1, 1, 1));
+	CHECK(vector_all_equal(vector_unpack_i8(i8 + 8), -1, -1, -1, -1));
+
+	uint16_t u16[8];
+	vector_pack_u16(vector_set_i32(-1, 0, 65535, 65536), vector_set_i32(32767, 32768, 40000, k_int32_max), u16);
+	CHECK(vector_all_equal(vector_unpack_u16(u16), 0, 0, 65535, 65535));
+	CHECK(vector_all_equal(vector_unpack_u16(u16 + 4), 32767, 32768, 40000, 65535));
+
+	int16_t i16[8];
+	vector_pack_i16(vector_set_i32(-40000, -32768, 32767, 40000), vector_set_i32(-1, 0, 1, k_int32_min), i16);
+	CHECK(vector_all_equal(vector_unpack_i16(i16), -32768, -32768, 32767, 32767));
+	CHECK(vector_all_equal(vector_unpack_i16(i16 + 4), -1, 0, 1, -32768));
+}
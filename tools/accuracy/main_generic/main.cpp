@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "../sources/accuracy_harness.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#ifdef _WIN32
+#include <conio.h>
+
+extern "C" __declspec(dllimport) int __stdcall IsDebuggerPresent();
+#endif
+
+static bool parse_option(const char* argument, const char* option_name, const char*& out_value)
+{
+	const size_t option_length = std::strlen(option_name);
+	if (std::strncmp(argument, option_name, option_length) != 0)
+		return false;
+
+	out_value = argument + option_length;
+	return true;
+}
+
+static void print_usage()
+{
+	std::printf("Usage: rtm_accuracy [-threads=N] [-step=N] [-samples=N] [-grid=N] [-filter=name] [-float32] [-float64]\n");
+	std::printf("  -threads=N    Number of worker threads, defaults to every hardware thread\n");
+	std::printf("  -step=N       Test every Nth float32 value, defaults to 1 (exhaustive)\n");
+	std::printf("  -samples=N    Number of float64 values tested per function\n");
+	std::printf("  -grid=N       Number of values tested along each axis for functions with two arguments\n");
+	std::printf("  -filter=name  Only test functions whose name contains this string\n");
+	std::printf("  -float32      Only test float32 functions\n");
+	std::printf("  -float64      Only test float64 functions\n");
+}
+
+int main(int argc, char* argv[])
+{
+	rtm_accuracy::accuracy_options options;
+	bool run_float32 = true;
+	bool run_float64 = true;
+
+	for (int arg_index = 1; arg_index < argc; ++arg_index)
+	{
+		const char* argument = argv[arg_index];
+		const char* value = nullptr;
+
+		if (parse_option(argument, "-threads=", value))
+			options.num_threads = static_cast<uint32_t>(std::strtoul(value, nullptr, 10));
+		else if (parse_option(argument, "-step=", value))
+			options.float32_step = std::max<uint64_t>(std::strtoull(value, nullptr, 10), 1);
+		else if (parse_option(argument, "-samples=", value))
+			options.num_float64_samples = std::max<uint64_t>(std::strtoull(value, nullptr, 10), 2);
+		else if (parse_option(argument, "-grid=", value))
+			options.num_grid_samples = std::max<uint64_t>(std::strtoull(value, nullptr, 10), 2);
+		else if (parse_option(argument, "-filter=", value))
+			options.filter = value;
+		else if (std::strcmp(argument, "-float32") == 0)
+			run_float64 = false;
+		else if (std::strcmp(argument, "-float64") == 0)
+			run_float32 = false;
+		else if (std::strcmp(argument, "-help") == 0)
+		{
+			print_usage();
+			return 0;
+		}
+		else
+		{
+			print_usage();
+			return 1;
+		}
+	}
+
+	if (run_float32)
+		rtm_accuracy::measure_float32_accuracy(options);
+
+	if (run_float64)
+		rtm_accuracy::measure_float64_accuracy(options);
+
+#ifdef _WIN32
+	if (IsDebuggerPresent())
+	{
+		printf("Press any key to continue...\n");
+		while (_kbhit() == 0);
+	}
+#endif
+
+	return 0;
+}
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "accuracy_harness.h"
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+// Generates a function that evaluates a scalar or vector RTM function over a buffer
+#define RTM_ACCURACY_SCALAR_UNARY(function) \
+	static void evaluate_##function(const float* inputs0, const float*, uint32_t num_values, float* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index) \
+			outputs[value_index] = function(inputs0[value_index]); \
+	}
+
+#define RTM_ACCURACY_SCALAR_BINARY(function) \
+	static void evaluate_##function(const float* inputs0, const float* inputs1, uint32_t num_values, float* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index) \
+			outputs[value_index] = function(inputs0[value_index], inputs1[value_index]); \
+	}
+
+#define RTM_ACCURACY_VECTOR_UNARY(function) \
+	static void evaluate_##function(const float* inputs0, const float*, uint32_t num_values, float* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; value_index += 4) \
+			vector_store(function(vector_load(inputs0 + value_index)), outputs + value_index); \
+	}
+
+#define RTM_ACCURACY_VECTOR_BINARY(function) \
+	static void evaluate_##function(const float* inputs0, const float* inputs1, uint32_t num_values, float* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; value_index += 4) \
+			vector_store(function(vector_load(inputs0 + value_index), vector_load(inputs1 + value_index)), outputs + value_index); \
+	}
+
+RTM_ACCURACY_SCALAR_UNARY(scalar_sin)
+RTM_ACCURACY_SCALAR_UNARY(scalar_cos)
+RTM_ACCURACY_SCALAR_UNARY(scalar_tan)
+RTM_ACCURACY_SCALAR_UNARY(scalar_asin)
+RTM_ACCURACY_SCALAR_UNARY(scalar_acos)
+RTM_ACCURACY_SCALAR_UNARY(scalar_atan)
+RTM_ACCURACY_SCALAR_BINARY(scalar_atan2)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt_reciprocal)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt_reciprocal_nr1)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt_reciprocal_approx)
+RTM_ACCURACY_SCALAR_UNARY(scalar_reciprocal)
+RTM_ACCURACY_SCALAR_UNARY(scalar_reciprocal_nr1)
+RTM_ACCURACY_SCALAR_UNARY(scalar_reciprocal_approx)
+
+RTM_ACCURACY_VECTOR_UNARY(vector_sin)
+RTM_ACCURACY_VECTOR_UNARY(vector_cos)
+RTM_ACCURACY_VECTOR_UNARY(vector_tan)
+RTM_ACCURACY_VECTOR_UNARY(vector_asin)
+RTM_ACCURACY_VECTOR_UNARY(vector_acos)
+RTM_ACCURACY_VECTOR_UNARY(vector_atan)
+RTM_ACCURACY_VECTOR_BINARY(vector_atan2)
+RTM_ACCURACY_VECTOR_UNARY(vector_sqrt)
+RTM_ACCURACY_VECTOR_UNARY(vector_reciprocal)
+RTM_ACCURACY_VECTOR_UNARY(vector_reciprocal_nr1)
+RTM_ACCURACY_VECTOR_UNARY(vector_reciprocal_approx)
+
+static double reference_sin(double input, double) { return std::sin(input); }
+static double reference_cos(double input, double) { return std::cos(input); }
+static double reference_tan(double input, double) { return std::tan(input); }
+static double reference_asin(double input, double) { return std::asin(input); }
+static double reference_acos(double input, double) { return std::acos(input); }
+static double reference_atan(double input, double) { return std::atan(input); }
+static double reference_atan2(double y, double x) { return std::atan2(y, x); }
+static double reference_sqrt(double input, double) { return std::sqrt(input); }
+static double reference_sqrt_reciprocal(double input, double) { return 1.0 / std::sqrt(input); }
+static double reference_reciprocal(double input, double) { return 1.0 / input; }
+
+namespace rtm_accuracy
+{
+	void measure_float32_accuracy(const accuracy_options& options)
+	{
+		// Trigonometric functions are measured over the range commonly used for angles, the error
+		// of the range reduction grows with the magnitude of the input.
+		// Sine and cosine are also measured over every finite float32 to show how the range reduction behaves.
+		// Reciprocals are measured over the positive normal range where their result is also normal.
+		const float two_pi = 6.28318530F;
+		const float half_pi = 1.57079625F;		// Largest float below PI/2
+		const float atan2_range = 1.0E4F;
+		const float reciprocal_max = 1.0F / FLT_MIN;
+
+		using function_desc32 = function_desc<float, double>;
+		const function_desc32 functions[] =
+		{
+			function_desc32{ "scalar_sin", -two_pi, two_pi, false, evaluate_scalar_sin, reference_sin },
+			function_desc32{ "scalar_cos", -two_pi, two_pi, false, evaluate_scalar_cos, reference_cos },
+			function_desc32{ "scalar_sin (full range)", -FLT_MAX, FLT_MAX, false, evaluate_scalar_sin, reference_sin },
+			function_desc32{ "scalar_cos (full range)", -FLT_MAX, FLT_MAX, false, evaluate_scalar_cos, reference_cos },
+			function_desc32{ "scalar_tan", -half_pi, half_pi, false, evaluate_scalar_tan, reference_tan },
+			function_desc32{ "scalar_asin", -1.0F, 1.0F, false, evaluate_scalar_asin, reference_asin },
+			function_desc32{ "scalar_acos", -1.0F, 1.0F, false, evaluate_scalar_acos, reference_acos },
+			function_desc32{ "scalar_atan", -FLT_MAX, FLT_MAX, false, evaluate_scalar_atan, reference_atan },
+			function_desc32{ "scalar_atan2", -atan2_range, atan2_range, true, evaluate_scalar_atan2, reference_atan2 },
+			function_desc32{ "scalar_sqrt", 0.0F, FLT_MAX, false, evaluate_scalar_sqrt, reference_sqrt },
+			function_desc32{ "scalar_sqrt_reciprocal", FLT_MIN, FLT_MAX, false, evaluate_scalar_sqrt_reciprocal, reference_sqrt_reciprocal },
+			function_desc32{ "scalar_sqrt_reciprocal_nr1", FLT_MIN, FLT_MAX, false, evaluate_scalar_sqrt_reciprocal_nr1, reference_sqrt_reciprocal },
+			function_desc32{ "scalar_sqrt_reciprocal_approx", FLT_MIN, FLT_MAX, false, evaluate_scalar_sqrt_reciprocal_approx, reference_sqrt_reciprocal },
+			function_desc32{ "scalar_reciprocal", FLT_MIN, reciprocal_max, false, evaluate_scalar_reciprocal, reference_reciprocal },
+			function_desc32{ "scalar_reciprocal_nr1", FLT_MIN, reciprocal_max, false, evaluate_scalar_reciprocal_nr1, reference_reciprocal },
+			function_desc32{ "scalar_reciprocal_approx", FLT_MIN, reciprocal_max, false, evaluate_scalar_reciprocal_approx, reference_reciprocal },
+
+			function_desc32{ "vector_sin", -two_pi, two_pi, false, evaluate_vector_sin, reference_sin },
+			function_desc32{ "vector_cos", -two_pi, two_pi, false, evaluate_vector_cos, reference_cos },
+			function_desc32{ "vector_sin (full range)", -FLT_MAX, FLT_MAX, false, evaluate_vector_sin, reference_sin },
+			function_desc32{ "vector_cos (full range)", -FLT_MAX, FLT_MAX, false, evaluate_vector_cos, reference_cos },
+			function_desc32{ "vector_tan", -half_pi, half_pi, false, evaluate_vector_tan, reference_tan },
+			function_desc32{ "vector_asin", -1.0F, 1.0F, false, evaluate_vector_asin, reference_asin },
+			function_desc32{ "vector_acos", -1.0F, 1.0F, false, evaluate_vector_acos, reference_acos },
+			function_desc32{ "vector_atan", -FLT_MAX, FLT_MAX, false, evaluate_vector_atan, reference_atan },
+			function_desc32{ "vector_atan2", -atan2_range, atan2_range, true, evaluate_vector_atan2, reference_atan2 },
+			function_desc32{ "vector_sqrt", 0.0F, FLT_MAX, false, evaluate_vector_sqrt, reference_sqrt },
+			function_desc32{ "vector_reciprocal", FLT_MIN, reciprocal_max, false, evaluate_vector_reciprocal, reference_reciprocal },
+			function_desc32{ "vector_reciprocal_nr1", FLT_MIN, reciprocal_max, false, evaluate_vector_reciprocal_nr1, reference_reciprocal },
+			function_desc32{ "vector_reciprocal_approx", FLT_MIN, reciprocal_max, false, evaluate_vector_reciprocal_approx, reference_reciprocal },
+		};
+
+		print_accuracy_header("float32 (reference: float64)");
+		measure_accuracy(functions, sizeof(functions) / sizeof(functions[0]), options);
+	}
+}
@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "accuracy_harness.h"
+
+#include <rtm/scalard.h>
+
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+using namespace rtm;
+
+// Generates a function that evaluates a scalar RTM function over a buffer
+#define RTM_ACCURACY_SCALAR_UNARY(function) \
+	static void evaluate_##function(const double* inputs0, const double*, uint32_t num_values, double* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index) \
+			outputs[value_index] = function(inputs0[value_index]); \
+	}
+
+#define RTM_ACCURACY_SCALAR_BINARY(function) \
+	static void evaluate_##function(const double* inputs0, const double* inputs1, uint32_t num_values, double* outputs) \
+	{ \
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index) \
+			outputs[value_index] = function(inputs0[value_index], inputs1[value_index]); \
+	}
+
+RTM_ACCURACY_SCALAR_UNARY(scalar_sin)
+RTM_ACCURACY_SCALAR_UNARY(scalar_cos)
+RTM_ACCURACY_SCALAR_UNARY(scalar_tan)
+RTM_ACCURACY_SCALAR_UNARY(scalar_asin)
+RTM_ACCURACY_SCALAR_UNARY(scalar_acos)
+RTM_ACCURACY_SCALAR_UNARY(scalar_atan)
+RTM_ACCURACY_SCALAR_BINARY(scalar_atan2)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt)
+RTM_ACCURACY_SCALAR_UNARY(scalar_sqrt_reciprocal)
+RTM_ACCURACY_SCALAR_UNARY(scalar_reciprocal)
+
+static long double reference_sin(long double input, long double) { return std::sin(input); }
+static long double reference_cos(long double input, long double) { return std::cos(input); }
+static long double reference_tan(long double input, long double) { return std::tan(input); }
+static long double reference_asin(long double input, long double) { return std::asin(input); }
+static long double reference_acos(long double input, long double) { return std::acos(input); }
+static long double reference_atan(long double input, long double) { return std::atan(input); }
+static long double reference_atan2(long double y, long double x) { return std::atan2(y, x); }
+static long double reference_sqrt(long double input, long double) { return std::sqrt(input); }
+static long double reference_sqrt_reciprocal(long double input, long double) { return 1.0L / std::sqrt(input); }
+static long double reference_reciprocal(long double input, long double) { return 1.0L / input; }
+
+namespace rtm_accuracy
+{
+	void measure_float64_accuracy(const accuracy_options& options)
+	{
+		// See measure_float32_accuracy(..) for how the domains are chosen
+		const double two_pi = 6.2831853071795865;
+		const double half_pi = 1.5707963267948966;		// Largest double below PI/2
+		const double atan2_range = 1.0E4;
+		const double reciprocal_max = 1.0 / DBL_MIN;
+
+		using function_desc64 = function_desc<double, long double>;
+		const function_desc64 functions[] =
+		{
+			function_desc64{ "scalar_sin", -two_pi, two_pi, false, evaluate_scalar_sin, reference_sin },
+			function_desc64{ "scalar_cos", -two_pi, two_pi, false, evaluate_scalar_cos, reference_cos },
+			function_desc64{ "scalar_sin (full range)", -DBL_MAX, DBL_MAX, false, evaluate_scalar_sin, reference_sin },
+			function_desc64{ "scalar_cos (full range)", -DBL_MAX, DBL_MAX, false, evaluate_scalar_cos, reference_cos },
+			function_desc64{ "scalar_tan", -half_pi, half_pi, false, evaluate_scalar_tan, reference_tan },
+			function_desc64{ "scalar_asin", -1.0, 1.0, false, evaluate_scalar_asin, reference_asin },
+			function_desc64{ "scalar_acos", -1.0, 1.0, false, evaluate_scalar_acos, reference_acos },
+			function_desc64{ "scalar_atan", -DBL_MAX, DBL_MAX, false, evaluate_scalar_atan, reference_atan },
+			function_desc64{ "scalar_atan2", -atan2_range, atan2_range, true, evaluate_scalar_atan2, reference_atan2 },
+			function_desc64{ "scalar_sqrt", 0.0, DBL_MAX, false, evaluate_scalar_sqrt, reference_sqrt },
+			function_desc64{ "scalar_sqrt_reciprocal", DBL_MIN, DBL_MAX, false, evaluate_scalar_sqrt_reciprocal, reference_sqrt_reciprocal },
+			function_desc64{ "scalar_reciprocal", DBL_MIN, reciprocal_max, false, evaluate_scalar_reciprocal, reference_reciprocal },
+		};
+
+		print_accuracy_header("float64 (reference: long double)");
+
+		// When long double is a double (e.g. MSVC), the reference has the same precision and errors below 1 ULP cannot be measured
+		if (std::numeric_limits<long double>::digits <= std::numeric_limits<double>::digits)
+			std::printf("Warning: long double has the same precision as double, the reference is only as accurate as the C runtime and the reported errors are approximate\n");
+
+		measure_accuracy(functions, sizeof(functions) / sizeof(functions[0]), options);
+	}
+}
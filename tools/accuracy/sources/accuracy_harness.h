@@ -0,0 +1,379 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace rtm_accuracy
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Options that control how densely each function is sampled.
+	//////////////////////////////////////////////////////////////////////////
+	struct accuracy_options
+	{
+		// Number of worker threads, 0 uses every hardware thread
+		uint32_t num_threads = 0;
+
+		// Every Nth float32 in the domain is tested, 1 sweeps every value
+		uint64_t float32_step = 1;
+
+		// Number of values tested for float64 functions, sampled evenly over the bit patterns of the domain
+		uint64_t num_float64_samples = 1ULL << 26;
+
+		// Number of values tested along each axis for functions with two arguments
+		uint64_t num_grid_samples = 1ULL << 13;
+
+		// When set, only functions whose name contains this string are tested
+		const char* filter = nullptr;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Describes a function to measure.
+	// The domain is sampled over its bit patterns, as such every exponent
+	// is equally represented and every value is tested with a step of 1.
+	// Functions with two arguments are sampled on a grid over the same domain.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename float_type, typename reference_type>
+	struct function_desc
+	{
+		const char* name;
+
+		// The domain is inclusive
+		float_type min_value;
+		float_type max_value;
+
+		bool is_binary;
+
+		// Evaluates RTM, 'num_values' is always a multiple of 4
+		void (*evaluate)(const float_type* inputs0, const float_type* inputs1, uint32_t num_values, float_type* outputs);
+
+		// Evaluates the reference with a higher precision
+		reference_type (*reference)(reference_type input0, reference_type input1);
+	};
+
+	namespace impl
+	{
+		template<typename float_type> struct float_traits {};
+
+		template<>
+		struct float_traits<float>
+		{
+			using bits_type = uint32_t;
+			static constexpr uint32_t sign_mask = 0x80000000U;
+			static const char* format() { return "%.9g"; }
+		};
+
+		template<>
+		struct float_traits<double>
+		{
+			using bits_type = uint64_t;
+			static constexpr uint64_t sign_mask = 0x8000000000000000ULL;
+			static const char* format() { return "%.17g"; }
+		};
+
+		// Maps a value to an unsigned integer that preserves the floating point ordering
+		template<typename float_type>
+		inline typename float_traits<float_type>::bits_type float_to_ordered(float_type value)
+		{
+			using traits = float_traits<float_type>;
+			typename traits::bits_type bits;
+			std::memcpy(&bits, &value, sizeof(float_type));
+			return (bits & traits::sign_mask) != 0 ? ~bits : (bits | traits::sign_mask);
+		}
+
+		template<typename float_type>
+		inline float_type ordered_to_float(typename float_traits<float_type>::bits_type ordered)
+		{
+			using traits = float_traits<float_type>;
+			const typename traits::bits_type bits = (ordered & traits::sign_mask) != 0 ? (ordered ^ traits::sign_mask) : ~ordered;
+			float_type value;
+			std::memcpy(&value, &bits, sizeof(float_type));
+			return value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the error in units in the last place of the reference rounded to the tested precision.
+		// Results that do not match a non-finite reference (or vice versa) have an infinite error.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename float_type, typename reference_type>
+		inline double compute_ulp_error(float_type result, reference_type reference)
+		{
+			const float_type reference_rounded = static_cast<float_type>(reference);
+			if (result == reference_rounded)
+				return 0.0;
+
+			if (!std::isfinite(result) || !std::isfinite(reference_rounded))
+				return std::numeric_limits<double>::infinity();
+
+			const float_type abs_reference = std::abs(reference_rounded);
+			const float_type ulp = abs_reference == std::numeric_limits<float_type>::max()
+				? (abs_reference - std::nextafter(abs_reference, float_type(0.0)))
+				: (std::nextafter(abs_reference, std::numeric_limits<float_type>::infinity()) - abs_reference);
+
+			return static_cast<double>(std::abs(static_cast<reference_type>(result) - reference) / static_cast<reference_type>(ulp));
+		}
+
+		template<typename float_type>
+		struct accuracy_result
+		{
+			uint64_t num_samples = 0;
+			uint64_t num_invalid = 0;
+
+			double max_ulp_error = 0.0;
+			float_type max_ulp_input0 = float_type(0.0);
+			float_type max_ulp_input1 = float_type(0.0);
+
+			double sum_ulp_error = 0.0;
+			double sum_abs_error = 0.0;
+
+			uint64_t evaluation_time_ns = 0;
+
+			void merge(const accuracy_result& other)
+			{
+				num_samples += other.num_samples;
+				num_invalid += other.num_invalid;
+				sum_ulp_error += other.sum_ulp_error;
+				sum_abs_error += other.sum_abs_error;
+				evaluation_time_ns += other.evaluation_time_ns;
+
+				if (other.max_ulp_error > max_ulp_error)
+				{
+					max_ulp_error = other.max_ulp_error;
+					max_ulp_input0 = other.max_ulp_input0;
+					max_ulp_input1 = other.max_ulp_input1;
+				}
+			}
+		};
+
+		// Describes which values are sampled in the domain
+		template<typename float_type>
+		struct sampling_desc
+		{
+			using bits_type = typename float_traits<float_type>::bits_type;
+
+			bits_type min_ordered;
+			bits_type step;
+			uint64_t num_axis_samples;		// Along each axis when binary
+			uint64_t num_samples;
+			bool is_binary;
+
+			float_type get_axis_value(uint64_t axis_index) const
+			{
+				return ordered_to_float<float_type>(static_cast<bits_type>(min_ordered + axis_index * step));
+			}
+
+			void get_sample(uint64_t sample_index, float_type& out_input0, float_type& out_input1) const
+			{
+				if (is_binary)
+				{
+					out_input0 = get_axis_value(sample_index / num_axis_samples);
+					out_input1 = get_axis_value(sample_index % num_axis_samples);
+				}
+				else
+				{
+					out_input0 = get_axis_value(sample_index);
+					out_input1 = float_type(0.0);
+				}
+			}
+		};
+
+		template<typename float_type, typename reference_type>
+		inline sampling_desc<float_type> make_sampling_desc(const function_desc<float_type, reference_type>& function, uint64_t step, uint64_t num_target_samples)
+		{
+			sampling_desc<float_type> desc;
+			desc.min_ordered = float_to_ordered(function.min_value);
+			desc.is_binary = function.is_binary;
+
+			const uint64_t range = static_cast<uint64_t>(float_to_ordered(function.max_value) - desc.min_ordered);
+
+			// Either sample with an explicit step or evenly to get the desired number of samples
+			if (num_target_samples != 0)
+				step = std::max<uint64_t>(range / std::max<uint64_t>(num_target_samples - 1, 1), 1);
+
+			desc.step = static_cast<typename sampling_desc<float_type>::bits_type>(step);
+			desc.num_axis_samples = (range / step) + 1;
+			desc.num_samples = desc.is_binary ? (desc.num_axis_samples * desc.num_axis_samples) : desc.num_axis_samples;
+			return desc;
+		}
+
+		template<typename float_type, typename reference_type>
+		inline void measure_thread(const function_desc<float_type, reference_type>& function, const sampling_desc<float_type>& sampling, std::atomic<uint64_t>& next_chunk_index, accuracy_result<float_type>& out_result)
+		{
+			constexpr uint32_t k_chunk_size = 4096;
+
+			std::vector<float_type> inputs0(k_chunk_size);
+			std::vector<float_type> inputs1(k_chunk_size);
+			std::vector<float_type> outputs(k_chunk_size);
+
+			const uint64_t num_chunks = (sampling.num_samples + k_chunk_size - 1) / k_chunk_size;
+
+			accuracy_result<float_type> result;
+			while (true)
+			{
+				const uint64_t chunk_index = next_chunk_index.fetch_add(1);
+				if (chunk_index >= num_chunks)
+					break;
+
+				const uint64_t chunk_start = chunk_index * k_chunk_size;
+				const uint32_t num_chunk_samples = static_cast<uint32_t>(std::min<uint64_t>(sampling.num_samples - chunk_start, k_chunk_size));
+
+				for (uint32_t sample_index = 0; sample_index < num_chunk_samples; ++sample_index)
+					sampling.get_sample(chunk_start + sample_index, inputs0[sample_index], inputs1[sample_index]);
+
+				// Pad with the last sample since we always evaluate groups of 4
+				const uint32_t num_padded_samples = (num_chunk_samples + 3) & ~3U;
+				for (uint32_t sample_index = num_chunk_samples; sample_index < num_padded_samples; ++sample_index)
+				{
+					inputs0[sample_index] = inputs0[num_chunk_samples - 1];
+					inputs1[sample_index] = inputs1[num_chunk_samples - 1];
+				}
+
+				const auto start_time = std::chrono::high_resolution_clock::now();
+				function.evaluate(inputs0.data(), inputs1.data(), num_padded_samples, outputs.data());
+				const auto end_time = std::chrono::high_resolution_clock::now();
+				result.evaluation_time_ns += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+
+				for (uint32_t sample_index = 0; sample_index < num_chunk_samples; ++sample_index)
+				{
+					const float_type input0 = inputs0[sample_index];
+					const float_type input1 = inputs1[sample_index];
+					const float_type output = outputs[sample_index];
+					const reference_type reference = function.reference(input0, input1);
+
+					const double ulp_error = compute_ulp_error(output, reference);
+					if (!std::isfinite(ulp_error))
+					{
+						result.num_invalid++;
+						continue;
+					}
+
+					result.num_samples++;
+					result.sum_ulp_error += ulp_error;
+					result.sum_abs_error += static_cast<double>(std::abs(static_cast<reference_type>(output) - reference));
+
+					if (ulp_error > result.max_ulp_error)
+					{
+						result.max_ulp_error = ulp_error;
+						result.max_ulp_input0 = input0;
+						result.max_ulp_input1 = input1;
+					}
+				}
+			}
+
+			out_result = result;
+		}
+
+		template<typename float_type>
+		inline void format_input(const accuracy_result<float_type>& result, bool is_binary, char* buffer, size_t buffer_size)
+		{
+			const char* format = float_traits<float_type>::format();
+			int offset = std::snprintf(buffer, buffer_size, format, static_cast<double>(result.max_ulp_input0));
+			if (is_binary && offset > 0 && static_cast<size_t>(offset) < buffer_size)
+			{
+				offset += std::snprintf(buffer + offset, buffer_size - offset, ", ");
+				std::snprintf(buffer + offset, buffer_size - offset, format, static_cast<double>(result.max_ulp_input1));
+			}
+		}
+	}
+
+	inline void print_accuracy_header(const char* title)
+	{
+		std::printf("\n%s\n", title);
+		std::printf("%-34s %14s %12s %12s %14s %12s %10s   %s\n", "Function", "Samples", "Max ULP", "Mean ULP", "Mean abs err", "Invalid", "ns/value", "Max ULP input");
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Measures the error of every function against its reference over its domain and
+	// prints one line per function with its maximum and mean error as well as its throughput.
+	// The throughput is measured over the whole sweep and does not include the reference.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename float_type, typename reference_type>
+	inline void measure_accuracy(const function_desc<float_type, reference_type>* functions, size_t num_functions, const accuracy_options& options)
+	{
+		const uint32_t num_threads = options.num_threads != 0 ? options.num_threads : std::max<uint32_t>(std::thread::hardware_concurrency(), 1);
+		const bool is_float32 = sizeof(float_type) == sizeof(float);
+
+		for (size_t function_index = 0; function_index < num_functions; ++function_index)
+		{
+			const function_desc<float_type, reference_type>& function = functions[function_index];
+			if (options.filter != nullptr && std::strstr(function.name, options.filter) == nullptr)
+				continue;
+
+			uint64_t num_target_samples;
+			if (function.is_binary)
+				num_target_samples = options.num_grid_samples;
+			else
+				num_target_samples = is_float32 ? 0 : options.num_float64_samples;
+
+			const impl::sampling_desc<float_type> sampling = impl::make_sampling_desc(function, options.float32_step, num_target_samples);
+
+			std::atomic<uint64_t> next_chunk_index(0);
+			std::vector<impl::accuracy_result<float_type>> thread_results(num_threads);
+			std::vector<std::thread> threads;
+			threads.reserve(num_threads);
+
+			for (uint32_t thread_index = 0; thread_index < num_threads; ++thread_index)
+				threads.emplace_back([&function, &sampling, &next_chunk_index, &thread_results, thread_index]() { impl::measure_thread(function, sampling, next_chunk_index, thread_results[thread_index]); });
+
+			impl::accuracy_result<float_type> result;
+			for (uint32_t thread_index = 0; thread_index < num_threads; ++thread_index)
+			{
+				threads[thread_index].join();
+				result.merge(thread_results[thread_index]);
+			}
+
+			const double num_valid_samples = static_cast<double>(std::max<uint64_t>(result.num_samples, 1));
+			const double num_total_samples = static_cast<double>(std::max<uint64_t>(result.num_samples + result.num_invalid, 1));
+
+			char input_buffer[64];
+			impl::format_input(result, function.is_binary, input_buffer, sizeof(input_buffer));
+
+			std::printf("%-34s %14" PRIu64 " %12.6g %12.6g %14.6e %12" PRIu64 " %10.3f   %s\n",
+				function.name,
+				result.num_samples + result.num_invalid,
+				result.max_ulp_error,
+				result.sum_ulp_error / num_valid_samples,
+				result.sum_abs_error / num_valid_samples,
+				result.num_invalid,
+				static_cast<double>(result.evaluation_time_ns) / num_total_samples,
+				input_buffer);
+			std::fflush(stdout);
+		}
+	}
+
+	void measure_float32_accuracy(const accuracy_options& options);
+	void measure_float64_accuracy(const accuracy_options& options);
+}
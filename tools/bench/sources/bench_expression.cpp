@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/expression.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// These benchmarks compare common transform expressions evaluated eagerly with the regular API
+// against the same expressions built with the expression layer (rtm/expression.h).
+
+static constexpr uint32_t k_num_bench_expression_values = 1024;
+
+RTM_FORCE_NOINLINE void rotate_normals_eager(const vector4f* inputs, uint32_t num_vectors, quatf_arg0 rotation, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		outputs[vector_index] = vector_normalize3(quat_mul_vector3(vector_normalize3(inputs[vector_index]), rotation));
+}
+
+RTM_FORCE_NOINLINE void rotate_normals_expr(const vector4f* inputs, uint32_t num_vectors, quatf_arg0 rotation, vector4f* outputs) RTM_NO_EXCEPT
+{
+	// The rotation preserves the length of its normalized input, the second normalization is skipped
+	const auto rotation_expr = expr::quat_rotation(rotation);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		outputs[vector_index] = expr::vector_normalize3(expr::quat_mul_vector3(expr::vector_normalize3(inputs[vector_index]), rotation_expr));
+}
+
+RTM_FORCE_NOINLINE void weighted_sum_eager(const vector4f* inputs0, const vector4f* inputs1, uint32_t num_vectors, vector4f_arg0 weight0, vector4f_arg1 weight1, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		outputs[vector_index] = vector_sub(vector_add(vector_mul(inputs0[vector_index], weight0), vector_mul(inputs1[vector_index], weight1)), vector_mul(outputs[vector_index], weight0));
+}
+
+RTM_FORCE_NOINLINE void weighted_sum_expr(const vector4f* inputs0, const vector4f* inputs1, uint32_t num_vectors, vector4f_arg0 weight0, vector4f_arg1 weight1, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		outputs[vector_index] = expr::vector_sub(expr::vector_add(expr::vector_mul(inputs0[vector_index], weight0), expr::vector_mul(inputs1[vector_index], weight1)), expr::vector_mul(outputs[vector_index], weight0));
+}
+
+static void setup_expression_bench(vector4f* inputs)
+{
+	for (uint32_t vector_index = 0; vector_index < k_num_bench_expression_values; ++vector_index)
+	{
+		const float value = float(vector_index % 64) - 31.5F;
+		inputs[vector_index] = vector_set(value, 1.0F - value, value * 0.5F, 0.0F);
+	}
+}
+
+template<void(*rotate_impl)(const vector4f*, uint32_t, quatf_arg0, vector4f*)>
+static void bm_expression_rotate_normals(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_expression_values];
+	vector4f outputs[k_num_bench_expression_values];
+	setup_expression_bench(inputs);
+
+	const quatf rotation = quat_from_euler(0.5F, -1.25F, 2.0F);
+
+	for (auto _ : state)
+	{
+		rotate_impl(inputs, k_num_bench_expression_values, rotation, outputs);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+}
+
+template<void(*sum_impl)(const vector4f*, const vector4f*, uint32_t, vector4f_arg0, vector4f_arg1, vector4f*)>
+static void bm_expression_weighted_sum(benchmark::State& state)
+{
+	vector4f inputs0[k_num_bench_expression_values];
+	vector4f inputs1[k_num_bench_expression_values];
+	vector4f outputs[k_num_bench_expression_values];
+	setup_expression_bench(inputs0);
+	setup_expression_bench(inputs1);
+	setup_expression_bench(outputs);
+
+	const vector4f weight0 = vector_set(0.25F);
+	const vector4f weight1 = vector_set(0.75F);
+
+	for (auto _ : state)
+	{
+		sum_impl(inputs0, inputs1, k_num_bench_expression_values, weight0, weight1, outputs);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+}
+
+BENCHMARK_TEMPLATE(bm_expression_rotate_normals, rotate_normals_eager);
+BENCHMARK_TEMPLATE(bm_expression_rotate_normals, rotate_normals_expr);
+BENCHMARK_TEMPLATE(bm_expression_weighted_sum, weighted_sum_eager);
+BENCHMARK_TEMPLATE(bm_expression_weighted_sum, weighted_sum_expr);
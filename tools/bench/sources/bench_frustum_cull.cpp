@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/frustumf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE uint32_t frustum_cull_ref(const frustumf& frustum, const spheref* spheres, uint32_t num_spheres, uint32_t* visible_indices) RTM_NO_EXCEPT
+{
+	// One sphere at a time against each plane with a 3D dot product
+	uint32_t num_visible = 0;
+	for (uint32_t sphere_index = 0; sphere_index < num_spheres; ++sphere_index)
+	{
+		const vector4f center = sphere_get_center(spheres[sphere_index]);
+		const float radius = sphere_get_radius(spheres[sphere_index]);
+
+		bool is_visible = true;
+		for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+		{
+			const vector4f plane = frustum.planes[plane_index];
+			const float distance = vector_dot3(plane, center) + vector_get_w(plane);
+			if (distance < -radius)
+			{
+				is_visible = false;
+				break;
+			}
+		}
+
+		if (is_visible)
+			visible_indices[num_visible++] = sphere_index;
+	}
+
+	return num_visible;
+}
+
+RTM_FORCE_NOINLINE uint32_t frustum_cull_soa(const frustumf& frustum, const spheref* spheres, uint32_t num_spheres, uint32_t* visible_indices) RTM_NO_EXCEPT
+{
+	return frustum_cull(frustum, spheres, num_spheres, visible_indices);
+}
+
+static constexpr uint32_t k_num_bench_spheres = 1024;
+
+static void setup_frustum_cull_bench(frustumf& frustum, spheref* spheres)
+{
+	// Left handed perspective projection with a 90 degree field of view, depth maps to [0, 1]
+	const float depth_scale = 100.0F / 99.0F;
+	const matrix4x4f projection = matrix_set(vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, depth_scale, 1.0F), vector_set(0.0F, 0.0F, -depth_scale, 0.0F));
+	frustum = frustum_from_matrix(projection);
+
+	// Roughly half of the spheres are visible in an unpredictable pattern
+	uint32_t seed = 12345;
+	for (uint32_t sphere_index = 0; sphere_index < k_num_bench_spheres; ++sphere_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const float x = float(seed % 200) - 100.0F;
+		seed = seed * 1664525 + 1013904223;
+		const float y = float(seed % 200) - 100.0F;
+		seed = seed * 1664525 + 1013904223;
+		const float z = float(seed % 120) - 10.0F;
+		spheres[sphere_index] = sphere_set(vector_set(x, y, z), 2.0F);
+	}
+}
+
+static void bm_frustum_cull_ref(benchmark::State& state)
+{
+	frustumf frustum;
+	spheref spheres[k_num_bench_spheres];
+	uint32_t visible_indices[k_num_bench_spheres];
+	setup_frustum_cull_bench(frustum, spheres);
+
+	uint32_t num_visible = 0;
+	for (auto _ : state)
+		num_visible += frustum_cull_ref(frustum, spheres, k_num_bench_spheres, visible_indices);
+
+	benchmark::DoNotOptimize(num_visible);
+	benchmark::DoNotOptimize(visible_indices);
+}
+
+BENCHMARK(bm_frustum_cull_ref);
+
+static void bm_frustum_cull_soa(benchmark::State& state)
+{
+	frustumf frustum;
+	spheref spheres[k_num_bench_spheres];
+	uint32_t visible_indices[k_num_bench_spheres];
+	setup_frustum_cull_bench(frustum, spheres);
+
+	uint32_t num_visible = 0;
+	for (auto _ : state)
+		num_visible += frustum_cull_soa(frustum, spheres, k_num_bench_spheres, visible_indices);
+
+	benchmark::DoNotOptimize(num_visible);
+	benchmark::DoNotOptimize(visible_indices);
+}
+
+BENCHMARK(bm_frustum_cull_soa);
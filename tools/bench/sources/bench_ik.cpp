@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/ikf.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_chains = 256;
+static constexpr uint32_t k_num_bench_joints = 5;
+static constexpr uint32_t k_num_bench_iterations = 4;
+
+struct ik_bench_data
+{
+	qvvf input_chains[k_num_bench_chains][k_num_bench_joints];
+	qvvf chains[k_num_bench_chains][k_num_bench_joints];
+	vector4f targets[k_num_bench_chains];
+};
+
+static void setup_ik_bench(ik_bench_data& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; ++chain_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const quatf bend = quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), scalar_deg_to_rad(float(seed % 45)));
+
+		quatf rotation = bend;
+		vector4f position = vector_zero();
+		for (uint32_t joint_index = 0; joint_index < k_num_bench_joints; ++joint_index)
+		{
+			data.input_chains[chain_index][joint_index] = qvv_set(rotation, position, vector_set(1.0F));
+			position = vector_add(position, quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), rotation));
+			rotation = quat_mul(bend, rotation);
+		}
+
+		seed = seed * 1664525 + 1013904223;
+		const float x = float(seed % 400) / 100.0F - 2.0F;
+		seed = seed * 1664525 + 1013904223;
+		const float y = float(seed % 400) / 100.0F - 2.0F;
+		seed = seed * 1664525 + 1013904223;
+		const float z = float(seed % 400) / 100.0F - 2.0F;
+		data.targets[chain_index] = vector_set(x, y, z);
+	}
+}
+
+static void reset_ik_bench(ik_bench_data& data)
+{
+	for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; ++chain_index)
+		for (uint32_t joint_index = 0; joint_index < k_num_bench_joints; ++joint_index)
+			data.chains[chain_index][joint_index] = data.input_chains[chain_index][joint_index];
+}
+
+static void bm_ik_two_bone(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	const vector4f bend_direction = vector_set(0.0F, 0.0F, 1.0F);
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; ++chain_index)
+			ik_two_bone(data.chains[chain_index], data.targets[chain_index], bend_direction);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_two_bone);
+
+static void bm_ik_two_bone_soa(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	const vector4f bend_x = vector_zero();
+	const vector4f bend_y = vector_zero();
+	const vector4f bend_z = vector_set(1.0F);
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; chain_index += 4)
+		{
+			qvvf* chain0 = data.chains[chain_index + 0];
+			qvvf* chain1 = data.chains[chain_index + 1];
+			qvvf* chain2 = data.chains[chain_index + 2];
+			qvvf* chain3 = data.chains[chain_index + 3];
+
+			vector4f target_x, target_y, target_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(data.targets[chain_index + 0], data.targets[chain_index + 1], data.targets[chain_index + 2], data.targets[chain_index + 3], target_x, target_y, target_z);
+
+			ik_chain4f<3> chains;
+			ik_chain_load(chain0, chain1, chain2, chain3, chains);
+			ik_two_bone(chains, target_x, target_y, target_z, bend_x, bend_y, bend_z);
+			ik_chain_store(chains, chain0, chain1, chain2, chain3);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_two_bone_soa);
+
+static void bm_ik_ccd(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; ++chain_index)
+			for (uint32_t iteration = 0; iteration < k_num_bench_iterations; ++iteration)
+				ik_ccd_iteration(data.chains[chain_index], k_num_bench_joints, data.targets[chain_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_ccd);
+
+static void bm_ik_ccd_soa(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; chain_index += 4)
+		{
+			qvvf* chain0 = data.chains[chain_index + 0];
+			qvvf* chain1 = data.chains[chain_index + 1];
+			qvvf* chain2 = data.chains[chain_index + 2];
+			qvvf* chain3 = data.chains[chain_index + 3];
+
+			vector4f target_x, target_y, target_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(data.targets[chain_index + 0], data.targets[chain_index + 1], data.targets[chain_index + 2], data.targets[chain_index + 3], target_x, target_y, target_z);
+
+			ik_chain4f<k_num_bench_joints> chains;
+			ik_chain_load(chain0, chain1, chain2, chain3, chains);
+			ik_ccd(chains, target_x, target_y, target_z, k_num_bench_iterations);
+			ik_chain_store(chains, chain0, chain1, chain2, chain3);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_ccd_soa);
+
+static void bm_ik_fabrik(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	vector4f positions[k_num_bench_joints];
+	float bone_lengths[k_num_bench_joints - 1];
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; ++chain_index)
+			ik_fabrik(data.chains[chain_index], k_num_bench_joints, data.targets[chain_index], k_num_bench_iterations, positions, bone_lengths);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_fabrik);
+
+static void bm_ik_fabrik_soa(benchmark::State& state)
+{
+	ik_bench_data data;
+	setup_ik_bench(data);
+
+	for (auto _ : state)
+	{
+		reset_ik_bench(data);
+
+		for (uint32_t chain_index = 0; chain_index < k_num_bench_chains; chain_index += 4)
+		{
+			qvvf* chain0 = data.chains[chain_index + 0];
+			qvvf* chain1 = data.chains[chain_index + 1];
+			qvvf* chain2 = data.chains[chain_index + 2];
+			qvvf* chain3 = data.chains[chain_index + 3];
+
+			vector4f target_x, target_y, target_z;
+			RTM_MATRIXF_TRANSPOSE_4X3(data.targets[chain_index + 0], data.targets[chain_index + 1], data.targets[chain_index + 2], data.targets[chain_index + 3], target_x, target_y, target_z);
+
+			ik_chain4f<k_num_bench_joints> chains;
+			ik_chain_load(chain0, chain1, chain2, chain3, chains);
+			ik_fabrik(chains, target_x, target_y, target_z, k_num_bench_iterations);
+			ik_chain_store(chains, chain0, chain1, chain2, chain3);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.chains);
+}
+
+BENCHMARK(bm_ik_fabrik_soa);
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x3d.h>
+#include <rtm/matrix3x3f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_tensors = 1024;
+
+template<typename float_type>
+struct inertia_bench_data
+{
+	using quat = typename float_traits<float_type>::quat;
+	using vector4 = typename float_traits<float_type>::vector4;
+	using matrix3x3 = typename float_traits<float_type>::matrix3x3;
+
+	quat rotations[k_num_bench_tensors];
+	vector4 diagonals[k_num_bench_tensors];
+	matrix3x3 tensors[k_num_bench_tensors];
+};
+
+template<typename float_type>
+static void setup_inertia_bench(inertia_bench_data<float_type>& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t tensor_index = 0; tensor_index < k_num_bench_tensors; ++tensor_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const float_type pitch = scalar_deg_to_rad(float_type(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float_type yaw = scalar_deg_to_rad(float_type(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float_type roll = scalar_deg_to_rad(float_type(seed % 360));
+
+		data.rotations[tensor_index] = quat_from_euler(pitch, yaw, roll);
+		data.diagonals[tensor_index] = vector_set(float_type(1.0) / float_type(1 + seed % 7), float_type(1.0) / float_type(1 + seed % 5), float_type(1.0) / float_type(1 + seed % 3));
+	}
+}
+
+template<typename float_type>
+static void bm_matrix_rotate_inertia_ref_impl(benchmark::State& state)
+{
+	inertia_bench_data<float_type> data;
+	setup_inertia_bench(data);
+
+	using matrix3x3 = typename float_traits<float_type>::matrix3x3;
+
+	for (auto _ : state)
+	{
+		// R^T * I^-1 * R with generic matrix math
+		for (uint32_t tensor_index = 0; tensor_index < k_num_bench_tensors; ++tensor_index)
+		{
+			const matrix3x3 rotation_mtx = matrix_from_quat(data.rotations[tensor_index]);
+			const matrix3x3 diagonal_mtx = matrix_from_scale(data.diagonals[tensor_index]);
+			data.tensors[tensor_index] = matrix_mul(matrix_mul(matrix_transpose(rotation_mtx), diagonal_mtx), rotation_mtx);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.tensors);
+}
+
+template<typename float_type>
+static void bm_matrix_rotate_inertia_impl(benchmark::State& state)
+{
+	inertia_bench_data<float_type> data;
+	setup_inertia_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t tensor_index = 0; tensor_index < k_num_bench_tensors; ++tensor_index)
+			data.tensors[tensor_index] = matrix_rotate_inertia(data.rotations[tensor_index], data.diagonals[tensor_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.tensors);
+}
+
+template<typename float_type>
+static void bm_matrix_rotate_inertia_batch_impl(benchmark::State& state)
+{
+	inertia_bench_data<float_type> data;
+	setup_inertia_bench(data);
+
+	for (auto _ : state)
+	{
+		matrix_rotate_inertia(data.rotations, data.diagonals, k_num_bench_tensors, data.tensors);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.tensors);
+}
+
+static void bm_matrix_rotate_inertia_ref_f(benchmark::State& state) { bm_matrix_rotate_inertia_ref_impl<float>(state); }
+static void bm_matrix_rotate_inertia_f(benchmark::State& state) { bm_matrix_rotate_inertia_impl<float>(state); }
+static void bm_matrix_rotate_inertia_batch_f(benchmark::State& state) { bm_matrix_rotate_inertia_batch_impl<float>(state); }
+static void bm_matrix_rotate_inertia_ref_d(benchmark::State& state) { bm_matrix_rotate_inertia_ref_impl<double>(state); }
+static void bm_matrix_rotate_inertia_d(benchmark::State& state) { bm_matrix_rotate_inertia_impl<double>(state); }
+static void bm_matrix_rotate_inertia_batch_d(benchmark::State& state) { bm_matrix_rotate_inertia_batch_impl<double>(state); }
+
+BENCHMARK(bm_matrix_rotate_inertia_ref_f);
+BENCHMARK(bm_matrix_rotate_inertia_f);
+BENCHMARK(bm_matrix_rotate_inertia_batch_f);
+BENCHMARK(bm_matrix_rotate_inertia_ref_d);
+BENCHMARK(bm_matrix_rotate_inertia_d);
+BENCHMARK(bm_matrix_rotate_inertia_batch_d);
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_rotations = 1024;
+
+static void setup_quat_euler_bench(float3f* angles, quatf* rotations)
+{
+	uint32_t seed = 12345;
+	for (uint32_t rotation_index = 0; rotation_index < k_num_bench_rotations; ++rotation_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const float pitch = scalar_deg_to_rad(float(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float yaw = scalar_deg_to_rad(float(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float roll = scalar_deg_to_rad(float(seed % 360));
+
+		angles[rotation_index] = float3f{ pitch, yaw, roll };
+		rotations[rotation_index] = quat_from_euler(pitch, yaw, roll);
+	}
+}
+
+static void bm_quat_from_euler_scalar(benchmark::State& state)
+{
+	float3f angles[k_num_bench_rotations];
+	quatf rotations[k_num_bench_rotations];
+	setup_quat_euler_bench(angles, rotations);
+
+	for (auto _ : state)
+	{
+		for (uint32_t rotation_index = 0; rotation_index < k_num_bench_rotations; ++rotation_index)
+			rotations[rotation_index] = quat_from_euler(angles[rotation_index].x, angles[rotation_index].y, angles[rotation_index].z);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_euler_scalar);
+
+static void bm_quat_from_euler(benchmark::State& state)
+{
+	float3f angles[k_num_bench_rotations];
+	quatf rotations[k_num_bench_rotations];
+	setup_quat_euler_bench(angles, rotations);
+
+	for (auto _ : state)
+	{
+		for (uint32_t rotation_index = 0; rotation_index < k_num_bench_rotations; ++rotation_index)
+			rotations[rotation_index] = quat_from_euler<euler_order::zyx>(vector_load3(&angles[rotation_index]));
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_euler);
+
+static void bm_quat_from_euler_batch(benchmark::State& state)
+{
+	float3f angles[k_num_bench_rotations];
+	quatf rotations[k_num_bench_rotations];
+	setup_quat_euler_bench(angles, rotations);
+
+	for (auto _ : state)
+	{
+		quat_from_euler<euler_order::zyx>(angles, k_num_bench_rotations, rotations);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_euler_batch);
+
+static void bm_quat_to_euler(benchmark::State& state)
+{
+	float3f angles[k_num_bench_rotations];
+	quatf rotations[k_num_bench_rotations];
+	setup_quat_euler_bench(angles, rotations);
+
+	for (auto _ : state)
+	{
+		for (uint32_t rotation_index = 0; rotation_index < k_num_bench_rotations; ++rotation_index)
+			vector_store3(quat_to_euler<euler_order::zyx>(rotations[rotation_index]), &angles[rotation_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(angles);
+}
+
+BENCHMARK(bm_quat_to_euler);
+
+static void bm_quat_to_euler_batch(benchmark::State& state)
+{
+	float3f angles[k_num_bench_rotations];
+	quatf rotations[k_num_bench_rotations];
+	setup_quat_euler_bench(angles, rotations);
+
+	for (auto _ : state)
+	{
+		quat_to_euler<euler_order::zyx>(rotations, k_num_bench_rotations, angles);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(angles);
+}
+
+BENCHMARK(bm_quat_to_euler_batch);
@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_from_matrix_ref(matrix3x4f_arg0 input) RTM_NO_EXCEPT
+{
+	// Branches on the trace and on the largest diagonal entry, writes to the stack and reloads
+	const vector4f x_axis = input.x_axis;
+	const vector4f y_axis = input.y_axis;
+	const vector4f z_axis = input.z_axis;
+
+	const float x_axis_x = vector_get_x(x_axis);
+	const float y_axis_y = vector_get_y(y_axis);
+	const float z_axis_z = vector_get_z(z_axis);
+
+	const float mtx_trace = x_axis_x + y_axis_y + z_axis_z;
+	if (mtx_trace > 0.0F)
+	{
+		const float inv_trace = scalar_sqrt_reciprocal(mtx_trace + 1.0F);
+		const float half_inv_trace = inv_trace * 0.5F;
+
+		const float x = (float(vector_get_z(y_axis)) - float(vector_get_y(z_axis))) * half_inv_trace;
+		const float y = (float(vector_get_x(z_axis)) - float(vector_get_z(x_axis))) * half_inv_trace;
+		const float z = (float(vector_get_y(x_axis)) - float(vector_get_x(y_axis))) * half_inv_trace;
+		const float w = scalar_reciprocal(inv_trace) * 0.5F;
+
+		return quat_normalize(quat_set(x, y, z, w));
+	}
+	else
+	{
+		float values[3][4];
+		vector_store(x_axis, &values[0][0]);
+		vector_store(y_axis, &values[1][0]);
+		vector_store(z_axis, &values[2][0]);
+
+		int32_t best_axis = 0;
+		if (y_axis_y > x_axis_x)
+			best_axis = 1;
+		if (z_axis_z > values[best_axis][best_axis])
+			best_axis = 2;
+
+		const int32_t next_best_axis = (best_axis + 1) % 3;
+		const int32_t next_next_best_axis = (next_best_axis + 1) % 3;
+
+		const float mtx_pseudo_trace = 1.0F + values[best_axis][best_axis] - values[next_best_axis][next_best_axis] - values[next_next_best_axis][next_next_best_axis];
+
+		const float inv_pseudo_trace = scalar_sqrt_reciprocal(mtx_pseudo_trace);
+		const float half_inv_pseudo_trace = inv_pseudo_trace * 0.5F;
+
+		float quat_values[4];
+		quat_values[best_axis] = scalar_reciprocal(inv_pseudo_trace) * 0.5F;
+		quat_values[next_best_axis] = half_inv_pseudo_trace * (values[best_axis][next_best_axis] + values[next_best_axis][best_axis]);
+		quat_values[next_next_best_axis] = half_inv_pseudo_trace * (values[best_axis][next_next_best_axis] + values[next_next_best_axis][best_axis]);
+		quat_values[3] = half_inv_pseudo_trace * (values[next_best_axis][next_next_best_axis] - values[next_next_best_axis][next_best_axis]);
+
+		return quat_normalize(quat_load(&quat_values[0]));
+	}
+}
+
+static constexpr uint32_t k_num_bench_matrices = 1024;
+
+static void setup_quat_from_matrix_bench(matrix3x4f* matrices)
+{
+	// Random rotations select every quaternion component in an unpredictable pattern
+	uint32_t seed = 12345;
+	for (uint32_t matrix_index = 0; matrix_index < k_num_bench_matrices; ++matrix_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const float pitch = float(seed % 360);
+		seed = seed * 1664525 + 1013904223;
+		const float yaw = float(seed % 360);
+		seed = seed * 1664525 + 1013904223;
+		const float roll = float(seed % 360);
+		matrices[matrix_index] = matrix_from_quat(quat_from_euler(scalar_deg_to_rad(pitch), scalar_deg_to_rad(yaw), scalar_deg_to_rad(roll)));
+	}
+}
+
+static void bm_quat_from_matrix_ref(benchmark::State& state)
+{
+	matrix3x4f matrices[k_num_bench_matrices];
+	quatf rotations[k_num_bench_matrices];
+	setup_quat_from_matrix_bench(matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_bench_matrices; ++matrix_index)
+			rotations[matrix_index] = quat_from_matrix_ref(matrices[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_matrix_ref);
+
+static void bm_quat_from_matrix(benchmark::State& state)
+{
+	matrix3x4f matrices[k_num_bench_matrices];
+	quatf rotations[k_num_bench_matrices];
+	setup_quat_from_matrix_bench(matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_bench_matrices; ++matrix_index)
+			rotations[matrix_index] = quat_from_matrix(matrices[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_matrix);
+
+static void bm_quat_from_matrices(benchmark::State& state)
+{
+	matrix3x4f matrices[k_num_bench_matrices];
+	quatf rotations[k_num_bench_matrices];
+	setup_quat_from_matrix_bench(matrices);
+
+	for (auto _ : state)
+	{
+		quat_from_matrices(matrices, k_num_bench_matrices, rotations);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+}
+
+BENCHMARK(bm_quat_from_matrices);
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_joints = 1024;
+
+struct swing_twist_bench_data
+{
+	quatf rotations[k_num_bench_joints];
+	vector4f twist_axes[k_num_bench_joints];
+	float max_swing_angles[k_num_bench_joints];
+	float min_twist_angles[k_num_bench_joints];
+	float max_twist_angles[k_num_bench_joints];
+	quatf results[k_num_bench_joints];
+};
+
+static void setup_swing_twist_bench(swing_twist_bench_data& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t joint_index = 0; joint_index < k_num_bench_joints; ++joint_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		const float pitch = scalar_deg_to_rad(float(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float yaw = scalar_deg_to_rad(float(seed % 360));
+		seed = seed * 1664525 + 1013904223;
+		const float roll = scalar_deg_to_rad(float(seed % 360));
+
+		data.rotations[joint_index] = quat_from_euler(pitch, yaw, roll);
+		data.twist_axes[joint_index] = vector_set(1.0F, 0.0F, 0.0F);
+		data.max_swing_angles[joint_index] = scalar_deg_to_rad(float(seed % 90));
+		data.min_twist_angles[joint_index] = -scalar_deg_to_rad(float(seed % 45));
+		data.max_twist_angles[joint_index] = scalar_deg_to_rad(float(seed % 60));
+	}
+}
+
+static void bm_quat_clamp_swing_twist(benchmark::State& state)
+{
+	swing_twist_bench_data data;
+	setup_swing_twist_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t joint_index = 0; joint_index < k_num_bench_joints; ++joint_index)
+			data.results[joint_index] = quat_clamp_swing_twist(data.rotations[joint_index], data.twist_axes[joint_index], data.max_swing_angles[joint_index], data.min_twist_angles[joint_index], data.max_twist_angles[joint_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.results);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist);
+
+static void bm_quat_clamp_swing_twist_batch(benchmark::State& state)
+{
+	swing_twist_bench_data data;
+	setup_swing_twist_bench(data);
+
+	for (auto _ : state)
+	{
+		quat_clamp_swing_twist(data.rotations, data.twist_axes, data.max_swing_angles, data.min_twist_angles, data.max_twist_angles, k_num_bench_joints, data.results);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.results);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist_batch);
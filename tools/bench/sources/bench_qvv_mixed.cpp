@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvd.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvm.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_transforms = 1024;
+
+static void setup_qvv_mixed_bench(qvvm* locals, qvvm* worlds)
+{
+	uint32_t seed = 12345;
+	for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+	{
+		float values[6];
+		for (float& value : values)
+		{
+			seed = seed * 1664525 + 1013904223;
+			value = float(seed % 2000) / 1000.0F - 1.0F;
+		}
+
+		const quatf rotation = quat_from_euler(values[0], values[1], values[2]);
+		const vector4d local_translation = vector_set(double(values[3]), double(values[4]), double(values[5]));
+		const vector4d world_translation = vector_mul(local_translation, 1.0E6);
+		const vector4f scale = vector_set(1.0F + scalar_abs(values[0]));
+
+		locals[transform_index] = qvv_set(rotation, local_translation, scale);
+		worlds[transform_index] = qvv_set(rotation, world_translation, scale);
+	}
+}
+
+static qvvd to_qvvd(const qvvm& input) { return qvv_cast(input); }
+static qvvf to_qvvf(const qvvm& input) { return qvv_cast(qvv_cast(input)); }
+static qvvm to_qvvm(const qvvm& input) { return input; }
+
+template<typename transform_type, typename convert_type>
+static void bm_qvv_mixed_mul_impl(benchmark::State& state, convert_type convert)
+{
+	qvvm mixed_locals[k_num_bench_transforms];
+	qvvm mixed_worlds[k_num_bench_transforms];
+	setup_qvv_mixed_bench(mixed_locals, mixed_worlds);
+
+	transform_type locals[k_num_bench_transforms];
+	transform_type worlds[k_num_bench_transforms];
+	transform_type results[k_num_bench_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+	{
+		locals[transform_index] = convert(mixed_locals[transform_index]);
+		worlds[transform_index] = convert(mixed_worlds[transform_index]);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+			results[transform_index] = qvv_mul(locals[transform_index], worlds[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(results);
+}
+
+template<typename transform_type, typename point_type, typename convert_type>
+static void bm_qvv_mixed_mul_point3_impl(benchmark::State& state, convert_type convert, point_type point)
+{
+	qvvm mixed_locals[k_num_bench_transforms];
+	qvvm mixed_worlds[k_num_bench_transforms];
+	setup_qvv_mixed_bench(mixed_locals, mixed_worlds);
+
+	transform_type worlds[k_num_bench_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+		worlds[transform_index] = convert(mixed_worlds[transform_index]);
+
+	decltype(qvv_mul_point3(point, worlds[0])) results[k_num_bench_transforms];
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+			results[transform_index] = qvv_mul_point3(point, worlds[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(results);
+}
+
+static void bm_qvv_mixed_mul_qvvf(benchmark::State& state) { bm_qvv_mixed_mul_impl<qvvf>(state, to_qvvf); }
+static void bm_qvv_mixed_mul_qvvd(benchmark::State& state) { bm_qvv_mixed_mul_impl<qvvd>(state, to_qvvd); }
+static void bm_qvv_mixed_mul_qvvm(benchmark::State& state) { bm_qvv_mixed_mul_impl<qvvm>(state, to_qvvm); }
+
+static void bm_qvv_mixed_mul_point3_qvvf(benchmark::State& state) { bm_qvv_mixed_mul_point3_impl<qvvf>(state, to_qvvf, vector_set(0.5F, -1.25F, 2.0F)); }
+static void bm_qvv_mixed_mul_point3_qvvd(benchmark::State& state) { bm_qvv_mixed_mul_point3_impl<qvvd>(state, to_qvvd, vector_set(0.5, -1.25, 2.0)); }
+static void bm_qvv_mixed_mul_point3_qvvm(benchmark::State& state) { bm_qvv_mixed_mul_point3_impl<qvvm>(state, to_qvvm, vector_set(0.5F, -1.25F, 2.0F)); }
+
+BENCHMARK(bm_qvv_mixed_mul_qvvf);
+BENCHMARK(bm_qvv_mixed_mul_qvvd);
+BENCHMARK(bm_qvv_mixed_mul_qvvm);
+BENCHMARK(bm_qvv_mixed_mul_point3_qvvf);
+BENCHMARK(bm_qvv_mixed_mul_point3_qvvd);
+BENCHMARK(bm_qvv_mixed_mul_point3_qvvm);
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/rayf.h>
+
+#include <cstdint>
+#include <limits>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE bool ray_intersect_triangles_ref(const rayf& ray, const float3f* vertices, uint32_t num_triangles, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+{
+	// One triangle at a time
+	float closest_t = std::numeric_limits<float>::infinity();
+	uint32_t closest_index = ~0U;
+	for (uint32_t triangle_index = 0; triangle_index < num_triangles; ++triangle_index)
+	{
+		const float3f* triangle_vertices = vertices + triangle_index * 3;
+
+		float t;
+		if (ray_intersect_triangle(ray, vector_load3(triangle_vertices + 0), vector_load3(triangle_vertices + 1), vector_load3(triangle_vertices + 2), t) && t < closest_t)
+		{
+			closest_t = t;
+			closest_index = triangle_index;
+		}
+	}
+
+	out_t = closest_t;
+	out_index = closest_index;
+	return closest_index != ~0U;
+}
+
+RTM_FORCE_NOINLINE bool ray_intersect_triangles_soa(const rayf& ray, const float3f* vertices, uint32_t num_triangles, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+{
+	return ray_intersect_triangles(ray, vertices, num_triangles, out_t, out_index);
+}
+
+RTM_FORCE_NOINLINE bool ray_intersect_aabbs_ref(const rayf& ray, const aabbf* aabbs, uint32_t num_aabbs, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+{
+	// One box at a time
+	float closest_t = std::numeric_limits<float>::infinity();
+	uint32_t closest_index = ~0U;
+	for (uint32_t aabb_index = 0; aabb_index < num_aabbs; ++aabb_index)
+	{
+		float t;
+		if (ray_intersect_aabb(ray, aabbs[aabb_index], t) && t < closest_t)
+		{
+			closest_t = t;
+			closest_index = aabb_index;
+		}
+	}
+
+	out_t = closest_t;
+	out_index = closest_index;
+	return closest_index != ~0U;
+}
+
+RTM_FORCE_NOINLINE bool ray_intersect_aabbs_soa(const rayf& ray, const aabbf* aabbs, uint32_t num_aabbs, float& out_t, uint32_t& out_index) RTM_NO_EXCEPT
+{
+	return ray_intersect_aabbs(ray, aabbs, num_aabbs, out_t, out_index);
+}
+
+static constexpr uint32_t k_num_bench_primitives = 1024;
+
+static float bench_random(uint32_t& seed)
+{
+	seed = seed * 1664525 + 1013904223;
+	return float(seed % 2000) * 0.01F - 10.0F;
+}
+
+static void setup_ray_bench(rayf& ray, float3f* vertices, aabbf* aabbs)
+{
+	ray = ray_set(vector_set(0.0F, 0.0F, -50.0F), vector_set(0.01F, 0.02F, 1.0F));
+
+	// Primitives scattered around the ray, a few of them are hit
+	uint32_t seed = 12345;
+	for (uint32_t primitive_index = 0; primitive_index < k_num_bench_primitives; ++primitive_index)
+	{
+		const vector4f center = vector_set(bench_random(seed), bench_random(seed), bench_random(seed) * 4.0F);
+
+		for (uint32_t vertex_index = 0; vertex_index < 3; ++vertex_index)
+		{
+			const vector4f offset = vector_set(bench_random(seed), bench_random(seed), bench_random(seed));
+			vector_store3(vector_add(center, vector_mul(offset, 0.1F)), vertices + primitive_index * 3 + vertex_index);
+		}
+
+		aabbs[primitive_index] = aabb_set(center, vector_set(0.5F));
+	}
+}
+
+static void bm_ray_intersect_triangles_ref(benchmark::State& state)
+{
+	rayf ray;
+	float3f vertices[k_num_bench_primitives * 3];
+	aabbf aabbs[k_num_bench_primitives];
+	setup_ray_bench(ray, vertices, aabbs);
+
+	float t = 0.0F;
+	uint32_t index = 0;
+	for (auto _ : state)
+		ray_intersect_triangles_ref(ray, vertices, k_num_bench_primitives, t, index);
+
+	benchmark::DoNotOptimize(t);
+	benchmark::DoNotOptimize(index);
+}
+
+BENCHMARK(bm_ray_intersect_triangles_ref);
+
+static void bm_ray_intersect_triangles_soa(benchmark::State& state)
+{
+	rayf ray;
+	float3f vertices[k_num_bench_primitives * 3];
+	aabbf aabbs[k_num_bench_primitives];
+	setup_ray_bench(ray, vertices, aabbs);
+
+	float t = 0.0F;
+	uint32_t index = 0;
+	for (auto _ : state)
+		ray_intersect_triangles_soa(ray, vertices, k_num_bench_primitives, t, index);
+
+	benchmark::DoNotOptimize(t);
+	benchmark::DoNotOptimize(index);
+}
+
+BENCHMARK(bm_ray_intersect_triangles_soa);
+
+static void bm_ray_intersect_aabbs_ref(benchmark::State& state)
+{
+	rayf ray;
+	float3f vertices[k_num_bench_primitives * 3];
+	aabbf aabbs[k_num_bench_primitives];
+	setup_ray_bench(ray, vertices, aabbs);
+
+	float t = 0.0F;
+	uint32_t index = 0;
+	for (auto _ : state)
+		ray_intersect_aabbs_ref(ray, aabbs, k_num_bench_primitives, t, index);
+
+	benchmark::DoNotOptimize(t);
+	benchmark::DoNotOptimize(index);
+}
+
+BENCHMARK(bm_ray_intersect_aabbs_ref);
+
+static void bm_ray_intersect_aabbs_soa(benchmark::State& state)
+{
+	rayf ray;
+	float3f vertices[k_num_bench_primitives * 3];
+	aabbf aabbs[k_num_bench_primitives];
+	setup_ray_bench(ray, vertices, aabbs);
+
+	float t = 0.0F;
+	uint32_t index = 0;
+	for (auto _ : state)
+		ray_intersect_aabbs_soa(ray, aabbs, k_num_bench_primitives, t, index);
+
+	benchmark::DoNotOptimize(t);
+	benchmark::DoNotOptimize(index);
+}
+
+BENCHMARK(bm_ray_intersect_aabbs_soa);
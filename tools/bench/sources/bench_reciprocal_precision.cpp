@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// These benchmarks compare the throughput of the three precision tiers: the full precision
+// functions, a single Newton-Raphson iteration ('_nr1'), and the raw hardware estimate ('_approx').
+
+static constexpr uint32_t k_num_bench_precision_values = 1024;
+
+RTM_FORCE_NOINLINE void vector_reciprocal_exact_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_reciprocal(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_reciprocal_nr1_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_reciprocal_nr1(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_reciprocal_approx_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_reciprocal_approx(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_normalize3_exact_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_normalize3(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_normalize3_nr1_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_normalize3_nr1(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_normalize3_approx_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = vector_normalize3_approx(inputs[value_index]);
+}
+
+RTM_FORCE_NOINLINE void quat_normalize_exact_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = quat_to_vector(quat_normalize(vector_to_quat(inputs[value_index])));
+}
+
+RTM_FORCE_NOINLINE void quat_normalize_nr1_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = quat_to_vector(quat_normalize_nr1(vector_to_quat(inputs[value_index])));
+}
+
+RTM_FORCE_NOINLINE void quat_normalize_approx_impl(const vector4f* inputs, uint32_t num_values, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		outputs[value_index] = quat_to_vector(quat_normalize_approx(vector_to_quat(inputs[value_index])));
+}
+
+template<void(*precision_impl)(const vector4f*, uint32_t, vector4f*)>
+static void bm_reciprocal_precision(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_precision_values];
+	vector4f outputs[k_num_bench_precision_values];
+
+	for (uint32_t value_index = 0; value_index < k_num_bench_precision_values; ++value_index)
+	{
+		const float value = float(value_index % 64) + 0.5F;
+		inputs[value_index] = vector_set(value, 2.0F - value, value * 0.5F, 1.0F);
+	}
+
+	for (auto _ : state)
+	{
+		precision_impl(inputs, k_num_bench_precision_values, outputs);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+}
+
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_reciprocal_exact_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_reciprocal_nr1_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_reciprocal_approx_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_normalize3_exact_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_normalize3_nr1_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, vector_normalize3_approx_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, quat_normalize_exact_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, quat_normalize_nr1_impl);
+BENCHMARK_TEMPLATE(bm_reciprocal_precision, quat_normalize_approx_impl);
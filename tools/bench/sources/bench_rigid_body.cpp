@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+// Runtime dispatch is opt-in and must be enabled before including RTM
+// It cannot be used with deterministic math since the dispatched kernels use FMA
+#if !defined(RTM_DETERMINISTIC)
+	#define RTM_RUNTIME_DISPATCH
+#endif
+
+#include <rtm/quatf.h>
+#include <rtm/rigid_bodyf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_bodies = 10000;
+
+struct rigid_body_bench_data
+{
+	float state[13][k_num_bench_bodies];
+
+	quatf rotations[k_num_bench_bodies];
+	vector4f positions[k_num_bench_bodies];
+	vector4f linear_velocities[k_num_bench_bodies];
+	vector4f angular_velocities[k_num_bench_bodies];
+
+	uint32_t sleep_bits[(k_num_bench_bodies + 31) / 32];
+};
+
+// Same as rigid_body_integrate(..) without the runtime dispatch, bodies are processed 4 at a time
+RTM_FORCE_NOINLINE void rigid_body_integrate_static(const rigid_bodies_soaf& bodies, uint32_t num_bodies, vector4f_arg0 linear_acceleration, float delta_time, const uint32_t* sleep_bits = nullptr) RTM_NO_EXCEPT
+{
+	rtm_impl::rigid_body_step4f step;
+	step.linear_acceleration_x = vector_dup_x(linear_acceleration);
+	step.linear_acceleration_y = vector_dup_y(linear_acceleration);
+	step.linear_acceleration_z = vector_dup_z(linear_acceleration);
+	step.delta_time = vector_set(delta_time);
+	step.half_delta_time = vector_set(delta_time * 0.5F);
+
+	uint32_t body_index = 0;
+	for (; body_index + 4 <= num_bodies; body_index += 4)
+	{
+		const uint32_t group_sleep_bits = rtm_impl::rigid_body_get_sleep_bits4(sleep_bits, body_index);
+		if (group_sleep_bits != 0xF)
+			rtm_impl::rigid_body_integrate4(bodies, body_index, step, group_sleep_bits);
+	}
+
+	for (; body_index < num_bodies; ++body_index)
+	{
+		const bool is_sleeping = sleep_bits != nullptr && ((sleep_bits[body_index / 32] >> (body_index % 32)) & 1) != 0;
+		if (!is_sleeping)
+			rtm_impl::rigid_body_integrate1(bodies, body_index, linear_acceleration, delta_time);
+	}
+}
+
+static void setup_rigid_body_bench(rigid_body_bench_data& data, rigid_bodies_soaf& bodies)
+{
+	uint32_t seed = 12345;
+	for (uint32_t component_index = 0; component_index < 13; ++component_index)
+	{
+		for (uint32_t body_index = 0; body_index < k_num_bench_bodies; ++body_index)
+		{
+			seed = seed * 1664525 + 1013904223;
+			data.state[component_index][body_index] = float(seed % 2000) / 1000.0F - 1.0F;
+		}
+	}
+
+	for (uint32_t body_index = 0; body_index < k_num_bench_bodies; ++body_index)
+	{
+		const quatf rotation = quat_normalize(quat_set(data.state[3][body_index], data.state[4][body_index], data.state[5][body_index], data.state[6][body_index]));
+		data.state[3][body_index] = quat_get_x(rotation);
+		data.state[4][body_index] = quat_get_y(rotation);
+		data.state[5][body_index] = quat_get_z(rotation);
+		data.state[6][body_index] = quat_get_w(rotation);
+
+		data.positions[body_index] = vector_set(data.state[0][body_index], data.state[1][body_index], data.state[2][body_index]);
+		data.rotations[body_index] = rotation;
+		data.linear_velocities[body_index] = vector_set(data.state[7][body_index], data.state[8][body_index], data.state[9][body_index]);
+		data.angular_velocities[body_index] = vector_set(data.state[10][body_index], data.state[11][body_index], data.state[12][body_index]);
+	}
+
+	// Roughly half the bodies are sleeping, in runs like they would in a real scene
+	for (uint32_t word_index = 0; word_index < (k_num_bench_bodies + 31) / 32; ++word_index)
+		data.sleep_bits[word_index] = (word_index % 2) == 0 ? 0xFFFF00F0 : 0x0000F0FF;
+
+	bodies.position_x = data.state[0];
+	bodies.position_y = data.state[1];
+	bodies.position_z = data.state[2];
+	bodies.rotation_x = data.state[3];
+	bodies.rotation_y = data.state[4];
+	bodies.rotation_z = data.state[5];
+	bodies.rotation_w = data.state[6];
+	bodies.linear_velocity_x = data.state[7];
+	bodies.linear_velocity_y = data.state[8];
+	bodies.linear_velocity_z = data.state[9];
+	bodies.angular_velocity_x = data.state[10];
+	bodies.angular_velocity_y = data.state[11];
+	bodies.angular_velocity_z = data.state[12];
+}
+
+static void bm_rigid_body_integrate_ref(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		// Per body with the first order update: q += 0.5 * w * q * dt
+		for (uint32_t body_index = 0; body_index < k_num_bench_bodies; ++body_index)
+		{
+			data->linear_velocities[body_index] = vector_mul_add(gravity, delta_time, data->linear_velocities[body_index]);
+			data->positions[body_index] = vector_mul_add(data->linear_velocities[body_index], delta_time, data->positions[body_index]);
+
+			const quatf rotation = data->rotations[body_index];
+			const quatf spin = vector_to_quat(vector_set_w(vector_mul(data->angular_velocities[body_index], 0.5F * delta_time), 0.0F));
+			data->rotations[body_index] = quat_normalize(vector_to_quat(vector_add(quat_to_vector(rotation), quat_to_vector(quat_mul(rotation, spin)))));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->rotations);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_ref);
+
+static void bm_rigid_body_integrate_aos(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		for (uint32_t body_index = 0; body_index < k_num_bench_bodies; ++body_index)
+		{
+			data->linear_velocities[body_index] = vector_mul_add(gravity, delta_time, data->linear_velocities[body_index]);
+			data->positions[body_index] = vector_mul_add(data->linear_velocities[body_index], delta_time, data->positions[body_index]);
+			data->rotations[body_index] = quat_integrate(data->rotations[body_index], data->angular_velocities[body_index], delta_time);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->rotations);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_aos);
+
+static void bm_rigid_body_integrate_soa(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		rigid_body_integrate(bodies, k_num_bench_bodies, gravity, delta_time);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->state);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_soa);
+
+static void bm_rigid_body_integrate_soa_sleeping(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		rigid_body_integrate(bodies, k_num_bench_bodies, gravity, delta_time, data->sleep_bits);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->state);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_soa_sleeping);
+
+static void bm_rigid_body_integrate_soa_static(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		rigid_body_integrate_static(bodies, k_num_bench_bodies, gravity, delta_time);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->state);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_soa_static);
+
+static void bm_rigid_body_integrate_soa_sleeping_static(benchmark::State& state)
+{
+	rigid_body_bench_data* data = new rigid_body_bench_data();
+	rigid_bodies_soaf bodies;
+	setup_rigid_body_bench(*data, bodies);
+
+	const vector4f gravity = vector_set(0.0F, 0.0F, -9.81F);
+	const float delta_time = 1.0F / 60.0F;
+
+	for (auto _ : state)
+	{
+		rigid_body_integrate_static(bodies, k_num_bench_bodies, gravity, delta_time, data->sleep_bits);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data->state);
+	delete data;
+}
+
+BENCHMARK(bm_rigid_body_integrate_soa_sleeping_static);
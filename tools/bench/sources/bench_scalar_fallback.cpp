@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// These benchmarks compare field by field implementations, the way the scalar code paths
+// used to be written, against RTM. Build the benchmarks with RTM_NO_INTRINSICS (e.g. make.py -nosimd)
+// to measure the scalar code paths, otherwise the SIMD code paths are measured.
+
+static constexpr uint32_t k_num_bench_fallback_values = 1024;
+
+RTM_FORCE_NOINLINE void vector_clamp_ref(const vector4f* inputs, uint32_t num_vectors, vector4f_arg0 min_value, vector4f_arg1 max_value, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const vector4f input = inputs[vector_index];
+		const float x = scalar_min(float(vector_get_x(max_value)), scalar_max(float(vector_get_x(min_value)), float(vector_get_x(input))));
+		const float y = scalar_min(float(vector_get_y(max_value)), scalar_max(float(vector_get_y(min_value)), float(vector_get_y(input))));
+		const float z = scalar_min(float(vector_get_z(max_value)), scalar_max(float(vector_get_z(min_value)), float(vector_get_z(input))));
+		const float w = scalar_min(float(vector_get_w(max_value)), scalar_max(float(vector_get_w(min_value)), float(vector_get_w(input))));
+		outputs[vector_index] = vector_set(x, y, z, w);
+	}
+}
+
+RTM_FORCE_NOINLINE void vector_clamp_rtm(const vector4f* inputs, uint32_t num_vectors, vector4f_arg0 min_value, vector4f_arg1 max_value, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		outputs[vector_index] = vector_clamp(inputs[vector_index], min_value, max_value);
+}
+
+RTM_FORCE_NOINLINE void vector_select_ref(const vector4f* inputs, uint32_t num_vectors, vector4f_arg0 threshold, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const vector4f input = inputs[vector_index];
+		const vector4f fallback = outputs[vector_index];
+		const float x = vector_get_x(input) < vector_get_x(threshold) ? vector_get_x(input) : vector_get_x(fallback);
+		const float y = vector_get_y(input) < vector_get_y(threshold) ? vector_get_y(input) : vector_get_y(fallback);
+		const float z = vector_get_z(input) < vector_get_z(threshold) ? vector_get_z(input) : vector_get_z(fallback);
+		const float w = vector_get_w(input) < vector_get_w(threshold) ? vector_get_w(input) : vector_get_w(fallback);
+		outputs[vector_index] = vector_set(x, y, z, w);
+	}
+}
+
+RTM_FORCE_NOINLINE void vector_select_rtm(const vector4f* inputs, uint32_t num_vectors, vector4f_arg0 threshold, vector4f* outputs) RTM_NO_EXCEPT
+{
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const vector4f input = inputs[vector_index];
+		outputs[vector_index] = vector_select(vector_less_than(input, threshold), input, outputs[vector_index]);
+	}
+}
+
+RTM_FORCE_NOINLINE quatf quat_mul_ref(const quatf* inputs, uint32_t num_quats) RTM_NO_EXCEPT
+{
+	// Every multiplication depends on the previous one
+	quatf result = inputs[0];
+	for (uint32_t quat_index = 1; quat_index < num_quats; ++quat_index)
+	{
+		const quatf lhs = result;
+		const quatf rhs = inputs[quat_index];
+		const float x = (quat_get_w(rhs) * quat_get_x(lhs)) + (quat_get_x(rhs) * quat_get_w(lhs)) + (quat_get_y(rhs) * quat_get_z(lhs)) - (quat_get_z(rhs) * quat_get_y(lhs));
+		const float y = (quat_get_w(rhs) * quat_get_y(lhs)) - (quat_get_x(rhs) * quat_get_z(lhs)) + (quat_get_y(rhs) * quat_get_w(lhs)) + (quat_get_z(rhs) * quat_get_x(lhs));
+		const float z = (quat_get_w(rhs) * quat_get_z(lhs)) + (quat_get_x(rhs) * quat_get_y(lhs)) - (quat_get_y(rhs) * quat_get_x(lhs)) + (quat_get_z(rhs) * quat_get_w(lhs));
+		const float w = (quat_get_w(rhs) * quat_get_w(lhs)) - (quat_get_x(rhs) * quat_get_x(lhs)) - (quat_get_y(rhs) * quat_get_y(lhs)) - (quat_get_z(rhs) * quat_get_z(lhs));
+		result = quat_set(x, y, z, w);
+	}
+
+	return result;
+}
+
+RTM_FORCE_NOINLINE quatf quat_mul_rtm(const quatf* inputs, uint32_t num_quats) RTM_NO_EXCEPT
+{
+	quatf result = inputs[0];
+	for (uint32_t quat_index = 1; quat_index < num_quats; ++quat_index)
+		result = quat_mul(result, inputs[quat_index]);
+
+	return result;
+}
+
+static void setup_fallback_vector_bench(vector4f* inputs)
+{
+	for (uint32_t vector_index = 0; vector_index < k_num_bench_fallback_values; ++vector_index)
+	{
+		const float value = float(vector_index % 64) - 32.0F;
+		inputs[vector_index] = vector_set(value, -value, value * 0.5F, value + 0.75F);
+	}
+}
+
+static void setup_fallback_quat_bench(quatf* inputs)
+{
+	for (uint32_t quat_index = 0; quat_index < k_num_bench_fallback_values; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.01F;
+		inputs[quat_index] = quat_normalize(quat_set(scalar_sin(angle), 0.25F, scalar_cos(angle), 0.5F));
+	}
+}
+
+template<void(*clamp_impl)(const vector4f*, uint32_t, vector4f_arg0, vector4f_arg1, vector4f*)>
+static void bm_vector_clamp(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_fallback_values];
+	vector4f outputs[k_num_bench_fallback_values];
+	setup_fallback_vector_bench(inputs);
+
+	const vector4f min_value = vector_set(-10.0F);
+	const vector4f max_value = vector_set(10.0F);
+
+	for (auto _ : state)
+	{
+		clamp_impl(inputs, k_num_bench_fallback_values, min_value, max_value, outputs);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+}
+
+template<void(*select_impl)(const vector4f*, uint32_t, vector4f_arg0, vector4f*)>
+static void bm_vector_select(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_fallback_values];
+	vector4f outputs[k_num_bench_fallback_values];
+	setup_fallback_vector_bench(inputs);
+	setup_fallback_vector_bench(outputs);
+
+	// Roughly half the lanes are selected, branches are unpredictable
+	const vector4f threshold = vector_set(0.0F);
+
+	for (auto _ : state)
+	{
+		select_impl(inputs, k_num_bench_fallback_values, threshold, outputs);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+}
+
+template<quatf(*mul_impl)(const quatf*, uint32_t)>
+static void bm_quat_mul(benchmark::State& state)
+{
+	quatf inputs[k_num_bench_fallback_values];
+	setup_fallback_quat_bench(inputs);
+
+	quatf result = quat_identity();
+	for (auto _ : state)
+		result = quat_mul(result, mul_impl(inputs, k_num_bench_fallback_values));
+
+	benchmark::DoNotOptimize(result);
+}
+
+BENCHMARK_TEMPLATE(bm_vector_clamp, vector_clamp_ref);
+BENCHMARK_TEMPLATE(bm_vector_clamp, vector_clamp_rtm);
+BENCHMARK_TEMPLATE(bm_vector_select, vector_select_ref);
+BENCHMARK_TEMPLATE(bm_vector_select, vector_select_rtm);
+BENCHMARK_TEMPLATE(bm_quat_mul, quat_mul_ref);
+BENCHMARK_TEMPLATE(bm_quat_mul, quat_mul_rtm);
@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+// Runtime dispatch is opt-in and must be enabled before including RTM
+// It cannot be used with deterministic math since the dispatched kernels use FMA
+#if !defined(RTM_DETERMINISTIC)
+	#define RTM_RUNTIME_DISPATCH
+#endif
+
+#include <rtm/skinningf.h>
+#include <rtm/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_skinning_bones = 64;
+static constexpr uint32_t k_num_bench_skinning_vertices = 1024;
+static constexpr uint32_t k_num_bench_skinning_influences = 4;
+
+// Same as skin_positions(..) without the runtime dispatch, it uses the compile time instruction set
+RTM_FORCE_NOINLINE void skin_positions_static(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights,
+	const float3f* input_positions, float3f* output_positions, uint32_t num_vertices) RTM_NO_EXCEPT
+{
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const matrix3x4f skin_mtx = matrix_blend<k_num_bench_skinning_influences>(palette, bone_indices, bone_weights);
+		const vector4f position = vector_load3(input_positions + vertex_index);
+		vector_store3(matrix_mul_point3(position, skin_mtx), output_positions + vertex_index);
+
+		bone_indices += k_num_bench_skinning_influences;
+		bone_weights += k_num_bench_skinning_influences;
+	}
+}
+
+RTM_FORCE_NOINLINE void skin_positions_dispatch(const matrix3x4f* palette, const uint16_t* bone_indices, const float* bone_weights,
+	const float3f* input_positions, float3f* output_positions, uint32_t num_vertices) RTM_NO_EXCEPT
+{
+	skin_positions<k_num_bench_skinning_influences>(palette, bone_indices, bone_weights, input_positions, output_positions, num_vertices);
+}
+
+struct skinning_bench_data
+{
+	matrix3x4f palette[k_num_bench_skinning_bones];
+	uint16_t bone_indices[k_num_bench_skinning_vertices * k_num_bench_skinning_influences];
+	float bone_weights[k_num_bench_skinning_vertices * k_num_bench_skinning_influences];
+	float3f positions[k_num_bench_skinning_vertices];
+	float3f skinned_positions[k_num_bench_skinning_vertices];
+};
+
+static void setup_skinning_bench(skinning_bench_data& data)
+{
+	for (uint32_t bone_index = 0; bone_index < k_num_bench_skinning_bones; ++bone_index)
+	{
+		const float angle = scalar_deg_to_rad(float(bone_index) * 5.0F);
+		data.palette[bone_index] = matrix_from_qvv(quat_from_euler(angle, -angle, angle * 0.5F), vector_set(float(bone_index), 1.0F, 0.0F), vector_set(1.0F));
+	}
+
+	uint32_t seed = 12345;
+	for (uint32_t index = 0; index < k_num_bench_skinning_vertices * k_num_bench_skinning_influences; ++index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		data.bone_indices[index] = uint16_t(seed % k_num_bench_skinning_bones);
+		data.bone_weights[index] = 1.0F / float(k_num_bench_skinning_influences);
+	}
+
+	for (uint32_t vertex_index = 0; vertex_index < k_num_bench_skinning_vertices; ++vertex_index)
+	{
+		const float value = float(vertex_index) * 0.01F;
+		vector_store3(vector_set(value, -value, 1.0F), &data.positions[vertex_index]);
+	}
+}
+
+static void bm_skin_positions_static(benchmark::State& state)
+{
+	static skinning_bench_data data;
+	setup_skinning_bench(data);
+
+	for (auto _ : state)
+	{
+		skin_positions_static(data.palette, data.bone_indices, data.bone_weights, data.positions, data.skinned_positions, k_num_bench_skinning_vertices);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.skinned_positions);
+}
+
+BENCHMARK(bm_skin_positions_static);
+
+static void bm_skin_positions_dispatch(benchmark::State& state)
+{
+	static skinning_bench_data data;
+	setup_skinning_bench(data);
+
+	for (auto _ : state)
+	{
+		skin_positions_dispatch(data.palette, data.bone_indices, data.bone_weights, data.positions, data.skinned_positions, k_num_bench_skinning_vertices);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.skinned_positions);
+}
+
+BENCHMARK(bm_skin_positions_dispatch);
@@ -0,0 +1,202 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvd.h>
+#include <rtm/soad.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_transforms = 1024;
+
+// Pad each component array by a cache line to avoid 4K aliasing between them
+static constexpr uint32_t k_bench_component_stride = k_num_bench_transforms + 8;
+
+struct soad_bench_data
+{
+	qvvd lhs_aos[k_num_bench_transforms];
+	qvvd rhs_aos[k_num_bench_transforms];
+	qvvd out_aos[k_num_bench_transforms];
+
+	// 10 components per transform: rotation xyzw, translation xyz, scale xyz
+	double lhs_components[10][k_bench_component_stride];
+	double rhs_components[10][k_bench_component_stride];
+	double out_components[10][k_bench_component_stride];
+};
+
+static qvvd_soa make_qvvd_soa(double (&components)[10][k_bench_component_stride])
+{
+	return qvvd_soa{
+		quatd_soa{ components[0], components[1], components[2], components[3] },
+		vector3d_soa{ components[4], components[5], components[6] },
+		vector3d_soa{ components[7], components[8], components[9] } };
+}
+
+static void setup_soad_bench(soad_bench_data& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+	{
+		qvvd* transforms[2] = { &data.lhs_aos[transform_index], &data.rhs_aos[transform_index] };
+		double (*components[2])[k_bench_component_stride] = { data.lhs_components, data.rhs_components };
+
+		for (uint32_t side_index = 0; side_index < 2; ++side_index)
+		{
+			double values[10];
+			for (double& value : values)
+			{
+				seed = seed * 1664525 + 1013904223;
+				value = double(seed % 2000) / 1000.0 - 1.0;
+			}
+
+			const quatd rotation = quat_normalize(quat_set(values[0], values[1], values[2], values[3]));
+			const vector4d translation = vector_set(values[4], values[5], values[6]);
+			const vector4d scale = vector_set(scalar_abs(values[7]) + 0.5, scalar_abs(values[8]) + 0.5, scalar_abs(values[9]) + 0.5);
+			*transforms[side_index] = qvv_set(rotation, translation, scale);
+
+			components[side_index][0][transform_index] = quat_get_x(rotation);
+			components[side_index][1][transform_index] = quat_get_y(rotation);
+			components[side_index][2][transform_index] = quat_get_z(rotation);
+			components[side_index][3][transform_index] = quat_get_w(rotation);
+			components[side_index][4][transform_index] = vector_get_x(translation);
+			components[side_index][5][transform_index] = vector_get_y(translation);
+			components[side_index][6][transform_index] = vector_get_z(translation);
+			components[side_index][7][transform_index] = vector_get_x(scale);
+			components[side_index][8][transform_index] = vector_get_y(scale);
+			components[side_index][9][transform_index] = vector_get_z(scale);
+		}
+	}
+}
+
+static void bm_soad_qvv_mul_aos(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+			data.out_aos[transform_index] = qvv_mul(data.lhs_aos[transform_index], data.rhs_aos[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_aos);
+}
+
+static void bm_soad_qvv_mul_soa(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	const qvvd_soa lhs = make_qvvd_soa(data.lhs_components);
+	const qvvd_soa rhs = make_qvvd_soa(data.rhs_components);
+	const qvvd_soa out = make_qvvd_soa(data.out_components);
+
+	for (auto _ : state)
+	{
+		qvv_mul(lhs, rhs, k_num_bench_transforms, out);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_components);
+}
+
+static void bm_soad_quat_mul_vector3_aos(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+			data.out_aos[transform_index].translation = quat_mul_vector3(data.lhs_aos[transform_index].translation, data.rhs_aos[transform_index].rotation);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_aos);
+}
+
+static void bm_soad_quat_mul_vector3_soa(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	const qvvd_soa lhs = make_qvvd_soa(data.lhs_components);
+	const qvvd_soa rhs = make_qvvd_soa(data.rhs_components);
+	const qvvd_soa out = make_qvvd_soa(data.out_components);
+
+	for (auto _ : state)
+	{
+		quat_mul_vector3(lhs.translation, rhs.rotation, k_num_bench_transforms, out.translation);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_components);
+}
+
+static void bm_soad_dot3_aos(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_transforms; ++transform_index)
+			data.out_components[0][transform_index] = vector_dot3(data.lhs_aos[transform_index].translation, data.rhs_aos[transform_index].translation);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_components);
+}
+
+static void bm_soad_dot3_soa(benchmark::State& state)
+{
+	soad_bench_data data;
+	setup_soad_bench(data);
+
+	const qvvd_soa lhs = make_qvvd_soa(data.lhs_components);
+	const qvvd_soa rhs = make_qvvd_soa(data.rhs_components);
+
+	for (auto _ : state)
+	{
+		vector_dot3(lhs.translation, rhs.translation, k_num_bench_transforms, data.out_components[0]);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.out_components);
+}
+
+BENCHMARK(bm_soad_qvv_mul_aos);
+BENCHMARK(bm_soad_qvv_mul_soa);
+BENCHMARK(bm_soad_quat_mul_vector3_aos);
+BENCHMARK(bm_soad_quat_mul_vector3_soa);
+BENCHMARK(bm_soad_dot3_aos);
+BENCHMARK(bm_soad_dot3_soa);
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/scalarf.h>
+#include <rtm/spatial_hashf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_points = 4096;
+
+struct spatial_hash_bench_data
+{
+	vector4f points[k_num_bench_points];
+	uint64_t codes64[k_num_bench_points];
+	uint32_t codes[k_num_bench_points];
+};
+
+static void setup_spatial_hash_bench(spatial_hash_bench_data& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t point_index = 0; point_index < k_num_bench_points; ++point_index)
+	{
+		float components[3];
+		for (float& component : components)
+		{
+			seed = seed * 1664525 + 1013904223;
+			component = float(seed % 20000) / 100.0F - 100.0F;
+		}
+
+		data.points[point_index] = vector_set(components[0], components[1], components[2], 1.0F);
+	}
+}
+
+static const vector4f k_bench_origin = vector_set(-100.0F);
+
+// Reference: quantize, interleave, and hash one point at a time
+static void bm_morton_encode3_scalar(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const float scale = 1024.0F / 200.0F;
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_bench_points; ++point_index)
+		{
+			float components[3];
+			vector_store3(data.points[point_index], &components[0]);
+
+			const uint32_t x = uint32_t(scalar_clamp((components[0] + 100.0F) * scale, 0.0F, 1023.0F));
+			const uint32_t y = uint32_t(scalar_clamp((components[1] + 100.0F) * scale, 0.0F, 1023.0F));
+			const uint32_t z = uint32_t(scalar_clamp((components[2] + 100.0F) * scale, 0.0F, 1023.0F));
+			data.codes[point_index] = morton_encode3(x, y, z);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes);
+}
+
+static void bm_morton_encode3(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const vector4f scale = vector_set(1024.0F / 200.0F);
+	for (auto _ : state)
+	{
+		morton_encode3(data.points, k_num_bench_points, k_bench_origin, scale, data.codes);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes);
+}
+
+static void bm_morton_encode3_64_scalar(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const float scale = 2097152.0F / 200.0F;
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_bench_points; ++point_index)
+		{
+			float components[3];
+			vector_store3(data.points[point_index], &components[0]);
+
+			const uint32_t x = uint32_t(scalar_clamp((components[0] + 100.0F) * scale, 0.0F, 2097151.0F));
+			const uint32_t y = uint32_t(scalar_clamp((components[1] + 100.0F) * scale, 0.0F, 2097151.0F));
+			const uint32_t z = uint32_t(scalar_clamp((components[2] + 100.0F) * scale, 0.0F, 2097151.0F));
+			data.codes64[point_index] = morton_encode3_64(x, y, z);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes64);
+}
+
+static void bm_morton_encode3_64(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const vector4f scale = vector_set(2097152.0F / 200.0F);
+	for (auto _ : state)
+	{
+		morton_encode3_64(data.points, k_num_bench_points, k_bench_origin, scale, data.codes64);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes64);
+}
+
+static void bm_grid_hash3_scalar(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const float inv_cell_size = 1.0F / 2.5F;
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_bench_points; ++point_index)
+		{
+			float components[3];
+			vector_store3(data.points[point_index], &components[0]);
+
+			const int32_t x = int32_t(scalar_floor(components[0] * inv_cell_size));
+			const int32_t y = int32_t(scalar_floor(components[1] * inv_cell_size));
+			const int32_t z = int32_t(scalar_floor(components[2] * inv_cell_size));
+			data.codes[point_index] = grid_hash3(x, y, z);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes);
+}
+
+static void bm_grid_hash3(benchmark::State& state)
+{
+	spatial_hash_bench_data data;
+	setup_spatial_hash_bench(data);
+
+	const vector4f inv_cell_size = vector_set(1.0F / 2.5F);
+	for (auto _ : state)
+	{
+		grid_hash3(data.points, k_num_bench_points, inv_cell_size, data.codes);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.codes);
+}
+
+BENCHMARK(bm_morton_encode3_scalar);
+BENCHMARK(bm_morton_encode3);
+BENCHMARK(bm_morton_encode3_64_scalar);
+BENCHMARK(bm_morton_encode3_64);
+BENCHMARK(bm_grid_hash3_scalar);
+BENCHMARK(bm_grid_hash3);
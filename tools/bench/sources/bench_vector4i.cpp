@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+#include <rtm/vector4i.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_values = 4096;
+
+struct vector4i_bench_data
+{
+	uint16_t quantized[k_num_bench_values];
+	float values[k_num_bench_values];
+};
+
+static void setup_vector4i_bench(vector4i_bench_data& data)
+{
+	uint32_t seed = 12345;
+	for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+	{
+		seed = seed * 1664525 + 1013904223;
+		data.quantized[value_index] = uint16_t(seed >> 16);
+		data.values[value_index] = float(seed % 1000) / 1000.0F;
+	}
+}
+
+static void bm_vector4i_dequantize_u16_scalar(benchmark::State& state)
+{
+	vector4i_bench_data data;
+	setup_vector4i_bench(data);
+
+	const float scale = 1.0F / 65535.0F;
+	for (auto _ : state)
+	{
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+			data.values[value_index] = float(data.quantized[value_index]) * scale;
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.values);
+}
+
+static void bm_vector4i_dequantize_u16(benchmark::State& state)
+{
+	vector4i_bench_data data;
+	setup_vector4i_bench(data);
+
+	const vector4f scale = vector_set(1.0F / 65535.0F);
+	for (auto _ : state)
+	{
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; value_index += 4)
+			vector_store(vector_mul(vector_cast(vector_unpack_u16(data.quantized + value_index)), scale), data.values + value_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.values);
+}
+
+static void bm_vector4i_quantize_u16_scalar(benchmark::State& state)
+{
+	vector4i_bench_data data;
+	setup_vector4i_bench(data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+		{
+			const float value = scalar_clamp(data.values[value_index], 0.0F, 1.0F);
+			data.quantized[value_index] = uint16_t(scalar_round_bankers(value * 65535.0F));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.quantized);
+}
+
+static void bm_vector4i_quantize_u16(benchmark::State& state)
+{
+	vector4i_bench_data data;
+	setup_vector4i_bench(data);
+
+	const vector4f scale = vector_set(65535.0F);
+	for (auto _ : state)
+	{
+		// Packing saturates to [0, 65535], no clamping required
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; value_index += 8)
+		{
+			const vector4i values0 = vector_to_int_round_bankers(vector_mul(vector_load(data.values + value_index + 0), scale));
+			const vector4i values1 = vector_to_int_round_bankers(vector_mul(vector_load(data.values + value_index + 4), scale));
+			vector_pack_u16(values0, values1, data.quantized + value_index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data.quantized);
+}
+
+BENCHMARK(bm_vector4i_dequantize_u16_scalar);
+BENCHMARK(bm_vector4i_dequantize_u16);
+BENCHMARK(bm_vector4i_quantize_u16_scalar);
+BENCHMARK(bm_vector4i_quantize_u16);
@@ -0,0 +1,158 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_scalar(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	const float x = vector_get_x(lhs) * vector_get_x(rhs);
+	const float y = vector_get_y(lhs) * vector_get_y(rhs);
+	const float z = vector_get_z(lhs) * vector_get_z(rhs);
+	const float w = vector_get_w(lhs) * vector_get_w(rhs);
+	return vector_set((x + y) + (z + w));
+}
+
+#if defined(RTM_SSE2_INTRINSICS)
+// Previous implementation: reduce into the first lane then broadcast it
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_sse2_shuffles(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	__m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
+	__m128 z2_w2_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 3, 2));
+	__m128 x2z2_y2w2_0_0 = _mm_add_ps(x2_y2_z2_w2, z2_w2_0_0);
+	__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
+	__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
+	return _mm_shuffle_ps(x2y2z2w2_0_0_0, x2y2z2w2_0_0_0, _MM_SHUFFLE(0, 0, 0, 0));
+}
+
+// Swapping pairs then halves leaves the sum in every lane without a final broadcast
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_sse2_swaps(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	const __m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
+	const __m128 xy_xy_zw_zw = _mm_add_ps(x2_y2_z2_w2, _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_add_ps(xy_xy_zw_zw, _mm_shuffle_ps(xy_xy_zw_zw, xy_xy_zw_zw, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+#endif
+
+#if defined(RTM_SSE3_INTRINSICS)
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_sse3_hadd(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	const __m128 x2_y2_z2_w2 = _mm_mul_ps(lhs, rhs);
+	const __m128 xy_zw_xy_zw = _mm_hadd_ps(x2_y2_z2_w2, x2_y2_z2_w2);
+	return _mm_hadd_ps(xy_zw_xy_zw, xy_zw_xy_zw);
+}
+#endif
+
+#if defined(RTM_SSE4_INTRINSICS)
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_sse4_dp(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	return _mm_dp_ps(lhs, rhs, 0xFF);
+}
+#endif
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_dot_rtm(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	return vector_dot(lhs, rhs);
+}
+
+RTM_FORCE_NOINLINE float RTM_SIMD_CALL vector_dot_rtm_scalar(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+{
+	return vector_dot(lhs, rhs);
+}
+
+template<vector4f (RTM_SIMD_CALL *dot_func)(vector4f_arg0, vector4f_arg1)>
+static void bm_vector_dot(benchmark::State& state)
+{
+	// With a quarter in every lane, the dot product of a broadcast value returns that value
+	const vector4f quarter = vector_set(0.25F);
+	vector4f v0 = vector_set(1.0F);
+	vector4f v1 = vector_set(2.0F);
+	vector4f v2 = vector_set(3.0F);
+	vector4f v3 = vector_set(4.0F);
+	vector4f v4 = vector_set(5.0F);
+	vector4f v5 = vector_set(6.0F);
+	vector4f v6 = vector_set(7.0F);
+	vector4f v7 = vector_set(8.0F);
+
+	for (auto _ : state)
+	{
+		v0 = dot_func(v0, quarter);
+		v1 = dot_func(v1, quarter);
+		v2 = dot_func(v2, quarter);
+		v3 = dot_func(v3, quarter);
+		v4 = dot_func(v4, quarter);
+		v5 = dot_func(v5, quarter);
+		v6 = dot_func(v6, quarter);
+		v7 = dot_func(v7, quarter);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_scalar);
+#if defined(RTM_SSE2_INTRINSICS)
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_sse2_shuffles);
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_sse2_swaps);
+#endif
+#if defined(RTM_SSE3_INTRINSICS)
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_sse3_hadd);
+#endif
+#if defined(RTM_SSE4_INTRINSICS)
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_sse4_dp);
+#endif
+BENCHMARK_TEMPLATE(bm_vector_dot, vector_dot_rtm);
+
+static void bm_vector_dot_rtm_scalar(benchmark::State& state)
+{
+	const vector4f quarter = vector_set(0.25F);
+	float f0 = 1.0F;
+	float f1 = 2.0F;
+	float f2 = 3.0F;
+	float f3 = 4.0F;
+
+	for (auto _ : state)
+	{
+		f0 = vector_dot_rtm_scalar(vector_set(f0), quarter);
+		f1 = vector_dot_rtm_scalar(vector_set(f1), quarter);
+		f2 = vector_dot_rtm_scalar(vector_set(f2), quarter);
+		f3 = vector_dot_rtm_scalar(vector_set(f3), quarter);
+	}
+
+	benchmark::DoNotOptimize(f0);
+	benchmark::DoNotOptimize(f1);
+	benchmark::DoNotOptimize(f2);
+	benchmark::DoNotOptimize(f3);
+}
+
+BENCHMARK(bm_vector_dot_rtm_scalar);
@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bench_mix_vectors = 1024;
+
+template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+RTM_FORCE_NOINLINE vector4f vector_mix_ref(const vector4f* inputs, uint32_t num_vectors) RTM_NO_EXCEPT
+{
+	// Gather each component one at a time, every mix depends on the previous one
+	vector4f result = inputs[0];
+	for (uint32_t vector_index = 1; vector_index < num_vectors; ++vector_index)
+	{
+		const vector4f input0 = result;
+		const vector4f input1 = inputs[vector_index];
+		const float x = rtm_impl::is_mix_xyzw(comp0) ? vector_get_component<comp0>(input0) : vector_get_component<comp0>(input1);
+		const float y = rtm_impl::is_mix_xyzw(comp1) ? vector_get_component<comp1>(input0) : vector_get_component<comp1>(input1);
+		const float z = rtm_impl::is_mix_xyzw(comp2) ? vector_get_component<comp2>(input0) : vector_get_component<comp2>(input1);
+		const float w = rtm_impl::is_mix_xyzw(comp3) ? vector_get_component<comp3>(input0) : vector_get_component<comp3>(input1);
+		result = vector_set(x, y, z, w);
+	}
+
+	return result;
+}
+
+template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+RTM_FORCE_NOINLINE vector4f vector_mix_simd(const vector4f* inputs, uint32_t num_vectors) RTM_NO_EXCEPT
+{
+	vector4f result = inputs[0];
+	for (uint32_t vector_index = 1; vector_index < num_vectors; ++vector_index)
+		result = vector_mix<comp0, comp1, comp2, comp3>(result, inputs[vector_index]);
+
+	return result;
+}
+
+static void setup_vector_mix_bench(vector4f* inputs)
+{
+	for (uint32_t vector_index = 0; vector_index < k_num_bench_mix_vectors; ++vector_index)
+	{
+		const float value = float(vector_index);
+		inputs[vector_index] = vector_set(value, value + 0.25F, value + 0.5F, value + 0.75F);
+	}
+}
+
+template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+static void bm_vector_mix_ref(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_mix_vectors];
+	setup_vector_mix_bench(inputs);
+
+	vector4f result = vector_zero();
+	for (auto _ : state)
+		result = vector_add(result, vector_mix_ref<comp0, comp1, comp2, comp3>(inputs, k_num_bench_mix_vectors));
+
+	benchmark::DoNotOptimize(result);
+}
+
+template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+static void bm_vector_mix_simd(benchmark::State& state)
+{
+	vector4f inputs[k_num_bench_mix_vectors];
+	setup_vector_mix_bench(inputs);
+
+	vector4f result = vector_zero();
+	for (auto _ : state)
+		result = vector_add(result, vector_mix_simd<comp0, comp1, comp2, comp3>(inputs, k_num_bench_mix_vectors));
+
+	benchmark::DoNotOptimize(result);
+}
+
+// Every component stays in its lane: a single blend with SSE 4.1
+BENCHMARK_TEMPLATE(bm_vector_mix_ref, mix4::x, mix4::b, mix4::z, mix4::d);
+BENCHMARK_TEMPLATE(bm_vector_mix_simd, mix4::x, mix4::b, mix4::z, mix4::d);
+
+// A single component is replaced: a single insert
+BENCHMARK_TEMPLATE(bm_vector_mix_ref, mix4::x, mix4::y, mix4::a, mix4::w);
+BENCHMARK_TEMPLATE(bm_vector_mix_simd, mix4::x, mix4::y, mix4::a, mix4::w);
+
+// Pairs from alternating inputs, as used by the matrix inverse
+BENCHMARK_TEMPLATE(bm_vector_mix_ref, mix4::x, mix4::a, mix4::z, mix4::c);
+BENCHMARK_TEMPLATE(bm_vector_mix_simd, mix4::x, mix4::a, mix4::z, mix4::c);
+
+// Fully general pattern: every lane moves and both inputs are interleaved
+BENCHMARK_TEMPLATE(bm_vector_mix_ref, mix4::w, mix4::a, mix4::y, mix4::c);
+BENCHMARK_TEMPLATE(bm_vector_mix_simd, mix4::w, mix4::a, mix4::y, mix4::c);